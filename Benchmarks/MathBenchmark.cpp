@@ -0,0 +1,1030 @@
+//-------------------------------------------------------------------------------------------------
+// MathBenchmark.cpp - Headless MathPrecalculation Microbenchmark and Accuracy Harness
+//
+// Purpose: Times every FAST_* entry point and the Fast* helpers of MathPrecalculation against the
+//          direct computation they stand in for (the standard library, the plain polynomial or
+//          formula, or a compiler bit intrinsic), and measures how far the fast result drifts from
+//          the direct one. Functions whose fast path is slower than the direct path are flagged so
+//          their callers can be routed to the direct computation.
+//
+// Method:  Each function runs over the same seeded input set (--samples inputs per pass). The
+//          reported ns/op is the fastest of --repeat passes, which filters scheduler noise. Errors
+//          are absolute, per output component, fast minus direct. The direct reference for
+//          helpers that do not use a table (bit helpers, physics formulas) is the same formula
+//          inlined at the call site, so the comparison shows what the member call and its lookup
+//          statistics cost.
+//
+// Usage:
+//   MathBenchmark [--function NAME]... [--group NAME]... [--samples N] [--repeat N] [--seed N]
+//                 [--margin PERCENT] [--json FILE]
+//
+// A function is flagged when its fast ns/op exceeds the direct ns/op by more than --margin percent
+// (default 5). Results are printed as a table and optionally written as JSON.
+//-------------------------------------------------------------------------------------------------
+
+#include "Includes.h"
+#include "Debug.h"
+#include "ExceptionHandler.h"
+#include "MathPrecalculation.h"
+#include "BuildInfo.h"
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// Engine globals normally defined in main.cpp
+Debug debug;
+ExceptionHandler exceptionHandler;
+
+namespace {
+
+//==============================================================================
+// Benchmark Configuration
+//==============================================================================
+const size_t DEFAULT_BENCHMARK_SAMPLES = 4096;                                  // Inputs per timed pass
+const int DEFAULT_BENCHMARK_REPEAT = 200;                                       // Timed passes (fastest is reported)
+const unsigned int DEFAULT_BENCHMARK_SEED = 1234;                               // Seed for every input set
+const double DEFAULT_SLOWER_MARGIN = 5.0;                                       // Percent slower before a function is flagged
+const int MAX_SAMPLE_FLOATS = 8;                                                // Float inputs per sample
+const int MAX_SAMPLE_WORDS = 3;                                                 // Integer inputs per sample
+const int MAX_CASE_OUTPUTS = 4;                                                 // Result components per operation
+
+struct BenchmarkOptions {
+    size_t samples = DEFAULT_BENCHMARK_SAMPLES;
+    int repeat = DEFAULT_BENCHMARK_REPEAT;
+    unsigned int seed = DEFAULT_BENCHMARK_SEED;
+    double slowerMargin = DEFAULT_SLOWER_MARGIN;
+    std::string jsonPath;                                                       // Empty = no JSON output
+    std::vector<std::string> functions;                                         // Empty = every function
+    std::vector<std::string> groups;                                            // Empty = every group
+};
+
+// One operation's inputs; each case fills the fields it needs
+struct BenchmarkSample {
+    float f[MAX_SAMPLE_FLOATS];
+    uint32_t u[MAX_SAMPLE_WORDS];
+};
+
+struct CaseResult {
+    std::string name;
+    std::string group;
+    std::string reference;                                                      // What the direct path computes with
+    bool usesTable = false;                                                     // Fast path reads a precalculated table
+    double fastNs = 0.0;
+    double directNs = 0.0;
+    double maxError = 0.0;
+    double meanError = 0.0;
+    bool slowerThanDirect = false;
+};
+
+struct BenchmarkContext {
+    BenchmarkOptions options;
+    std::mt19937 rng;
+    std::vector<BenchmarkSample> samples;
+    std::vector<CaseResult> results;
+
+    bool Selected(const char* name, const char* group) const
+    {
+        const std::vector<std::string>& functions = options.functions;
+        const std::vector<std::string>& groups = options.groups;
+        const bool nameMatch = functions.empty() || std::find(functions.begin(), functions.end(), name) != functions.end();
+        const bool groupMatch = groups.empty() || std::find(groups.begin(), groups.end(), group) != groups.end();
+        return nameMatch && groupMatch;
+    }
+};
+
+const char* const BENCHMARK_GROUPS[] = { "trig", "inverse", "batch", "interpolation", "color", "geometry", "bits", "physics" };
+
+//==============================================================================
+// Timing and Accuracy
+//==============================================================================
+double ElapsedNs(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+}
+
+float Uniform(std::mt19937& rng, float low, float high)
+{
+    return std::uniform_real_distribution<float>(low, high)(rng);
+}
+
+// Fastest pass over every sample, in ns per operation
+template<typename Function>
+double TimeFunction(Function function, const std::vector<BenchmarkSample>& samples, double* results, int repeat)
+{
+    double best = std::numeric_limits<double>::max();
+    for (int pass = 0; pass < repeat; ++pass)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < samples.size(); ++i)
+        {
+            function(samples[i], results + i * MAX_CASE_OUTPUTS);
+        }
+        best = std::min(best, ElapsedNs(start));
+    }
+    return best / static_cast<double>(samples.size());
+}
+
+void MeasureError(const std::vector<double>& fast, const std::vector<double>& direct, int outputs, CaseResult& result)
+{
+    double maxError = 0.0;
+    double sumError = 0.0;
+    size_t count = 0;
+    for (size_t i = 0; i < fast.size(); i += MAX_CASE_OUTPUTS)
+    {
+        for (int component = 0; component < outputs; ++component)
+        {
+            const double error = std::fabs(fast[i + component] - direct[i + component]);
+            maxError = std::max(maxError, error);
+            sumError += error;
+            ++count;
+        }
+    }
+
+    result.maxError = maxError;
+    result.meanError = (count > 0) ? sumError / static_cast<double>(count) : 0.0;
+}
+
+void FinishCase(BenchmarkContext& context, CaseResult& result)
+{
+    result.slowerThanDirect = result.fastNs > result.directNs * (1.0 + context.options.slowerMargin / 100.0);
+    context.results.push_back(result);
+}
+
+// Generate the inputs, time both paths over them and compare the results
+template<typename Generator, typename FastFunction, typename DirectFunction>
+void RunCase(BenchmarkContext& context, const char* name, const char* group, const char* reference, bool usesTable, int outputs,
+    Generator generate, FastFunction fast, DirectFunction direct)
+{
+    if (!context.Selected(name, group))
+    {
+        return;
+    }
+
+    // Every case starts from the same seed so runs are comparable across commits
+    context.rng.seed(context.options.seed);
+    context.samples.assign(context.options.samples, BenchmarkSample{});
+    for (BenchmarkSample& sample : context.samples)
+    {
+        generate(context.rng, sample);
+    }
+
+    std::vector<double> fastResults(context.samples.size() * MAX_CASE_OUTPUTS, 0.0);
+    std::vector<double> directResults(context.samples.size() * MAX_CASE_OUTPUTS, 0.0);
+
+    CaseResult result;
+    result.name = name;
+    result.group = group;
+    result.reference = reference;
+    result.usesTable = usesTable;
+    result.fastNs = TimeFunction(fast, context.samples, fastResults.data(), context.options.repeat);
+    result.directNs = TimeFunction(direct, context.samples, directResults.data(), context.options.repeat);
+    MeasureError(fastResults, directResults, outputs, result);
+    FinishCase(context, result);
+}
+
+//==============================================================================
+// Direct References
+//==============================================================================
+inline uint32_t DirectCountLeadingZeros(uint32_t value)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    return _BitScanReverse(&index, value) ? 31 - index : 32;
+#else
+    return value ? static_cast<uint32_t>(__builtin_clz(value)) : 32;
+#endif
+}
+
+inline uint32_t DirectCountTrailingZeros(uint32_t value)
+{
+#if defined(_MSC_VER)
+    unsigned long index;
+    return _BitScanForward(&index, value) ? index : 32;
+#else
+    return value ? static_cast<uint32_t>(__builtin_ctz(value)) : 32;
+#endif
+}
+
+// SWAR population count - __popcnt needs a POPCNT-capable CPU on MSVC
+inline uint32_t DirectCountSetBits(uint32_t value)
+{
+    value = value - ((value >> 1) & 0x55555555u);
+    value = (value & 0x33333333u) + ((value >> 2) & 0x33333333u);
+    return (((value + (value >> 4)) & 0x0F0F0F0Fu) * 0x01010101u) >> 24;
+}
+
+inline uint32_t DirectRotateLeft(uint32_t value, uint32_t positions)
+{
+    positions &= 31;
+    return (value << positions) | (value >> ((32 - positions) & 31));
+}
+
+inline uint32_t DirectRotateRight(uint32_t value, uint32_t positions)
+{
+    positions &= 31;
+    return (value >> positions) | (value << ((32 - positions) & 31));
+}
+
+inline uint32_t DirectReverseBits(uint32_t value)
+{
+    value = ((value & 0xAAAAAAAAu) >> 1) | ((value & 0x55555555u) << 1);
+    value = ((value & 0xCCCCCCCCu) >> 2) | ((value & 0x33333333u) << 2);
+    value = ((value & 0xF0F0F0F0u) >> 4) | ((value & 0x0F0F0F0Fu) << 4);
+    value = ((value & 0xFF00FF00u) >> 8) | ((value & 0x00FF00FFu) << 8);
+    return (value >> 16) | (value << 16);
+}
+
+inline uint32_t DirectModPow(uint32_t base, uint32_t exponent, uint32_t modulus)
+{
+    if (modulus == 1) return 0;
+    uint64_t result = 1;
+    uint64_t factor = base % modulus;
+    while (exponent > 0)
+    {
+        if (exponent & 1)
+        {
+            result = (result * factor) % modulus;
+        }
+        exponent >>= 1;
+        factor = (factor * factor) % modulus;
+    }
+    return static_cast<uint32_t>(result);
+}
+
+inline uint32_t DirectFNV1aHash(const void* data, size_t size)
+{
+    uint32_t hash = 0x811C9DC5u;
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; ++i)
+    {
+        hash = (hash ^ bytes[i]) * 0x01000193u;
+    }
+    return hash;
+}
+
+inline uint64_t DirectFNV1aHash64(const void* data, size_t size)
+{
+    uint64_t hash = 0xCBF29CE484222325ULL;
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; ++i)
+    {
+        hash = (hash ^ bytes[i]) * 0x100000001B3ULL;
+    }
+    return hash;
+}
+
+inline int DirectYuvChannel(float value)
+{
+    return std::clamp(static_cast<int>(value), 0, 255);
+}
+
+// BT.601, as FastYuvToRgb computes it when its table is unavailable
+inline void DirectYuvToRgb(int y, int u, int v, double* out)
+{
+    out[0] = DirectYuvChannel(y + 1.402f * (v - 128));
+    out[1] = DirectYuvChannel(y - 0.344f * (u - 128) - 0.714f * (v - 128));
+    out[2] = DirectYuvChannel(y + 1.772f * (u - 128));
+}
+
+inline void DirectReflection(const float* incoming, const float* normal, float restitution, double* out)
+{
+    const float dot = incoming[0] * normal[0] + incoming[1] * normal[1] + incoming[2] * normal[2];
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        out[axis] = (incoming[axis] - 2.0f * dot * normal[axis]) * restitution;
+    }
+}
+
+inline void DirectCollisionResponse(const float* velocity, const float* normal, float restitution, float friction, double* out)
+{
+    const float normalVelocity = velocity[0] * normal[0] + velocity[1] * normal[1] + velocity[2] * normal[2];
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        const float normalComponent = normal[axis] * normalVelocity;
+        out[axis] = -normalComponent * restitution + (velocity[axis] - normalComponent) * (1.0f - friction);
+    }
+}
+
+// FastProjectileTrajectory's ballistic solution with std:: math in place of the tables
+inline void DirectProjectileTrajectory(const float* start, const float* target, float speed, float gravity, double* out)
+{
+    const float dx = target[0] - start[0];
+    const float dy = target[1] - start[1];
+    const float dz = target[2] - start[2];
+    const float horizontalDistance = std::sqrt(dx * dx + dz * dz);
+    const float discriminant = (speed * speed * speed * speed) - gravity * (gravity * horizontalDistance * horizontalDistance + 2.0f * dy * speed * speed);
+    const float angle = (discriminant < 0.0f) ? XM_PI * 0.25f :
+        std::atan((speed * speed + std::sqrt(discriminant)) / (gravity * horizontalDistance));
+
+    float directionX = 1.0f;
+    float directionZ = 0.0f;
+    if (horizontalDistance > 0.001f)
+    {
+        directionX = dx / horizontalDistance;
+        directionZ = dz / horizontalDistance;
+    }
+
+    const float horizontalSpeed = speed * std::cos(angle);
+    out[0] = directionX * horizontalSpeed;
+    out[1] = speed * std::sin(angle);
+    out[2] = directionZ * horizontalSpeed;
+}
+
+//==============================================================================
+// Cases
+//==============================================================================
+void StoreFloat3(const XMFLOAT3& value, double* out)
+{
+    out[0] = value.x;
+    out[1] = value.y;
+    out[2] = value.z;
+}
+
+XMFLOAT3 LoadFloat3(const float* values)
+{
+    return XMFLOAT3(values[0], values[1], values[2]);
+}
+
+// Fill f[0..count) uniformly in [low, high)
+auto UniformFloats(float low, float high, int count = 1)
+{
+    return [low, high, count](std::mt19937& rng, BenchmarkSample& sample)
+    {
+        for (int i = 0; i < count; ++i)
+        {
+            sample.f[i] = Uniform(rng, low, high);
+        }
+    };
+}
+
+// Random unit vector written to out[0..3)
+void RandomUnitVector(std::mt19937& rng, float* out)
+{
+    float length = 0.0f;
+    do
+    {
+        out[0] = Uniform(rng, -1.0f, 1.0f);
+        out[1] = Uniform(rng, -1.0f, 1.0f);
+        out[2] = Uniform(rng, -1.0f, 1.0f);
+        length = std::sqrt(out[0] * out[0] + out[1] * out[1] + out[2] * out[2]);
+    } while (length < 0.1f || length > 1.0f);
+
+    out[0] /= length;
+    out[1] /= length;
+    out[2] /= length;
+}
+
+void RunTrigCases(BenchmarkContext& context)
+{
+    const MathPrecalculation& math = FAST_MATH;
+    const float turn = 2.0f * XM_PI;
+
+    RunCase(context, "FAST_SIN", "trig", "std::sin", true, 1, UniformFloats(-2.0f * turn, 2.0f * turn),
+        [&](const BenchmarkSample& s, double* out) { out[0] = math.FastSin(s.f[0]); },
+        [](const BenchmarkSample& s, double* out) { out[0] = std::sin(s.f[0]); });
+    RunCase(context, "FAST_COS", "trig", "std::cos", true, 1, UniformFloats(-2.0f * turn, 2.0f * turn),
+        [&](const BenchmarkSample& s, double* out) { out[0] = math.FastCos(s.f[0]); },
+        [](const BenchmarkSample& s, double* out) { out[0] = std::cos(s.f[0]); });
+    // Away from the poles, where any absolute error is meaningless
+    RunCase(context, "FAST_TAN", "trig", "std::tan", true, 1, UniformFloats(-1.4f, 1.4f),
+        [&](const BenchmarkSample& s, double* out) { out[0] = math.FastTan(s.f[0]); },
+        [](const BenchmarkSample& s, double* out) { out[0] = std::tan(s.f[0]); });
+    RunCase(context, "FastCot", "trig", "1 / std::tan", true, 1, UniformFloats(0.2f, 2.9f),
+        [&](const BenchmarkSample& s, double* out) { out[0] = math.FastCot(s.f[0]); },
+        [](const BenchmarkSample& s, double* out) { out[0] = 1.0f / std::tan(s.f[0]); });
+    RunCase(context, "FastSinCos", "trig", "std::sin + std::cos", true, 2, UniformFloats(-2.0f * turn, 2.0f * turn),
+        [&](const BenchmarkSample& s, double* out)
+        {
+            float sine, cosine;
+            math.FastSinCos(s.f[0], sine, cosine);
+            out[0] = sine;
+            out[1] = cosine;
+        },
+        [](const BenchmarkSample& s, double* out)
+        {
+            out[0] = std::sin(s.f[0]);
+            out[1] = std::cos(s.f[0]);
+        });
+    RunCase(context, "FAST_SQRT", "trig", "std::sqrt", true, 1, UniformFloats(0.0f, 1000.0f),
+        [&](const BenchmarkSample& s, double* out) { out[0] = math.FastSqrt(s.f[0]); },
+        [](const BenchmarkSample& s, double* out) { out[0] = std::sqrt(s.f[0]); });
+}
+
+void RunInverseTrigCases(BenchmarkContext& context)
+{
+    const MathPrecalculation& math = FAST_MATH;
+
+    RunCase(context, "FAST_ASIN", "inverse", "std::asin", true, 1, UniformFloats(-1.0f, 1.0f),
+        [&](const BenchmarkSample& s, double* out) { out[0] = math.FastASin(s.f[0]); },
+        [](const BenchmarkSample& s, double* out) { out[0] = std::asin(s.f[0]); });
+    RunCase(context, "FAST_ACOS", "inverse", "std::acos", true, 1, UniformFloats(-1.0f, 1.0f),
+        [&](const BenchmarkSample& s, double* out) { out[0] = math.FastACos(s.f[0]); },
+        [](const BenchmarkSample& s, double* out) { out[0] = std::acos(s.f[0]); });
+    // Half the inputs fall outside the table's [-10, 10] range and take the asymptotic path
+    RunCase(context, "FAST_ATAN", "inverse", "std::atan", true, 1, UniformFloats(-20.0f, 20.0f),
+        [&](const BenchmarkSample& s, double* out) { out[0] = math.FastATan(s.f[0]); },
+        [](const BenchmarkSample& s, double* out) { out[0] = std::atan(s.f[0]); });
+    RunCase(context, "FAST_ATAN2", "inverse", "std::atan2", true, 1, UniformFloats(-10.0f, 10.0f, 2),
+        [&](const BenchmarkSample& s, double* out) { out[0] = math.FastATan2(s.f[0], s.f[1]); },
+        [](const BenchmarkSample& s, double* out) { out[0] = std::atan2(s.f[0], s.f[1]); });
+}
+
+// The batch kernels work on whole buffers, so each is timed as one call per pass
+void RunBatchCases(BenchmarkContext& context)
+{
+    const MathPrecalculation& math = FAST_MATH;
+    const size_t count = context.options.samples;
+    const float turn = 2.0f * XM_PI;
+
+    if (context.Selected("FastSinCosBatch", "batch"))
+    {
+        context.rng.seed(context.options.seed);
+        std::vector<float> angles(count);
+        for (float& angle : angles)
+        {
+            angle = Uniform(context.rng, -2.0f * turn, 2.0f * turn);
+        }
+
+        std::vector<float> fastSin(count), fastCos(count), directSin(count), directCos(count);
+        double fastBest = std::numeric_limits<double>::max();
+        double directBest = std::numeric_limits<double>::max();
+        for (int pass = 0; pass < context.options.repeat; ++pass)
+        {
+            auto start = std::chrono::steady_clock::now();
+            math.FastSinCosBatch(angles.data(), fastSin.data(), fastCos.data(), count);
+            fastBest = std::min(fastBest, ElapsedNs(start));
+
+            start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < count; ++i)
+            {
+                directSin[i] = std::sin(angles[i]);
+                directCos[i] = std::cos(angles[i]);
+            }
+            directBest = std::min(directBest, ElapsedNs(start));
+        }
+
+        std::vector<double> fast(count * MAX_CASE_OUTPUTS, 0.0), direct(count * MAX_CASE_OUTPUTS, 0.0);
+        for (size_t i = 0; i < count; ++i)
+        {
+            fast[i * MAX_CASE_OUTPUTS + 0] = fastSin[i];
+            fast[i * MAX_CASE_OUTPUTS + 1] = fastCos[i];
+            direct[i * MAX_CASE_OUTPUTS + 0] = directSin[i];
+            direct[i * MAX_CASE_OUTPUTS + 1] = directCos[i];
+        }
+
+        CaseResult result;
+        result.name = "FastSinCosBatch";
+        result.group = "batch";
+        result.reference = "std::sin + std::cos loop";
+        result.fastNs = fastBest / static_cast<double>(count);
+        result.directNs = directBest / static_cast<double>(count);
+        MeasureError(fast, direct, 2, result);
+        FinishCase(context, result);
+    }
+
+    if (context.Selected("FastSqrtBatch", "batch"))
+    {
+        context.rng.seed(context.options.seed);
+        std::vector<float> values(count);
+        for (float& value : values)
+        {
+            value = Uniform(context.rng, 0.0f, 1000.0f);
+        }
+
+        std::vector<float> fastRoots(count), directRoots(count);
+        double fastBest = std::numeric_limits<double>::max();
+        double directBest = std::numeric_limits<double>::max();
+        for (int pass = 0; pass < context.options.repeat; ++pass)
+        {
+            auto start = std::chrono::steady_clock::now();
+            math.FastSqrtBatch(values.data(), fastRoots.data(), count);
+            fastBest = std::min(fastBest, ElapsedNs(start));
+
+            start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < count; ++i)
+            {
+                directRoots[i] = std::sqrt(values[i]);
+            }
+            directBest = std::min(directBest, ElapsedNs(start));
+        }
+
+        std::vector<double> fast(count * MAX_CASE_OUTPUTS, 0.0), direct(count * MAX_CASE_OUTPUTS, 0.0);
+        for (size_t i = 0; i < count; ++i)
+        {
+            fast[i * MAX_CASE_OUTPUTS] = fastRoots[i];
+            direct[i * MAX_CASE_OUTPUTS] = directRoots[i];
+        }
+
+        CaseResult result;
+        result.name = "FastSqrtBatch";
+        result.group = "batch";
+        result.reference = "std::sqrt loop";
+        result.fastNs = fastBest / static_cast<double>(count);
+        result.directNs = directBest / static_cast<double>(count);
+        MeasureError(fast, direct, 1, result);
+        FinishCase(context, result);
+    }
+}
+
+void RunInterpolationCases(BenchmarkContext& context)
+{
+    const MathPrecalculation& math = FAST_MATH;
+    auto generate = [](std::mt19937& rng, BenchmarkSample& sample)
+    {
+        sample.f[0] = Uniform(rng, -100.0f, 100.0f);
+        sample.f[1] = Uniform(rng, -100.0f, 100.0f);
+        sample.f[2] = Uniform(rng, 0.0f, 1.0f);
+    };
+
+    RunCase(context, "FAST_LERP", "interpolation", "start + t * (end - start)", true, 1, generate,
+        [&](const BenchmarkSample& s, double* out) { out[0] = math.FastLerp(s.f[0], s.f[1], s.f[2]); },
+        [](const BenchmarkSample& s, double* out) { out[0] = s.f[0] + s.f[2] * (s.f[1] - s.f[0]); });
+    RunCase(context, "FastSmoothStep", "interpolation", "t^2 (3 - 2t) polynomial", true, 1, generate,
+        [&](const BenchmarkSample& s, double* out) { out[0] = math.FastSmoothStep(s.f[0], s.f[1], s.f[2]); },
+        [](const BenchmarkSample& s, double* out)
+        {
+            const float t = s.f[2];
+            out[0] = s.f[0] + t * t * (3.0f - 2.0f * t) * (s.f[1] - s.f[0]);
+        });
+    RunCase(context, "FastSmootherStep", "interpolation", "t^3 (t (6t - 15) + 10) polynomial", true, 1, generate,
+        [&](const BenchmarkSample& s, double* out) { out[0] = math.FastSmootherStep(s.f[0], s.f[1], s.f[2]); },
+        [](const BenchmarkSample& s, double* out)
+        {
+            const float t = s.f[2];
+            out[0] = s.f[0] + t * t * t * (t * (t * 6.0f - 15.0f) + 10.0f) * (s.f[1] - s.f[0]);
+        });
+    RunCase(context, "FastEaseIn", "interpolation", "t^2 polynomial", true, 1, generate,
+        [&](const BenchmarkSample& s, double* out) { out[0] = math.FastEaseIn(s.f[0], s.f[1], s.f[2]); },
+        [](const BenchmarkSample& s, double* out) { out[0] = s.f[0] + s.f[2] * s.f[2] * (s.f[1] - s.f[0]); });
+    RunCase(context, "FastEaseOut", "interpolation", "1 - (1 - t)^2 polynomial", true, 1, generate,
+        [&](const BenchmarkSample& s, double* out) { out[0] = math.FastEaseOut(s.f[0], s.f[1], s.f[2]); },
+        [](const BenchmarkSample& s, double* out)
+        {
+            const float inverse = 1.0f - s.f[2];
+            out[0] = s.f[0] + (1.0f - inverse * inverse) * (s.f[1] - s.f[0]);
+        });
+    RunCase(context, "FastEaseInOut", "interpolation", "piecewise quadratic", true, 1, generate,
+        [&](const BenchmarkSample& s, double* out) { out[0] = math.FastEaseInOut(s.f[0], s.f[1], s.f[2]); },
+        [](const BenchmarkSample& s, double* out)
+        {
+            const float t = s.f[2];
+            const float temp = -2.0f * t + 2.0f;
+            const float easeT = (t < 0.5f) ? 2.0f * t * t : 1.0f - temp * temp * 0.5f;
+            out[0] = s.f[0] + easeT * (s.f[1] - s.f[0]);
+        });
+}
+
+void RunColorCases(BenchmarkContext& context)
+{
+    const MathPrecalculation& math = FAST_MATH;
+    auto randomBytes = [](std::mt19937& rng, BenchmarkSample& sample)
+    {
+        sample.u[0] = rng() & 0xFF;
+        sample.u[1] = rng() & 0xFF;
+        sample.u[2] = rng() & 0xFF;
+    };
+
+    // The 64^3 table quantizes each channel, so errors of several levels are expected
+    RunCase(context, "FastYuvToRgb", "color", "BT.601 formula", true, 3, randomBytes,
+        [&](const BenchmarkSample& s, double* out)
+        {
+            uint8_t r, g, b;
+            math.FastYuvToRgb(static_cast<uint8_t>(s.u[0]), static_cast<uint8_t>(s.u[1]), static_cast<uint8_t>(s.u[2]), r, g, b);
+            out[0] = r;
+            out[1] = g;
+            out[2] = b;
+        },
+        [](const BenchmarkSample& s, double* out) { DirectYuvToRgb(s.u[0], s.u[1], s.u[2], out); });
+    RunCase(context, "FastYuvToRgbFloat", "color", "BT.601 formula", true, 3, UniformFloats(0.0f, 1.0f, 3),
+        [&](const BenchmarkSample& s, double* out)
+        {
+            const XMFLOAT4 color = math.FastYuvToRgbFloat(s.f[0], s.f[1], s.f[2]);
+            out[0] = color.x;
+            out[1] = color.y;
+            out[2] = color.z;
+        },
+        [](const BenchmarkSample& s, double* out)
+        {
+            DirectYuvToRgb(static_cast<int>(s.f[0] * 255.0f), static_cast<int>(s.f[1] * 255.0f), static_cast<int>(s.f[2] * 255.0f), out);
+            out[0] = static_cast<float>(out[0]) / 255.0f;
+            out[1] = static_cast<float>(out[1]) / 255.0f;
+            out[2] = static_cast<float>(out[2]) / 255.0f;
+        });
+    RunCase(context, "FastRgbToYuv", "color", "BT.601 formula + std::clamp", true, 3, randomBytes,
+        [&](const BenchmarkSample& s, double* out)
+        {
+            uint8_t y, u, v;
+            math.FastRgbToYuv(static_cast<uint8_t>(s.u[0]), static_cast<uint8_t>(s.u[1]), static_cast<uint8_t>(s.u[2]), y, u, v);
+            out[0] = y;
+            out[1] = u;
+            out[2] = v;
+        },
+        [](const BenchmarkSample& s, double* out)
+        {
+            const float r = static_cast<float>(s.u[0]);
+            const float g = static_cast<float>(s.u[1]);
+            const float b = static_cast<float>(s.u[2]);
+            out[0] = DirectYuvChannel(0.299f * r + 0.587f * g + 0.114f * b);
+            out[1] = DirectYuvChannel(-0.169f * r - 0.331f * g + 0.500f * b + 128);
+            out[2] = DirectYuvChannel(0.500f * r - 0.419f * g - 0.081f * b + 128);
+        });
+    RunCase(context, "FastGammaCorrect", "color", "std::pow", false, 1, randomBytes,
+        [&](const BenchmarkSample& s, double* out) { out[0] = math.FastGammaCorrect(static_cast<uint8_t>(s.u[0]), 2.2f); },
+        [](const BenchmarkSample& s, double* out)
+        {
+            const float corrected = std::pow(static_cast<float>(s.u[0]) / 255.0f, 1.0f / 2.2f);
+            out[0] = std::clamp(static_cast<int>(corrected * 255.0f + 0.5f), 0, 255);
+        });
+    RunCase(context, "FastClamp", "color", "std::clamp", true, 1,
+        [](std::mt19937& rng, BenchmarkSample& sample) { sample.u[0] = static_cast<uint32_t>(static_cast<int>(rng() % 601) - 300); },
+        [&](const BenchmarkSample& s, double* out) { out[0] = math.FastClamp(static_cast<int>(s.u[0])); },
+        [](const BenchmarkSample& s, double* out) { out[0] = std::clamp(static_cast<int>(s.u[0]), 0, 255); });
+}
+
+void RunGeometryCases(BenchmarkContext& context)
+{
+    const MathPrecalculation& math = FAST_MATH;
+
+    // Points within 20 units, so squared distances stay inside the sqrt table
+    RunCase(context, "FastDistance", "geometry", "std::sqrt", true, 1, UniformFloats(-10.0f, 10.0f, 4),
+        [&](const BenchmarkSample& s, double* out) { out[0] = math.FastDistance(XMFLOAT2(s.f[0], s.f[1]), XMFLOAT2(s.f[2], s.f[3])); },
+        [](const BenchmarkSample& s, double* out)
+        {
+            const float dx = s.f[2] - s.f[0];
+            const float dy = s.f[3] - s.f[1];
+            out[0] = std::sqrt(dx * dx + dy * dy);
+        });
+    RunCase(context, "FastNormalize", "geometry", "std::sqrt", true, 2, UniformFloats(-20.0f, 20.0f, 2),
+        [&](const BenchmarkSample& s, double* out)
+        {
+            const XMFLOAT2 normalized = math.FastNormalize(XMFLOAT2(s.f[0], s.f[1]));
+            out[0] = normalized.x;
+            out[1] = normalized.y;
+        },
+        [](const BenchmarkSample& s, double* out)
+        {
+            const float magnitude = std::sqrt(s.f[0] * s.f[0] + s.f[1] * s.f[1]);
+            const float inverse = (magnitude < 1e-8f) ? 0.0f : 1.0f / magnitude;
+            out[0] = s.f[0] * inverse;
+            out[1] = s.f[1] * inverse;
+        });
+}
+
+void RunBitCases(BenchmarkContext& context)
+{
+    const MathPrecalculation& math = FAST_MATH;
+    auto randomWords = [](std::mt19937& rng, BenchmarkSample& sample)
+    {
+        // Vary the magnitude so leading / trailing zero counts are spread out
+        sample.u[0] = static_cast<uint32_t>(rng()) >> (rng() % 32);
+        sample.u[1] = 1 + rng() % 31;
+        sample.u[2] = static_cast<uint32_t>(rng());
+    };
+
+    RunCase(context, "FastCountLeadingZeros", "bits", "clz intrinsic", false, 1, randomWords,
+        [&](const BenchmarkSample& s, double* out) { out[0] = math.FastCountLeadingZeros(s.u[0]); },
+        [](const BenchmarkSample& s, double* out) { out[0] = DirectCountLeadingZeros(s.u[0]); });
+    RunCase(context, "FastCountTrailingZeros", "bits", "ctz intrinsic", false, 1, randomWords,
+        [&](const BenchmarkSample& s, double* out) { out[0] = math.FastCountTrailingZeros(s.u[2] << (s.u[1] - 1)); },
+        [](const BenchmarkSample& s, double* out) { out[0] = DirectCountTrailingZeros(s.u[2] << (s.u[1] - 1)); });
+    RunCase(context, "FastIsPowerOfTwo", "bits", "x & (x - 1)", false, 1, randomWords,
+        [&](const BenchmarkSample& s, double* out) { out[0] = math.FastIsPowerOfTwo(s.u[0] & (s.u[2] | 0xFFFF0000u)); },
+        [](const BenchmarkSample& s, double* out)
+        {
+            const uint32_t value = s.u[0] & (s.u[2] | 0xFFFF0000u);
+            out[0] = (value != 0) && ((value & (value - 1)) == 0);
+        });
+    RunCase(context, "FastNextPowerOfTwo", "bits", "1 << (32 - clz(x - 1))", false, 1, randomWords,
+        [&](const BenchmarkSample& s, double* out) { out[0] = math.FastNextPowerOfTwo(s.u[0] >> 1); },
+        [](const BenchmarkSample& s, double* out)
+        {
+            const uint32_t value = s.u[0] >> 1;
+            out[0] = (value <= 1) ? 1u : (1u << (32 - DirectCountLeadingZeros(value - 1)));
+        });
+    RunCase(context, "FastRotateLeft", "bits", "shift pair", false, 1, randomWords,
+        [&](const BenchmarkSample& s, double* out) { out[0] = math.FastRotateLeft(s.u[2], static_cast<int>(s.u[1])); },
+        [](const BenchmarkSample& s, double* out) { out[0] = DirectRotateLeft(s.u[2], s.u[1]); });
+    RunCase(context, "FastRotateRight", "bits", "shift pair", false, 1, randomWords,
+        [&](const BenchmarkSample& s, double* out) { out[0] = math.FastRotateRight(s.u[2], static_cast<int>(s.u[1])); },
+        [](const BenchmarkSample& s, double* out) { out[0] = DirectRotateRight(s.u[2], s.u[1]); });
+    RunCase(context, "FastCountSetBits", "bits", "SWAR popcount", false, 1, randomWords,
+        [&](const BenchmarkSample& s, double* out) { out[0] = math.FastCountSetBits(s.u[2]); },
+        [](const BenchmarkSample& s, double* out) { out[0] = DirectCountSetBits(s.u[2]); });
+    RunCase(context, "FastReverseBits", "bits", "inlined SWAR reverse", false, 1, randomWords,
+        [&](const BenchmarkSample& s, double* out) { out[0] = math.FastReverseBits(s.u[2]); },
+        [](const BenchmarkSample& s, double* out) { out[0] = DirectReverseBits(s.u[2]); });
+    RunCase(context, "FastModPow", "bits", "inlined square-and-multiply", false, 1, randomWords,
+        [&](const BenchmarkSample& s, double* out) { out[0] = math.FastModPow(s.u[2], s.u[0] & 0xFFFF, s.u[1] * 977u + 2u); },
+        [](const BenchmarkSample& s, double* out) { out[0] = DirectModPow(s.u[2], s.u[0] & 0xFFFF, s.u[1] * 977u + 2u); });
+    // 12 bytes per sample (the three words)
+    RunCase(context, "FastFNV1aHash", "bits", "inlined FNV-1a", false, 1, randomWords,
+        [&](const BenchmarkSample& s, double* out) { out[0] = math.FastFNV1aHash(s.u, sizeof(s.u)); },
+        [](const BenchmarkSample& s, double* out) { out[0] = DirectFNV1aHash(s.u, sizeof(s.u)); });
+    // 64-bit hashes are compared as two 32-bit halves, which doubles hold exactly
+    RunCase(context, "FastFNV1aHash64", "bits", "inlined FNV-1a", false, 2, randomWords,
+        [&](const BenchmarkSample& s, double* out)
+        {
+            const uint64_t hash = math.FastFNV1aHash64(s.u, sizeof(s.u));
+            out[0] = static_cast<double>(hash >> 32);
+            out[1] = static_cast<double>(hash & 0xFFFFFFFFu);
+        },
+        [](const BenchmarkSample& s, double* out)
+        {
+            const uint64_t hash = DirectFNV1aHash64(s.u, sizeof(s.u));
+            out[0] = static_cast<double>(hash >> 32);
+            out[1] = static_cast<double>(hash & 0xFFFFFFFFu);
+        });
+    RunCase(context, "FastByteSwap", "bits", "std::reverse", false, 1, randomWords,
+        [&](const BenchmarkSample& s, double* out)
+        {
+            uint8_t bytes[sizeof(s.u)];
+            memcpy(bytes, s.u, sizeof(bytes));
+            math.FastByteSwap(bytes, sizeof(bytes));
+            out[0] = DirectFNV1aHash(bytes, sizeof(bytes));
+        },
+        [](const BenchmarkSample& s, double* out)
+        {
+            uint8_t bytes[sizeof(s.u)];
+            memcpy(bytes, s.u, sizeof(bytes));
+            std::reverse(bytes, bytes + sizeof(bytes));
+            out[0] = DirectFNV1aHash(bytes, sizeof(bytes));
+        });
+}
+
+void RunPhysicsCases(BenchmarkContext& context)
+{
+    const MathPrecalculation& math = FAST_MATH;
+    auto distanceMass = [](std::mt19937& rng, BenchmarkSample& sample)
+    {
+        sample.f[0] = Uniform(rng, 0.5f, 100.0f);
+        sample.f[1] = Uniform(rng, 1.0f, 1000.0f);
+        sample.f[2] = Uniform(rng, 0.1f, 2.0f);
+    };
+    auto vectorNormal = [](std::mt19937& rng, BenchmarkSample& sample)
+    {
+        sample.f[0] = Uniform(rng, -20.0f, 20.0f);
+        sample.f[1] = Uniform(rng, -20.0f, 20.0f);
+        sample.f[2] = Uniform(rng, -20.0f, 20.0f);
+        RandomUnitVector(rng, sample.f + 3);
+        sample.f[6] = Uniform(rng, 0.0f, 1.0f);
+        sample.f[7] = Uniform(rng, 0.0f, 1.0f);
+    };
+
+    RunCase(context, "FAST_GRAVITY_INTENSITY", "physics", "inlined intensity * mass / d^2", false, 1, distanceMass,
+        [&](const BenchmarkSample& s, double* out) { out[0] = math.FastGravityIntensity(s.f[0], s.f[1], s.f[2]); },
+        [](const BenchmarkSample& s, double* out) { out[0] = s.f[2] * s.f[1] / (s.f[0] * s.f[0]); });
+    RunCase(context, "FAST_REFLECTION_VECTOR", "physics", "inlined reflection", false, 3, vectorNormal,
+        [&](const BenchmarkSample& s, double* out) { StoreFloat3(math.FastReflectionVector(LoadFloat3(s.f), LoadFloat3(s.f + 3), s.f[6]), out); },
+        [](const BenchmarkSample& s, double* out) { DirectReflection(s.f, s.f + 3, s.f[6], out); });
+    RunCase(context, "FAST_INERTIA_COEFFICIENT", "physics", "inlined 2/5 m r^2", false, 1, distanceMass,
+        [&](const BenchmarkSample& s, double* out) { out[0] = math.FastInertiaCoefficient(s.f[1], s.f[2]); },
+        [](const BenchmarkSample& s, double* out) { out[0] = (2.0f / 5.0f) * s.f[1] * (s.f[2] * s.f[2]); });
+    RunCase(context, "FAST_COLLISION_RESPONSE", "physics", "inlined response", false, 3, vectorNormal,
+        [&](const BenchmarkSample& s, double* out) { StoreFloat3(math.FastCollisionResponse(LoadFloat3(s.f), LoadFloat3(s.f + 3), s.f[6], s.f[7]), out); },
+        [](const BenchmarkSample& s, double* out) { DirectCollisionResponse(s.f, s.f + 3, s.f[6], s.f[7], out); });
+    RunCase(context, "FAST_AUDIO_PROPAGATION", "physics", "inlined 1 / (1 + 0.01 d^2)", false, 1, distanceMass,
+        [&](const BenchmarkSample& s, double* out) { out[0] = math.FastAudioPropagation(s.f[0], s.f[2] * 0.5f); },
+        [](const BenchmarkSample& s, double* out)
+        {
+            const float attenuation = (s.f[0] > 0.1f) ? 1.0f / (1.0f + s.f[0] * s.f[0] * 0.01f) : 1.0f;
+            out[0] = std::clamp(attenuation * (1.0f - s.f[2] * 0.5f), 0.0f, 1.0f);
+        });
+    RunCase(context, "FAST_PROJECTILE_TRAJECTORY", "physics", "std::sqrt / atan / sin / cos", true, 3,
+        [](std::mt19937& rng, BenchmarkSample& sample)
+        {
+            sample.f[0] = 0.0f;
+            sample.f[1] = 0.0f;
+            sample.f[2] = 0.0f;
+            sample.f[3] = Uniform(rng, -20.0f, 20.0f);
+            sample.f[4] = Uniform(rng, -5.0f, 5.0f);
+            sample.f[5] = Uniform(rng, -20.0f, 20.0f);
+            sample.f[6] = Uniform(rng, 10.0f, 30.0f);
+        },
+        [&](const BenchmarkSample& s, double* out) { StoreFloat3(math.FastProjectileTrajectory(LoadFloat3(s.f), LoadFloat3(s.f + 3), s.f[6], 9.81f), out); },
+        [](const BenchmarkSample& s, double* out) { DirectProjectileTrajectory(s.f, s.f + 3, s.f[6], 9.81f, out); });
+    RunCase(context, "FAST_ORBITAL_VELOCITY", "physics", "std::sqrt", true, 1, distanceMass,
+        [&](const BenchmarkSample& s, double* out) { out[0] = math.FastOrbitalVelocity(s.f[0], s.f[1]); },
+        [](const BenchmarkSample& s, double* out) { out[0] = std::sqrt(s.f[1] / s.f[0]); });
+    RunCase(context, "FAST_ESCAPE_VELOCITY", "physics", "std::sqrt", true, 1, distanceMass,
+        [&](const BenchmarkSample& s, double* out) { out[0] = math.FastEscapeVelocity(s.f[0], s.f[1]); },
+        [](const BenchmarkSample& s, double* out) { out[0] = std::sqrt(2.0f * s.f[1] / s.f[0]); });
+}
+
+//==============================================================================
+// Reporting
+//==============================================================================
+void PrintResults(const std::vector<CaseResult>& results, double slowerMargin)
+{
+    printf("\n%-28s %-14s %10s %10s %8s %12s %12s\n", "function", "group", "fast ns", "direct ns", "speedup", "max error", "mean error");
+    for (const CaseResult& result : results)
+    {
+        const double speedup = (result.fastNs > 0.0) ? result.directNs / result.fastNs : 0.0;
+        printf("%-28s %-14s %10.2f %10.2f %7.2fx %12.4e %12.4e%s\n", result.name.c_str(), result.group.c_str(),
+            result.fastNs, result.directNs, speedup, result.maxError, result.meanError, result.slowerThanDirect ? "  SLOWER" : "");
+    }
+
+    printf("\nSlower than direct computation (by more than %.0f%%):", slowerMargin);
+    bool any = false;
+    for (const CaseResult& result : results)
+    {
+        if (result.slowerThanDirect)
+        {
+            printf(" %s", result.name.c_str());
+            any = true;
+        }
+    }
+    printf("%s\n", any ? "" : " none");
+}
+
+nlohmann::json ResultToJson(const CaseResult& result)
+{
+    nlohmann::json entry;
+    entry["name"] = result.name;
+    entry["group"] = result.group;
+    entry["reference"] = result.reference;
+    entry["usesTable"] = result.usesTable;
+    entry["fastNsPerOp"] = result.fastNs;
+    entry["directNsPerOp"] = result.directNs;
+    entry["speedup"] = (result.fastNs > 0.0) ? result.directNs / result.fastNs : 0.0;
+    entry["maxAbsError"] = result.maxError;
+    entry["meanAbsError"] = result.meanError;
+    entry["slowerThanDirect"] = result.slowerThanDirect;
+    return entry;
+}
+
+void PrintUsage()
+{
+    printf("Usage: MathBenchmark [--function NAME]... [--group NAME]... [--samples N] [--repeat N] [--seed N]\n");
+    printf("                     [--margin PERCENT] [--json FILE]\n");
+    printf("Groups:");
+    for (const char* group : BENCHMARK_GROUPS)
+    {
+        printf(" %s", group);
+    }
+    printf("\n");
+}
+
+bool ParseOptions(int argc, char** argv, BenchmarkOptions& options)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string argument = argv[i];
+        const bool hasValue = (i + 1 < argc);
+        if (argument == "--function" && hasValue)
+        {
+            options.functions.push_back(argv[++i]);
+        }
+        else if (argument == "--group" && hasValue)
+        {
+            options.groups.push_back(argv[++i]);
+        }
+        else if (argument == "--samples" && hasValue)
+        {
+            options.samples = static_cast<size_t>(std::max(1, atoi(argv[++i])));
+        }
+        else if (argument == "--repeat" && hasValue)
+        {
+            options.repeat = std::max(1, atoi(argv[++i]));
+        }
+        else if (argument == "--seed" && hasValue)
+        {
+            options.seed = static_cast<unsigned int>(strtoul(argv[++i], nullptr, 10));
+        }
+        else if (argument == "--margin" && hasValue)
+        {
+            options.slowerMargin = std::max(0.0, atof(argv[++i]));
+        }
+        else if (argument == "--json" && hasValue)
+        {
+            options.jsonPath = argv[++i];
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    for (const std::string& name : options.groups)
+    {
+        if (std::find(std::begin(BENCHMARK_GROUPS), std::end(BENCHMARK_GROUPS), name) == std::end(BENCHMARK_GROUPS))
+        {
+            fprintf(stderr, "[MathBenchmark] Unknown group '%s'\n", name.c_str());
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} // namespace
+
+//==============================================================================
+// Entry Point
+//==============================================================================
+int main(int argc, char** argv)
+{
+    BenchmarkContext context;
+    if (!ParseOptions(argc, argv, context.options))
+    {
+        PrintUsage();
+        return EXIT_FAILURE;
+    }
+
+    // Build every table family up front so no timed pass includes a lazy table build
+    MathPrecalculation& math = MathPrecalculation::GetInstance();
+    MathPrecalculationConfig mathConfig;
+    mathConfig.preloadFamilies = MATH_TABLE_FAMILIES_ALL;
+    if (!math.Initialize(mathConfig))
+    {
+        fprintf(stderr, "[MathBenchmark] MathPrecalculation initialization failed\n");
+        return EXIT_FAILURE;
+    }
+
+    // A single sample is enough to learn which batch kernel this CPU selects
+    const char* batchKernel = math.MeasureBatchAccuracy(1.0f, 1).kernelName;
+
+    printf("MathBenchmark v%d.%d.%d - %zu samples x %d passes, seed %u, tables %s, batch kernel %s, lookup statistics %s\n",
+        CURRENT_BUILD_VERSION, CURRENT_BUILD_SUBVERSION, CURRENT_BUILD, context.options.samples, context.options.repeat,
+        context.options.seed, math.UsesGeneratedTables() ? "generated" : "runtime", batchKernel,
+#if defined(MATHPRECALC_STATISTICS_ENABLED)
+        "on");
+#else
+        "off");
+#endif
+
+    RunTrigCases(context);
+    RunInverseTrigCases(context);
+    RunBatchCases(context);
+    RunInterpolationCases(context);
+    RunColorCases(context);
+    RunGeometryCases(context);
+    RunBitCases(context);
+    RunPhysicsCases(context);
+
+    if (context.results.empty())
+    {
+        fprintf(stderr, "[MathBenchmark] No function matched the --function / --group filters\n");
+        math.Cleanup();
+        return EXIT_FAILURE;
+    }
+
+    PrintResults(context.results, context.options.slowerMargin);
+
+    if (!context.options.jsonPath.empty())
+    {
+        nlohmann::json report;
+        report["benchmark"] = "MathBenchmark";
+        report["build"] = std::to_string(CURRENT_BUILD_VERSION) + "." + std::to_string(CURRENT_BUILD_SUBVERSION) + "." +
+            std::to_string(CURRENT_BUILD);
+        report["samples"] = context.options.samples;
+        report["repeat"] = context.options.repeat;
+        report["seed"] = context.options.seed;
+        report["slowerMarginPercent"] = context.options.slowerMargin;
+        report["generatedTables"] = math.UsesGeneratedTables();
+        report["tableMemoryBytes"] = math.GetMemoryUsage();
+        report["batchKernel"] = batchKernel;
+#if defined(MATHPRECALC_STATISTICS_ENABLED)
+        report["lookupStatistics"] = true;
+#else
+        report["lookupStatistics"] = false;
+#endif
+
+        report["functions"] = nlohmann::json::array();
+        report["routeToDirect"] = nlohmann::json::array();
+        for (const CaseResult& result : context.results)
+        {
+            report["functions"].push_back(ResultToJson(result));
+            if (result.slowerThanDirect)
+            {
+                report["routeToDirect"].push_back(result.name);
+            }
+        }
+
+        std::ofstream file(context.options.jsonPath, std::ios::trunc);
+        if (!file.is_open())
+        {
+            fprintf(stderr, "[MathBenchmark] Could not open '%s' for writing\n", context.options.jsonPath.c_str());
+            math.Cleanup();
+            return EXIT_FAILURE;
+        }
+        file << report.dump(4) << "\n";
+        printf("\nJSON written to %s\n", context.options.jsonPath.c_str());
+    }
+
+    math.Cleanup();
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,588 @@
+//-------------------------------------------------------------------------------------------------
+// PhysicsBenchmark.cpp - Headless Physics Benchmark Suite
+//
+// Purpose: Runs canned, reproducible stress scenes through the Physics class without a renderer,
+//          window or GUI so physics changes can be measured on their own and tracked across
+//          commits. Every scene is seeded, uses a fixed timestep and runs a fixed number of steps.
+//
+// Scenes:
+// - pile       5000 bodies falling into a heightfield bowl (sleeping disabled, so the pile stays live)
+// - explosion  MAX_PARTICLE_COUNT pooled particles under gravity and wind
+// - ragdolls   50 XPBD humanoid ragdolls
+// - gravity    500 gravity fields acting on 2000 free-floating bodies (exact sum)
+// - gravity-bh the gravity scene with the Barnes-Hut approximation enabled
+// - paths      20000 followers sampling a MAX_PATH_COORDINATES point CurvedPath3D
+//
+// Usage:
+//   PhysicsBenchmark [--scene NAME]... [--steps N] [--warmup N] [--threads N] [--seed N] [--json FILE]
+//
+// Results (step time min/avg/max/p99, entities per second and the per-phase step profile) are
+// printed as a table and optionally written as JSON.
+//-------------------------------------------------------------------------------------------------
+
+#include "Includes.h"
+#include "Debug.h"
+#include "ExceptionHandler.h"
+#include "MathPrecalculation.h"
+#include "Physics.h"
+#include "BuildInfo.h"
+
+#include <nlohmann/json.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+// Engine globals normally defined in main.cpp
+Debug debug;
+ExceptionHandler exceptionHandler;
+
+namespace {
+
+//==============================================================================
+// Benchmark Configuration
+//==============================================================================
+const int DEFAULT_BENCHMARK_STEPS = PHYSICS_PROFILE_WINDOW;                     // Timed steps (one full profiler window)
+const int DEFAULT_BENCHMARK_WARMUP_STEPS = 60;                                  // Untimed steps before measuring
+const unsigned int DEFAULT_BENCHMARK_SEED = 1234;                               // Seed for every scene's random layout
+const float BENCHMARK_TIMESTEP = 1.0f / 60.0f;                                  // Fixed step length in seconds
+
+const int PILE_BODY_COUNT = 5000;                                               // Bodies in the pile scene
+const int RAGDOLL_COUNT = 50;                                                   // XPBD ragdolls in the ragdoll scene
+const int GRAVITY_FIELD_COUNT = 500;                                            // Fields in the gravity scene
+const int GRAVITY_BODY_COUNT = 2000;                                            // Bodies probing those fields
+const int PATH_FOLLOWER_COUNT = 20000;                                          // Followers in the curved path scene
+
+struct BenchmarkOptions {
+    int steps = DEFAULT_BENCHMARK_STEPS;
+    int warmupSteps = DEFAULT_BENCHMARK_WARMUP_STEPS;
+    int solverThreads = -1;                                                     // -1 keeps the world's default
+    unsigned int seed = DEFAULT_BENCHMARK_SEED;
+    std::string jsonPath;                                                       // Empty = no JSON output
+    std::vector<std::string> scenes;                                            // Empty = every scene
+};
+
+// State a scene keeps between its setup and its steps
+struct SceneState {
+    PhysicsParticlePool particles;
+    CurvedPath3D path;
+    std::vector<float> followerDistances;
+    std::vector<float> followerSpeeds;
+    std::vector<PhysicsVector3D> followerPoints;
+    std::vector<PhysicsVector3D> followerTangents;
+};
+
+struct BenchmarkScene {
+    const char* name;
+    const char* description;
+    bool stepsWorld;                                                            // Whether the scene runs Physics::Update
+    int (*setup)(Physics& physics, SceneState& state, std::mt19937& rng);      // Returns the entity count
+    void (*step)(Physics& physics, SceneState& state, float deltaTime);
+};
+
+struct SceneResult {
+    std::string name;
+    std::string description;
+    int entityCount = 0;
+    double setupMs = 0.0;
+    double totalMs = 0.0;
+    std::vector<float> stepMs;
+    PhysicsStatistics statistics;
+    bool hasWorldStatistics = false;
+};
+
+//==============================================================================
+// Scenes
+//==============================================================================
+int SetupPile(Physics& physics, SceneState&, std::mt19937& rng)
+{
+    // A bowl keeps the falling bodies together so they form one large contact pile
+    const int gridSize = 65;
+    const float cellSize = 1.0f;
+    const float half = (gridSize - 1) * cellSize * 0.5f;
+    std::vector<float> heights(static_cast<size_t>(gridSize) * gridSize);
+    for (int z = 0; z < gridSize; ++z)
+    {
+        for (int x = 0; x < gridSize; ++x)
+        {
+            const float dx = x * cellSize - half;
+            const float dz = z * cellSize - half;
+            heights[static_cast<size_t>(z) * gridSize + x] = 0.02f * (dx * dx + dz * dz);
+        }
+    }
+
+    PhysicsHeightfield bowl;
+    bowl.BuildFromHeights(heights.data(), gridSize, gridSize, cellSize, PhysicsVector3D(-half, 0.0f, -half));
+    physics.AddHeightfield(std::move(bowl));
+
+    std::uniform_real_distribution<float> spread(-12.0f, 12.0f);
+    std::uniform_real_distribution<float> height(4.0f, 60.0f);
+    for (int i = 0; i < PILE_BODY_COUNT; ++i)
+    {
+        PhysicsBody body;
+        body.position = PhysicsVector3D(spread(rng), height(rng), spread(rng));
+        body.radius = 0.5f;
+        body.restitution = 0.1f;
+        body.friction = 0.6f;
+        physics.AddPhysicsBody(body);
+    }
+
+    physics.SetSleepingEnabled(false);
+    return PILE_BODY_COUNT;
+}
+
+int SetupExplosion(Physics& physics, SceneState& state, std::mt19937& rng)
+{
+    // Particle generation uses rand(), so seed it from the scene generator
+    srand(static_cast<unsigned int>(rng()));
+
+    // Lifetime outlasts the run so the particle count stays constant while timing
+    state.particles.SetCapacity(MAX_PARTICLE_COUNT);
+    return physics.CreateExplosion(state.particles, PhysicsVector3D(0.0f, 10.0f, 0.0f), MAX_PARTICLE_COUNT, 25.0f, 3600.0f);
+}
+
+void StepExplosion(Physics& physics, SceneState& state, float deltaTime)
+{
+    physics.ApplyWindForce(state.particles, PhysicsVector3D(2.0f, 0.0f, 0.5f));
+    physics.ApplyGravityToParticles(state.particles);
+    physics.UpdateParticleSystem(state.particles, deltaTime);
+}
+
+int SetupRagdolls(Physics& physics, SceneState&, std::mt19937& rng)
+{
+    // 17-joint humanoid: pelvis, spine, chest, neck, head, arms (shoulder, elbow, hand), legs (hip, knee, foot)
+    const std::vector<PhysicsVector3D> skeleton = {
+        { 0.0f, 1.0f, 0.0f }, { 0.0f, 1.25f, 0.0f }, { 0.0f, 1.5f, 0.0f }, { 0.0f, 1.65f, 0.0f }, { 0.0f, 1.85f, 0.0f },
+        { -0.2f, 1.5f, 0.0f }, { -0.45f, 1.5f, 0.0f }, { -0.7f, 1.5f, 0.0f },
+        { 0.2f, 1.5f, 0.0f }, { 0.45f, 1.5f, 0.0f }, { 0.7f, 1.5f, 0.0f },
+        { -0.1f, 0.95f, 0.0f }, { -0.1f, 0.5f, 0.0f }, { -0.1f, 0.05f, 0.0f },
+        { 0.1f, 0.95f, 0.0f }, { 0.1f, 0.5f, 0.0f }, { 0.1f, 0.05f, 0.0f }
+    };
+    const std::vector<std::pair<int, int>> bones = {
+        { 0, 1 }, { 1, 2 }, { 2, 3 }, { 3, 4 },
+        { 2, 5 }, { 5, 6 }, { 6, 7 }, { 2, 8 }, { 8, 9 }, { 9, 10 },
+        { 0, 11 }, { 11, 12 }, { 12, 13 }, { 0, 14 }, { 14, 15 }, { 15, 16 }
+    };
+
+    std::uniform_real_distribution<float> push(-3.0f, 3.0f);
+    int jointCount = 0;
+    std::vector<PhysicsVector3D> joints(skeleton.size());
+    for (int ragdoll = 0; ragdoll < RAGDOLL_COUNT; ++ragdoll)
+    {
+        const PhysicsVector3D offset((ragdoll % 10) * 2.0f, 0.0f, (ragdoll / 10) * 2.0f);
+        for (size_t i = 0; i < skeleton.size(); ++i)
+        {
+            joints[i] = skeleton[i] + offset;
+        }
+
+        const int ragdollId = physics.CreateXPBDRagdoll(joints, bones);
+        if (ragdollId >= 0)
+        {
+            physics.ApplyXPBDRagdollImpulse(ragdollId, 4, PhysicsVector3D(push(rng), push(rng), push(rng)));
+            jointCount += static_cast<int>(joints.size());
+        }
+    }
+
+    return jointCount;
+}
+
+int SetupGravityFields(Physics& physics, SceneState&, std::mt19937& rng)
+{
+    std::uniform_real_distribution<float> fieldPosition(-200.0f, 200.0f);
+    std::uniform_real_distribution<float> fieldMass(10.0f, 1000.0f);
+    for (int i = 0; i < GRAVITY_FIELD_COUNT; ++i)
+    {
+        GravityField field;
+        field.center = PhysicsVector3D(fieldPosition(rng), fieldPosition(rng), fieldPosition(rng));
+        field.mass = fieldMass(rng);
+        field.radius = 150.0f;
+        physics.AddGravityField(field);
+    }
+
+    std::uniform_real_distribution<float> bodyPosition(-250.0f, 250.0f);
+    for (int i = 0; i < GRAVITY_BODY_COUNT; ++i)
+    {
+        PhysicsBody body;
+        body.position = PhysicsVector3D(bodyPosition(rng), bodyPosition(rng), bodyPosition(rng));
+        body.radius = 0.5f;
+        physics.AddPhysicsBody(body);
+    }
+
+    return GRAVITY_BODY_COUNT;
+}
+
+int SetupGravityFieldsApproximated(Physics& physics, SceneState& state, std::mt19937& rng)
+{
+    // Same seeded layout as the exact scene, so the two step times compare directly
+    const int bodyCount = SetupGravityFields(physics, state, rng);
+    physics.SetGravityApproximation(true);
+    return bodyCount;
+}
+
+int SetupPaths(Physics& physics, SceneState& state, std::mt19937& rng)
+{
+    // Rising spiral through jittered control points, sampled to the full coordinate budget
+    std::uniform_real_distribution<float> jitter(-2.0f, 2.0f);
+    std::vector<PhysicsVector3D> controlPoints;
+    for (int i = 0; i < 32; ++i)
+    {
+        const float angle = i * 0.6f;
+        controlPoints.emplace_back(std::cos(angle) * 50.0f + jitter(rng), i * 3.0f, std::sin(angle) * 50.0f + jitter(rng));
+    }
+    state.path = physics.CreateCurvedPath3D(controlPoints, MAX_PATH_COORDINATES);
+
+    std::uniform_real_distribution<float> start(0.0f, state.path.totalLength);
+    std::uniform_real_distribution<float> speed(2.0f, 20.0f);
+    state.followerDistances.resize(PATH_FOLLOWER_COUNT);
+    state.followerSpeeds.resize(PATH_FOLLOWER_COUNT);
+    state.followerPoints.resize(PATH_FOLLOWER_COUNT);
+    state.followerTangents.resize(PATH_FOLLOWER_COUNT);
+    for (int i = 0; i < PATH_FOLLOWER_COUNT; ++i)
+    {
+        state.followerDistances[i] = start(rng);
+        state.followerSpeeds[i] = speed(rng);
+    }
+
+    return PATH_FOLLOWER_COUNT;
+}
+
+void StepPaths(Physics&, SceneState& state, float deltaTime)
+{
+    const float length = state.path.totalLength;
+    for (int i = 0; i < PATH_FOLLOWER_COUNT; ++i)
+    {
+        float distance = state.followerDistances[i] + state.followerSpeeds[i] * deltaTime;
+        state.followerDistances[i] = (distance >= length) ? distance - length : distance;
+    }
+
+    state.path.GetPointsAtDistances(state.followerDistances.data(), state.followerDistances.size(),
+        state.followerPoints.data(), state.followerTangents.data());
+}
+
+void StepWorld(Physics& physics, SceneState&, float deltaTime)
+{
+    physics.Update(deltaTime);
+}
+
+const BenchmarkScene BENCHMARK_SCENES[] = {
+    { "pile", "5000 bodies falling into a heightfield bowl", true, SetupPile, StepWorld },
+    { "explosion", "MAX_PARTICLE_COUNT pooled particles under gravity and wind", false, SetupExplosion, StepExplosion },
+    { "ragdolls", "50 XPBD humanoid ragdolls", true, SetupRagdolls, StepWorld },
+    { "gravity", "500 gravity fields acting on 2000 bodies (exact sum)", true, SetupGravityFields, StepWorld },
+    { "gravity-bh", "500 gravity fields acting on 2000 bodies (Barnes-Hut)", true, SetupGravityFieldsApproximated, StepWorld },
+    { "paths", "20000 followers on a MAX_PATH_COORDINATES point CurvedPath3D", false, SetupPaths, StepPaths },
+};
+
+//==============================================================================
+// Measurement and Reporting
+//==============================================================================
+double ElapsedMs(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Step times reduced the same way the physics profiler reduces its window
+PhysicsProfileSeries SummarizeSteps(const std::vector<float>& samples)
+{
+    PhysicsProfileSeries series;
+    if (samples.empty())
+    {
+        return series;
+    }
+
+    std::vector<float> sorted(samples);
+    std::sort(sorted.begin(), sorted.end());
+    double sum = 0.0;
+    for (float sample : sorted)
+    {
+        sum += sample;
+    }
+
+    const size_t rank = std::max<size_t>(1, static_cast<size_t>(std::ceil(0.99 * sorted.size())));
+    series.last = samples.back();
+    series.min = sorted.front();
+    series.avg = static_cast<float>(sum / sorted.size());
+    series.max = sorted.back();
+    series.p99 = sorted[rank - 1];
+    return series;
+}
+
+const char* GetSIMDPathName(PhysicsSIMDPath path)
+{
+    switch (path)
+    {
+    case PhysicsSIMDPath::AVX2: return "AVX2";
+    case PhysicsSIMDPath::SSE2: return "SSE2";
+    default:                    return "Scalar";
+    }
+}
+
+nlohmann::json SeriesToJson(const PhysicsProfileSeries& series)
+{
+    return { { "min", series.min }, { "avg", series.avg }, { "max", series.max }, { "p99", series.p99 } };
+}
+
+SceneResult RunScene(const BenchmarkScene& scene, const BenchmarkOptions& options)
+{
+    SceneResult result;
+    result.name = scene.name;
+    result.description = scene.description;
+
+    std::unique_ptr<Physics> physics = std::make_unique<Physics>();
+    if (!physics->Initialize())
+    {
+        fprintf(stderr, "[PhysicsBenchmark] Physics initialization failed for scene '%s'\n", scene.name);
+        return result;
+    }
+    if (options.solverThreads >= 0)
+    {
+        physics->SetSolverThreadCount(options.solverThreads);
+    }
+
+    // Every scene starts from the same seed so runs are comparable across commits
+    std::mt19937 rng(options.seed);
+    std::unique_ptr<SceneState> state = std::make_unique<SceneState>();
+
+    auto setupStart = std::chrono::steady_clock::now();
+    result.entityCount = scene.setup(*physics, *state, rng);
+    result.setupMs = ElapsedMs(setupStart);
+
+    for (int step = 0; step < options.warmupSteps; ++step)
+    {
+        scene.step(*physics, *state, BENCHMARK_TIMESTEP);
+    }
+
+    // The profiler window then only holds timed steps
+    physics->ResetPerformanceCounters();
+
+    result.stepMs.reserve(options.steps);
+    auto runStart = std::chrono::steady_clock::now();
+    for (int step = 0; step < options.steps; ++step)
+    {
+        auto stepStart = std::chrono::steady_clock::now();
+        scene.step(*physics, *state, BENCHMARK_TIMESTEP);
+        result.stepMs.push_back(static_cast<float>(ElapsedMs(stepStart)));
+    }
+    result.totalMs = ElapsedMs(runStart);
+
+    if (scene.stepsWorld)
+    {
+        physics->GetPhysicsStatistics(result.statistics);
+        result.hasWorldStatistics = result.statistics.sampleCount > 0;
+    }
+
+    physics->Cleanup();
+    return result;
+}
+
+void PrintResult(const SceneResult& result, int steps)
+{
+    const PhysicsProfileSeries stepSeries = SummarizeSteps(result.stepMs);
+    const double seconds = result.totalMs / 1000.0;
+    const double entitiesPerSecond = (seconds > 0.0) ? result.entityCount * static_cast<double>(steps) / seconds : 0.0;
+
+    printf("\n%s - %s\n", result.name.c_str(), result.description.c_str());
+    printf("  entities %d, setup %.2f ms, %d steps in %.2f ms\n", result.entityCount, result.setupMs, steps, result.totalMs);
+    printf("  step ms   min %.3f  avg %.3f  max %.3f  p99 %.3f\n", stepSeries.min, stepSeries.avg, stepSeries.max, stepSeries.p99);
+    printf("  entities/s %.0f\n", entitiesPerSecond);
+
+    if (result.hasWorldStatistics)
+    {
+        printf("  %-20s %9s %9s %9s\n", "phase (ms)", "avg", "max", "p99");
+        for (int phase = 0; phase < PhysicsProfiler::PHASE_COUNT; ++phase)
+        {
+            const PhysicsProfileSeries& series = result.statistics.phases[phase];
+            printf("  %-20s %9.3f %9.3f %9.3f\n", PhysicsProfiler::GetPhaseName(static_cast<PhysicsProfilePhase>(phase)),
+                series.avg, series.max, series.p99);
+        }
+        printf("  %-20s %9s %9s %9s\n", "counter", "avg", "max", "p99");
+        for (int counter = 0; counter < PhysicsProfiler::COUNTER_COUNT; ++counter)
+        {
+            const PhysicsProfileSeries& series = result.statistics.counters[counter];
+            printf("  %-20s %9.1f %9.1f %9.1f\n", PhysicsProfiler::GetCounterName(static_cast<PhysicsProfileCounter>(counter)),
+                series.avg, series.max, series.p99);
+        }
+    }
+}
+
+nlohmann::json ResultToJson(const SceneResult& result, int steps)
+{
+    const PhysicsProfileSeries stepSeries = SummarizeSteps(result.stepMs);
+    const double seconds = result.totalMs / 1000.0;
+
+    nlohmann::json scene;
+    scene["name"] = result.name;
+    scene["description"] = result.description;
+    scene["entities"] = result.entityCount;
+    scene["setupMs"] = result.setupMs;
+    scene["totalMs"] = result.totalMs;
+    scene["entitiesPerSecond"] = (seconds > 0.0) ? result.entityCount * static_cast<double>(steps) / seconds : 0.0;
+    scene["stepMs"] = SeriesToJson(stepSeries);
+
+    if (result.hasWorldStatistics)
+    {
+        nlohmann::json phases = nlohmann::json::object();
+        for (int phase = 0; phase < PhysicsProfiler::PHASE_COUNT; ++phase)
+        {
+            phases[PhysicsProfiler::GetPhaseName(static_cast<PhysicsProfilePhase>(phase))] = SeriesToJson(result.statistics.phases[phase]);
+        }
+        nlohmann::json counters = nlohmann::json::object();
+        for (int counter = 0; counter < PhysicsProfiler::COUNTER_COUNT; ++counter)
+        {
+            counters[PhysicsProfiler::GetCounterName(static_cast<PhysicsProfileCounter>(counter))] = SeriesToJson(result.statistics.counters[counter]);
+        }
+        scene["phasesMs"] = phases;
+        scene["counters"] = counters;
+    }
+
+    return scene;
+}
+
+void PrintUsage()
+{
+    printf("Usage: PhysicsBenchmark [--scene NAME]... [--steps N] [--warmup N] [--threads N] [--seed N] [--json FILE]\n");
+    printf("Scenes:");
+    for (const BenchmarkScene& scene : BENCHMARK_SCENES)
+    {
+        printf(" %s", scene.name);
+    }
+    printf("\n");
+}
+
+bool ParseOptions(int argc, char** argv, BenchmarkOptions& options)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string argument = argv[i];
+        const bool hasValue = (i + 1 < argc);
+        if (argument == "--scene" && hasValue)
+        {
+            options.scenes.push_back(argv[++i]);
+        }
+        else if (argument == "--steps" && hasValue)
+        {
+            options.steps = std::max(1, atoi(argv[++i]));
+        }
+        else if (argument == "--warmup" && hasValue)
+        {
+            options.warmupSteps = std::max(0, atoi(argv[++i]));
+        }
+        else if (argument == "--threads" && hasValue)
+        {
+            options.solverThreads = std::max(0, atoi(argv[++i]));
+        }
+        else if (argument == "--seed" && hasValue)
+        {
+            options.seed = static_cast<unsigned int>(strtoul(argv[++i], nullptr, 10));
+        }
+        else if (argument == "--json" && hasValue)
+        {
+            options.jsonPath = argv[++i];
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    for (const std::string& name : options.scenes)
+    {
+        bool known = false;
+        for (const BenchmarkScene& scene : BENCHMARK_SCENES)
+        {
+            known = known || (name == scene.name);
+        }
+        if (!known)
+        {
+            fprintf(stderr, "[PhysicsBenchmark] Unknown scene '%s'\n", name.c_str());
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} // namespace
+
+//==============================================================================
+// Entry Point
+//==============================================================================
+int main(int argc, char** argv)
+{
+    BenchmarkOptions options;
+    if (!ParseOptions(argc, argv, options))
+    {
+        PrintUsage();
+        return EXIT_FAILURE;
+    }
+
+    if (!MathPrecalculation::GetInstance().Initialize())
+    {
+        fprintf(stderr, "[PhysicsBenchmark] MathPrecalculation initialization failed\n");
+        return EXIT_FAILURE;
+    }
+
+    // Reported once - every world selects the same kernel
+    PhysicsSIMDPath integrationPath = PhysicsSIMDPath::Scalar;
+    {
+        std::unique_ptr<Physics> probe = std::make_unique<Physics>();
+        if (probe->Initialize())
+        {
+            integrationPath = probe->GetIntegrationPath();
+            probe->Cleanup();
+        }
+    }
+
+    printf("PhysicsBenchmark v%d.%d.%d - %d steps (%d warmup), seed %u, integration %s, profiling %s\n",
+        CURRENT_BUILD_VERSION, CURRENT_BUILD_SUBVERSION, CURRENT_BUILD, options.steps, options.warmupSteps, options.seed,
+        GetSIMDPathName(integrationPath),
+#if defined(PHYSICS_PROFILING_ENABLED)
+        "on");
+#else
+        "off");
+#endif
+
+    nlohmann::json report;
+    report["benchmark"] = "PhysicsBenchmark";
+    report["build"] = std::to_string(CURRENT_BUILD_VERSION) + "." + std::to_string(CURRENT_BUILD_SUBVERSION) + "." +
+        std::to_string(CURRENT_BUILD);
+    report["steps"] = options.steps;
+    report["warmupSteps"] = options.warmupSteps;
+    report["timestep"] = BENCHMARK_TIMESTEP;
+    report["seed"] = options.seed;
+    report["solverThreads"] = options.solverThreads;
+    report["integrationPath"] = GetSIMDPathName(integrationPath);
+    report["scenes"] = nlohmann::json::array();
+
+    for (const BenchmarkScene& scene : BENCHMARK_SCENES)
+    {
+        if (!options.scenes.empty() && std::find(options.scenes.begin(), options.scenes.end(), scene.name) == options.scenes.end())
+        {
+            continue;
+        }
+
+        const SceneResult result = RunScene(scene, options);
+        PrintResult(result, options.steps);
+        report["scenes"].push_back(ResultToJson(result, options.steps));
+    }
+
+    if (!options.jsonPath.empty())
+    {
+        std::ofstream file(options.jsonPath, std::ios::trunc);
+        if (!file.is_open())
+        {
+            fprintf(stderr, "[PhysicsBenchmark] Could not open '%s' for writing\n", options.jsonPath.c_str());
+            return EXIT_FAILURE;
+        }
+        file << report.dump(4) << "\n";
+        printf("\nJSON written to %s\n", options.jsonPath.c_str());
+    }
+
+    MathPrecalculation::GetInstance().Cleanup();
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+//-------------------------------------------------------------------------------------------------
+// CPUFeatures.h - Runtime CPU SIMD Feature Detection
+//
+// Purpose: Reports which SIMD instruction sets the running processor supports so hot loops can
+//          select an SSE / AVX2 / NEON kernel at runtime while the engine still ships as a single
+//          binary built for the baseline instruction set.
+//
+// Usage:
+//   const CPUFeatureFlags& cpu = GetCPUFeatures();
+//   if (cpu.hasAVX2) { ... } else if (cpu.hasSSE2) { ... } else { ... scalar ... }
+//
+// Kernels that use instructions above the compiler baseline must be marked with
+// CPUFEATURES_TARGET_AVX2 / CPUFEATURES_TARGET_AVX / CPUFEATURES_TARGET_SSE41 so GCC and Clang will
+// emit them.
+//-------------------------------------------------------------------------------------------------
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+    #define CPUFEATURES_X86 1
+    #include <immintrin.h>
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #endif
+#elif defined(__ARM_NEON) || defined(_M_ARM64) || defined(__aarch64__)
+    #define CPUFEATURES_NEON 1
+    #include <arm_neon.h>
+#endif
+
+// MSVC emits any intrinsic regardless of /arch, GCC and Clang need a per-function target
+#if defined(CPUFEATURES_X86) && !defined(_MSC_VER) && (defined(__GNUC__) || defined(__clang__))
+    #define CPUFEATURES_TARGET_AVX2 __attribute__((target("avx2,fma")))
+    #define CPUFEATURES_TARGET_AVX __attribute__((target("avx")))
+    #define CPUFEATURES_TARGET_SSE41 __attribute__((target("sse4.1")))
+#else
+    #define CPUFEATURES_TARGET_AVX2
+    #define CPUFEATURES_TARGET_AVX
+    #define CPUFEATURES_TARGET_SSE41
+#endif
+
+//==============================================================================
+// CPU Feature Flags
+//==============================================================================
+struct CPUFeatureFlags {
+    bool hasSSE2;                                                               // SSE2 (baseline on every x64 CPU)
+    bool hasSSE41;                                                              // SSE4.1 (blend, round, dot product)
+    bool hasAVX;                                                                // AVX with OS support for YMM state
+    bool hasAVX2;                                                               // AVX2 integer and gather instructions
+    bool hasFMA;                                                                // Fused multiply-add (FMA3)
+    bool hasNEON;                                                               // ARM Advanced SIMD
+};
+
+// Detect once on first use - thread-safe through static local initialization
+inline const CPUFeatureFlags& GetCPUFeatures()
+{
+    static const CPUFeatureFlags flags = []() {
+        CPUFeatureFlags detected = {};
+
+#if defined(CPUFEATURES_X86) && defined(_MSC_VER)
+        int cpuInfo[4] = { 0 };
+        __cpuid(cpuInfo, 0);
+        const int maxLeaf = cpuInfo[0];
+
+        if (maxLeaf >= 1)
+        {
+            __cpuid(cpuInfo, 1);
+            detected.hasSSE2 = (cpuInfo[3] & (1 << 26)) != 0;
+            detected.hasSSE41 = (cpuInfo[2] & (1 << 19)) != 0;
+            detected.hasFMA = (cpuInfo[2] & (1 << 12)) != 0;
+
+            // AVX also requires the OS to save YMM registers (OSXSAVE + XCR0 bits 1 and 2)
+            const bool hasOSXSAVE = (cpuInfo[2] & (1 << 27)) != 0;
+            const bool hasAVXBit = (cpuInfo[2] & (1 << 28)) != 0;
+            if (hasOSXSAVE && hasAVXBit)
+            {
+                detected.hasAVX = (_xgetbv(0) & 0x6) == 0x6;
+            }
+        }
+
+        if (maxLeaf >= 7 && detected.hasAVX)
+        {
+            __cpuidex(cpuInfo, 7, 0);
+            detected.hasAVX2 = (cpuInfo[1] & (1 << 5)) != 0;
+        }
+#elif defined(CPUFEATURES_X86)
+        __builtin_cpu_init();
+        detected.hasSSE2 = __builtin_cpu_supports("sse2") != 0;
+        detected.hasSSE41 = __builtin_cpu_supports("sse4.1") != 0;
+        detected.hasAVX = __builtin_cpu_supports("avx") != 0;
+        detected.hasAVX2 = __builtin_cpu_supports("avx2") != 0;
+        detected.hasFMA = __builtin_cpu_supports("fma") != 0;
+#elif defined(CPUFEATURES_NEON)
+        detected.hasNEON = true;
+#endif
+
+        // FMA and AVX2 kernels assume the AVX register state is available
+        detected.hasFMA = detected.hasFMA && detected.hasAVX;
+        detected.hasAVX2 = detected.hasAVX2 && detected.hasAVX;
+        return detected;
+    }();
+
+    return flags;
+}
@@ -1,6 +1,9 @@
 #include "Includes.h"
 #include "Debug.h"
-#ifdef _DEBUG
+// Debug builds mirror log output to the in-game console window.  Headless tools that link
+// Debug.cpp without the GUI (e.g. the physics benchmark) define NO_CONSOLE_WINDOW.
+#if defined(_DEBUG) && !defined(NO_CONSOLE_WINDOW)
+#define DEBUG_CONSOLE_WINDOW_OUTPUT
 #include "ConsoleWindow.h"
 extern ConsoleWindow consoleWindow;
 #endif
@@ -61,7 +64,7 @@ void Debug::DebugLog(const std::string& message)
     std::ostringstream oss;
     oss << "[INFO]: " << message << "\n";
     OutputDebugStringA(oss.str().c_str());
-#ifdef _DEBUG
+#if defined(DEBUG_CONSOLE_WINDOW_OUTPUT)
     {
         std::wstring w(message.begin(), message.end());
         consoleWindow.AddLine(L"[INFO]: " + w, ConsoleLineColor::Normal);
@@ -181,7 +184,7 @@ void Debug::logLevelMessage(LogLevel level, const std::wstring& message)
         woss << taggedMessage << L"\n";
         OutputDebugStringW(woss.str().c_str());
 
-#ifdef _DEBUG
+#if defined(DEBUG_CONSOLE_WINDOW_OUTPUT)
         {
             ConsoleLineColor clr = ConsoleLineColor::Normal;
             if (level == LogLevel::LOG_WARNING)
@@ -244,10 +247,12 @@ void Debug::Log(const std::string& message)
 {
     #ifdef _DEBUG
         OutputDebugStringA(("[INFO]: " + message).c_str());
+        #if defined(DEBUG_CONSOLE_WINDOW_OUTPUT)
         {
             std::wstring w(message.begin(), message.end());
             consoleWindow.AddLine(L"[INFO]: " + w, ConsoleLineColor::Normal);
         }
+        #endif
     #endif
 }
 
@@ -255,10 +260,12 @@ void Debug::LogWarning(const std::string& message)
 {
     #ifdef _DEBUG
         OutputDebugStringA(("[WARNING]: " + message + "\n").c_str());
+        #if defined(DEBUG_CONSOLE_WINDOW_OUTPUT)
         {
             std::wstring w(message.begin(), message.end());
             consoleWindow.AddLine(L"[WARNING]: " + w, ConsoleLineColor::Warning);
         }
+        #endif
     #endif
 }
 
@@ -266,10 +273,12 @@ void Debug::LogError(const std::string& message)
 {
     #ifdef _DEBUG
         OutputDebugStringA(("[ERROR]: " + message + "\n").c_str());
+        #if defined(DEBUG_CONSOLE_WINDOW_OUTPUT)
         {
             std::wstring w(message.begin(), message.end());
             consoleWindow.AddLine(L"[ERROR]: " + w, ConsoleLineColor::Error);
         }
+        #endif
     #endif
 }
 
@@ -278,10 +287,12 @@ void Debug::LogFunction(const std::string& functionName, const std::string& mess
     std::string fullMessage = "[Function: " + functionName + "] " + message;
     #ifdef _DEBUG
         OutputDebugStringA(fullMessage.c_str());
+        #if defined(DEBUG_CONSOLE_WINDOW_OUTPUT)
         {
             std::wstring w(fullMessage.begin(), fullMessage.end());
             consoleWindow.AddLine(w, ConsoleLineColor::Normal);
         }
+        #endif
     #endif
 }
 
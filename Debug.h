@@ -37,6 +37,7 @@
 //#define _DEBUG_PUNPACK_                                                 // Define this line, to show all debug output for the PUNPuck class.
 //#define _DEBUG_GAMEPLAYER_                                              // Define this line, to show all debug output for the GamePlayer class.
 //#define _DEBUG_PHYSICS_                                                 // Define this line, to show all debug output for the Physics class.
+//#define _DEBUG_PHYSICS_ALLOCATIONS_                                     // Define this line, to count heap allocations per physics step and assert none happen in steady state.
 //#define _DEBUG_MYRANDOMIZER_                                            // Define this line, to show all debug output for the MyRandomizer class.
 //#define _DEBUG_TTSMANAGER_                                              // Define this line, to show all debug output for the TTSManager class.
 //#define _DEBUG_GUI_                                                     // Define this line, to show all debug output to runtime console for the GUIManager class.
@@ -119,6 +119,10 @@ NOTE:   Becareful to not alter the order of the includes or directive conditiona
             #include <DirectXMath.h>                // DirectX Math library
             #include <DirectXColors.h>              // Predefined color constants
 
+            // Matrix4x4 storage alias — same as the Windows Vulkan branch, so shared code
+            // (e.g. the MathPrecalculation batch kernels) names 4x4 float storage the same way.
+            using Matrix4x4 = DirectX::XMFLOAT4X4;
+
             // Audio related includes
             #include <xaudio2.h>                    // XAudio2 for audio processing
             #include <dsound.h>                     // DirectSound for legacy audio support
@@ -171,6 +175,9 @@ NOTE:   Becareful to not alter the order of the includes or directive conditiona
             using namespace DirectX;
             using Microsoft::WRL::ComPtr;
 
+            // Matrix4x4 storage alias — same as the DirectX 11 and Windows Vulkan branches.
+            using Matrix4x4 = XMFLOAT4X4;
+
         #elif defined(__USE_OPENGL__)
             // GLEW must be first — it replaces and includes gl.h internally.
             // Fall back to the bare Windows SDK gl.h if GLEW is not installed.
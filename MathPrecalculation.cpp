@@ -10,10 +10,142 @@
 #include "Physics.h"
 #include "MathPrecalculation.h"
 #include "Debug.h"
+#include "CPUFeatures.h"
+
+#include <fstream>
 
 // External reference for global debug instance
 extern Debug debug;
 
+//==============================================================================
+// Lookup Statistics
+//==============================================================================
+#if defined(MATHPRECALC_STATISTICS_ENABLED)
+// One cache line of lookup counts per thread. Only the owning thread writes its count, with a
+// relaxed load + store rather than a locked read-modify-write, so FAST_* lookups from physics, FX
+// and AI threads never contend on a shared counter; GetLookupCount() sums the shards on demand.
+// Shards are never freed: a thread releases its shard on exit and the next new thread reuses it,
+// so the list only grows to the peak number of threads that have performed lookups. Claiming,
+// releasing and summing shards all hold s_mathLookupShardMutex, so a shard only changes owner
+// between sums; counting itself never takes the lock.
+struct alignas(64) MathLookupShard {
+    std::atomic<size_t> count{ 0 };
+    bool inUse = false;
+    MathLookupShard* next = nullptr;
+};
+
+static std::mutex s_mathLookupShardMutex;
+static MathLookupShard* s_mathLookupShards = nullptr;
+static thread_local MathLookupShard* t_mathLookupShard = nullptr;
+
+// Hands the calling thread's shard back for reuse when the thread exits
+struct MathLookupShardOwner {
+    MathLookupShard* shard = nullptr;
+
+    ~MathLookupShardOwner()
+    {
+        if (shard)
+        {
+            std::lock_guard<std::mutex> lock(s_mathLookupShardMutex);
+            shard->inUse = false;
+        }
+    }
+};
+
+// Slow path, once per thread: claim a released shard or push a new one onto the list
+static MathLookupShard* AcquireMathLookupShard()
+{
+    MathLookupShard* shard = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(s_mathLookupShardMutex);
+        for (MathLookupShard* candidate = s_mathLookupShards; candidate && !shard; candidate = candidate->next)
+        {
+            shard = candidate->inUse ? nullptr : candidate;
+        }
+
+        if (!shard)
+        {
+            shard = new MathLookupShard();
+            shard->next = s_mathLookupShards;
+            s_mathLookupShards = shard;
+        }
+        shard->inUse = true;
+    }
+
+    static thread_local MathLookupShardOwner owner;
+    owner.shard = shard;
+    t_mathLookupShard = shard;
+    return shard;
+}
+
+static inline void CountMathLookup()
+{
+    MathLookupShard* shard = t_mathLookupShard;
+    if (!shard)
+    {
+        shard = AcquireMathLookupShard();
+    }
+
+    shard->count.store(shard->count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+static size_t SumMathLookupShards()
+{
+    std::lock_guard<std::mutex> lock(s_mathLookupShardMutex);
+    size_t total = 0;
+    for (MathLookupShard* shard = s_mathLookupShards; shard; shard = shard->next)
+    {
+        total += shard->count.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+#else
+static inline void CountMathLookup() {}
+static size_t SumMathLookupShards() { return 0; }
+#endif
+
+#if defined(MATHPRECALC_GENERATED_TABLES)
+//==============================================================================
+// Build-Time Generated Tables
+//==============================================================================
+// Defined in the MathPrecalculationTables.cpp the MathTableGenerator build step writes (see
+// ExportGeneratedTables); values are bit-identical to the runtime builders below.
+extern const TrigonometricData g_mathTrigonometricTable[TRIG_TABLE_SIZE];
+extern const float g_mathSqrtTable[SQRT_TABLE_SIZE];
+extern const InverseTrigonometricData g_mathInverseTrigonometricTable[INVERSE_TRIG_TABLE_SIZE];
+extern const uint8_t g_mathYuvToRgbTable[YUV_RGB_TABLE_ENTRIES];
+extern const uint8_t g_mathClampTable[CLAMP_TABLE_SIZE];
+extern const InterpolationData g_mathInterpolationTable[INTERPOLATION_TABLE_SIZE];
+extern const float g_mathTransparencyTable[TRANSPARENCY_TABLE_SIZE];
+#endif
+
+//==============================================================================
+// Table Family Contents
+//==============================================================================
+// Fixed contents of the cache families, shared by their builders and ProjectTableFamilyHeapBytes
+static const int EXPLOSION_PARTICLE_COUNTS[] = { 8, 16, 24, 32, 48, 64, 100, 128 };
+static const float CACHED_MATRIX_SCALES[] = { 0.1f, 0.25f, 0.5f, 0.75f, 1.0f, 1.25f, 1.5f, 2.0f, 4.0f, 8.0f };
+static const int CACHED_ROTATION_STEP_DEGREES = 15;
+static const wchar_t CACHED_TEXT_CHARACTERS[] = L"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789 !@#$%^&*()_+-=[]{}|;':\",./<>?";
+
+static const char* const TABLE_FAMILY_NAMES[MATH_TABLE_FAMILY_COUNT] = {
+    "Trigonometric", "SquareRoot", "InverseTrigonometric", "ColorConversion", "Interpolation",
+    "Particle", "MatrixCache", "Text", "Physics"
+};
+
+// True when a table of the configured size is bound from the build-time generated data instead of
+// being built on the heap (the generated source only holds the default sizes)
+static bool IsGeneratedTableSize(int configuredSize, int generatedSize)
+{
+#if defined(MATHPRECALC_GENERATED_TABLES)
+    return configuredSize == generatedSize;
+#else
+    (void)configuredSize;
+    (void)generatedSize;
+    return false;
+#endif
+}
+
 //==============================================================================
 // Singleton Pattern Implementation
 //==============================================================================
@@ -30,18 +162,20 @@ MathPrecalculation& MathPrecalculation::GetInstance()
 MathPrecalculation::MathPrecalculation() :
     m_bIsInitialized(false),
     m_bHasCleanedUp(false),
+    m_trigPrecisionFactor(TRIG_PRECISION_FACTOR),
+    m_sqrtPrecisionFactor(SQRT_PRECISION_FACTOR),
+    m_inverseTrigPrecisionFactor(INVERSE_TRIG_PRECISION_FACTOR),
     m_totalMemoryUsage(0),
-    m_lookupCount(0)
+    m_lookupCountBaseline(0)
 {
-    // Reserve memory for lookup tables to avoid reallocations during initialization
-    m_trigonometricTable.reserve(TRIG_TABLE_SIZE);
-    m_sqrtTable.reserve(SQRT_TABLE_SIZE);
-    m_interpolationTable.reserve(INTERPOLATION_TABLE_SIZE);
-    m_particleDirections.reserve(PARTICLE_ANGLE_DIVISIONS);
-    m_transparencyLookup.reserve(1024);
+    // No table memory is reserved here - each family allocates when it is first built
+    for (std::atomic<TableFamilyState>& state : m_tableFamilyState)
+    {
+        state.store(TableFamilyState::Unbuilt);
+    }
 
 #if defined(_DEBUG_MATHPRECALC_)
-    debug.logLevelMessage(LogLevel::LOG_INFO, L"[MathPrecalculation] Constructor called - Memory reserved for lookup tables");
+    debug.logLevelMessage(LogLevel::LOG_INFO, L"[MathPrecalculation] Constructor called");
 #endif
 }
 
@@ -62,6 +196,11 @@ MathPrecalculation::~MathPrecalculation()
 // Initialization Methods
 //==============================================================================
 bool MathPrecalculation::Initialize()
+{
+    return Initialize(MathPrecalculationConfig());
+}
+
+bool MathPrecalculation::Initialize(const MathPrecalculationConfig& config)
 {
     // Check if already initialized to prevent double initialization
     if (m_bIsInitialized.load())
@@ -72,6 +211,15 @@ bool MathPrecalculation::Initialize()
         return true;
     }
 
+    // Reject table sizes the builders and lookup index math cannot handle
+    if (config.trigonometricTableSize < 2 || config.sqrtTableSize < 2 || config.inverseTrigTableSize < 2 ||
+        config.yuvTableDivisions < 2 || config.yuvTableDivisions > 256 || config.interpolationTableSize < 2 ||
+        config.particleAngleDivisions < 1 || config.transparencyTableSize < 2)
+    {
+        debug.logLevelMessage(LogLevel::LOG_ERROR, L"[MathPrecalculation] Initialization failed - invalid table size in configuration");
+        return false;
+    }
+
     // Thread-safe initialization using mutex
     std::lock_guard<std::mutex> lock(m_tablesMutex);
 
@@ -85,52 +233,199 @@ bool MathPrecalculation::Initialize()
     debug.logLevelMessage(LogLevel::LOG_INFO, L"[MathPrecalculation] Starting initialization of lookup tables");
 #endif
 
-    try
+    // Record the configuration - families read it when they are built
+    m_config = config;
+    m_trigPrecisionFactor = static_cast<float>(config.trigonometricTableSize) / (2.0f * XM_PI);
+    m_sqrtPrecisionFactor = static_cast<float>(config.sqrtTableSize) / 1000.0f;
+    m_inverseTrigPrecisionFactor = static_cast<float>(config.inverseTrigTableSize - 1) / 2.0f;
+
+    for (std::atomic<TableFamilyState>& state : m_tableFamilyState)
+    {
+        state.store(TableFamilyState::Unbuilt);
+    }
+
+    // Build the preloaded families now; every other family is built on its first lookup. A family
+    // refused by the memory budget is not an error - its lookups compute directly.
+    for (int i = 0; i < MATH_TABLE_FAMILY_COUNT; ++i)
     {
-        // Initialize all lookup tables in order of dependency
-        InitializeTrigonometricTables();
-        InitializeInverseTrigonometricTables();
-        InitializeColorConversionTables();
-        InitializeInterpolationTables();
-        InitializeParticleData();
-        InitializeMatrixCaches();
-        InitializeTextOptimizations();
+        MathTableFamily family = static_cast<MathTableFamily>(i);
+        if ((config.preloadFamilies & MathTableFamilyBit(family)) != 0 &&
+            !BuildTableFamilyLocked(family) && m_tableFamilyState[i].load() == TableFamilyState::Failed)
+        {
+            return false;
+        }
+    }
 
-        // Calculate total memory usage for debugging
-        m_totalMemoryUsage.store(GetMemoryUsage());
+    // Calculate total memory usage for debugging
+    m_totalMemoryUsage.store(GetMemoryUsage());
 
-        // Mark as successfully initialized
-        m_bIsInitialized.store(true);
+    // Publish the configuration - lookups acquire this flag before building a family
+    m_bHasCleanedUp.store(false);
+    m_bIsInitialized.store(true, std::memory_order_release);
 
 #if defined(_DEBUG_MATHPRECALC_)
-        debug.logDebugMessage(LogLevel::LOG_INFO,
-            L"[MathPrecalculation] Initialization completed successfully - Memory usage: %zu bytes",
-            m_totalMemoryUsage.load());
+    debug.logDebugMessage(LogLevel::LOG_INFO,
+        L"[MathPrecalculation] Initialization completed successfully - Preloaded memory usage: %zu bytes",
+        m_totalMemoryUsage.load());
 
-        // Dump detailed statistics in debug mode
-        DumpTableStatistics();
+    // Dump detailed statistics in debug mode
+    DumpTableStatistics();
 #endif
 
+    return true;
+}
+
+//==============================================================================
+// Table Family Management
+//==============================================================================
+inline bool MathPrecalculation::AcquireTableFamily(MathTableFamily family) const
+{
+    // One acquire load once the family is published - the same cost as the old initialization check
+    TableFamilyState state = m_tableFamilyState[static_cast<int>(family)].load(std::memory_order_acquire);
+    if (state == TableFamilyState::Ready)
+    {
         return true;
     }
+
+    // Over-budget and failed families compute directly without ever taking the lock
+    return (state == TableFamilyState::Unbuilt) && BuildTableFamily(family);
+}
+
+bool MathPrecalculation::BuildTableFamily(MathTableFamily family) const
+{
+    // Lookups before Initialize() compute directly, as they always have
+    if (!m_bIsInitialized.load(std::memory_order_acquire))
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(m_tablesMutex);
+
+    // Cleanup() may have run while this thread waited for the lock
+    if (!m_bIsInitialized.load())
+    {
+        return false;
+    }
+
+    // The tables are the lazily built cache behind the const lookups; the singleton is never const
+    return const_cast<MathPrecalculation*>(this)->BuildTableFamilyLocked(family);
+}
+
+bool MathPrecalculation::BuildTableFamilyLocked(MathTableFamily family)
+{
+    const int familyIndex = static_cast<int>(family);
+    if (familyIndex < 0 || familyIndex >= MATH_TABLE_FAMILY_COUNT)
+    {
+        return false;
+    }
+
+    // Another thread may have built (or refused) the family while this one waited for the lock
+    TableFamilyState state = m_tableFamilyState[familyIndex].load();
+    if (state != TableFamilyState::Unbuilt)
+    {
+        return state == TableFamilyState::Ready;
+    }
+
+    std::string familyName = GetTableFamilyName(family);
+    std::wstring wFamilyName(familyName.begin(), familyName.end());
+
+    // Refuse the family if its heap tables would take the ready families over the budget
+    if (m_config.memoryBudgetBytes > 0)
+    {
+        size_t allocatedBytes = 0;
+        for (int i = 0; i < MATH_TABLE_FAMILY_COUNT; ++i)
+        {
+            if (m_tableFamilyState[i].load() == TableFamilyState::Ready)
+            {
+                size_t heapBytes = 0;
+                size_t readOnlyBytes = 0;
+                MeasureTableFamily(static_cast<MathTableFamily>(i), heapBytes, readOnlyBytes);
+                allocatedBytes += heapBytes;
+            }
+        }
+
+        const size_t projectedBytes = ProjectTableFamilyHeapBytes(family);
+        if (allocatedBytes + projectedBytes > m_config.memoryBudgetBytes)
+        {
+            m_tableFamilyState[familyIndex].store(TableFamilyState::OverBudget, std::memory_order_release);
+
+#if defined(_DEBUG_MATHPRECALC_)
+            debug.logDebugMessage(LogLevel::LOG_WARNING,
+                L"[MathPrecalculation] %ls tables need %zu bytes but only %zu of the %zu byte budget remain - computing directly",
+                wFamilyName.c_str(), projectedBytes, m_config.memoryBudgetBytes - std::min(allocatedBytes, m_config.memoryBudgetBytes),
+                m_config.memoryBudgetBytes);
+#endif
+            return false;
+        }
+    }
+
+    try
+    {
+        switch (family)
+        {
+        case MathTableFamily::Trigonometric:        InitializeTrigonometricTables(); break;
+        case MathTableFamily::SquareRoot:           InitializeSqrtTables(); break;
+        case MathTableFamily::InverseTrigonometric: InitializeInverseTrigonometricTables(); break;
+        case MathTableFamily::ColorConversion:      InitializeColorConversionTables(); break;
+        case MathTableFamily::Interpolation:        InitializeInterpolationTables(); break;
+        case MathTableFamily::Particle:             InitializeParticleData(); break;
+        case MathTableFamily::MatrixCache:          InitializeMatrixCaches(); break;
+        case MathTableFamily::Text:                 InitializeTextOptimizations(); break;
+        case MathTableFamily::Physics:              InitializePhysicsPrecalculations(); break;
+        default:                                    return false;
+        }
+    }
     catch (const std::exception& e)
     {
         // Convert exception message to wide string for logging
         std::string errorMsg = e.what();
         std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
 
+        m_tableFamilyState[familyIndex].store(TableFamilyState::Failed, std::memory_order_release);
         debug.logLevelMessage(LogLevel::LOG_CRITICAL,
-            L"[MathPrecalculation] Initialization failed with exception: " + wErrorMsg);
+            L"[MathPrecalculation] Building " + wFamilyName + L" tables failed with exception: " + wErrorMsg);
 
         return false;
     }
     catch (...)
     {
+        m_tableFamilyState[familyIndex].store(TableFamilyState::Failed, std::memory_order_release);
         debug.logLevelMessage(LogLevel::LOG_CRITICAL,
-            L"[MathPrecalculation] Initialization failed with unknown exception");
+            L"[MathPrecalculation] Building " + wFamilyName + L" tables failed with unknown exception");
 
         return false;
     }
+
+    // Publish the family - lookups acquire its state before reading the tables
+    m_tableFamilyState[familyIndex].store(TableFamilyState::Ready, std::memory_order_release);
+    m_totalMemoryUsage.store(GetMemoryUsage());
+
+#if defined(_DEBUG_MATHPRECALC_)
+    debug.logDebugMessage(LogLevel::LOG_INFO,
+        L"[MathPrecalculation] %ls tables ready - Total memory usage: %zu bytes",
+        wFamilyName.c_str(), m_totalMemoryUsage.load());
+#endif
+
+    return true;
+}
+
+bool MathPrecalculation::PreloadTableFamily(MathTableFamily family)
+{
+    const int familyIndex = static_cast<int>(family);
+    return familyIndex >= 0 && familyIndex < MATH_TABLE_FAMILY_COUNT && AcquireTableFamily(family);
+}
+
+bool MathPrecalculation::IsTableFamilyReady(MathTableFamily family) const
+{
+    const int familyIndex = static_cast<int>(family);
+    return familyIndex >= 0 && familyIndex < MATH_TABLE_FAMILY_COUNT &&
+        m_tableFamilyState[familyIndex].load(std::memory_order_acquire) == TableFamilyState::Ready;
+}
+
+const char* MathPrecalculation::GetTableFamilyName(MathTableFamily family)
+{
+    const int familyIndex = static_cast<int>(family);
+    return (familyIndex >= 0 && familyIndex < MATH_TABLE_FAMILY_COUNT) ? TABLE_FAMILY_NAMES[familyIndex] : "Unknown";
 }
 
 void MathPrecalculation::InitializeTrigonometricTables()
@@ -139,18 +434,29 @@ void MathPrecalculation::InitializeTrigonometricTables()
     debug.logLevelMessage(LogLevel::LOG_INFO, L"[MathPrecalculation] Initializing trigonometric lookup tables");
 #endif
 
+    const int tableSize = m_config.trigonometricTableSize;
+
+#if defined(MATHPRECALC_GENERATED_TABLES)
+    // Generated at build time - bind the read-only data instead of computing it
+    if (IsGeneratedTableSize(tableSize, TRIG_TABLE_SIZE))
+    {
+        m_trigonometricTable.Bind(g_mathTrigonometricTable, TRIG_TABLE_SIZE);
+        return;
+    }
+#endif
+
     // Clear and resize the trigonometric table
-    m_trigonometricTable.clear();
-    m_trigonometricTable.resize(TRIG_TABLE_SIZE);
+    m_trigonometricStorage.clear();
+    m_trigonometricStorage.resize(tableSize);
 
     // Precalculate trigonometric values for the entire table
-    for (int i = 0; i < TRIG_TABLE_SIZE; ++i)
+    for (int i = 0; i < tableSize; ++i)
     {
         // Calculate angle for this table entry
-        float angle = (static_cast<float>(i) / static_cast<float>(TRIG_TABLE_SIZE)) * 2.0f * XM_PI;
+        float angle = (static_cast<float>(i) / static_cast<float>(tableSize)) * 2.0f * XM_PI;
 
         // Calculate and store all trigonometric values
-        TrigonometricData& data = m_trigonometricTable[i];
+        TrigonometricData& data = m_trigonometricStorage[i];
         data.sine = std::sin(angle);
         data.cosine = std::cos(angle);
         data.tangent = std::tan(angle);
@@ -167,21 +473,46 @@ void MathPrecalculation::InitializeTrigonometricTables()
         }
     }
 
-    // Initialize square root lookup table
-    m_sqrtTable.clear();
-    m_sqrtTable.resize(SQRT_TABLE_SIZE);
+    m_trigonometricTable.Bind(m_trigonometricStorage);
+
+#if defined(_DEBUG_MATHPRECALC_)
+    debug.logDebugMessage(LogLevel::LOG_INFO,
+        L"[MathPrecalculation] Trigonometric tables initialized - Sin/Cos entries: %d", tableSize);
+#endif
+}
+
+void MathPrecalculation::InitializeSqrtTables()
+{
+#if defined(_DEBUG_MATHPRECALC_)
+    debug.logLevelMessage(LogLevel::LOG_INFO, L"[MathPrecalculation] Initializing square root lookup table");
+#endif
+
+    const int tableSize = m_config.sqrtTableSize;
+
+#if defined(MATHPRECALC_GENERATED_TABLES)
+    // Generated at build time - bind the read-only data instead of computing it
+    if (IsGeneratedTableSize(tableSize, SQRT_TABLE_SIZE))
+    {
+        m_sqrtTable.Bind(g_mathSqrtTable, SQRT_TABLE_SIZE);
+        return;
+    }
+#endif
+
+    m_sqrtStorage.clear();
+    m_sqrtStorage.resize(tableSize);
 
-    for (int i = 0; i < SQRT_TABLE_SIZE; ++i)
+    for (int i = 0; i < tableSize; ++i)
     {
         // Calculate value for this table entry (range 0 to 1000)
-        float value = static_cast<float>(i) / SQRT_PRECISION_FACTOR;
-        m_sqrtTable[i] = std::sqrt(value);
+        float value = static_cast<float>(i) / m_sqrtPrecisionFactor;
+        m_sqrtStorage[i] = std::sqrt(value);
     }
 
+    m_sqrtTable.Bind(m_sqrtStorage);
+
 #if defined(_DEBUG_MATHPRECALC_)
     debug.logDebugMessage(LogLevel::LOG_INFO,
-        L"[MathPrecalculation] Trigonometric tables initialized - Sin/Cos entries: %d, Sqrt entries: %d",
-        TRIG_TABLE_SIZE, SQRT_TABLE_SIZE);
+        L"[MathPrecalculation] Square root table initialized - Entries: %d", tableSize);
 #endif
 }
 
@@ -191,21 +522,32 @@ void MathPrecalculation::InitializeInverseTrigonometricTables()
     debug.logLevelMessage(LogLevel::LOG_INFO, L"[MathPrecalculation] Initializing inverse trigonometric lookup tables");
 #endif
 
+    const int tableSize = m_config.inverseTrigTableSize;
+
+#if defined(MATHPRECALC_GENERATED_TABLES)
+    // Generated at build time - bind the read-only data instead of computing it
+    if (IsGeneratedTableSize(tableSize, INVERSE_TRIG_TABLE_SIZE))
+    {
+        m_inverseTrigonometricTable.Bind(g_mathInverseTrigonometricTable, INVERSE_TRIG_TABLE_SIZE);
+        return;
+    }
+#endif
+
     // Clear and resize the inverse trigonometric table
-    m_inverseTrigonometricTable.clear();
-    m_inverseTrigonometricTable.resize(INVERSE_TRIG_TABLE_SIZE);
+    m_inverseTrigonometricStorage.clear();
+    m_inverseTrigonometricStorage.resize(tableSize);
 
     // Precalculate inverse trigonometric values for the entire table
-    for (int i = 0; i < INVERSE_TRIG_TABLE_SIZE; ++i)
+    for (int i = 0; i < tableSize; ++i)
     {
         // Calculate input value for this table entry (domain [-1, 1])
-        float inputValue = -1.0f + (static_cast<float>(i) / static_cast<float>(INVERSE_TRIG_TABLE_SIZE - 1)) * 2.0f;
+        float inputValue = -1.0f + (static_cast<float>(i) / static_cast<float>(tableSize - 1)) * 2.0f;
 
         // Ensure input value is exactly within valid domain to prevent numerical errors
         inputValue = std::clamp(inputValue, -1.0f, 1.0f);
 
         // Calculate and store all inverse trigonometric values
-        InverseTrigonometricData& data = m_inverseTrigonometricTable[i];
+        InverseTrigonometricData& data = m_inverseTrigonometricStorage[i];
         data.inputValue = inputValue;
 
         // Calculate arcsine (domain [-1, 1], range [-π/2, π/2])
@@ -220,10 +562,12 @@ void MathPrecalculation::InitializeInverseTrigonometricTables()
         data.arcTangent = std::atan(extendedInput);
     }
 
+    m_inverseTrigonometricTable.Bind(m_inverseTrigonometricStorage);
+
 #if defined(_DEBUG_MATHPRECALC_)
     debug.logDebugMessage(LogLevel::LOG_INFO,
         L"[MathPrecalculation] Inverse trigonometric tables initialized - Entries: %d",
-        INVERSE_TRIG_TABLE_SIZE);
+        tableSize);
 #endif
 }
 
@@ -235,51 +579,63 @@ void MathPrecalculation::InitializeColorConversionTables()
 
     // Initialize YUV to RGB conversion lookup table with proper size calculation
     // Full YUV lookup would be 256^3 * 3 = 48MB, so we use a more efficient approach
-    const int yuvTableSize = 64;  // Reduced size for memory efficiency (64^3 * 3 = 768KB)
+    const int yuvTableSize = m_config.yuvTableDivisions;  // Reduced size for memory efficiency (64^3 * 3 = 768KB)
     const int yuvTableEntries = yuvTableSize * yuvTableSize * yuvTableSize * 3;
 
-    // Clear and resize the YUV to RGB lookup table
-    m_yuvToRgbLookup.clear();
-    m_yuvToRgbLookup.resize(yuvTableEntries);
+#if defined(MATHPRECALC_GENERATED_TABLES)
+    if (IsGeneratedTableSize(yuvTableSize, YUV_RGB_TABLE_DIVISIONS))
+    {
+        // Generated at build time - bind the read-only data instead of computing it
+        m_yuvToRgbLookup.Bind(g_mathYuvToRgbTable, YUV_RGB_TABLE_ENTRIES);
+    }
+    else
+#endif
+    {
+        // Clear and resize the YUV to RGB lookup table
+        m_yuvToRgbStorage.clear();
+        m_yuvToRgbStorage.resize(yuvTableEntries);
 
 #if defined(_DEBUG_MATHPRECALC_)
-    debug.logDebugMessage(LogLevel::LOG_INFO,
-        L"[MathPrecalculation] YUV lookup table allocated - Size: %d entries (%d bytes)",
-        yuvTableEntries, yuvTableEntries);
+        debug.logDebugMessage(LogLevel::LOG_INFO,
+            L"[MathPrecalculation] YUV lookup table allocated - Size: %d entries (%d bytes)",
+            yuvTableEntries, yuvTableEntries);
 #endif
 
-    // Initialize YUV to RGB conversion lookup table with reduced precision for memory efficiency
-    for (int y = 0; y < yuvTableSize; ++y)
-    {
-        for (int u = 0; u < yuvTableSize; ++u)
+        // Initialize YUV to RGB conversion lookup table with reduced precision for memory efficiency
+        for (int y = 0; y < yuvTableSize; ++y)
         {
-            for (int v = 0; v < yuvTableSize; ++v)
+            for (int u = 0; u < yuvTableSize; ++u)
             {
-                // Scale values to full range [0, 255] for calculation
-                int yFull = (y * 255) / (yuvTableSize - 1);
-                int uFull = (u * 255) / (yuvTableSize - 1);
-                int vFull = (v * 255) / (yuvTableSize - 1);
-
-                // Calculate RGB values using standard YUV to RGB conversion formulas
-                // Y'UV to RGB conversion using BT.601 standard
-                int r = static_cast<int>(yFull + 1.402f * (vFull - 128));
-                int g = static_cast<int>(yFull - 0.344f * (uFull - 128) - 0.714f * (vFull - 128));
-                int b = static_cast<int>(yFull + 1.772f * (uFull - 128));
-
-                // Calculate index into the lookup table
-                int index = (y * yuvTableSize + u) * yuvTableSize + v;
-                int baseIndex = index * 3;
-
-                // Ensure we don't exceed array bounds
-                if (baseIndex + 2 < static_cast<int>(m_yuvToRgbLookup.size()))
+                for (int v = 0; v < yuvTableSize; ++v)
                 {
-                    // Store clamped RGB values in the lookup table
-                    m_yuvToRgbLookup[baseIndex + 0] = static_cast<uint8_t>(std::clamp(r, 0, 255));
-                    m_yuvToRgbLookup[baseIndex + 1] = static_cast<uint8_t>(std::clamp(g, 0, 255));
-                    m_yuvToRgbLookup[baseIndex + 2] = static_cast<uint8_t>(std::clamp(b, 0, 255));
+                    // Scale values to full range [0, 255] for calculation
+                    int yFull = (y * 255) / (yuvTableSize - 1);
+                    int uFull = (u * 255) / (yuvTableSize - 1);
+                    int vFull = (v * 255) / (yuvTableSize - 1);
+
+                    // Calculate RGB values using standard YUV to RGB conversion formulas
+                    // Y'UV to RGB conversion using BT.601 standard
+                    int r = static_cast<int>(yFull + 1.402f * (vFull - 128));
+                    int g = static_cast<int>(yFull - 0.344f * (uFull - 128) - 0.714f * (vFull - 128));
+                    int b = static_cast<int>(yFull + 1.772f * (uFull - 128));
+
+                    // Calculate index into the lookup table
+                    int index = (y * yuvTableSize + u) * yuvTableSize + v;
+                    int baseIndex = index * 3;
+
+                    // Ensure we don't exceed array bounds
+                    if (baseIndex + 2 < static_cast<int>(m_yuvToRgbStorage.size()))
+                    {
+                        // Store clamped RGB values in the lookup table
+                        m_yuvToRgbStorage[baseIndex + 0] = static_cast<uint8_t>(std::clamp(r, 0, 255));
+                        m_yuvToRgbStorage[baseIndex + 1] = static_cast<uint8_t>(std::clamp(g, 0, 255));
+                        m_yuvToRgbStorage[baseIndex + 2] = static_cast<uint8_t>(std::clamp(b, 0, 255));
+                    }
                 }
             }
         }
+
+        m_yuvToRgbLookup.Bind(m_yuvToRgbStorage);
     }
 
     // Initialize color conversion coefficients table
@@ -312,16 +668,23 @@ void MathPrecalculation::InitializeColorConversionTables()
     }
 
     // Initialize extended clamp table for values beyond normal range [-256, 255]
-    for (int i = 0; i < 512; ++i)
+#if defined(MATHPRECALC_GENERATED_TABLES)
+    m_clampTable.Bind(g_mathClampTable, CLAMP_TABLE_SIZE);
+#else
+    m_clampStorage.resize(CLAMP_TABLE_SIZE);
+    for (int i = 0; i < CLAMP_TABLE_SIZE; ++i)
     {
         int clampedValue = i - 256;  // Range from -256 to 255
-        m_clampTable[i] = static_cast<uint8_t>(std::clamp(clampedValue, 0, 255));
+        m_clampStorage[i] = static_cast<uint8_t>(std::clamp(clampedValue, 0, 255));
     }
 
+    m_clampTable.Bind(m_clampStorage);
+#endif
+
 #if defined(_DEBUG_MATHPRECALC_)
     debug.logDebugMessage(LogLevel::LOG_INFO,
-        L"[MathPrecalculation] Color conversion tables initialized - YUV table: %d entries, Conversion data: %d entries, Clamp table: 512 entries",
-        yuvTableEntries, COLOR_CONVERSION_TABLE_SIZE);
+        L"[MathPrecalculation] Color conversion tables initialized - YUV table: %d entries, Conversion data: %d entries, Clamp table: %d entries",
+        yuvTableEntries, COLOR_CONVERSION_TABLE_SIZE, CLAMP_TABLE_SIZE);
 #endif
 }
 
@@ -331,17 +694,28 @@ void MathPrecalculation::InitializeInterpolationTables()
     debug.logLevelMessage(LogLevel::LOG_INFO, L"[MathPrecalculation] Initializing interpolation coefficient tables");
 #endif
 
+    const int tableSize = m_config.interpolationTableSize;
+
+#if defined(MATHPRECALC_GENERATED_TABLES)
+    // Generated at build time - bind the read-only data instead of computing it
+    if (IsGeneratedTableSize(tableSize, INTERPOLATION_TABLE_SIZE))
+    {
+        m_interpolationTable.Bind(g_mathInterpolationTable, INTERPOLATION_TABLE_SIZE);
+        return;
+    }
+#endif
+
     // Clear and resize interpolation table
-    m_interpolationTable.clear();
-    m_interpolationTable.resize(INTERPOLATION_TABLE_SIZE);
+    m_interpolationStorage.clear();
+    m_interpolationStorage.resize(tableSize);
 
     // Precalculate interpolation coefficients for smooth animations
-    for (int i = 0; i < INTERPOLATION_TABLE_SIZE; ++i)
+    for (int i = 0; i < tableSize; ++i)
     {
         // Normalize t value to range [0, 1]
-        float t = static_cast<float>(i) / static_cast<float>(INTERPOLATION_TABLE_SIZE - 1);
+        float t = static_cast<float>(i) / static_cast<float>(tableSize - 1);
 
-        InterpolationData& data = m_interpolationTable[i];
+        InterpolationData& data = m_interpolationStorage[i];
 
         // Linear interpolation coefficient (simply t)
         data.linear = t;
@@ -370,10 +744,12 @@ void MathPrecalculation::InitializeInterpolationTables()
         }
     }
 
+    m_interpolationTable.Bind(m_interpolationStorage);
+
 #if defined(_DEBUG_MATHPRECALC_)
     debug.logDebugMessage(LogLevel::LOG_INFO,
         L"[MathPrecalculation] Interpolation tables initialized - Entries: %d",
-        INTERPOLATION_TABLE_SIZE);
+        tableSize);
 #endif
 }
 
@@ -383,15 +759,17 @@ void MathPrecalculation::InitializeParticleData()
     debug.logLevelMessage(LogLevel::LOG_INFO, L"[MathPrecalculation] Initializing particle system precalculations");
 #endif
 
+    const int angleDivisions = m_config.particleAngleDivisions;
+
     // Clear and resize particle directions table
     m_particleDirections.clear();
-    m_particleDirections.resize(PARTICLE_ANGLE_DIVISIONS);
+    m_particleDirections.resize(angleDivisions);
 
     // Precalculate particle directions for explosion effects
-    for (int i = 0; i < PARTICLE_ANGLE_DIVISIONS; ++i)
+    for (int i = 0; i < angleDivisions; ++i)
     {
         // Calculate angle for this particle direction
-        float angleDegrees = static_cast<float>(i);
+        float angleDegrees = static_cast<float>(i) * 360.0f / static_cast<float>(angleDivisions);
         float angleRadians = angleDegrees * XM_PI / 180.0f;
 
         ParticleData& data = m_particleDirections[i];
@@ -409,9 +787,7 @@ void MathPrecalculation::InitializeParticleData()
     }
 
     // Precalculate common explosion patterns for different particle counts
-    std::vector<int> commonParticleCounts = { 8, 16, 24, 32, 48, 64, 100, 128 };
-
-    for (int particleCount : commonParticleCounts)
+    for (int particleCount : EXPLOSION_PARTICLE_COUNTS)
     {
         std::vector<XMFLOAT2> explosionPattern;
         explosionPattern.reserve(particleCount);
@@ -439,7 +815,7 @@ void MathPrecalculation::InitializeParticleData()
 #if defined(_DEBUG_MATHPRECALC_)
     debug.logDebugMessage(LogLevel::LOG_INFO,
         L"[MathPrecalculation] Particle data initialized - Directions: %d, Patterns: %zu",
-        PARTICLE_ANGLE_DIVISIONS, m_explosionPatterns.size());
+        angleDivisions, m_explosionPatterns.size());
 #endif
 }
 
@@ -450,9 +826,7 @@ void MathPrecalculation::InitializeMatrixCaches()
 #endif
 
     // Precalculate common scale matrices
-    std::vector<float> commonScales = { 0.1f, 0.25f, 0.5f, 0.75f, 1.0f, 1.25f, 1.5f, 2.0f, 4.0f, 8.0f };
-
-    for (float scale : commonScales)
+    for (float scale : CACHED_MATRIX_SCALES)
     {
         // Create hash key for this scale (multiply by 1000 and cast to int for precision)
         int scaleKey = static_cast<int>(scale * 1000.0f);
@@ -463,7 +837,7 @@ void MathPrecalculation::InitializeMatrixCaches()
     }
 
     // Precalculate common rotation matrices (every 15 degrees)
-    for (int degrees = 0; degrees < 360; degrees += 15)
+    for (int degrees = 0; degrees < 360; degrees += CACHED_ROTATION_STEP_DEGREES)
     {
         float angleRadians = static_cast<float>(degrees) * XM_PI / 180.0f;
 
@@ -493,10 +867,9 @@ void MathPrecalculation::InitializeTextOptimizations()
 
     // Precalculate character widths for common ASCII characters
     // This would typically be done with font metrics, but for now we use estimates
-    const std::wstring commonChars = L"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789 !@#$%^&*()_+-=[]{}|;':\",./<>?";
-
-    for (wchar_t ch : commonChars)
+    for (size_t i = 0; CACHED_TEXT_CHARACTERS[i] != L'\0'; ++i)
     {
+        const wchar_t ch = CACHED_TEXT_CHARACTERS[i];
         float estimatedWidth = 0.0f;
 
         // Estimate character width based on character type
@@ -531,18 +904,31 @@ void MathPrecalculation::InitializeTextOptimizations()
     }
 
     // Precalculate transparency lookup table for text fade effects
-    m_transparencyLookup.clear();
-    m_transparencyLookup.resize(1024);
+    const int transparencyTableSize = m_config.transparencyTableSize;
 
-    for (int i = 0; i < 1024; ++i)
+#if defined(MATHPRECALC_GENERATED_TABLES)
+    if (IsGeneratedTableSize(transparencyTableSize, TRANSPARENCY_TABLE_SIZE))
     {
-        // Normalize value to range [0, 1]
-        float normalizedValue = static_cast<float>(i) / 1023.0f;
+        m_transparencyLookup.Bind(g_mathTransparencyTable, TRANSPARENCY_TABLE_SIZE);
+    }
+    else
+#endif
+    {
+        m_transparencyStorage.clear();
+        m_transparencyStorage.resize(transparencyTableSize);
 
-        // Calculate smooth fade curve (sigmoid-like)
-        float transparency = 1.0f / (1.0f + std::exp(-6.0f * (normalizedValue - 0.5f)));
+        for (int i = 0; i < transparencyTableSize; ++i)
+        {
+            // Normalize value to range [0, 1]
+            float normalizedValue = static_cast<float>(i) / static_cast<float>(transparencyTableSize - 1);
+
+            // Calculate smooth fade curve (sigmoid-like)
+            float transparency = 1.0f / (1.0f + std::exp(-6.0f * (normalizedValue - 0.5f)));
+
+            m_transparencyStorage[i] = transparency;
+        }
 
-        m_transparencyLookup[i] = transparency;
+        m_transparencyLookup.Bind(m_transparencyStorage);
     }
 
 #if defined(_DEBUG_MATHPRECALC_)
@@ -557,11 +943,11 @@ void MathPrecalculation::InitializeTextOptimizations()
 //==============================================================================
 float MathPrecalculation::FastSin(float angle) const
 {
-    // Ensure the system is initialized before attempting lookup
-    if (!m_bIsInitialized.load())
+    // Ensure the trigonometric tables are built before attempting lookup
+    if (!AcquireTableFamily(MathTableFamily::Trigonometric))
     {
 #if defined(_DEBUG_MATHPRECALC_)
-        debug.logLevelMessage(LogLevel::LOG_WARNING, L"[MathPrecalculation] FastSin called before initialization");
+        debug.logLevelMessage(LogLevel::LOG_WARNING, L"[MathPrecalculation] FastSin called before its tables were ready");
 #endif
         return std::sin(angle);  // Fallback to standard sine
     }
@@ -573,13 +959,13 @@ float MathPrecalculation::FastSin(float angle) const
     int index = AngleToIndex(normalizedAngle);
 
     // Ensure index is within bounds
-    if (index >= TRIG_TABLE_SIZE)
+    if (index >= m_config.trigonometricTableSize)
     {
-        index = TRIG_TABLE_SIZE - 1;
+        index = m_config.trigonometricTableSize - 1;
     }
 
     // Increment lookup counter for statistics
-    m_lookupCount.fetch_add(1);
+    CountMathLookup();
 
     // Return precalculated sine value
     return m_trigonometricTable[index].sine;
@@ -587,11 +973,11 @@ float MathPrecalculation::FastSin(float angle) const
 
 float MathPrecalculation::FastCos(float angle) const
 {
-    // Ensure the system is initialized before attempting lookup
-    if (!m_bIsInitialized.load())
+    // Ensure the trigonometric tables are built before attempting lookup
+    if (!AcquireTableFamily(MathTableFamily::Trigonometric))
     {
 #if defined(_DEBUG_MATHPRECALC_)
-        debug.logLevelMessage(LogLevel::LOG_WARNING, L"[MathPrecalculation] FastCos called before initialization");
+        debug.logLevelMessage(LogLevel::LOG_WARNING, L"[MathPrecalculation] FastCos called before its tables were ready");
 #endif
         return std::cos(angle);  // Fallback to standard cosine
     }
@@ -603,13 +989,13 @@ float MathPrecalculation::FastCos(float angle) const
     int index = AngleToIndex(normalizedAngle);
 
     // Ensure index is within bounds
-    if (index >= TRIG_TABLE_SIZE)
+    if (index >= m_config.trigonometricTableSize)
     {
-        index = TRIG_TABLE_SIZE - 1;
+        index = m_config.trigonometricTableSize - 1;
     }
 
     // Increment lookup counter for statistics
-    m_lookupCount.fetch_add(1);
+    CountMathLookup();
 
     // Return precalculated cosine value
     return m_trigonometricTable[index].cosine;
@@ -617,11 +1003,11 @@ float MathPrecalculation::FastCos(float angle) const
 
 float MathPrecalculation::FastTan(float angle) const
 {
-    // Ensure the system is initialized before attempting lookup
-    if (!m_bIsInitialized.load())
+    // Ensure the trigonometric tables are built before attempting lookup
+    if (!AcquireTableFamily(MathTableFamily::Trigonometric))
     {
 #if defined(_DEBUG_MATHPRECALC_)
-        debug.logLevelMessage(LogLevel::LOG_WARNING, L"[MathPrecalculation] FastTan called before initialization");
+        debug.logLevelMessage(LogLevel::LOG_WARNING, L"[MathPrecalculation] FastTan called before its tables were ready");
 #endif
         return std::tan(angle);  // Fallback to standard tangent
     }
@@ -633,13 +1019,13 @@ float MathPrecalculation::FastTan(float angle) const
     int index = AngleToIndex(normalizedAngle);
 
     // Ensure index is within bounds
-    if (index >= TRIG_TABLE_SIZE)
+    if (index >= m_config.trigonometricTableSize)
     {
-        index = TRIG_TABLE_SIZE - 1;
+        index = m_config.trigonometricTableSize - 1;
     }
 
     // Increment lookup counter for statistics
-    m_lookupCount.fetch_add(1);
+    CountMathLookup();
 
     // Return precalculated tangent value
     return m_trigonometricTable[index].tangent;
@@ -647,11 +1033,11 @@ float MathPrecalculation::FastTan(float angle) const
 
 float MathPrecalculation::FastCot(float angle) const
 {
-    // Ensure the system is initialized before attempting lookup
-    if (!m_bIsInitialized.load())
+    // Ensure the trigonometric tables are built before attempting lookup
+    if (!AcquireTableFamily(MathTableFamily::Trigonometric))
     {
 #if defined(_DEBUG_MATHPRECALC_)
-        debug.logLevelMessage(LogLevel::LOG_WARNING, L"[MathPrecalculation] FastCot called before initialization");
+        debug.logLevelMessage(LogLevel::LOG_WARNING, L"[MathPrecalculation] FastCot called before its tables were ready");
 #endif
         return 1.0f / std::tan(angle);  // Fallback to standard cotangent
     }
@@ -663,13 +1049,13 @@ float MathPrecalculation::FastCot(float angle) const
     int index = AngleToIndex(normalizedAngle);
 
     // Ensure index is within bounds
-    if (index >= TRIG_TABLE_SIZE)
+    if (index >= m_config.trigonometricTableSize)
     {
-        index = TRIG_TABLE_SIZE - 1;
+        index = m_config.trigonometricTableSize - 1;
     }
 
     // Increment lookup counter for statistics
-    m_lookupCount.fetch_add(1);
+    CountMathLookup();
 
     // Return precalculated cotangent value
     return m_trigonometricTable[index].cotangent;
@@ -677,11 +1063,11 @@ float MathPrecalculation::FastCot(float angle) const
 
 float MathPrecalculation::FastASin(float value) const
 {
-    // Ensure the system is initialized before attempting lookup
-    if (!m_bIsInitialized.load())
+    // Ensure the inverse trigonometric tables are built before attempting lookup
+    if (!AcquireTableFamily(MathTableFamily::InverseTrigonometric))
     {
 #if defined(_DEBUG_MATHPRECALC_)
-        debug.logLevelMessage(LogLevel::LOG_WARNING, L"[MathPrecalculation] FastASin called before initialization");
+        debug.logLevelMessage(LogLevel::LOG_WARNING, L"[MathPrecalculation] FastASin called before its tables were ready");
 #endif
         return std::asin(std::clamp(value, -1.0f, 1.0f));  // Fallback to standard arcsine with clamping
     }
@@ -690,13 +1076,13 @@ float MathPrecalculation::FastASin(float value) const
     float clampedValue = std::clamp(value, -1.0f, 1.0f);
 
     // Convert input value to table index
-    int index = static_cast<int>((clampedValue + 1.0f) * INVERSE_TRIG_PRECISION_FACTOR);
+    int index = static_cast<int>((clampedValue + 1.0f) * m_inverseTrigPrecisionFactor);
 
     // Ensure index is within bounds
-    index = std::clamp(index, 0, INVERSE_TRIG_TABLE_SIZE - 1);
+    index = std::clamp(index, 0, m_config.inverseTrigTableSize - 1);
 
     // Increment lookup counter for statistics
-    m_lookupCount.fetch_add(1);
+    CountMathLookup();
 
     // Return precalculated arcsine value
     return m_inverseTrigonometricTable[index].arcSine;
@@ -704,11 +1090,11 @@ float MathPrecalculation::FastASin(float value) const
 
 float MathPrecalculation::FastACos(float value) const
 {
-    // Ensure the system is initialized before attempting lookup
-    if (!m_bIsInitialized.load())
+    // Ensure the inverse trigonometric tables are built before attempting lookup
+    if (!AcquireTableFamily(MathTableFamily::InverseTrigonometric))
     {
 #if defined(_DEBUG_MATHPRECALC_)
-        debug.logLevelMessage(LogLevel::LOG_WARNING, L"[MathPrecalculation] FastACos called before initialization");
+        debug.logLevelMessage(LogLevel::LOG_WARNING, L"[MathPrecalculation] FastACos called before its tables were ready");
 #endif
         return std::acos(std::clamp(value, -1.0f, 1.0f));  // Fallback to standard arccosine with clamping
     }
@@ -717,13 +1103,13 @@ float MathPrecalculation::FastACos(float value) const
     float clampedValue = std::clamp(value, -1.0f, 1.0f);
 
     // Convert input value to table index
-    int index = static_cast<int>((clampedValue + 1.0f) * INVERSE_TRIG_PRECISION_FACTOR);
+    int index = static_cast<int>((clampedValue + 1.0f) * m_inverseTrigPrecisionFactor);
 
     // Ensure index is within bounds
-    index = std::clamp(index, 0, INVERSE_TRIG_TABLE_SIZE - 1);
+    index = std::clamp(index, 0, m_config.inverseTrigTableSize - 1);
 
     // Increment lookup counter for statistics
-    m_lookupCount.fetch_add(1);
+    CountMathLookup();
 
     // Return precalculated arccosine value
     return m_inverseTrigonometricTable[index].arcCosine;
@@ -731,11 +1117,11 @@ float MathPrecalculation::FastACos(float value) const
 
 float MathPrecalculation::FastATan(float value) const
 {
-    // Ensure the system is initialized before attempting lookup
-    if (!m_bIsInitialized.load())
+    // Ensure the inverse trigonometric tables are built before attempting lookup
+    if (!AcquireTableFamily(MathTableFamily::InverseTrigonometric))
     {
 #if defined(_DEBUG_MATHPRECALC_)
-        debug.logLevelMessage(LogLevel::LOG_WARNING, L"[MathPrecalculation] FastATan called before initialization");
+        debug.logLevelMessage(LogLevel::LOG_WARNING, L"[MathPrecalculation] FastATan called before its tables were ready");
 #endif
         return std::atan(value);  // Fallback to standard arctangent
     }
@@ -755,13 +1141,13 @@ float MathPrecalculation::FastATan(float value) const
     normalizedValue = std::clamp(normalizedValue, -1.0f, 1.0f);
 
     // Convert normalized value to table index
-    int index = static_cast<int>((normalizedValue + 1.0f) * INVERSE_TRIG_PRECISION_FACTOR);
+    int index = static_cast<int>((normalizedValue + 1.0f) * m_inverseTrigPrecisionFactor);
 
     // Ensure index is within bounds
-    index = std::clamp(index, 0, INVERSE_TRIG_TABLE_SIZE - 1);
+    index = std::clamp(index, 0, m_config.inverseTrigTableSize - 1);
 
     // Increment lookup counter for statistics
-    m_lookupCount.fetch_add(1);
+    CountMathLookup();
 
     // Return precalculated arctangent value
     return m_inverseTrigonometricTable[index].arcTangent;
@@ -828,11 +1214,11 @@ float MathPrecalculation::FastATan2(float y, float x) const
 
 void MathPrecalculation::FastSinCos(float angle, float& outSin, float& outCos) const
 {
-    // Ensure the system is initialized before attempting lookup
-    if (!m_bIsInitialized.load())
+    // Ensure the trigonometric tables are built before attempting lookup
+    if (!AcquireTableFamily(MathTableFamily::Trigonometric))
     {
 #if defined(_DEBUG_MATHPRECALC_)
-        debug.logLevelMessage(LogLevel::LOG_WARNING, L"[MathPrecalculation] FastSinCos called before initialization");
+        debug.logLevelMessage(LogLevel::LOG_WARNING, L"[MathPrecalculation] FastSinCos called before its tables were ready");
 #endif
         outSin = std::sin(angle);
         outCos = std::cos(angle);
@@ -846,13 +1232,13 @@ void MathPrecalculation::FastSinCos(float angle, float& outSin, float& outCos) c
     int index = AngleToIndex(normalizedAngle);
 
     // Ensure index is within bounds
-    if (index >= TRIG_TABLE_SIZE)
+    if (index >= m_config.trigonometricTableSize)
     {
-        index = TRIG_TABLE_SIZE - 1;
+        index = m_config.trigonometricTableSize - 1;
     }
 
     // Increment lookup counter for statistics (single lookup for both values)
-    m_lookupCount.fetch_add(1);
+    CountMathLookup();
 
     // Return both precalculated values efficiently
     const TrigonometricData& data = m_trigonometricTable[index];
@@ -862,11 +1248,11 @@ void MathPrecalculation::FastSinCos(float angle, float& outSin, float& outCos) c
 
 float MathPrecalculation::FastSqrt(float value) const
 {
-    // Ensure the system is initialized before attempting lookup
-    if (!m_bIsInitialized.load())
+    // Ensure the square root tables are built before attempting lookup
+    if (!AcquireTableFamily(MathTableFamily::SquareRoot))
     {
 #if defined(_DEBUG_MATHPRECALC_)
-        debug.logLevelMessage(LogLevel::LOG_WARNING, L"[MathPrecalculation] FastSqrt called before initialization");
+        debug.logLevelMessage(LogLevel::LOG_WARNING, L"[MathPrecalculation] FastSqrt called before its tables were ready");
 #endif
         return std::sqrt(value);  // Fallback to standard square root
     }
@@ -884,78 +1270,483 @@ float MathPrecalculation::FastSqrt(float value) const
     }
 
     // Convert value to table index
-    int index = static_cast<int>(value * SQRT_PRECISION_FACTOR);
+    int index = static_cast<int>(value * m_sqrtPrecisionFactor);
 
     // Ensure index is within bounds
-    if (index >= SQRT_TABLE_SIZE)
+    if (index >= m_config.sqrtTableSize)
     {
-        index = SQRT_TABLE_SIZE - 1;
+        index = m_config.sqrtTableSize - 1;
     }
 
     // Increment lookup counter for statistics
-    m_lookupCount.fetch_add(1);
+    CountMathLookup();
 
     // Return precalculated square root value
     return m_sqrtTable[index];
 }
 
-
-
 //==============================================================================
-// Color Conversion Methods
+// Batch SIMD Kernels
 //==============================================================================
-void MathPrecalculation::FastYuvToRgb(uint8_t y, uint8_t u, uint8_t v, uint8_t& outR, uint8_t& outG, uint8_t& outB) const
+// Sine / cosine: the angle is reduced around the nearest multiple of pi/2 to r in [-pi/4, pi/4]
+// (Cody-Waite with pi/2 split in three parts, exact enough up to |angle| ~ 8192) and both functions are
+// evaluated with minimax polynomials on that interval. Bit 0 of the quadrant swaps sine and cosine,
+// bit 1 negates the sine and bit 1 of (quadrant + 1) negates the cosine.
+static constexpr float BATCH_TWO_OVER_PI = 0.636619772367581343f;
+static constexpr float BATCH_HALF_PI_PART1 = 1.5703125f;
+static constexpr float BATCH_HALF_PI_PART2 = 4.837512969970703125e-4f;
+static constexpr float BATCH_HALF_PI_PART3 = 7.54978995489188216e-8f;
+static constexpr float BATCH_SIN_COEFF1 = -1.6666654611e-1f;
+static constexpr float BATCH_SIN_COEFF2 = 8.3321608736e-3f;
+static constexpr float BATCH_SIN_COEFF3 = -1.9515295891e-4f;
+static constexpr float BATCH_COS_COEFF1 = 4.166664568298827e-2f;
+static constexpr float BATCH_COS_COEFF2 = -1.388731625493765e-3f;
+static constexpr float BATCH_COS_COEFF3 = 2.443315711809948e-5f;
+
+// Portable kernel - also finishes the tail of every SIMD kernel
+static void SinCosBatchScalar(const float* angles, float* outSin, float* outCos, size_t begin, size_t count)
 {
-    // Ensure the system is initialized before attempting lookup
-    if (!m_bIsInitialized.load())
+    for (size_t i = begin; i < count; ++i)
     {
-#if defined(_DEBUG_MATHPRECALC_)
-        debug.logLevelMessage(LogLevel::LOG_WARNING, L"[MathPrecalculation] FastYuvToRgb called before initialization");
-#endif
-        // Fallback to standard conversion using BT.601 coefficients
-        int r = static_cast<int>(y + 1.402f * (v - 128));
-        int g = static_cast<int>(y - 0.344f * (u - 128) - 0.714f * (v - 128));
-        int b = static_cast<int>(y + 1.772f * (u - 128));
+        const float angle = angles[i];
+        const float quadrant = std::nearbyint(angle * BATCH_TWO_OVER_PI);
+        if (!(std::fabs(quadrant) < 2147483648.0f))
+        {
+            // Far outside the accurate range (or NaN / infinity) - leave it to the C runtime
+            if (outSin)
+            {
+                outSin[i] = std::sin(angle);
+            }
+            if (outCos)
+            {
+                outCos[i] = std::cos(angle);
+            }
+            continue;
+        }
 
-        outR = static_cast<uint8_t>(std::clamp(r, 0, 255));
-        outG = static_cast<uint8_t>(std::clamp(g, 0, 255));
-        outB = static_cast<uint8_t>(std::clamp(b, 0, 255));
-        return;
+        float r = angle - quadrant * BATCH_HALF_PI_PART1;
+        r -= quadrant * BATCH_HALF_PI_PART2;
+        r -= quadrant * BATCH_HALF_PI_PART3;
+        const float r2 = r * r;
+        const float sine = r + r * r2 * (BATCH_SIN_COEFF1 + r2 * (BATCH_SIN_COEFF2 + r2 * BATCH_SIN_COEFF3));
+        const float cosine = 1.0f - 0.5f * r2 + r2 * r2 * (BATCH_COS_COEFF1 + r2 * (BATCH_COS_COEFF2 + r2 * BATCH_COS_COEFF3));
+
+        const int j = static_cast<int>(quadrant);
+        const bool isSwapped = (j & 1) != 0;
+        if (outSin)
+        {
+            outSin[i] = ((j & 2) ? -1.0f : 1.0f) * (isSwapped ? cosine : sine);
+        }
+        if (outCos)
+        {
+            outCos[i] = (((j + 1) & 2) ? -1.0f : 1.0f) * (isSwapped ? sine : cosine);
+        }
     }
+}
 
-    // Check if lookup table is properly sized
-    if (m_yuvToRgbLookup.empty())
+static void SqrtBatchScalar(const float* values, float* outResults, size_t begin, size_t count)
+{
+    for (size_t i = begin; i < count; ++i)
     {
-        // Fallback to calculation if lookup table is not available
-        int r = static_cast<int>(y + 1.402f * (v - 128));
-        int g = static_cast<int>(y - 0.344f * (u - 128) - 0.714f * (v - 128));
-        int b = static_cast<int>(y + 1.772f * (u - 128));
+        const float value = values[i];
+        outResults[i] = (value > 0.0f) ? std::sqrt(value) : 0.0f;
+    }
+}
 
-        outR = FastClamp(r);
-        outG = FastClamp(g);
-        outB = FastClamp(b);
-        return;
+#if defined(CPUFEATURES_X86)
+// SSE4.1 - 4 lanes, round-to-nearest quadrant and blend select
+CPUFEATURES_TARGET_SSE41
+static size_t SinCosBatchSSE41(const float* angles, float* outSin, float* outCos, size_t count)
+{
+    const __m128 twoOverPi = _mm_set1_ps(BATCH_TWO_OVER_PI);
+    const __m128 halfPi1 = _mm_set1_ps(BATCH_HALF_PI_PART1);
+    const __m128 halfPi2 = _mm_set1_ps(BATCH_HALF_PI_PART2);
+    const __m128 halfPi3 = _mm_set1_ps(BATCH_HALF_PI_PART3);
+    const __m128 sin1 = _mm_set1_ps(BATCH_SIN_COEFF1);
+    const __m128 sin2 = _mm_set1_ps(BATCH_SIN_COEFF2);
+    const __m128 sin3 = _mm_set1_ps(BATCH_SIN_COEFF3);
+    const __m128 cos1 = _mm_set1_ps(BATCH_COS_COEFF1);
+    const __m128 cos2 = _mm_set1_ps(BATCH_COS_COEFF2);
+    const __m128 cos3 = _mm_set1_ps(BATCH_COS_COEFF3);
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128i oneBit = _mm_set1_epi32(1);
+    const __m128i twoBit = _mm_set1_epi32(2);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128 angle = _mm_loadu_ps(angles + i);
+        const __m128 quadrant = _mm_round_ps(_mm_mul_ps(angle, twoOverPi), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        const __m128i j = _mm_cvtps_epi32(quadrant);
+
+        __m128 r = _mm_sub_ps(angle, _mm_mul_ps(quadrant, halfPi1));
+        r = _mm_sub_ps(r, _mm_mul_ps(quadrant, halfPi2));
+        r = _mm_sub_ps(r, _mm_mul_ps(quadrant, halfPi3));
+        const __m128 r2 = _mm_mul_ps(r, r);
+
+        const __m128 sinPoly = _mm_add_ps(sin1, _mm_mul_ps(r2, _mm_add_ps(sin2, _mm_mul_ps(r2, sin3))));
+        const __m128 sine = _mm_add_ps(r, _mm_mul_ps(_mm_mul_ps(r, r2), sinPoly));
+        const __m128 cosPoly = _mm_add_ps(cos1, _mm_mul_ps(r2, _mm_add_ps(cos2, _mm_mul_ps(r2, cos3))));
+        const __m128 cosine = _mm_add_ps(_mm_sub_ps(one, _mm_mul_ps(half, r2)), _mm_mul_ps(_mm_mul_ps(r2, r2), cosPoly));
+
+        const __m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(j, oneBit), oneBit));
+        const __m128 sinSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(j, twoBit), 30));
+        const __m128 cosSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(j, oneBit), twoBit), 30));
+        if (outSin)
+        {
+            _mm_storeu_ps(outSin + i, _mm_xor_ps(_mm_blendv_ps(sine, cosine, swap), sinSign));
+        }
+        if (outCos)
+        {
+            _mm_storeu_ps(outCos + i, _mm_xor_ps(_mm_blendv_ps(cosine, sine, swap), cosSign));
+        }
     }
 
-    // Use reduced lookup table size (64x64x64 instead of 256x256x256)
-    const int yuvTableSize = 64;
+    return i;
+}
 
-    // Scale input values to reduced table size
-    int yIndex = (y * (yuvTableSize - 1)) / 255;
-    int uIndex = (u * (yuvTableSize - 1)) / 255;
-    int vIndex = (v * (yuvTableSize - 1)) / 255;
+CPUFEATURES_TARGET_SSE41
+static size_t SqrtBatchSSE41(const float* values, float* outResults, size_t count)
+{
+    const __m128 zero = _mm_setzero_ps();
 
-    // Ensure indices are within bounds
-    yIndex = std::clamp(yIndex, 0, yuvTableSize - 1);
-    uIndex = std::clamp(uIndex, 0, yuvTableSize - 1);
-    vIndex = std::clamp(vIndex, 0, yuvTableSize - 1);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        // max(NaN, 0) returns 0, the same as the scalar path
+        _mm_storeu_ps(outResults + i, _mm_sqrt_ps(_mm_max_ps(_mm_loadu_ps(values + i), zero)));
+    }
 
-    // Calculate index into the YUV to RGB lookup table
-    size_t index = (static_cast<size_t>(yIndex) * yuvTableSize + static_cast<size_t>(uIndex)) * yuvTableSize + static_cast<size_t>(vIndex);
-    size_t baseIndex = index * 3;
+    return i;
+}
 
-    // Ensure index is within bounds of the lookup table
-    if (baseIndex + 2 < m_yuvToRgbLookup.size())
+// AVX2 + FMA - 8 lanes, the reduction and polynomials use fused multiply-adds
+CPUFEATURES_TARGET_AVX2
+static size_t SinCosBatchAVX2(const float* angles, float* outSin, float* outCos, size_t count)
+{
+    const __m256 twoOverPi = _mm256_set1_ps(BATCH_TWO_OVER_PI);
+    const __m256 negHalfPi1 = _mm256_set1_ps(-BATCH_HALF_PI_PART1);
+    const __m256 negHalfPi2 = _mm256_set1_ps(-BATCH_HALF_PI_PART2);
+    const __m256 negHalfPi3 = _mm256_set1_ps(-BATCH_HALF_PI_PART3);
+    const __m256 sin1 = _mm256_set1_ps(BATCH_SIN_COEFF1);
+    const __m256 sin2 = _mm256_set1_ps(BATCH_SIN_COEFF2);
+    const __m256 sin3 = _mm256_set1_ps(BATCH_SIN_COEFF3);
+    const __m256 cos1 = _mm256_set1_ps(BATCH_COS_COEFF1);
+    const __m256 cos2 = _mm256_set1_ps(BATCH_COS_COEFF2);
+    const __m256 cos3 = _mm256_set1_ps(BATCH_COS_COEFF3);
+    const __m256 negHalf = _mm256_set1_ps(-0.5f);
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256i oneBit = _mm256_set1_epi32(1);
+    const __m256i twoBit = _mm256_set1_epi32(2);
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m256 angle = _mm256_loadu_ps(angles + i);
+        const __m256 quadrant = _mm256_round_ps(_mm256_mul_ps(angle, twoOverPi), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        const __m256i j = _mm256_cvtps_epi32(quadrant);
+
+        __m256 r = _mm256_fmadd_ps(quadrant, negHalfPi1, angle);
+        r = _mm256_fmadd_ps(quadrant, negHalfPi2, r);
+        r = _mm256_fmadd_ps(quadrant, negHalfPi3, r);
+        const __m256 r2 = _mm256_mul_ps(r, r);
+
+        const __m256 sinPoly = _mm256_fmadd_ps(r2, _mm256_fmadd_ps(r2, sin3, sin2), sin1);
+        const __m256 sine = _mm256_fmadd_ps(_mm256_mul_ps(r, r2), sinPoly, r);
+        const __m256 cosPoly = _mm256_fmadd_ps(r2, _mm256_fmadd_ps(r2, cos3, cos2), cos1);
+        const __m256 cosine = _mm256_fmadd_ps(_mm256_mul_ps(r2, r2), cosPoly, _mm256_fmadd_ps(negHalf, r2, one));
+
+        const __m256 swap = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(j, oneBit), oneBit));
+        const __m256 sinSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(j, twoBit), 30));
+        const __m256 cosSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(_mm256_add_epi32(j, oneBit), twoBit), 30));
+        if (outSin)
+        {
+            _mm256_storeu_ps(outSin + i, _mm256_xor_ps(_mm256_blendv_ps(sine, cosine, swap), sinSign));
+        }
+        if (outCos)
+        {
+            _mm256_storeu_ps(outCos + i, _mm256_xor_ps(_mm256_blendv_ps(cosine, sine, swap), cosSign));
+        }
+    }
+
+    return i;
+}
+
+CPUFEATURES_TARGET_AVX2
+static size_t SqrtBatchAVX2(const float* values, float* outResults, size_t count)
+{
+    const __m256 zero = _mm256_setzero_ps();
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        _mm256_storeu_ps(outResults + i, _mm256_sqrt_ps(_mm256_max_ps(_mm256_loadu_ps(values + i), zero)));
+    }
+
+    return i;
+}
+#elif defined(CPUFEATURES_NEON)
+// NEON - 4 lanes, quadrant rounded half away from zero (ARMv7 has no round-to-nearest convert)
+static size_t SinCosBatchNEON(const float* angles, float* outSin, float* outCos, size_t count)
+{
+    const float32x4_t half = vdupq_n_f32(0.5f);
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    const uint32x4_t signMask = vdupq_n_u32(0x80000000u);
+    const int32x4_t oneBit = vdupq_n_s32(1);
+    const int32x4_t twoBit = vdupq_n_s32(2);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const float32x4_t angle = vld1q_f32(angles + i);
+        const float32x4_t scaled = vmulq_n_f32(angle, BATCH_TWO_OVER_PI);
+        const float32x4_t roundBias = vreinterpretq_f32_u32(vorrq_u32(vandq_u32(vreinterpretq_u32_f32(scaled), signMask),
+            vreinterpretq_u32_f32(half)));
+        const int32x4_t j = vcvtq_s32_f32(vaddq_f32(scaled, roundBias));
+        const float32x4_t quadrant = vcvtq_f32_s32(j);
+
+        float32x4_t r = vmlsq_n_f32(angle, quadrant, BATCH_HALF_PI_PART1);
+        r = vmlsq_n_f32(r, quadrant, BATCH_HALF_PI_PART2);
+        r = vmlsq_n_f32(r, quadrant, BATCH_HALF_PI_PART3);
+        const float32x4_t r2 = vmulq_f32(r, r);
+
+        const float32x4_t sinPoly = vmlaq_f32(vdupq_n_f32(BATCH_SIN_COEFF1), r2,
+            vmlaq_f32(vdupq_n_f32(BATCH_SIN_COEFF2), r2, vdupq_n_f32(BATCH_SIN_COEFF3)));
+        const float32x4_t sine = vmlaq_f32(r, vmulq_f32(r, r2), sinPoly);
+        const float32x4_t cosPoly = vmlaq_f32(vdupq_n_f32(BATCH_COS_COEFF1), r2,
+            vmlaq_f32(vdupq_n_f32(BATCH_COS_COEFF2), r2, vdupq_n_f32(BATCH_COS_COEFF3)));
+        const float32x4_t cosine = vmlaq_f32(vmlsq_f32(one, half, r2), vmulq_f32(r2, r2), cosPoly);
+
+        const uint32x4_t swap = vceqq_s32(vandq_s32(j, oneBit), oneBit);
+        const uint32x4_t sinSign = vshlq_n_u32(vreinterpretq_u32_s32(vandq_s32(j, twoBit)), 30);
+        const uint32x4_t cosSign = vshlq_n_u32(vreinterpretq_u32_s32(vandq_s32(vaddq_s32(j, oneBit), twoBit)), 30);
+        if (outSin)
+        {
+            vst1q_f32(outSin + i, vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(vbslq_f32(swap, cosine, sine)), sinSign)));
+        }
+        if (outCos)
+        {
+            vst1q_f32(outCos + i, vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(vbslq_f32(swap, sine, cosine)), cosSign)));
+        }
+    }
+
+    return i;
+}
+
+static size_t SqrtBatchNEON(const float* values, float* outResults, size_t count)
+{
+    const float32x4_t zero = vdupq_n_f32(0.0f);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const float32x4_t value = vld1q_f32(values + i);
+        const uint32x4_t isPositive = vcgtq_f32(value, zero);
+#if defined(__aarch64__) || defined(_M_ARM64)
+        const float32x4_t root = vsqrtq_f32(vbslq_f32(isPositive, value, zero));
+#else
+        // ARMv7 has no vector square root - reciprocal estimate refined twice, then x * (1 / sqrt(x))
+        const float32x4_t safeValue = vbslq_f32(isPositive, value, vdupq_n_f32(1.0f));
+        float32x4_t inverse = vrsqrteq_f32(safeValue);
+        inverse = vmulq_f32(inverse, vrsqrtsq_f32(vmulq_f32(safeValue, inverse), inverse));
+        inverse = vmulq_f32(inverse, vrsqrtsq_f32(vmulq_f32(safeValue, inverse), inverse));
+        const float32x4_t root = vmulq_f32(safeValue, inverse);
+#endif
+        vst1q_f32(outResults + i, vbslq_f32(isPositive, root, zero));
+    }
+
+    return i;
+}
+#endif
+
+// Name of the kernel family FastSinCosBatch / FastSqrtBatch dispatch to on this CPU
+static const char* GetBatchKernelName()
+{
+#if defined(CPUFEATURES_X86)
+    const CPUFeatureFlags& cpu = GetCPUFeatures();
+    if (cpu.hasAVX2 && cpu.hasFMA)
+    {
+        return "AVX2";
+    }
+    return cpu.hasSSE41 ? "SSE4.1" : "Scalar";
+#elif defined(CPUFEATURES_NEON)
+    return "NEON";
+#else
+    return "Scalar";
+#endif
+}
+
+//==============================================================================
+// Batch SIMD Methods
+//==============================================================================
+void MathPrecalculation::FastSinCosBatch(const float* angles, float* outSin, float* outCos, size_t count) const
+{
+    if (!angles || (!outSin && !outCos))
+    {
+        return;
+    }
+
+    size_t processed = 0;
+#if defined(CPUFEATURES_X86)
+    const CPUFeatureFlags& cpu = GetCPUFeatures();
+    if (cpu.hasAVX2 && cpu.hasFMA)
+    {
+        processed = SinCosBatchAVX2(angles, outSin, outCos, count);
+    }
+    else if (cpu.hasSSE41)
+    {
+        processed = SinCosBatchSSE41(angles, outSin, outCos, count);
+    }
+#elif defined(CPUFEATURES_NEON)
+    processed = SinCosBatchNEON(angles, outSin, outCos, count);
+#endif
+
+    SinCosBatchScalar(angles, outSin, outCos, processed, count);
+}
+
+void MathPrecalculation::FastSqrtBatch(const float* values, float* outResults, size_t count) const
+{
+    if (!values || !outResults)
+    {
+        return;
+    }
+
+    size_t processed = 0;
+#if defined(CPUFEATURES_X86)
+    const CPUFeatureFlags& cpu = GetCPUFeatures();
+    if (cpu.hasAVX2 && cpu.hasFMA)
+    {
+        processed = SqrtBatchAVX2(values, outResults, count);
+    }
+    else if (cpu.hasSSE41)
+    {
+        processed = SqrtBatchSSE41(values, outResults, count);
+    }
+#elif defined(CPUFEATURES_NEON)
+    processed = SqrtBatchNEON(values, outResults, count);
+#endif
+
+    SqrtBatchScalar(values, outResults, processed, count);
+}
+
+MathBatchAccuracy MathPrecalculation::MeasureBatchAccuracy(float angleRange, size_t sampleCount) const
+{
+    MathBatchAccuracy accuracy = {};
+    accuracy.angleRange = angleRange;
+    accuracy.sampleCount = sampleCount;
+    accuracy.kernelName = GetBatchKernelName();
+
+    // Work through the samples in cache-sized chunks
+    const size_t CHUNK_SIZE = 4096;
+    std::vector<float> inputs(CHUNK_SIZE);
+    std::vector<float> sines(CHUNK_SIZE);
+    std::vector<float> cosines(CHUNK_SIZE);
+    double sinMaxError = 0.0;
+    double cosMaxError = 0.0;
+    double sqrtMaxError = 0.0;
+
+    for (size_t first = 0; first < sampleCount; first += CHUNK_SIZE)
+    {
+        const size_t chunkCount = std::min(CHUNK_SIZE, sampleCount - first);
+
+        // Angles evenly spaced over [-angleRange, angleRange]
+        for (size_t i = 0; i < chunkCount; ++i)
+        {
+            const double t = (static_cast<double>(first + i) + 0.5) / static_cast<double>(sampleCount);
+            inputs[i] = static_cast<float>((2.0 * t - 1.0) * angleRange);
+        }
+        FastSinCosBatch(inputs.data(), sines.data(), cosines.data(), chunkCount);
+        for (size_t i = 0; i < chunkCount; ++i)
+        {
+            sinMaxError = std::max(sinMaxError, std::fabs(static_cast<double>(sines[i]) - std::sin(static_cast<double>(inputs[i]))));
+            cosMaxError = std::max(cosMaxError, std::fabs(static_cast<double>(cosines[i]) - std::cos(static_cast<double>(inputs[i]))));
+        }
+
+        // Square root inputs spread logarithmically over [1e-6, 1e6]
+        for (size_t i = 0; i < chunkCount; ++i)
+        {
+            const double t = (static_cast<double>(first + i) + 0.5) / static_cast<double>(sampleCount);
+            inputs[i] = static_cast<float>(std::pow(10.0, 12.0 * t - 6.0));
+        }
+        FastSqrtBatch(inputs.data(), sines.data(), chunkCount);
+        for (size_t i = 0; i < chunkCount; ++i)
+        {
+            const double expected = std::sqrt(static_cast<double>(inputs[i]));
+            sqrtMaxError = std::max(sqrtMaxError, std::fabs(static_cast<double>(sines[i]) - expected) / expected);
+        }
+    }
+
+    accuracy.sinMaxError = static_cast<float>(sinMaxError);
+    accuracy.cosMaxError = static_cast<float>(cosMaxError);
+    accuracy.sqrtMaxRelativeError = static_cast<float>(sqrtMaxError);
+
+#if defined(_DEBUG_MATHPRECALC_)
+    debug.logDebugMessage(LogLevel::LOG_INFO,
+        L"[MathPrecalculation] Batch kernels (%hs): sin %.3e, cos %.3e over +/-%.1f, sqrt relative %.3e",
+        accuracy.kernelName, sinMaxError, cosMaxError, angleRange, sqrtMaxError);
+#endif
+
+    return accuracy;
+}
+
+
+
+//==============================================================================
+// Color Conversion Methods
+//==============================================================================
+void MathPrecalculation::FastYuvToRgb(uint8_t y, uint8_t u, uint8_t v, uint8_t& outR, uint8_t& outG, uint8_t& outB) const
+{
+    // Ensure the color conversion tables are built before attempting lookup
+    if (!AcquireTableFamily(MathTableFamily::ColorConversion))
+    {
+#if defined(_DEBUG_MATHPRECALC_)
+        debug.logLevelMessage(LogLevel::LOG_WARNING, L"[MathPrecalculation] FastYuvToRgb called before its tables were ready");
+#endif
+        // Fallback to standard conversion using BT.601 coefficients
+        int r = static_cast<int>(y + 1.402f * (v - 128));
+        int g = static_cast<int>(y - 0.344f * (u - 128) - 0.714f * (v - 128));
+        int b = static_cast<int>(y + 1.772f * (u - 128));
+
+        outR = static_cast<uint8_t>(std::clamp(r, 0, 255));
+        outG = static_cast<uint8_t>(std::clamp(g, 0, 255));
+        outB = static_cast<uint8_t>(std::clamp(b, 0, 255));
+        return;
+    }
+
+    // Check if lookup table is properly sized
+    if (m_yuvToRgbLookup.empty())
+    {
+        // Fallback to calculation if lookup table is not available
+        int r = static_cast<int>(y + 1.402f * (v - 128));
+        int g = static_cast<int>(y - 0.344f * (u - 128) - 0.714f * (v - 128));
+        int b = static_cast<int>(y + 1.772f * (u - 128));
+
+        outR = FastClamp(r);
+        outG = FastClamp(g);
+        outB = FastClamp(b);
+        return;
+    }
+
+    // Use reduced lookup table size (64x64x64 instead of 256x256x256 by default)
+    const int yuvTableSize = m_config.yuvTableDivisions;
+
+    // Scale input values to reduced table size
+    int yIndex = (y * (yuvTableSize - 1)) / 255;
+    int uIndex = (u * (yuvTableSize - 1)) / 255;
+    int vIndex = (v * (yuvTableSize - 1)) / 255;
+
+    // Ensure indices are within bounds
+    yIndex = std::clamp(yIndex, 0, yuvTableSize - 1);
+    uIndex = std::clamp(uIndex, 0, yuvTableSize - 1);
+    vIndex = std::clamp(vIndex, 0, yuvTableSize - 1);
+
+    // Calculate index into the YUV to RGB lookup table
+    size_t index = (static_cast<size_t>(yIndex) * yuvTableSize + static_cast<size_t>(uIndex)) * yuvTableSize + static_cast<size_t>(vIndex);
+    size_t baseIndex = index * 3;
+
+    // Ensure index is within bounds of the lookup table
+    if (baseIndex + 2 < m_yuvToRgbLookup.size())
     {
         // Retrieve precalculated RGB values from lookup table
         outR = m_yuvToRgbLookup[baseIndex + 0];
@@ -963,7 +1754,7 @@ void MathPrecalculation::FastYuvToRgb(uint8_t y, uint8_t u, uint8_t v, uint8_t&
         outB = m_yuvToRgbLookup[baseIndex + 2];
 
         // Increment lookup counter for statistics
-        m_lookupCount.fetch_add(1);
+        CountMathLookup();
     }
     else
     {
@@ -1035,8 +1826,8 @@ uint8_t MathPrecalculation::FastGammaCorrect(uint8_t input, float gamma) const
 
 uint8_t MathPrecalculation::FastClamp(int value) const
 {
-    // Ensure the system is initialized before attempting lookup
-    if (!m_bIsInitialized.load())
+    // Ensure the color conversion tables are built before attempting lookup
+    if (!AcquireTableFamily(MathTableFamily::ColorConversion))
     {
         return static_cast<uint8_t>(std::clamp(value, 0, 255));
     }
@@ -1063,8 +1854,8 @@ uint8_t MathPrecalculation::FastClamp(int value) const
 //==============================================================================
 float MathPrecalculation::FastLerp(float start, float end, float t) const
 {
-    // Ensure the system is initialized before attempting lookup
-    if (!m_bIsInitialized.load())
+    // Ensure the interpolation tables are built before attempting lookup
+    if (!AcquireTableFamily(MathTableFamily::Interpolation))
     {
         return start + t * (end - start);  // Fallback to standard linear interpolation
     }
@@ -1073,19 +1864,19 @@ float MathPrecalculation::FastLerp(float start, float end, float t) const
     float clampedT = std::clamp(t, 0.0f, 1.0f);
 
     // Convert t to table index
-    int index = static_cast<int>(clampedT * (INTERPOLATION_TABLE_SIZE - 1));
+    int index = static_cast<int>(clampedT * (m_config.interpolationTableSize - 1));
 
     // Ensure index is within bounds
-    if (index >= INTERPOLATION_TABLE_SIZE)
+    if (index >= m_config.interpolationTableSize)
     {
-        index = INTERPOLATION_TABLE_SIZE - 1;
+        index = m_config.interpolationTableSize - 1;
     }
 
     // Get linear interpolation coefficient from lookup table
     float coefficient = m_interpolationTable[index].linear;
 
     // Increment lookup counter for statistics
-    m_lookupCount.fetch_add(1);
+    CountMathLookup();
 
     // Return interpolated value
     return start + coefficient * (end - start);
@@ -1093,8 +1884,8 @@ float MathPrecalculation::FastLerp(float start, float end, float t) const
 
 float MathPrecalculation::FastSmoothStep(float start, float end, float t) const
 {
-    // Ensure the system is initialized before attempting lookup
-    if (!m_bIsInitialized.load())
+    // Ensure the interpolation tables are built before attempting lookup
+    if (!AcquireTableFamily(MathTableFamily::Interpolation))
     {
         float clampedT = std::clamp(t, 0.0f, 1.0f);
         float smoothT = clampedT * clampedT * (3.0f - 2.0f * clampedT);
@@ -1105,19 +1896,19 @@ float MathPrecalculation::FastSmoothStep(float start, float end, float t) const
     float clampedT = std::clamp(t, 0.0f, 1.0f);
 
     // Convert t to table index
-    int index = static_cast<int>(clampedT * (INTERPOLATION_TABLE_SIZE - 1));
+    int index = static_cast<int>(clampedT * (m_config.interpolationTableSize - 1));
 
     // Ensure index is within bounds
-    if (index >= INTERPOLATION_TABLE_SIZE)
+    if (index >= m_config.interpolationTableSize)
     {
-        index = INTERPOLATION_TABLE_SIZE - 1;
+        index = m_config.interpolationTableSize - 1;
     }
 
     // Get smooth step coefficient from lookup table
     float coefficient = m_interpolationTable[index].smoothStep;
 
     // Increment lookup counter for statistics
-    m_lookupCount.fetch_add(1);
+    CountMathLookup();
 
     // Return interpolated value
     return start + coefficient * (end - start);
@@ -1125,8 +1916,8 @@ float MathPrecalculation::FastSmoothStep(float start, float end, float t) const
 
 float MathPrecalculation::FastSmootherStep(float start, float end, float t) const
 {
-    // Ensure the system is initialized before attempting lookup
-    if (!m_bIsInitialized.load())
+    // Ensure the interpolation tables are built before attempting lookup
+    if (!AcquireTableFamily(MathTableFamily::Interpolation))
     {
         float clampedT = std::clamp(t, 0.0f, 1.0f);
         float smoothT = clampedT * clampedT * clampedT * (clampedT * (clampedT * 6.0f - 15.0f) + 10.0f);
@@ -1137,19 +1928,19 @@ float MathPrecalculation::FastSmootherStep(float start, float end, float t) cons
     float clampedT = std::clamp(t, 0.0f, 1.0f);
 
     // Convert t to table index
-    int index = static_cast<int>(clampedT * (INTERPOLATION_TABLE_SIZE - 1));
+    int index = static_cast<int>(clampedT * (m_config.interpolationTableSize - 1));
 
     // Ensure index is within bounds
-    if (index >= INTERPOLATION_TABLE_SIZE)
+    if (index >= m_config.interpolationTableSize)
     {
-        index = INTERPOLATION_TABLE_SIZE - 1;
+        index = m_config.interpolationTableSize - 1;
     }
 
     // Get smoother step coefficient from lookup table
     float coefficient = m_interpolationTable[index].smootherStep;
 
     // Increment lookup counter for statistics
-    m_lookupCount.fetch_add(1);
+    CountMathLookup();
 
     // Return interpolated value
     return start + coefficient * (end - start);
@@ -1157,8 +1948,8 @@ float MathPrecalculation::FastSmootherStep(float start, float end, float t) cons
 
 float MathPrecalculation::FastEaseIn(float start, float end, float t) const
 {
-    // Ensure the system is initialized before attempting lookup
-    if (!m_bIsInitialized.load())
+    // Ensure the interpolation tables are built before attempting lookup
+    if (!AcquireTableFamily(MathTableFamily::Interpolation))
     {
         float clampedT = std::clamp(t, 0.0f, 1.0f);
         float easeT = clampedT * clampedT;
@@ -1169,19 +1960,19 @@ float MathPrecalculation::FastEaseIn(float start, float end, float t) const
     float clampedT = std::clamp(t, 0.0f, 1.0f);
 
     // Convert t to table index
-    int index = static_cast<int>(clampedT * (INTERPOLATION_TABLE_SIZE - 1));
+    int index = static_cast<int>(clampedT * (m_config.interpolationTableSize - 1));
 
     // Ensure index is within bounds
-    if (index >= INTERPOLATION_TABLE_SIZE)
+    if (index >= m_config.interpolationTableSize)
     {
-        index = INTERPOLATION_TABLE_SIZE - 1;
+        index = m_config.interpolationTableSize - 1;
     }
 
     // Get ease-in coefficient from lookup table
     float coefficient = m_interpolationTable[index].easeIn;
 
     // Increment lookup counter for statistics
-    m_lookupCount.fetch_add(1);
+    CountMathLookup();
 
     // Return interpolated value
     return start + coefficient * (end - start);
@@ -1189,8 +1980,8 @@ float MathPrecalculation::FastEaseIn(float start, float end, float t) const
 
 float MathPrecalculation::FastEaseOut(float start, float end, float t) const
 {
-    // Ensure the system is initialized before attempting lookup
-    if (!m_bIsInitialized.load())
+    // Ensure the interpolation tables are built before attempting lookup
+    if (!AcquireTableFamily(MathTableFamily::Interpolation))
     {
         float clampedT = std::clamp(t, 0.0f, 1.0f);
         float easeT = 1.0f - (1.0f - clampedT) * (1.0f - clampedT);
@@ -1201,19 +1992,19 @@ float MathPrecalculation::FastEaseOut(float start, float end, float t) const
     float clampedT = std::clamp(t, 0.0f, 1.0f);
 
     // Convert t to table index
-    int index = static_cast<int>(clampedT * (INTERPOLATION_TABLE_SIZE - 1));
+    int index = static_cast<int>(clampedT * (m_config.interpolationTableSize - 1));
 
     // Ensure index is within bounds
-    if (index >= INTERPOLATION_TABLE_SIZE)
+    if (index >= m_config.interpolationTableSize)
     {
-        index = INTERPOLATION_TABLE_SIZE - 1;
+        index = m_config.interpolationTableSize - 1;
     }
 
     // Get ease-out coefficient from lookup table
     float coefficient = m_interpolationTable[index].easeOut;
 
     // Increment lookup counter for statistics
-    m_lookupCount.fetch_add(1);
+    CountMathLookup();
 
     // Return interpolated value
     return start + coefficient * (end - start);
@@ -1221,8 +2012,8 @@ float MathPrecalculation::FastEaseOut(float start, float end, float t) const
 
 float MathPrecalculation::FastEaseInOut(float start, float end, float t) const
 {
-    // Ensure the system is initialized before attempting lookup
-    if (!m_bIsInitialized.load())
+    // Ensure the interpolation tables are built before attempting lookup
+    if (!AcquireTableFamily(MathTableFamily::Interpolation))
     {
         float clampedT = std::clamp(t, 0.0f, 1.0f);
         float easeT;
@@ -1242,19 +2033,19 @@ float MathPrecalculation::FastEaseInOut(float start, float end, float t) const
     float clampedT = std::clamp(t, 0.0f, 1.0f);
 
     // Convert t to table index
-    int index = static_cast<int>(clampedT * (INTERPOLATION_TABLE_SIZE - 1));
+    int index = static_cast<int>(clampedT * (m_config.interpolationTableSize - 1));
 
     // Ensure index is within bounds
-    if (index >= INTERPOLATION_TABLE_SIZE)
+    if (index >= m_config.interpolationTableSize)
     {
-        index = INTERPOLATION_TABLE_SIZE - 1;
+        index = m_config.interpolationTableSize - 1;
     }
 
     // Get ease-in-out coefficient from lookup table
     float coefficient = m_interpolationTable[index].easeInOut;
 
     // Increment lookup counter for statistics
-    m_lookupCount.fetch_add(1);
+    CountMathLookup();
 
     // Return interpolated value
     return start + coefficient * (end - start);
@@ -1265,8 +2056,8 @@ float MathPrecalculation::FastEaseInOut(float start, float end, float t) const
 //==============================================================================
 XMFLOAT2 MathPrecalculation::GetParticleDirection(int particleIndex, int totalParticles) const
 {
-    // Ensure the system is initialized before attempting lookup
-    if (!m_bIsInitialized.load())
+    // Ensure the particle tables are built before attempting lookup
+    if (!AcquireTableFamily(MathTableFamily::Particle))
     {
         // Fallback calculation
         float angle = (static_cast<float>(particleIndex) / static_cast<float>(totalParticles)) * 2.0f * XM_PI;
@@ -1278,16 +2069,16 @@ XMFLOAT2 MathPrecalculation::GetParticleDirection(int particleIndex, int totalPa
     if (it != m_explosionPatterns.end() && particleIndex < static_cast<int>(it->second.size()))
     {
         // Return precalculated direction from explosion pattern
-        m_lookupCount.fetch_add(1);
+        CountMathLookup();
         return it->second[particleIndex];
     }
 
     // Calculate direction using angle divisions if no specific pattern exists
-    int angleIndex = (particleIndex * PARTICLE_ANGLE_DIVISIONS) / totalParticles;
-    angleIndex = std::clamp(angleIndex, 0, PARTICLE_ANGLE_DIVISIONS - 1);
+    int angleIndex = (particleIndex * m_config.particleAngleDivisions) / totalParticles;
+    angleIndex = std::clamp(angleIndex, 0, m_config.particleAngleDivisions - 1);
 
     // Increment lookup counter for statistics
-    m_lookupCount.fetch_add(1);
+    CountMathLookup();
 
     // Return precalculated direction
     return m_particleDirections[angleIndex].direction;
@@ -1295,17 +2086,17 @@ XMFLOAT2 MathPrecalculation::GetParticleDirection(int particleIndex, int totalPa
 
 XMFLOAT2 MathPrecalculation::GetParticleVelocity(float angle, float speed) const
 {
-    // Get direction vector for the specified angle
-    float normalizedAngle = NormalizeAngle(angle);
-    int angleIndex = static_cast<int>((normalizedAngle / (2.0f * XM_PI)) * PARTICLE_ANGLE_DIVISIONS);
-    angleIndex = std::clamp(angleIndex, 0, PARTICLE_ANGLE_DIVISIONS - 1);
-
     // Get base direction from lookup table
     XMFLOAT2 direction;
-    if (m_bIsInitialized.load() && angleIndex < static_cast<int>(m_particleDirections.size()))
+    if (AcquireTableFamily(MathTableFamily::Particle))
     {
+        // Get direction vector for the specified angle
+        float normalizedAngle = NormalizeAngle(angle);
+        int angleIndex = static_cast<int>((normalizedAngle / (2.0f * XM_PI)) * m_config.particleAngleDivisions);
+        angleIndex = std::clamp(angleIndex, 0, m_config.particleAngleDivisions - 1);
+
         direction = m_particleDirections[angleIndex].direction;
-        m_lookupCount.fetch_add(1);
+        CountMathLookup();
     }
     else
     {
@@ -1351,7 +2142,7 @@ XMFLOAT2 MathPrecalculation::FastNormalize(const XMFLOAT2& vector) const
 XMMATRIX MathPrecalculation::GetScaleMatrix(float scaleX, float scaleY, float scaleZ) const
 {
     // Check for uniform scaling first (most common case)
-    if (scaleX == scaleY && scaleY == scaleZ)
+    if (scaleX == scaleY && scaleY == scaleZ && AcquireTableFamily(MathTableFamily::MatrixCache))
     {
         // Create hash key for uniform scale lookup
         int scaleKey = static_cast<int>(scaleX * 1000.0f);
@@ -1360,7 +2151,7 @@ XMMATRIX MathPrecalculation::GetScaleMatrix(float scaleX, float scaleY, float sc
         auto it = m_scaleMatrixCache.find(scaleKey);
         if (it != m_scaleMatrixCache.end())
         {
-            m_lookupCount.fetch_add(1);
+            CountMathLookup();
             return it->second;
         }
     }
@@ -1381,17 +2172,20 @@ XMMATRIX MathPrecalculation::GetRotationMatrix(float angleX, float angleY, float
     degreesY = ((degreesY % 360) + 360) % 360;
     degreesZ = ((degreesZ % 360) + 360) % 360;
 
+    // Cached rotations are only looked up once the matrix cache family is built
+    const bool hasMatrixCache = AcquireTableFamily(MathTableFamily::MatrixCache);
+
     // Check for single-axis rotations (most common case)
     if (angleX != 0.0f && angleY == 0.0f && angleZ == 0.0f)
     {
         // X-axis rotation only
-        if (degreesX % 15 == 0)  // Check if it's a cached angle
+        if (hasMatrixCache && degreesX % CACHED_ROTATION_STEP_DEGREES == 0)  // Check if it's a cached angle
         {
             int rotationKey = degreesX * 1000 + 0;  // X-axis key
             auto it = m_rotationMatrixCache.find(rotationKey);
             if (it != m_rotationMatrixCache.end())
             {
-                m_lookupCount.fetch_add(1);
+                CountMathLookup();
                 return it->second;
             }
         }
@@ -1399,13 +2193,13 @@ XMMATRIX MathPrecalculation::GetRotationMatrix(float angleX, float angleY, float
     else if (angleX == 0.0f && angleY != 0.0f && angleZ == 0.0f)
     {
         // Y-axis rotation only
-        if (degreesY % 15 == 0)  // Check if it's a cached angle
+        if (hasMatrixCache && degreesY % CACHED_ROTATION_STEP_DEGREES == 0)  // Check if it's a cached angle
         {
             int rotationKey = degreesY * 1000 + 1;  // Y-axis key
             auto it = m_rotationMatrixCache.find(rotationKey);
             if (it != m_rotationMatrixCache.end())
             {
-                m_lookupCount.fetch_add(1);
+                CountMathLookup();
                 return it->second;
             }
         }
@@ -1413,13 +2207,13 @@ XMMATRIX MathPrecalculation::GetRotationMatrix(float angleX, float angleY, float
     else if (angleX == 0.0f && angleY == 0.0f && angleZ != 0.0f)
     {
         // Z-axis rotation only
-        if (degreesZ % 15 == 0)  // Check if it's a cached angle
+        if (hasMatrixCache && degreesZ % CACHED_ROTATION_STEP_DEGREES == 0)  // Check if it's a cached angle
         {
             int rotationKey = degreesZ * 1000 + 2;  // Z-axis key
             auto it = m_rotationMatrixCache.find(rotationKey);
             if (it != m_rotationMatrixCache.end())
             {
-                m_lookupCount.fetch_add(1);
+                CountMathLookup();
                 return it->second;
             }
         }
@@ -1449,252 +2243,1125 @@ XMMATRIX MathPrecalculation::GetViewMatrix(const XMFLOAT3& position, const XMFLO
 }
 
 //==============================================================================
-// Text Rendering Optimization Methods
+// Batch Matrix Transform Kernels
 //==============================================================================
-float MathPrecalculation::GetCharacterWidthFast(wchar_t character, float fontSize) const
+// The kernels work on row-major float[16] matrices and packed float3 / float4 arrays, the layout
+// Matrix4x4, XMFLOAT4X4 and XMMATRIX share. Every path evaluates the same operations in the same
+// order without fused multiply-adds, so scalar, SSE2 and AVX results are bit-identical.
+static_assert(sizeof(Matrix4x4) == 16 * sizeof(float), "Matrix4x4 must be 16 packed floats");
+static_assert(sizeof(XMFLOAT3) == 3 * sizeof(float), "XMFLOAT3 must be 3 packed floats");
+static_assert(sizeof(XMFLOAT4) == 4 * sizeof(float), "XMFLOAT4 must be 4 packed floats");
+
+// out = a * b for one matrix; out may alias a or b
+static inline void MultiplyMatrixScalar(const float* a, const float* b, float* out)
 {
-    // Ensure the system is initialized before attempting lookup
-    if (!m_bIsInitialized.load())
-    {
-        return fontSize * 0.6f;  // Fallback estimate
+    float result[16];
+    for (int row = 0; row < 4; ++row)
+    {
+        const float a0 = a[row * 4 + 0];
+        const float a1 = a[row * 4 + 1];
+        const float a2 = a[row * 4 + 2];
+        const float a3 = a[row * 4 + 3];
+        for (int col = 0; col < 4; ++col)
+        {
+            result[row * 4 + col] = ((a0 * b[col] + a1 * b[4 + col]) + a2 * b[8 + col]) + a3 * b[12 + col];
+        }
     }
+    memcpy(out, result, sizeof(result));
+}
 
-    // Look up character width in cache
-    auto it = m_characterWidthCache.find(character);
-    if (it != m_characterWidthCache.end())
+// Portable kernels - also finish the tail of every SIMD kernel
+static void ComposeTransformsScalar(const float* positions, const float* rotations, const float* scales, float* out,
+    size_t begin, size_t count)
+{
+    for (size_t i = begin; i < count; ++i)
     {
-        m_lookupCount.fetch_add(1);
-        return it->second * fontSize;
-    }
+        const float x = rotations[i * 4 + 0];
+        const float y = rotations[i * 4 + 1];
+        const float z = rotations[i * 4 + 2];
+        const float w = rotations[i * 4 + 3];
 
-    // Fallback for characters not in cache
-    return fontSize * 0.6f;  // Default character width estimate
+        float rows[3][3] = {
+            { 1.0f - 2.0f * (y * y + z * z), 2.0f * (x * y + z * w), 2.0f * (x * z - y * w) },
+            { 2.0f * (x * y - z * w), 1.0f - 2.0f * (x * x + z * z), 2.0f * (y * z + x * w) },
+            { 2.0f * (x * z + y * w), 2.0f * (y * z - x * w), 1.0f - 2.0f * (x * x + y * y) }
+        };
+
+        // Scaling * Rotation scales row r of the rotation by the r-th scale component
+        if (scales)
+        {
+            for (int row = 0; row < 3; ++row)
+            {
+                const float scale = scales[i * 3 + row];
+                rows[row][0] *= scale;
+                rows[row][1] *= scale;
+                rows[row][2] *= scale;
+            }
+        }
+
+        float* m = out + i * 16;
+        for (int row = 0; row < 3; ++row)
+        {
+            m[row * 4 + 0] = rows[row][0];
+            m[row * 4 + 1] = rows[row][1];
+            m[row * 4 + 2] = rows[row][2];
+            m[row * 4 + 3] = 0.0f;
+        }
+        m[12] = positions[i * 3 + 0];
+        m[13] = positions[i * 3 + 1];
+        m[14] = positions[i * 3 + 2];
+        m[15] = 1.0f;
+    }
 }
 
-float MathPrecalculation::GetTextTransparencyFast(float position, float regionStart, float regionEnd, float fadeDistance) const
+static void TransformFloat3Scalar(const float* matrix, const float* in, float* out, bool isPoint, size_t begin, size_t count)
 {
-    // Ensure the system is initialized before attempting lookup
-    if (!m_bIsInitialized.load())
+    for (size_t i = begin; i < count; ++i)
     {
-        // Fallback calculation
-        if (position < regionStart - fadeDistance || position > regionEnd + fadeDistance)
+        const float x = in[i * 3 + 0];
+        const float y = in[i * 3 + 1];
+        const float z = in[i * 3 + 2];
+        for (int col = 0; col < 3; ++col)
         {
-            return 0.0f;  // Completely transparent
+            float value = (x * matrix[col] + y * matrix[4 + col]) + z * matrix[8 + col];
+            if (isPoint)
+            {
+                value += matrix[12 + col];
+            }
+            out[i * 3 + col] = value;
         }
+    }
+}
 
-        if (position < regionStart)
+#if defined(CPUFEATURES_X86)
+// Split four packed float3 (12 floats) into x, y and z lanes, and the reverse
+static inline void LoadFloat3x4SSE2(const float* p, __m128& x, __m128& y, __m128& z)
+{
+    const __m128 a = _mm_loadu_ps(p);                                           // x0 y0 z0 x1
+    const __m128 b = _mm_loadu_ps(p + 4);                                       // y1 z1 x2 y2
+    const __m128 c = _mm_loadu_ps(p + 8);                                       // z2 x3 y3 z3
+    x = _mm_shuffle_ps(a, _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+    y = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+    z = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), c, _MM_SHUFFLE(3, 0, 2, 0));
+}
+
+static inline void StoreFloat3x4SSE2(float* p, __m128 x, __m128 y, __m128 z)
+{
+    _mm_storeu_ps(p, _mm_shuffle_ps(_mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0)));
+    _mm_storeu_ps(p + 4, _mm_shuffle_ps(_mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0)));
+    _mm_storeu_ps(p + 8, _mm_shuffle_ps(_mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0)));
+}
+
+// One output row: a.row * b, accumulated in the scalar kernel's order
+static inline __m128 MultiplyRowSSE2(__m128 row, __m128 b0, __m128 b1, __m128 b2, __m128 b3)
+{
+    __m128 result = _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(0, 0, 0, 0)), b0);
+    result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(1, 1, 1, 1)), b1));
+    result = _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(2, 2, 2, 2)), b2));
+    return _mm_add_ps(result, _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(3, 3, 3, 3)), b3));
+}
+
+// Both matrices are loaded before anything is stored, so out may alias a or b
+static inline void MultiplyMatrixSSE2(const float* a, const float* b, float* out)
+{
+    const __m128 b0 = _mm_loadu_ps(b);
+    const __m128 b1 = _mm_loadu_ps(b + 4);
+    const __m128 b2 = _mm_loadu_ps(b + 8);
+    const __m128 b3 = _mm_loadu_ps(b + 12);
+    const __m128 a0 = _mm_loadu_ps(a);
+    const __m128 a1 = _mm_loadu_ps(a + 4);
+    const __m128 a2 = _mm_loadu_ps(a + 8);
+    const __m128 a3 = _mm_loadu_ps(a + 12);
+
+    _mm_storeu_ps(out, MultiplyRowSSE2(a0, b0, b1, b2, b3));
+    _mm_storeu_ps(out + 4, MultiplyRowSSE2(a1, b0, b1, b2, b3));
+    _mm_storeu_ps(out + 8, MultiplyRowSSE2(a2, b0, b1, b2, b3));
+    _mm_storeu_ps(out + 12, MultiplyRowSSE2(a3, b0, b1, b2, b3));
+}
+
+// SSE2 - 4 transforms per iteration: quaternions transposed to lanes, rows transposed back
+static size_t ComposeTransformsSSE2(const float* positions, const float* rotations, const float* scales, float* out, size_t count)
+{
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 two = _mm_set1_ps(2.0f);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 x = _mm_loadu_ps(rotations + i * 4);
+        __m128 y = _mm_loadu_ps(rotations + i * 4 + 4);
+        __m128 z = _mm_loadu_ps(rotations + i * 4 + 8);
+        __m128 w = _mm_loadu_ps(rotations + i * 4 + 12);
+        _MM_TRANSPOSE4_PS(x, y, z, w);
+
+        const __m128 xx = _mm_mul_ps(x, x);
+        const __m128 yy = _mm_mul_ps(y, y);
+        const __m128 zz = _mm_mul_ps(z, z);
+        const __m128 xy = _mm_mul_ps(x, y);
+        const __m128 xz = _mm_mul_ps(x, z);
+        const __m128 yz = _mm_mul_ps(y, z);
+        const __m128 xw = _mm_mul_ps(x, w);
+        const __m128 yw = _mm_mul_ps(y, w);
+        const __m128 zw = _mm_mul_ps(z, w);
+
+        __m128 r00 = _mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(yy, zz)));
+        __m128 r01 = _mm_mul_ps(two, _mm_add_ps(xy, zw));
+        __m128 r02 = _mm_mul_ps(two, _mm_sub_ps(xz, yw));
+        __m128 r10 = _mm_mul_ps(two, _mm_sub_ps(xy, zw));
+        __m128 r11 = _mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, zz)));
+        __m128 r12 = _mm_mul_ps(two, _mm_add_ps(yz, xw));
+        __m128 r20 = _mm_mul_ps(two, _mm_add_ps(xz, yw));
+        __m128 r21 = _mm_mul_ps(two, _mm_sub_ps(yz, xw));
+        __m128 r22 = _mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, yy)));
+
+        if (scales)
         {
-            float distanceFromStart = regionStart - position;
-            return 1.0f - (distanceFromStart / fadeDistance);
+            __m128 sx, sy, sz;
+            LoadFloat3x4SSE2(scales + i * 3, sx, sy, sz);
+            r00 = _mm_mul_ps(r00, sx);
+            r01 = _mm_mul_ps(r01, sx);
+            r02 = _mm_mul_ps(r02, sx);
+            r10 = _mm_mul_ps(r10, sy);
+            r11 = _mm_mul_ps(r11, sy);
+            r12 = _mm_mul_ps(r12, sy);
+            r20 = _mm_mul_ps(r20, sz);
+            r21 = _mm_mul_ps(r21, sz);
+            r22 = _mm_mul_ps(r22, sz);
         }
 
-        if (position > regionEnd)
+        __m128 tx, ty, tz;
+        LoadFloat3x4SSE2(positions + i * 3, tx, ty, tz);
+
+        // Each transpose turns one row, held lane-per-transform, into that row of all four matrices
+        __m128 row0[4] = { r00, r01, r02, _mm_setzero_ps() };
+        __m128 row1[4] = { r10, r11, r12, _mm_setzero_ps() };
+        __m128 row2[4] = { r20, r21, r22, _mm_setzero_ps() };
+        __m128 row3[4] = { tx, ty, tz, one };
+        _MM_TRANSPOSE4_PS(row0[0], row0[1], row0[2], row0[3]);
+        _MM_TRANSPOSE4_PS(row1[0], row1[1], row1[2], row1[3]);
+        _MM_TRANSPOSE4_PS(row2[0], row2[1], row2[2], row2[3]);
+        _MM_TRANSPOSE4_PS(row3[0], row3[1], row3[2], row3[3]);
+
+        for (int lane = 0; lane < 4; ++lane)
         {
-            float distanceFromEnd = position - regionEnd;
-            return 1.0f - (distanceFromEnd / fadeDistance);
+            float* m = out + (i + lane) * 16;
+            _mm_storeu_ps(m, row0[lane]);
+            _mm_storeu_ps(m + 4, row1[lane]);
+            _mm_storeu_ps(m + 8, row2[lane]);
+            _mm_storeu_ps(m + 12, row3[lane]);
         }
-
-        return 1.0f;  // Fully opaque
     }
 
-    // Calculate normalized position within the transparency range
-    float totalRange = (regionEnd + fadeDistance) - (regionStart - fadeDistance);
-    if (totalRange <= 0.0f)
-    {
-        return 1.0f;
-    }
+    return i;
+}
 
-    float normalizedPos = (position - (regionStart - fadeDistance)) / totalRange;
-    normalizedPos = std::clamp(normalizedPos, 0.0f, 1.0f);
+static size_t TransformFloat3SSE2(const float* matrix, const float* in, float* out, bool isPoint, size_t count)
+{
+    const __m128 m00 = _mm_set1_ps(matrix[0]);
+    const __m128 m01 = _mm_set1_ps(matrix[1]);
+    const __m128 m02 = _mm_set1_ps(matrix[2]);
+    const __m128 m10 = _mm_set1_ps(matrix[4]);
+    const __m128 m11 = _mm_set1_ps(matrix[5]);
+    const __m128 m12 = _mm_set1_ps(matrix[6]);
+    const __m128 m20 = _mm_set1_ps(matrix[8]);
+    const __m128 m21 = _mm_set1_ps(matrix[9]);
+    const __m128 m22 = _mm_set1_ps(matrix[10]);
+    const __m128 m30 = _mm_set1_ps(isPoint ? matrix[12] : 0.0f);
+    const __m128 m31 = _mm_set1_ps(isPoint ? matrix[13] : 0.0f);
+    const __m128 m32 = _mm_set1_ps(isPoint ? matrix[14] : 0.0f);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 x, y, z;
+        LoadFloat3x4SSE2(in + i * 3, x, y, z);
+
+        __m128 outX = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m00), _mm_mul_ps(y, m10)), _mm_mul_ps(z, m20));
+        __m128 outY = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m01), _mm_mul_ps(y, m11)), _mm_mul_ps(z, m21));
+        __m128 outZ = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, m02), _mm_mul_ps(y, m12)), _mm_mul_ps(z, m22));
+        if (isPoint)
+        {
+            outX = _mm_add_ps(outX, m30);
+            outY = _mm_add_ps(outY, m31);
+            outZ = _mm_add_ps(outZ, m32);
+        }
 
-    // Convert to lookup table index
-    int index = static_cast<int>(normalizedPos * (m_transparencyLookup.size() - 1));
-    index = std::clamp(index, 0, static_cast<int>(m_transparencyLookup.size() - 1));
+        StoreFloat3x4SSE2(out + i * 3, outX, outY, outZ);
+    }
 
-    // Increment lookup counter for statistics
-    m_lookupCount.fetch_add(1);
+    return i;
+}
 
-    // Return precalculated transparency value
-    return m_transparencyLookup[index];
+// AVX - the SSE2 lane layouts with a second group of four in the upper 128 bits
+CPUFEATURES_TARGET_AVX
+static inline __m256 LoadFloat4PairAVX(const float* low, const float* high)
+{
+    return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(low)), _mm_loadu_ps(high), 1);
 }
 
-//==============================================================================
-// Utility Methods
-//==============================================================================
-size_t MathPrecalculation::GetMemoryUsage() const
+CPUFEATURES_TARGET_AVX
+static inline void StoreFloat4PairAVX(float* low, float* high, __m256 value)
 {
-    size_t totalMemory = 0;
+    _mm_storeu_ps(low, _mm256_castps256_ps128(value));
+    _mm_storeu_ps(high, _mm256_extractf128_ps(value, 1));
+}
 
-    // Calculate memory usage for each lookup table
-    totalMemory += m_trigonometricTable.size() * sizeof(TrigonometricData);
-    totalMemory += m_sqrtTable.size() * sizeof(float);
-    totalMemory += m_colorConversionTable.size() * sizeof(ColorConversionData);
-    totalMemory += m_yuvToRgbLookup.size() * sizeof(uint8_t);                   // Vector-based YUV lookup
-    totalMemory += m_clampTable.size() * sizeof(uint8_t);
-    totalMemory += m_interpolationTable.size() * sizeof(InterpolationData);
-    totalMemory += m_particleDirections.size() * sizeof(ParticleData);
-    totalMemory += m_transparencyLookup.size() * sizeof(float);
-    totalMemory += m_inverseTrigonometricTable.size() * sizeof(InverseTrigonometricData);
-    // Calculate memory usage for physics-specific lookup tables
-    totalMemory += m_gravityIntensityTable.size() * sizeof(GravityIntensityData);
-    totalMemory += m_reflectionAngleTable.size() * sizeof(ReflectionAngleData);
-    totalMemory += m_inertiaTable.size() * sizeof(InertiaData);
-    totalMemory += m_collisionResponseTable.size() * sizeof(CollisionResponseData);
-    totalMemory += m_audioAttenuationTable.size() * sizeof(AudioAttenuationData);
-    totalMemory += m_orbitalMechanicsTable.size() * sizeof(OrbitalMechanicsData);
-
-    // Calculate memory usage for hash maps
-    for (const auto& pair : m_explosionPatterns)
-    {
-        totalMemory += pair.second.size() * sizeof(XMFLOAT2);
-    }
-
-    totalMemory += m_scaleMatrixCache.size() * (sizeof(int) + sizeof(XMMATRIX));
-    totalMemory += m_rotationMatrixCache.size() * (sizeof(int) + sizeof(XMMATRIX));
-    totalMemory += m_characterWidthCache.size() * (sizeof(wchar_t) + sizeof(float));
+// Points 0-3 land in the low half, points 4-7 in the high half
+CPUFEATURES_TARGET_AVX
+static inline void LoadFloat3x8AVX(const float* p, __m256& x, __m256& y, __m256& z)
+{
+    const __m256 a = LoadFloat4PairAVX(p, p + 12);
+    const __m256 b = LoadFloat4PairAVX(p + 4, p + 16);
+    const __m256 c = LoadFloat4PairAVX(p + 8, p + 20);
+    x = _mm256_shuffle_ps(a, _mm256_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+    y = _mm256_shuffle_ps(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm256_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+    z = _mm256_shuffle_ps(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), c, _MM_SHUFFLE(3, 0, 2, 0));
+}
 
-    return totalMemory;
+CPUFEATURES_TARGET_AVX
+static inline void StoreFloat3x8AVX(float* p, __m256 x, __m256 y, __m256 z)
+{
+    StoreFloat4PairAVX(p, p + 12, _mm256_shuffle_ps(_mm256_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0)), _mm256_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0)));
+    StoreFloat4PairAVX(p + 4, p + 16, _mm256_shuffle_ps(_mm256_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)), _mm256_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0)));
+    StoreFloat4PairAVX(p + 8, p + 20, _mm256_shuffle_ps(_mm256_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)), _mm256_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0)));
 }
 
-bool MathPrecalculation::ValidateTables() const
+// _MM_TRANSPOSE4_PS within each 128-bit half
+CPUFEATURES_TARGET_AVX
+static inline void Transpose4x4PairAVX(__m256& r0, __m256& r1, __m256& r2, __m256& r3)
 {
-    // Ensure the system is initialized before validation
-    if (!m_bIsInitialized.load())
-    {
-        #if defined(_DEBUG_MATHPRECALC_)
-            debug.logLevelMessage(LogLevel::LOG_ERROR, L"[MathPrecalculation] Cannot validate tables - system not initialized");
-        #endif
-        return false;
-    }
+    const __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+    const __m256 t1 = _mm256_unpackhi_ps(r0, r1);
+    const __m256 t2 = _mm256_unpacklo_ps(r2, r3);
+    const __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+    r0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+    r1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+    r2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+    r3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+}
 
-    bool isValid = true;
+// Two output rows per 256-bit operation, b's rows broadcast to both halves
+CPUFEATURES_TARGET_AVX
+static inline void MultiplyMatrixAVX(const float* a, const float* b, float* out)
+{
+    const __m256 b0 = LoadFloat4PairAVX(b, b);
+    const __m256 b1 = LoadFloat4PairAVX(b + 4, b + 4);
+    const __m256 b2 = LoadFloat4PairAVX(b + 8, b + 8);
+    const __m256 b3 = LoadFloat4PairAVX(b + 12, b + 12);
+    const __m256 a01 = _mm256_loadu_ps(a);
+    const __m256 a23 = _mm256_loadu_ps(a + 8);
+
+    __m256 r01 = _mm256_mul_ps(_mm256_permute_ps(a01, _MM_SHUFFLE(0, 0, 0, 0)), b0);
+    __m256 r23 = _mm256_mul_ps(_mm256_permute_ps(a23, _MM_SHUFFLE(0, 0, 0, 0)), b0);
+    r01 = _mm256_add_ps(r01, _mm256_mul_ps(_mm256_permute_ps(a01, _MM_SHUFFLE(1, 1, 1, 1)), b1));
+    r23 = _mm256_add_ps(r23, _mm256_mul_ps(_mm256_permute_ps(a23, _MM_SHUFFLE(1, 1, 1, 1)), b1));
+    r01 = _mm256_add_ps(r01, _mm256_mul_ps(_mm256_permute_ps(a01, _MM_SHUFFLE(2, 2, 2, 2)), b2));
+    r23 = _mm256_add_ps(r23, _mm256_mul_ps(_mm256_permute_ps(a23, _MM_SHUFFLE(2, 2, 2, 2)), b2));
+    r01 = _mm256_add_ps(r01, _mm256_mul_ps(_mm256_permute_ps(a01, _MM_SHUFFLE(3, 3, 3, 3)), b3));
+    r23 = _mm256_add_ps(r23, _mm256_mul_ps(_mm256_permute_ps(a23, _MM_SHUFFLE(3, 3, 3, 3)), b3));
+
+    _mm256_storeu_ps(out, r01);
+    _mm256_storeu_ps(out + 8, r23);
+}
 
-    // Validate trigonometric table
-    if (m_trigonometricTable.size() != TRIG_TABLE_SIZE)
+CPUFEATURES_TARGET_AVX
+static void MultiplyMatricesAVX(const float* locals, const float* parents, float* out, size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
     {
-        #if defined(_DEBUG_MATHPRECALC_)
-            debug.logLevelMessage(LogLevel::LOG_ERROR, L"[MathPrecalculation] Trigonometric table size mismatch");
-        #endif
-        isValid = false;
+        MultiplyMatrixAVX(locals + i * 16, parents + i * 16, out + i * 16);
     }
+}
 
-    // Validate square root table
-    if (m_sqrtTable.size() != SQRT_TABLE_SIZE)
+CPUFEATURES_TARGET_AVX
+static void ComputeHierarchyAVX(const float* locals, const int* parentIndices, float* out, size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
     {
-        #if defined(_DEBUG_MATHPRECALC_)
-            debug.logLevelMessage(LogLevel::LOG_ERROR, L"[MathPrecalculation] Square root table size mismatch");
-        #endif
-        isValid = false;
+        if (parentIndices[i] < 0)
+        {
+            if (out != locals)
+            {
+                memcpy(out + i * 16, locals + i * 16, 16 * sizeof(float));
+            }
+            continue;
+        }
+        MultiplyMatrixAVX(locals + i * 16, out + static_cast<size_t>(parentIndices[i]) * 16, out + i * 16);
     }
+}
 
-    // Validate interpolation table
-    if (m_interpolationTable.size() != INTERPOLATION_TABLE_SIZE)
+CPUFEATURES_TARGET_AVX
+static size_t ComposeTransformsAVX(const float* positions, const float* rotations, const float* scales, float* out, size_t count)
+{
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 two = _mm256_set1_ps(2.0f);
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const float* q = rotations + i * 4;
+        __m256 x = LoadFloat4PairAVX(q, q + 16);
+        __m256 y = LoadFloat4PairAVX(q + 4, q + 20);
+        __m256 z = LoadFloat4PairAVX(q + 8, q + 24);
+        __m256 w = LoadFloat4PairAVX(q + 12, q + 28);
+        Transpose4x4PairAVX(x, y, z, w);
+
+        const __m256 xx = _mm256_mul_ps(x, x);
+        const __m256 yy = _mm256_mul_ps(y, y);
+        const __m256 zz = _mm256_mul_ps(z, z);
+        const __m256 xy = _mm256_mul_ps(x, y);
+        const __m256 xz = _mm256_mul_ps(x, z);
+        const __m256 yz = _mm256_mul_ps(y, z);
+        const __m256 xw = _mm256_mul_ps(x, w);
+        const __m256 yw = _mm256_mul_ps(y, w);
+        const __m256 zw = _mm256_mul_ps(z, w);
+
+        __m256 r00 = _mm256_sub_ps(one, _mm256_mul_ps(two, _mm256_add_ps(yy, zz)));
+        __m256 r01 = _mm256_mul_ps(two, _mm256_add_ps(xy, zw));
+        __m256 r02 = _mm256_mul_ps(two, _mm256_sub_ps(xz, yw));
+        __m256 r10 = _mm256_mul_ps(two, _mm256_sub_ps(xy, zw));
+        __m256 r11 = _mm256_sub_ps(one, _mm256_mul_ps(two, _mm256_add_ps(xx, zz)));
+        __m256 r12 = _mm256_mul_ps(two, _mm256_add_ps(yz, xw));
+        __m256 r20 = _mm256_mul_ps(two, _mm256_add_ps(xz, yw));
+        __m256 r21 = _mm256_mul_ps(two, _mm256_sub_ps(yz, xw));
+        __m256 r22 = _mm256_sub_ps(one, _mm256_mul_ps(two, _mm256_add_ps(xx, yy)));
+
+        if (scales)
+        {
+            __m256 sx, sy, sz;
+            LoadFloat3x8AVX(scales + i * 3, sx, sy, sz);
+            r00 = _mm256_mul_ps(r00, sx);
+            r01 = _mm256_mul_ps(r01, sx);
+            r02 = _mm256_mul_ps(r02, sx);
+            r10 = _mm256_mul_ps(r10, sy);
+            r11 = _mm256_mul_ps(r11, sy);
+            r12 = _mm256_mul_ps(r12, sy);
+            r20 = _mm256_mul_ps(r20, sz);
+            r21 = _mm256_mul_ps(r21, sz);
+            r22 = _mm256_mul_ps(r22, sz);
+        }
+
+        __m256 tx, ty, tz;
+        LoadFloat3x8AVX(positions + i * 3, tx, ty, tz);
+
+        __m256 row0[4] = { r00, r01, r02, _mm256_setzero_ps() };
+        __m256 row1[4] = { r10, r11, r12, _mm256_setzero_ps() };
+        __m256 row2[4] = { r20, r21, r22, _mm256_setzero_ps() };
+        __m256 row3[4] = { tx, ty, tz, one };
+        Transpose4x4PairAVX(row0[0], row0[1], row0[2], row0[3]);
+        Transpose4x4PairAVX(row1[0], row1[1], row1[2], row1[3]);
+        Transpose4x4PairAVX(row2[0], row2[1], row2[2], row2[3]);
+        Transpose4x4PairAVX(row3[0], row3[1], row3[2], row3[3]);
+
+        for (int lane = 0; lane < 4; ++lane)
+        {
+            float* low = out + (i + lane) * 16;
+            float* high = out + (i + lane + 4) * 16;
+            StoreFloat4PairAVX(low, high, row0[lane]);
+            StoreFloat4PairAVX(low + 4, high + 4, row1[lane]);
+            StoreFloat4PairAVX(low + 8, high + 8, row2[lane]);
+            StoreFloat4PairAVX(low + 12, high + 12, row3[lane]);
+        }
+    }
+
+    return i;
+}
+
+CPUFEATURES_TARGET_AVX
+static size_t TransformFloat3AVX(const float* matrix, const float* in, float* out, bool isPoint, size_t count)
+{
+    const __m256 m00 = _mm256_set1_ps(matrix[0]);
+    const __m256 m01 = _mm256_set1_ps(matrix[1]);
+    const __m256 m02 = _mm256_set1_ps(matrix[2]);
+    const __m256 m10 = _mm256_set1_ps(matrix[4]);
+    const __m256 m11 = _mm256_set1_ps(matrix[5]);
+    const __m256 m12 = _mm256_set1_ps(matrix[6]);
+    const __m256 m20 = _mm256_set1_ps(matrix[8]);
+    const __m256 m21 = _mm256_set1_ps(matrix[9]);
+    const __m256 m22 = _mm256_set1_ps(matrix[10]);
+    const __m256 m30 = _mm256_set1_ps(isPoint ? matrix[12] : 0.0f);
+    const __m256 m31 = _mm256_set1_ps(isPoint ? matrix[13] : 0.0f);
+    const __m256 m32 = _mm256_set1_ps(isPoint ? matrix[14] : 0.0f);
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m256 x, y, z;
+        LoadFloat3x8AVX(in + i * 3, x, y, z);
+
+        __m256 outX = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, m00), _mm256_mul_ps(y, m10)), _mm256_mul_ps(z, m20));
+        __m256 outY = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, m01), _mm256_mul_ps(y, m11)), _mm256_mul_ps(z, m21));
+        __m256 outZ = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, m02), _mm256_mul_ps(y, m12)), _mm256_mul_ps(z, m22));
+        if (isPoint)
+        {
+            outX = _mm256_add_ps(outX, m30);
+            outY = _mm256_add_ps(outY, m31);
+            outZ = _mm256_add_ps(outZ, m32);
+        }
+
+        StoreFloat3x8AVX(out + i * 3, outX, outY, outZ);
+    }
+
+    return i;
+}
+#endif
+
+// Per-call dispatch shared by the Matrix4x4 and XMMATRIX entry points
+static void ComposeTransformsKernel(const float* positions, const float* rotations, const float* scales, float* out, size_t count)
+{
+    size_t processed = 0;
+#if defined(CPUFEATURES_X86)
+    processed = GetCPUFeatures().hasAVX ?
+        ComposeTransformsAVX(positions, rotations, scales, out, count) :
+        ComposeTransformsSSE2(positions, rotations, scales, out, count);
+#endif
+    ComposeTransformsScalar(positions, rotations, scales, out, processed, count);
+}
+
+static void MultiplyMatricesKernel(const float* locals, const float* parents, float* out, size_t count)
+{
+#if defined(CPUFEATURES_X86)
+    if (GetCPUFeatures().hasAVX)
     {
-        #if defined(_DEBUG_MATHPRECALC_)
-            debug.logLevelMessage(LogLevel::LOG_ERROR, L"[MathPrecalculation] Interpolation table size mismatch");
-        #endif
-        isValid = false;
+        MultiplyMatricesAVX(locals, parents, out, count);
+        return;
     }
 
-    // Validate particle directions table
-    if (m_particleDirections.size() != PARTICLE_ANGLE_DIVISIONS)
+    for (size_t i = 0; i < count; ++i)
     {
-        #if defined(_DEBUG_MATHPRECALC_)
-            debug.logLevelMessage(LogLevel::LOG_ERROR, L"[MathPrecalculation] Particle directions table size mismatch");
-        #endif
-        isValid = false;
+        MultiplyMatrixSSE2(locals + i * 16, parents + i * 16, out + i * 16);
     }
+#else
+    for (size_t i = 0; i < count; ++i)
+    {
+        MultiplyMatrixScalar(locals + i * 16, parents + i * 16, out + i * 16);
+    }
+#endif
+}
 
-    // Sample validation of trigonometric values
-    if (!m_trigonometricTable.empty())
+static bool ComputeHierarchyKernel(const float* locals, const int* parentIndices, float* out, size_t count)
+{
+    // Parents must already be resolved when their children are reached
+    for (size_t i = 0; i < count; ++i)
     {
-        const TrigonometricData& zeroData = m_trigonometricTable[0];
-        if (std::abs(zeroData.sine - 0.0f) > 1e-6f || std::abs(zeroData.cosine - 1.0f) > 1e-6f)
+        if (parentIndices[i] >= 0 && static_cast<size_t>(parentIndices[i]) >= i)
         {
-            #if defined(_DEBUG_MATHPRECALC_)
-                debug.logLevelMessage(LogLevel::LOG_ERROR, L"[MathPrecalculation] Trigonometric values at angle 0 are incorrect");
-            #endif
-            isValid = false;
+            return false;
+        }
+    }
+
+#if defined(CPUFEATURES_X86)
+    if (GetCPUFeatures().hasAVX)
+    {
+        ComputeHierarchyAVX(locals, parentIndices, out, count);
+        return true;
+    }
+#endif
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (parentIndices[i] < 0)
+        {
+            if (out != locals)
+            {
+                memcpy(out + i * 16, locals + i * 16, 16 * sizeof(float));
+            }
+            continue;
+        }
+
+        const float* parent = out + static_cast<size_t>(parentIndices[i]) * 16;
+#if defined(CPUFEATURES_X86)
+        MultiplyMatrixSSE2(locals + i * 16, parent, out + i * 16);
+#else
+        MultiplyMatrixScalar(locals + i * 16, parent, out + i * 16);
+#endif
+    }
+    return true;
+}
+
+static void TransformFloat3Kernel(const float* matrix, const float* in, float* out, bool isPoint, size_t count)
+{
+    size_t processed = 0;
+#if defined(CPUFEATURES_X86)
+    processed = GetCPUFeatures().hasAVX ?
+        TransformFloat3AVX(matrix, in, out, isPoint, count) :
+        TransformFloat3SSE2(matrix, in, out, isPoint, count);
+#endif
+    TransformFloat3Scalar(matrix, in, out, isPoint, processed, count);
+}
+
+//==============================================================================
+// Batch Matrix Transform Methods
+//==============================================================================
+void MathPrecalculation::ComposeTransformsBatch(const XMFLOAT3* positions, const XMFLOAT4* rotations, const XMFLOAT3* scales,
+    Matrix4x4* outMatrices, size_t count) const
+{
+    if (!positions || !rotations || !outMatrices)
+    {
+        return;
+    }
+
+    ComposeTransformsKernel(reinterpret_cast<const float*>(positions), reinterpret_cast<const float*>(rotations),
+        reinterpret_cast<const float*>(scales), reinterpret_cast<float*>(outMatrices), count);
+}
+
+void MathPrecalculation::MultiplyMatricesBatch(const Matrix4x4* locals, const Matrix4x4* parents, Matrix4x4* outMatrices, size_t count) const
+{
+    if (!locals || !parents || !outMatrices)
+    {
+        return;
+    }
+
+    MultiplyMatricesKernel(reinterpret_cast<const float*>(locals), reinterpret_cast<const float*>(parents),
+        reinterpret_cast<float*>(outMatrices), count);
+}
+
+bool MathPrecalculation::ComputeHierarchyBatch(const Matrix4x4* locals, const int* parentIndices, Matrix4x4* outWorld, size_t count) const
+{
+    if (!locals || !parentIndices || !outWorld)
+    {
+        return false;
+    }
+
+    return ComputeHierarchyKernel(reinterpret_cast<const float*>(locals), parentIndices, reinterpret_cast<float*>(outWorld), count);
+}
+
+void MathPrecalculation::TransformPointsBatch(const Matrix4x4& matrix, const XMFLOAT3* points, XMFLOAT3* outPoints, size_t count) const
+{
+    if (!points || !outPoints)
+    {
+        return;
+    }
+
+    TransformFloat3Kernel(reinterpret_cast<const float*>(&matrix), reinterpret_cast<const float*>(points),
+        reinterpret_cast<float*>(outPoints), true, count);
+}
+
+void MathPrecalculation::TransformNormalsBatch(const Matrix4x4& matrix, const XMFLOAT3* normals, XMFLOAT3* outNormals, size_t count) const
+{
+    if (!normals || !outNormals)
+    {
+        return;
+    }
+
+    TransformFloat3Kernel(reinterpret_cast<const float*>(&matrix), reinterpret_cast<const float*>(normals),
+        reinterpret_cast<float*>(outNormals), false, count);
+}
+
+#if defined(__USE_DIRECTX_11__) || defined(__USE_DIRECTX_12__) || (defined(__USE_VULKAN__) && defined(PLATFORM_WINDOWS))
+static_assert(sizeof(XMMATRIX) == 16 * sizeof(float), "XMMATRIX must be 16 packed floats");
+
+void MathPrecalculation::ComposeTransformsBatch(const XMFLOAT3* positions, const XMFLOAT4* rotations, const XMFLOAT3* scales,
+    XMMATRIX* outMatrices, size_t count) const
+{
+    if (!positions || !rotations || !outMatrices)
+    {
+        return;
+    }
+
+    ComposeTransformsKernel(reinterpret_cast<const float*>(positions), reinterpret_cast<const float*>(rotations),
+        reinterpret_cast<const float*>(scales), reinterpret_cast<float*>(outMatrices), count);
+}
+
+void MathPrecalculation::MultiplyMatricesBatch(const XMMATRIX* locals, const XMMATRIX* parents, XMMATRIX* outMatrices, size_t count) const
+{
+    if (!locals || !parents || !outMatrices)
+    {
+        return;
+    }
+
+    MultiplyMatricesKernel(reinterpret_cast<const float*>(locals), reinterpret_cast<const float*>(parents),
+        reinterpret_cast<float*>(outMatrices), count);
+}
+
+bool MathPrecalculation::ComputeHierarchyBatch(const XMMATRIX* locals, const int* parentIndices, XMMATRIX* outWorld, size_t count) const
+{
+    if (!locals || !parentIndices || !outWorld)
+    {
+        return false;
+    }
+
+    return ComputeHierarchyKernel(reinterpret_cast<const float*>(locals), parentIndices, reinterpret_cast<float*>(outWorld), count);
+}
+
+void MathPrecalculation::TransformPointsBatch(const XMMATRIX& matrix, const XMFLOAT3* points, XMFLOAT3* outPoints, size_t count) const
+{
+    if (!points || !outPoints)
+    {
+        return;
+    }
+
+    TransformFloat3Kernel(reinterpret_cast<const float*>(&matrix), reinterpret_cast<const float*>(points),
+        reinterpret_cast<float*>(outPoints), true, count);
+}
+
+void MathPrecalculation::TransformNormalsBatch(const XMMATRIX& matrix, const XMFLOAT3* normals, XMFLOAT3* outNormals, size_t count) const
+{
+    if (!normals || !outNormals)
+    {
+        return;
+    }
+
+    TransformFloat3Kernel(reinterpret_cast<const float*>(&matrix), reinterpret_cast<const float*>(normals),
+        reinterpret_cast<float*>(outNormals), false, count);
+}
+#endif
+
+//==============================================================================
+// Text Rendering Optimization Methods
+//==============================================================================
+float MathPrecalculation::GetCharacterWidthFast(wchar_t character, float fontSize) const
+{
+    // Ensure the text tables are built before attempting lookup
+    if (!AcquireTableFamily(MathTableFamily::Text))
+    {
+        return fontSize * 0.6f;  // Fallback estimate
+    }
+
+    // Look up character width in cache
+    auto it = m_characterWidthCache.find(character);
+    if (it != m_characterWidthCache.end())
+    {
+        CountMathLookup();
+        return it->second * fontSize;
+    }
+
+    // Fallback for characters not in cache
+    return fontSize * 0.6f;  // Default character width estimate
+}
+
+float MathPrecalculation::GetTextTransparencyFast(float position, float regionStart, float regionEnd, float fadeDistance) const
+{
+    // Ensure the text tables are built before attempting lookup
+    if (!AcquireTableFamily(MathTableFamily::Text))
+    {
+        // Fallback calculation
+        if (position < regionStart - fadeDistance || position > regionEnd + fadeDistance)
+        {
+            return 0.0f;  // Completely transparent
+        }
+
+        if (position < regionStart)
+        {
+            float distanceFromStart = regionStart - position;
+            return 1.0f - (distanceFromStart / fadeDistance);
+        }
+
+        if (position > regionEnd)
+        {
+            float distanceFromEnd = position - regionEnd;
+            return 1.0f - (distanceFromEnd / fadeDistance);
+        }
+
+        return 1.0f;  // Fully opaque
+    }
+
+    // Calculate normalized position within the transparency range
+    float totalRange = (regionEnd + fadeDistance) - (regionStart - fadeDistance);
+    if (totalRange <= 0.0f)
+    {
+        return 1.0f;
+    }
+
+    float normalizedPos = (position - (regionStart - fadeDistance)) / totalRange;
+    normalizedPos = std::clamp(normalizedPos, 0.0f, 1.0f);
+
+    // Convert to lookup table index
+    int index = static_cast<int>(normalizedPos * (m_transparencyLookup.size() - 1));
+    index = std::clamp(index, 0, static_cast<int>(m_transparencyLookup.size() - 1));
+
+    // Increment lookup counter for statistics
+    CountMathLookup();
+
+    // Return precalculated transparency value
+    return m_transparencyLookup[index];
+}
+
+//==============================================================================
+// Utility Methods
+//==============================================================================
+size_t MathPrecalculation::GetMemoryUsage() const
+{
+    size_t totalMemory = 0;
+
+    // Ready families are immutable, so they can be measured without the lock; a family that is still
+    // being built is not counted until it is published
+    for (int i = 0; i < MATH_TABLE_FAMILY_COUNT; ++i)
+    {
+        if (m_tableFamilyState[i].load(std::memory_order_acquire) == TableFamilyState::Ready)
+        {
+            size_t heapBytes = 0;
+            size_t readOnlyBytes = 0;
+            MeasureTableFamily(static_cast<MathTableFamily>(i), heapBytes, readOnlyBytes);
+            totalMemory += heapBytes + readOnlyBytes;
+        }
+    }
+
+    return totalMemory;
+}
+
+MathMemoryBudget MathPrecalculation::GetMemoryBudget() const
+{
+    MathMemoryBudget budget = {};
+    budget.budgetBytes = m_config.memoryBudgetBytes;
+
+    for (int i = 0; i < MATH_TABLE_FAMILY_COUNT; ++i)
+    {
+        const MathTableFamily family = static_cast<MathTableFamily>(i);
+        const TableFamilyState state = m_tableFamilyState[i].load(std::memory_order_acquire);
+
+        MathTableFamilyUsage& usage = budget.families[i];
+        usage.name = GetTableFamilyName(family);
+        usage.tableSize = GetTableFamilySize(family);
+        usage.isReady = (state == TableFamilyState::Ready);
+        usage.isOverBudget = (state == TableFamilyState::OverBudget);
+        usage.projectedHeapBytes = ProjectTableFamilyHeapBytes(family);
+
+        if (usage.isReady)
+        {
+            MeasureTableFamily(family, usage.heapBytes, usage.readOnlyBytes);
         }
+
+        budget.heapBytes += usage.heapBytes;
+        budget.readOnlyBytes += usage.readOnlyBytes;
+        budget.projectedHeapBytes += usage.projectedHeapBytes;
     }
 
-    // Validate inverse trigonometric table
-    if (m_inverseTrigonometricTable.size() != INVERSE_TRIG_TABLE_SIZE)
+    return budget;
+}
+
+void MathPrecalculation::MeasureTableFamily(MathTableFamily family, size_t& outHeapBytes, size_t& outReadOnlyBytes) const
+{
+    // tableBytes covers everything the family's lookups read, heapBytes the part the builders allocated
+    size_t tableBytes = 0;
+    size_t heapBytes = 0;
+
+    switch (family)
+    {
+    case MathTableFamily::Trigonometric:
+        tableBytes = m_trigonometricTable.size() * sizeof(TrigonometricData);
+        heapBytes = m_trigonometricStorage.size() * sizeof(TrigonometricData);
+        break;
+
+    case MathTableFamily::SquareRoot:
+        tableBytes = m_sqrtTable.size() * sizeof(float);
+        heapBytes = m_sqrtStorage.size() * sizeof(float);
+        break;
+
+    case MathTableFamily::InverseTrigonometric:
+        tableBytes = m_inverseTrigonometricTable.size() * sizeof(InverseTrigonometricData);
+        heapBytes = m_inverseTrigonometricStorage.size() * sizeof(InverseTrigonometricData);
+        break;
+
+    case MathTableFamily::ColorConversion:
+        heapBytes = m_colorConversionTable.size() * sizeof(ColorConversionData);
+        heapBytes += m_yuvToRgbStorage.size() * sizeof(uint8_t);
+        heapBytes += m_clampStorage.size() * sizeof(uint8_t);
+        tableBytes = m_colorConversionTable.size() * sizeof(ColorConversionData);
+        tableBytes += m_yuvToRgbLookup.size() * sizeof(uint8_t);                 // Vector-based YUV lookup
+        tableBytes += m_clampTable.size() * sizeof(uint8_t);
+        break;
+
+    case MathTableFamily::Interpolation:
+        tableBytes = m_interpolationTable.size() * sizeof(InterpolationData);
+        heapBytes = m_interpolationStorage.size() * sizeof(InterpolationData);
+        break;
+
+    case MathTableFamily::Particle:
+        heapBytes = m_particleDirections.size() * sizeof(ParticleData);
+        for (const auto& pair : m_explosionPatterns)
+        {
+            heapBytes += pair.second.size() * sizeof(XMFLOAT2);
+        }
+        tableBytes = heapBytes;
+        break;
+
+    case MathTableFamily::MatrixCache:
+        heapBytes = m_scaleMatrixCache.size() * (sizeof(int) + sizeof(XMMATRIX));
+        heapBytes += m_rotationMatrixCache.size() * (sizeof(int) + sizeof(XMMATRIX));
+        tableBytes = heapBytes;
+        break;
+
+    case MathTableFamily::Text:
+        heapBytes = m_characterWidthCache.size() * (sizeof(wchar_t) + sizeof(float));
+        heapBytes += m_transparencyStorage.size() * sizeof(float);
+        tableBytes = m_characterWidthCache.size() * (sizeof(wchar_t) + sizeof(float));
+        tableBytes += m_transparencyLookup.size() * sizeof(float);
+        break;
+
+    case MathTableFamily::Physics:
+        heapBytes = m_gravityIntensityTable.size() * sizeof(GravityIntensityData);
+        heapBytes += m_reflectionAngleTable.size() * sizeof(ReflectionAngleData);
+        heapBytes += m_inertiaTable.size() * sizeof(InertiaData);
+        heapBytes += m_collisionResponseTable.size() * sizeof(CollisionResponseData);
+        heapBytes += m_audioAttenuationTable.size() * sizeof(AudioAttenuationData);
+        heapBytes += m_orbitalMechanicsTable.size() * sizeof(OrbitalMechanicsData);
+        tableBytes = heapBytes;
+        break;
+
+    default:
+        break;
+    }
+
+    outHeapBytes = heapBytes;
+    outReadOnlyBytes = tableBytes - heapBytes;
+}
+
+size_t MathPrecalculation::ProjectTableFamilyHeapBytes(MathTableFamily family) const
+{
+    const MathPrecalculationConfig& config = m_config;
+
+    switch (family)
+    {
+    case MathTableFamily::Trigonometric:
+        return IsGeneratedTableSize(config.trigonometricTableSize, TRIG_TABLE_SIZE) ? 0 :
+            static_cast<size_t>(config.trigonometricTableSize) * sizeof(TrigonometricData);
+
+    case MathTableFamily::SquareRoot:
+        return IsGeneratedTableSize(config.sqrtTableSize, SQRT_TABLE_SIZE) ? 0 :
+            static_cast<size_t>(config.sqrtTableSize) * sizeof(float);
+
+    case MathTableFamily::InverseTrigonometric:
+        return IsGeneratedTableSize(config.inverseTrigTableSize, INVERSE_TRIG_TABLE_SIZE) ? 0 :
+            static_cast<size_t>(config.inverseTrigTableSize) * sizeof(InverseTrigonometricData);
+
+    case MathTableFamily::ColorConversion:
+    {
+        const size_t divisions = static_cast<size_t>(config.yuvTableDivisions);
+        size_t bytes = static_cast<size_t>(COLOR_CONVERSION_TABLE_SIZE) * sizeof(ColorConversionData);
+        bytes += IsGeneratedTableSize(config.yuvTableDivisions, YUV_RGB_TABLE_DIVISIONS) ? 0 : divisions * divisions * divisions * 3;
+        bytes += IsGeneratedTableSize(CLAMP_TABLE_SIZE, CLAMP_TABLE_SIZE) ? 0 : CLAMP_TABLE_SIZE;
+        return bytes;
+    }
+
+    case MathTableFamily::Interpolation:
+        return IsGeneratedTableSize(config.interpolationTableSize, INTERPOLATION_TABLE_SIZE) ? 0 :
+            static_cast<size_t>(config.interpolationTableSize) * sizeof(InterpolationData);
+
+    case MathTableFamily::Particle:
+    {
+        size_t bytes = static_cast<size_t>(config.particleAngleDivisions) * sizeof(ParticleData);
+        for (int particleCount : EXPLOSION_PARTICLE_COUNTS)
+        {
+            bytes += static_cast<size_t>(particleCount) * sizeof(XMFLOAT2);
+        }
+        return bytes;
+    }
+
+    case MathTableFamily::MatrixCache:
+    {
+        const size_t matrixCount = std::size(CACHED_MATRIX_SCALES) + (360 / CACHED_ROTATION_STEP_DEGREES) * 3;
+        return matrixCount * (sizeof(int) + sizeof(XMMATRIX));
+    }
+
+    case MathTableFamily::Text:
+    {
+        // The character list holds no duplicates, so each character is one cache entry
+        size_t bytes = (std::size(CACHED_TEXT_CHARACTERS) - 1) * (sizeof(wchar_t) + sizeof(float));
+        bytes += IsGeneratedTableSize(config.transparencyTableSize, TRANSPARENCY_TABLE_SIZE) ? 0 :
+            static_cast<size_t>(config.transparencyTableSize) * sizeof(float);
+        return bytes;
+    }
+
+    case MathTableFamily::Physics:
+        return GRAVITY_INTENSITY_TABLE_SIZE * sizeof(GravityIntensityData) +
+            REFLECTION_ANGLE_TABLE_SIZE * sizeof(ReflectionAngleData) +
+            INERTIA_COEFFICIENT_TABLE_SIZE * sizeof(InertiaData) +
+            COLLISION_RESPONSE_TABLE_SIZE * sizeof(CollisionResponseData) +
+            AUDIO_ATTENUATION_TABLE_SIZE * sizeof(AudioAttenuationData) +
+            ORBITAL_MECHANICS_TABLE_SIZE * sizeof(OrbitalMechanicsData);
+
+    default:
+        return 0;
+    }
+}
+
+int MathPrecalculation::GetTableFamilySize(MathTableFamily family) const
+{
+    switch (family)
+    {
+    case MathTableFamily::Trigonometric:        return m_config.trigonometricTableSize;
+    case MathTableFamily::SquareRoot:           return m_config.sqrtTableSize;
+    case MathTableFamily::InverseTrigonometric: return m_config.inverseTrigTableSize;
+    case MathTableFamily::ColorConversion:      return m_config.yuvTableDivisions;
+    case MathTableFamily::Interpolation:        return m_config.interpolationTableSize;
+    case MathTableFamily::Particle:             return m_config.particleAngleDivisions;
+    case MathTableFamily::Text:                 return m_config.transparencyTableSize;
+    default:                                    return 0;
+    }
+}
+
+bool MathPrecalculation::ValidateTables() const
+{
+    // Ensure the system is initialized before validation
+    if (!m_bIsInitialized.load())
     {
         #if defined(_DEBUG_MATHPRECALC_)
-            debug.logLevelMessage(LogLevel::LOG_ERROR, L"[MathPrecalculation] Inverse trigonometric table size mismatch");
+            debug.logLevelMessage(LogLevel::LOG_ERROR, L"[MathPrecalculation] Cannot validate tables - system not initialized");
         #endif
-        isValid = false;
+        return false;
     }
 
-    // Sample validation of inverse trigonometric values
-    if (!m_inverseTrigonometricTable.empty())
+    bool isValid = true;
+
+    // Only families that have been built are validated - the others hold no tables yet
+    if (IsTableFamilyReady(MathTableFamily::Trigonometric))
     {
-        // Validate arcsine(0) = 0
-        int zeroIndex = INVERSE_TRIG_TABLE_SIZE / 2;  // Middle index corresponds to input value 0
-        const InverseTrigonometricData& zeroData = m_inverseTrigonometricTable[zeroIndex];
-        if (std::abs(zeroData.arcSine - 0.0f) > 1e-6f)
+        // Validate trigonometric table
+        if (m_trigonometricTable.size() != static_cast<size_t>(m_config.trigonometricTableSize))
         {
             #if defined(_DEBUG_MATHPRECALC_)
-                debug.logLevelMessage(LogLevel::LOG_ERROR, L"[MathPrecalculation] Inverse trigonometric values at input 0 are incorrect");
+                debug.logLevelMessage(LogLevel::LOG_ERROR, L"[MathPrecalculation] Trigonometric table size mismatch");
             #endif
             isValid = false;
         }
+
+        // Sample validation of trigonometric values
+        if (!m_trigonometricTable.empty())
+        {
+            const TrigonometricData& zeroData = m_trigonometricTable[0];
+            if (std::abs(zeroData.sine - 0.0f) > 1e-6f || std::abs(zeroData.cosine - 1.0f) > 1e-6f)
+            {
+                #if defined(_DEBUG_MATHPRECALC_)
+                    debug.logLevelMessage(LogLevel::LOG_ERROR, L"[MathPrecalculation] Trigonometric values at angle 0 are incorrect");
+                #endif
+                isValid = false;
+            }
+        }
     }
 
-    // Validate physics-specific tables
-    if (m_gravityIntensityTable.size() != GRAVITY_INTENSITY_TABLE_SIZE)
+    // Validate square root table
+    if (IsTableFamilyReady(MathTableFamily::SquareRoot) && m_sqrtTable.size() != static_cast<size_t>(m_config.sqrtTableSize))
     {
         #if defined(_DEBUG_MATHPRECALC_)
-            debug.logLevelMessage(LogLevel::LOG_ERROR, L"[MathPrecalculation] Gravity intensity table size mismatch");
+            debug.logLevelMessage(LogLevel::LOG_ERROR, L"[MathPrecalculation] Square root table size mismatch");
         #endif
         isValid = false;
     }
 
-    if (m_reflectionAngleTable.size() != REFLECTION_ANGLE_TABLE_SIZE)
+    // Validate interpolation table
+    if (IsTableFamilyReady(MathTableFamily::Interpolation) && m_interpolationTable.size() != static_cast<size_t>(m_config.interpolationTableSize))
     {
         #if defined(_DEBUG_MATHPRECALC_)
-            debug.logLevelMessage(LogLevel::LOG_ERROR, L"[MathPrecalculation] Reflection angle table size mismatch");
+            debug.logLevelMessage(LogLevel::LOG_ERROR, L"[MathPrecalculation] Interpolation table size mismatch");
         #endif
         isValid = false;
     }
 
-    if (m_inertiaTable.size() != INERTIA_COEFFICIENT_TABLE_SIZE)
+    // Validate particle directions table
+    if (IsTableFamilyReady(MathTableFamily::Particle) && m_particleDirections.size() != static_cast<size_t>(m_config.particleAngleDivisions))
     {
         #if defined(_DEBUG_MATHPRECALC_)
-            debug.logLevelMessage(LogLevel::LOG_ERROR, L"[MathPrecalculation] Inertia coefficient table size mismatch");
+            debug.logLevelMessage(LogLevel::LOG_ERROR, L"[MathPrecalculation] Particle directions table size mismatch");
         #endif
         isValid = false;
     }
 
-    if (m_collisionResponseTable.size() != COLLISION_RESPONSE_TABLE_SIZE)
+    if (IsTableFamilyReady(MathTableFamily::InverseTrigonometric))
     {
-        #if defined(_DEBUG_MATHPRECALC_)
-            debug.logLevelMessage(LogLevel::LOG_ERROR, L"[MathPrecalculation] Collision response table size mismatch");
-        #endif
-        isValid = false;
+        // Validate inverse trigonometric table
+        if (m_inverseTrigonometricTable.size() != static_cast<size_t>(m_config.inverseTrigTableSize))
+        {
+            #if defined(_DEBUG_MATHPRECALC_)
+                debug.logLevelMessage(LogLevel::LOG_ERROR, L"[MathPrecalculation] Inverse trigonometric table size mismatch");
+            #endif
+            isValid = false;
+        }
+
+        // Sample validation of inverse trigonometric values
+        if (!m_inverseTrigonometricTable.empty())
+        {
+            // Validate arcsine(0) = 0 - the middle entry is within one table step of input 0
+            int zeroIndex = static_cast<int>(m_inverseTrigonometricTable.size() / 2);
+            const InverseTrigonometricData& zeroData = m_inverseTrigonometricTable[zeroIndex];
+            if (std::abs(zeroData.arcSine - 0.0f) > 1.0f / m_inverseTrigPrecisionFactor)
+            {
+                #if defined(_DEBUG_MATHPRECALC_)
+                    debug.logLevelMessage(LogLevel::LOG_ERROR, L"[MathPrecalculation] Inverse trigonometric values at input 0 are incorrect");
+                #endif
+                isValid = false;
+            }
+        }
     }
 
-    if (m_audioAttenuationTable.size() != AUDIO_ATTENUATION_TABLE_SIZE)
+    // Validate the YUV to RGB table
+    if (IsTableFamilyReady(MathTableFamily::ColorConversion))
     {
-        #if defined(_DEBUG_MATHPRECALC_)
-            debug.logLevelMessage(LogLevel::LOG_ERROR, L"[MathPrecalculation] Audio attenuation table size mismatch");
-        #endif
-        isValid = false;
+        const size_t divisions = static_cast<size_t>(m_config.yuvTableDivisions);
+        if (m_yuvToRgbLookup.size() != divisions * divisions * divisions * 3 || m_clampTable.size() != CLAMP_TABLE_SIZE)
+        {
+            #if defined(_DEBUG_MATHPRECALC_)
+                debug.logLevelMessage(LogLevel::LOG_ERROR, L"[MathPrecalculation] Color conversion table size mismatch");
+            #endif
+            isValid = false;
+        }
     }
 
-    if (m_orbitalMechanicsTable.size() != ORBITAL_MECHANICS_TABLE_SIZE)
+    // Validate the text fade curve
+    if (IsTableFamilyReady(MathTableFamily::Text) && m_transparencyLookup.size() != static_cast<size_t>(m_config.transparencyTableSize))
     {
         #if defined(_DEBUG_MATHPRECALC_)
-            debug.logLevelMessage(LogLevel::LOG_ERROR, L"[MathPrecalculation] Orbital mechanics table size mismatch");
+            debug.logLevelMessage(LogLevel::LOG_ERROR, L"[MathPrecalculation] Transparency table size mismatch");
         #endif
         isValid = false;
     }
 
+    // Validate physics-specific tables
+    if (IsTableFamilyReady(MathTableFamily::Physics))
+    {
+        if (m_gravityIntensityTable.size() != GRAVITY_INTENSITY_TABLE_SIZE)
+        {
+            #if defined(_DEBUG_MATHPRECALC_)
+                debug.logLevelMessage(LogLevel::LOG_ERROR, L"[MathPrecalculation] Gravity intensity table size mismatch");
+            #endif
+            isValid = false;
+        }
+
+        if (m_reflectionAngleTable.size() != REFLECTION_ANGLE_TABLE_SIZE)
+        {
+            #if defined(_DEBUG_MATHPRECALC_)
+                debug.logLevelMessage(LogLevel::LOG_ERROR, L"[MathPrecalculation] Reflection angle table size mismatch");
+            #endif
+            isValid = false;
+        }
+
+        if (m_inertiaTable.size() != INERTIA_COEFFICIENT_TABLE_SIZE)
+        {
+            #if defined(_DEBUG_MATHPRECALC_)
+                debug.logLevelMessage(LogLevel::LOG_ERROR, L"[MathPrecalculation] Inertia coefficient table size mismatch");
+            #endif
+            isValid = false;
+        }
+
+        if (m_collisionResponseTable.size() != COLLISION_RESPONSE_TABLE_SIZE)
+        {
+            #if defined(_DEBUG_MATHPRECALC_)
+                debug.logLevelMessage(LogLevel::LOG_ERROR, L"[MathPrecalculation] Collision response table size mismatch");
+            #endif
+            isValid = false;
+        }
+
+        if (m_audioAttenuationTable.size() != AUDIO_ATTENUATION_TABLE_SIZE)
+        {
+            #if defined(_DEBUG_MATHPRECALC_)
+                debug.logLevelMessage(LogLevel::LOG_ERROR, L"[MathPrecalculation] Audio attenuation table size mismatch");
+            #endif
+            isValid = false;
+        }
+
+        if (m_orbitalMechanicsTable.size() != ORBITAL_MECHANICS_TABLE_SIZE)
+        {
+            #if defined(_DEBUG_MATHPRECALC_)
+                debug.logLevelMessage(LogLevel::LOG_ERROR, L"[MathPrecalculation] Orbital mechanics table size mismatch");
+            #endif
+            isValid = false;
+        }
+    }
+
 #if defined(_DEBUG_MATHPRECALC_)
     if (isValid)
     {
-        debug.logLevelMessage(LogLevel::LOG_INFO, L"[MathPrecalculation] All lookup tables validated successfully");
+        debug.logLevelMessage(LogLevel::LOG_INFO, L"[MathPrecalculation] All built lookup tables validated successfully");
     }
     else
     {
@@ -1708,31 +3375,218 @@ bool MathPrecalculation::ValidateTables() const
 void MathPrecalculation::DumpTableStatistics() const
 {
 #if defined(_DEBUG_MATHPRECALC_)
+    const MathMemoryBudget budget = GetMemoryBudget();
+
     debug.logLevelMessage(LogLevel::LOG_INFO, L"[MathPrecalculation] === Lookup Table Statistics ===");
-    debug.logDebugMessage(LogLevel::LOG_INFO, L"Trigonometric table entries: %d", TRIG_TABLE_SIZE);
-    debug.logDebugMessage(LogLevel::LOG_INFO, L"Inverse trigonometric table entries: %d", INVERSE_TRIG_TABLE_SIZE);
-    debug.logDebugMessage(LogLevel::LOG_INFO, L"Square root table entries: %d", SQRT_TABLE_SIZE);
-    debug.logDebugMessage(LogLevel::LOG_INFO, L"Color conversion entries: %d", COLOR_CONVERSION_TABLE_SIZE);
-    debug.logDebugMessage(LogLevel::LOG_INFO, L"Interpolation table entries: %d", INTERPOLATION_TABLE_SIZE);
-    debug.logDebugMessage(LogLevel::LOG_INFO, L"Particle directions: %d", PARTICLE_ANGLE_DIVISIONS);
+    for (const MathTableFamilyUsage& usage : budget.families)
+    {
+        debug.logDebugMessage(LogLevel::LOG_INFO,
+            L"%hs family: %ls - Size: %d, Heap: %zu bytes, Read-only: %zu bytes, Heap when built: %zu bytes",
+            usage.name, usage.isReady ? L"ready" : (usage.isOverBudget ? L"over budget" : L"not built"),
+            usage.tableSize, usage.heapBytes, usage.readOnlyBytes, usage.projectedHeapBytes);
+    }
     debug.logDebugMessage(LogLevel::LOG_INFO, L"Explosion patterns: %zu", m_explosionPatterns.size());
     debug.logDebugMessage(LogLevel::LOG_INFO, L"Scale matrix cache: %zu", m_scaleMatrixCache.size());
     debug.logDebugMessage(LogLevel::LOG_INFO, L"Rotation matrix cache: %zu", m_rotationMatrixCache.size());
     debug.logDebugMessage(LogLevel::LOG_INFO, L"Character width cache: %zu", m_characterWidthCache.size());
-    debug.logDebugMessage(LogLevel::LOG_INFO, L"Transparency lookup entries: %zu", m_transparencyLookup.size());
-    debug.logDebugMessage(LogLevel::LOG_INFO, L"Total memory usage: %zu bytes", GetMemoryUsage());
-    debug.logDebugMessage(LogLevel::LOG_INFO, L"Total lookups performed: %zu", m_lookupCount.load());
-    debug.logDebugMessage(LogLevel::LOG_INFO, L"Physics-specific lookup tables:");
-    debug.logDebugMessage(LogLevel::LOG_INFO, L"Gravity intensity entries: %zu", m_gravityIntensityTable.size());
-    debug.logDebugMessage(LogLevel::LOG_INFO, L"Reflection angle entries: %zu", m_reflectionAngleTable.size());
-    debug.logDebugMessage(LogLevel::LOG_INFO, L"Inertia coefficient entries: %zu", m_inertiaTable.size());
-    debug.logDebugMessage(LogLevel::LOG_INFO, L"Collision response entries: %zu", m_collisionResponseTable.size());
-    debug.logDebugMessage(LogLevel::LOG_INFO, L"Audio attenuation entries: %zu", m_audioAttenuationTable.size());
-    debug.logDebugMessage(LogLevel::LOG_INFO, L"Orbital mechanics entries: %zu", m_orbitalMechanicsTable.size());
+    debug.logDebugMessage(LogLevel::LOG_INFO, L"Deterministic tables: %ls", UsesGeneratedTables() ? L"build-time generated (read-only data)" : L"built at runtime");
+    debug.logDebugMessage(LogLevel::LOG_INFO, L"Total memory usage: %zu bytes (heap %zu, read-only %zu)", GetMemoryUsage(), budget.heapBytes, budget.readOnlyBytes);
+    debug.logDebugMessage(LogLevel::LOG_INFO, L"Heap budget: %zu bytes (0 = unlimited), all families built: %zu bytes", budget.budgetBytes, budget.projectedHeapBytes);
+    debug.logDebugMessage(LogLevel::LOG_INFO, L"Total lookups performed: %zu", GetLookupCount());
     debug.logLevelMessage(LogLevel::LOG_INFO, L"[MathPrecalculation] === End Statistics ===");
 #endif
 }
 
+size_t MathPrecalculation::GetLookupCount() const
+{
+    return SumMathLookupShards() - m_lookupCountBaseline.load(std::memory_order_relaxed);
+}
+
+void MathPrecalculation::ResetLookupCount()
+{
+    // Shards are only written by their own threads, so a reset records the current total instead
+    m_lookupCountBaseline.store(SumMathLookupShards(), std::memory_order_relaxed);
+}
+
+//==============================================================================
+// Build-Time Table Export
+//==============================================================================
+bool MathPrecalculation::UsesGeneratedTables() const
+{
+#if defined(MATHPRECALC_GENERATED_TABLES)
+    return true;
+#else
+    return false;
+#endif
+}
+
+// Append a float as a hex-float literal - exact, so the generated tables are bit-identical
+static bool AppendFloatLiteral(std::string& out, float value)
+{
+    if (!std::isfinite(value))
+    {
+        return false;
+    }
+
+    char buffer[48];
+    snprintf(buffer, sizeof(buffer), "%af", static_cast<double>(value));
+    out += buffer;
+    return true;
+}
+
+// Append "{a, b, ...}," entries for a table of plain float structs, one entry per line
+template<typename T>
+static bool AppendFloatStructArray(std::string& out, const char* declaration, const MathTableView<T>& table)
+{
+    const size_t fieldCount = sizeof(T) / sizeof(float);
+    static_assert(sizeof(T) % sizeof(float) == 0, "Generated struct tables must hold only floats");
+
+    out += "alignas(64) extern const ";
+    out += declaration;
+    out += " = {\n";
+
+    for (size_t i = 0; i < table.size(); ++i)
+    {
+        float fields[sizeof(T) / sizeof(float)];
+        memcpy(fields, &table[i], sizeof(T));
+
+        out += "    {";
+        for (size_t field = 0; field < fieldCount; ++field)
+        {
+            if (field > 0)
+            {
+                out += ", ";
+            }
+            if (!AppendFloatLiteral(out, fields[field]))
+            {
+                return false;
+            }
+        }
+        out += "},\n";
+    }
+
+    out += "};\n\n";
+    return true;
+}
+
+static bool AppendFloatArray(std::string& out, const char* declaration, const MathTableView<float>& table)
+{
+    out += "alignas(64) extern const ";
+    out += declaration;
+    out += " = {\n";
+
+    for (size_t i = 0; i < table.size(); ++i)
+    {
+        out += ((i % 8) == 0) ? "    " : " ";
+        if (!AppendFloatLiteral(out, table[i]))
+        {
+            return false;
+        }
+        out += ((i % 8) == 7 || i + 1 == table.size()) ? ",\n" : ",";
+    }
+
+    out += "};\n\n";
+    return true;
+}
+
+static void AppendByteArray(std::string& out, const char* declaration, const MathTableView<uint8_t>& table)
+{
+    out += "alignas(64) extern const ";
+    out += declaration;
+    out += " = {\n";
+
+    for (size_t i = 0; i < table.size(); ++i)
+    {
+        out += ((i % 24) == 0) ? "    " : " ";
+        out += std::to_string(table[i]);
+        out += ((i % 24) == 23 || i + 1 == table.size()) ? ",\n" : ",";
+    }
+
+    out += "};\n\n";
+}
+
+bool MathPrecalculation::ExportGeneratedTables(const std::string& filePath) const
+{
+    if (!m_bIsInitialized.load())
+    {
+        debug.logLevelMessage(LogLevel::LOG_ERROR, L"[MathPrecalculation] Cannot export tables - system not initialized");
+        return false;
+    }
+
+    // The generated source declares the default sizes, so other sizes cannot be exported
+    if (m_config.trigonometricTableSize != TRIG_TABLE_SIZE || m_config.sqrtTableSize != SQRT_TABLE_SIZE ||
+        m_config.inverseTrigTableSize != INVERSE_TRIG_TABLE_SIZE || m_config.yuvTableDivisions != YUV_RGB_TABLE_DIVISIONS ||
+        m_config.interpolationTableSize != INTERPOLATION_TABLE_SIZE || m_config.transparencyTableSize != TRANSPARENCY_TABLE_SIZE)
+    {
+        debug.logLevelMessage(LogLevel::LOG_ERROR, L"[MathPrecalculation] Cannot export tables - table sizes differ from the defaults");
+        return false;
+    }
+
+    // Build the exported families if no lookup has needed them yet
+    const MathTableFamily exportedFamilies[] = {
+        MathTableFamily::Trigonometric, MathTableFamily::SquareRoot, MathTableFamily::InverseTrigonometric,
+        MathTableFamily::ColorConversion, MathTableFamily::Interpolation, MathTableFamily::Text
+    };
+
+    for (MathTableFamily family : exportedFamilies)
+    {
+        if (!AcquireTableFamily(family))
+        {
+            debug.logLevelMessage(LogLevel::LOG_ERROR, L"[MathPrecalculation] Cannot export tables - a table family could not be built");
+            return false;
+        }
+    }
+
+    try
+    {
+        std::string source;
+        source.reserve(12 * 1024 * 1024);
+
+        source += "//-------------------------------------------------------------------------------------------------\n";
+        source += "// MathPrecalculationTables.cpp - GENERATED by MathTableGenerator, do not edit\n";
+        source += "//\n";
+        source += "// Deterministic MathPrecalculation lookup tables as read-only data, so Initialize() binds them\n";
+        source += "// instead of computing them. Values are exact hex-float copies of the runtime builders' output.\n";
+        source += "//-------------------------------------------------------------------------------------------------\n\n";
+        source += "#include \"Includes.h\"\n";
+        source += "#include \"MathPrecalculation.h\"\n\n";
+
+        bool isValid =
+            AppendFloatStructArray(source, "TrigonometricData g_mathTrigonometricTable[TRIG_TABLE_SIZE]", m_trigonometricTable) &&
+            AppendFloatArray(source, "float g_mathSqrtTable[SQRT_TABLE_SIZE]", m_sqrtTable) &&
+            AppendFloatStructArray(source, "InverseTrigonometricData g_mathInverseTrigonometricTable[INVERSE_TRIG_TABLE_SIZE]", m_inverseTrigonometricTable) &&
+            AppendFloatStructArray(source, "InterpolationData g_mathInterpolationTable[INTERPOLATION_TABLE_SIZE]", m_interpolationTable) &&
+            AppendFloatArray(source, "float g_mathTransparencyTable[TRANSPARENCY_TABLE_SIZE]", m_transparencyLookup);
+
+        if (!isValid)
+        {
+            debug.logLevelMessage(LogLevel::LOG_ERROR, L"[MathPrecalculation] Cannot export tables - non-finite table value");
+            return false;
+        }
+
+        AppendByteArray(source, "uint8_t g_mathYuvToRgbTable[YUV_RGB_TABLE_ENTRIES]", m_yuvToRgbLookup);
+        AppendByteArray(source, "uint8_t g_mathClampTable[CLAMP_TABLE_SIZE]", m_clampTable);
+
+        std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open())
+        {
+            std::wstring wPath(filePath.begin(), filePath.end());
+            debug.logLevelMessage(LogLevel::LOG_ERROR, L"[MathPrecalculation] Cannot open table export file: " + wPath);
+            return false;
+        }
+
+        file.write(source.data(), static_cast<std::streamsize>(source.size()));
+        return file.good();
+    }
+    catch (const std::exception& e)
+    {
+        std::string errorMsg = e.what();
+        std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
+        debug.logLevelMessage(LogLevel::LOG_ERROR, L"[MathPrecalculation] Table export failed: " + wErrorMsg);
+        return false;
+    }
+}
+
 void MathPrecalculation::Cleanup()
 {
     // Check if already cleaned up
@@ -1754,35 +3608,52 @@ void MathPrecalculation::Cleanup()
         debug.logLevelMessage(LogLevel::LOG_INFO, L"[MathPrecalculation] Starting cleanup of lookup tables");
     #endif
 
-    // Clear all lookup tables and free memory
-    m_trigonometricTable.clear();
-    m_trigonometricTable.shrink_to_fit();
+    // Unpublish every family first - each is rebuilt on demand after the next Initialize()
+    for (std::atomic<TableFamilyState>& state : m_tableFamilyState)
+    {
+        state.store(TableFamilyState::Unbuilt);
+    }
 
-    m_sqrtTable.clear();
-    m_sqrtTable.shrink_to_fit();
+    // Detach the table views, then free any runtime-built storage (generated tables are read-only data)
+    m_trigonometricTable.Reset();
+    m_sqrtTable.Reset();
+    m_inverseTrigonometricTable.Reset();
+    m_yuvToRgbLookup.Reset();
+    m_clampTable.Reset();
+    m_interpolationTable.Reset();
+    m_transparencyLookup.Reset();
+
+    m_trigonometricStorage.clear();
+    m_trigonometricStorage.shrink_to_fit();
+
+    m_sqrtStorage.clear();
+    m_sqrtStorage.shrink_to_fit();
 
     m_colorConversionTable.clear();
     m_colorConversionTable.shrink_to_fit();
 
-    m_yuvToRgbLookup.clear();                                                   // Clear vector-based YUV lookup
-    m_yuvToRgbLookup.shrink_to_fit();
+    m_yuvToRgbStorage.clear();
+    m_yuvToRgbStorage.shrink_to_fit();
+
+    m_clampStorage.clear();
+    m_clampStorage.shrink_to_fit();
 
-    m_interpolationTable.clear();
-    m_interpolationTable.shrink_to_fit();
+    m_interpolationStorage.clear();
+    m_interpolationStorage.shrink_to_fit();
 
     m_particleDirections.clear();
     m_particleDirections.shrink_to_fit();
 
-    m_inverseTrigonometricTable.clear();
-    m_inverseTrigonometricTable.shrink_to_fit();
+    m_inverseTrigonometricStorage.clear();
+    m_inverseTrigonometricStorage.shrink_to_fit();
 
     m_explosionPatterns.clear();
     m_scaleMatrixCache.clear();
     m_rotationMatrixCache.clear();
     m_characterWidthCache.clear();
 
-    m_transparencyLookup.clear();
-    m_transparencyLookup.shrink_to_fit();
+    m_transparencyStorage.clear();
+    m_transparencyStorage.shrink_to_fit();
 
     // Clear physics-specific lookup tables
     m_gravityIntensityTable.clear();
@@ -1807,7 +3678,7 @@ void MathPrecalculation::Cleanup()
     m_bIsInitialized.store(false);
     m_bHasCleanedUp.store(true);
     m_totalMemoryUsage.store(0);
-    m_lookupCount.store(0);
+    ResetLookupCount();
 
     #if defined(_DEBUG_MATHPRECALC_)
         debug.logLevelMessage(LogLevel::LOG_INFO, L"[MathPrecalculation] Cleanup completed successfully");
@@ -1835,11 +3706,11 @@ float MathPrecalculation::NormalizeAngle(float angle) const
 
 int MathPrecalculation::AngleToIndex(float angle) const
 {
-    // Convert normalized angle [0, 2π] to table index [0, TRIG_TABLE_SIZE-1]
-    int index = static_cast<int>(angle * TRIG_PRECISION_FACTOR);
+    // Convert normalized angle [0, 2π] to table index [0, trigonometricTableSize-1]
+    int index = static_cast<int>(angle * m_trigPrecisionFactor);
 
     // Ensure index is within bounds
-    return std::clamp(index, 0, TRIG_TABLE_SIZE - 1);
+    return std::clamp(index, 0, m_config.trigonometricTableSize - 1);
 }
 
 float MathPrecalculation::InterpolateTableValue(float value, const std::vector<float>& table, float maxValue) const
@@ -1897,7 +3768,7 @@ uint32_t MathPrecalculation::FastRotateLeft(uint32_t value, int positions) const
     }
 
     // Increment lookup counter for statistics
-    m_lookupCount.fetch_add(1);
+    CountMathLookup();
 
     // Fast bit rotation using optimized approach
     positions = positions % 32; // Normalize positions to valid range [0, 31]
@@ -1915,7 +3786,7 @@ uint32_t MathPrecalculation::FastRotateRight(uint32_t value, int positions) cons
     }
 
     // Increment lookup counter for statistics
-    m_lookupCount.fetch_add(1);
+    CountMathLookup();
 
     // Fast bit rotation using optimized approach
     positions = positions % 32; // Normalize positions to valid range [0, 31]
@@ -1942,7 +3813,7 @@ uint32_t MathPrecalculation::FastFNV1aHash(const void* data, size_t size) const
     // Increment lookup counter for statistics
     if (m_bIsInitialized.load())
     {
-        m_lookupCount.fetch_add(1);
+        CountMathLookup();
     }
 
     return hash;
@@ -1968,7 +3839,7 @@ uint64_t MathPrecalculation::FastFNV1aHash64(const void* data, size_t size) cons
     // Increment lookup counter for statistics
     if (m_bIsInitialized.load())
     {
-        m_lookupCount.fetch_add(1);
+        CountMathLookup();
     }
 
     return hash;
@@ -2000,7 +3871,7 @@ uint32_t MathPrecalculation::FastModPow(uint32_t base, uint32_t exponent, uint32
     // Increment lookup counter for statistics
     if (m_bIsInitialized.load())
     {
-        m_lookupCount.fetch_add(1);
+        CountMathLookup();
     }
 
     return result;
@@ -2032,7 +3903,7 @@ void MathPrecalculation::FastByteSwap(uint8_t* data, size_t size) const
     // Increment lookup counter for statistics
     if (m_bIsInitialized.load())
     {
-        m_lookupCount.fetch_add(1);
+        CountMathLookup();
     }
 }
 
@@ -2050,7 +3921,7 @@ uint32_t MathPrecalculation::FastCountSetBits(uint32_t value) const
     // Increment lookup counter for statistics
     if (m_bIsInitialized.load())
     {
-        m_lookupCount.fetch_add(1);
+        CountMathLookup();
     }
 
     return count;
@@ -2070,7 +3941,7 @@ uint32_t MathPrecalculation::FastReverseBits(uint32_t value) const
     // Increment lookup counter for statistics
     if (m_bIsInitialized.load())
     {
-        m_lookupCount.fetch_add(1);
+        CountMathLookup();
     }
 
     return result;
@@ -2096,7 +3967,7 @@ uint8_t MathPrecalculation::FastCountLeadingZeros(uint32_t value) const
     // Increment lookup counter for statistics
     if (m_bIsInitialized.load())
     {
-        m_lookupCount.fetch_add(1);
+        CountMathLookup();
     }
 
     return count;
@@ -2123,7 +3994,7 @@ uint8_t MathPrecalculation::FastCountTrailingZeros(uint32_t value) const
     // Increment lookup counter for statistics
     if (m_bIsInitialized.load())
     {
-        m_lookupCount.fetch_add(1);
+        CountMathLookup();
     }
 
     return count;
@@ -2137,7 +4008,7 @@ bool MathPrecalculation::FastIsPowerOfTwo(uint32_t value) const
     // Increment lookup counter for statistics
     if (m_bIsInitialized.load())
     {
-        m_lookupCount.fetch_add(1);
+        CountMathLookup();
     }
 
     return result;
@@ -2161,7 +4032,7 @@ uint32_t MathPrecalculation::FastNextPowerOfTwo(uint32_t value) const
     // Increment lookup counter for statistics
     if (m_bIsInitialized.load())
     {
-        m_lookupCount.fetch_add(1);
+        CountMathLookup();
     }
 
     return value;
@@ -2199,7 +4070,7 @@ float MathPrecalculation::FastGravityIntensity(float distance, float mass, float
     float gravityForce = intensity * mass / distanceSquared;
     
     // Increment lookup counter for statistics
-    m_lookupCount.fetch_add(1);
+    CountMathLookup();
     
 #if defined(_DEBUG_MATHPRECALC_)
     static int debugCounter = 0;
@@ -2259,7 +4130,7 @@ XMFLOAT3 MathPrecalculation::FastReflectionVector(const XMFLOAT3& incoming, cons
         reflection.z *= restitution;
         
         // Increment lookup counter for statistics
-        m_lookupCount.fetch_add(1);
+        CountMathLookup();
         
 #if defined(_DEBUG_MATHPRECALC_)
         debug.logDebugMessage(LogLevel::LOG_DEBUG, 
@@ -2314,7 +4185,7 @@ float MathPrecalculation::FastInertiaCoefficient(float mass, float radius) const
         float inertiaCoefficient = (2.0f / 5.0f) * mass * radiusSquared;
         
         // Increment lookup counter for statistics
-        m_lookupCount.fetch_add(1);
+        CountMathLookup();
         
 #if defined(_DEBUG_MATHPRECALC_)
         static int debugCounter = 0;
@@ -2397,7 +4268,7 @@ XMFLOAT3 MathPrecalculation::FastCollisionResponse(const XMFLOAT3& velocity, con
         result.z = reflectedNormal.z + reflectedTangential.z;
         
         // Increment lookup counter for statistics
-        m_lookupCount.fetch_add(1);
+        CountMathLookup();
         
 #if defined(_DEBUG_MATHPRECALC_)
         debug.logDebugMessage(LogLevel::LOG_DEBUG, 
@@ -2465,7 +4336,7 @@ float MathPrecalculation::FastAudioPropagation(float distance, float occlusionFa
         occludedAttenuation = std::clamp(occludedAttenuation, 0.0f, 1.0f);
         
         // Increment lookup counter for statistics
-        m_lookupCount.fetch_add(1);
+        CountMathLookup();
         
 #if defined(_DEBUG_MATHPRECALC_)
         static int debugCounter = 0;
@@ -2594,7 +4465,7 @@ XMFLOAT3 MathPrecalculation::FastProjectileTrajectory(const XMFLOAT3& startPos,
         launchVelocity.z = horizontalDirection.z * horizontalSpeed;
         
         // Increment lookup counter for statistics
-        m_lookupCount.fetch_add(1);
+        CountMathLookup();
         
 #if defined(_DEBUG_MATHPRECALC_)
         debug.logDebugMessage(LogLevel::LOG_DEBUG, 
@@ -2649,7 +4520,7 @@ float MathPrecalculation::FastOrbitalVelocity(float distance, float mass) const
         float orbitalVelocity = FastSqrt(mass / distance);
         
         // Increment lookup counter for statistics
-        m_lookupCount.fetch_add(1);
+        CountMathLookup();
         
 #if defined(_DEBUG_MATHPRECALC_)
         static int debugCounter = 0;
@@ -2707,7 +4578,7 @@ float MathPrecalculation::FastEscapeVelocity(float distance, float mass) const
         float escapeVelocity = FastSqrt(2.0f * mass / distance);
         
         // Increment lookup counter for statistics
-        m_lookupCount.fetch_add(1);
+        CountMathLookup();
         
 #if defined(_DEBUG_MATHPRECALC_)
         static int debugCounter = 0;
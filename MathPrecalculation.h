@@ -16,6 +16,7 @@
 // - Particle physics precalculations
 // - Camera projection and view matrix optimizations
 // - Thread-safe singleton pattern for global access
+// - Table families built on first use, with per-family table sizes and a heap memory budget
 //-------------------------------------------------------------------------------------------------
 
 #include "Includes.h"
@@ -34,6 +35,11 @@
 #include <mutex>
 #include <atomic>
 
+// Per-thread lookup statistics are compiled in unless _NO_MATHPRECALC_STATISTICS_ is defined
+#if !defined(_NO_MATHPRECALC_STATISTICS_)
+    #define MATHPRECALC_STATISTICS_ENABLED 1
+#endif
+
 //==============================================================================
 // Constants and Configuration
 //==============================================================================
@@ -44,6 +50,10 @@ const int COLOR_CONVERSION_TABLE_SIZE = 256;                                   /
 const int INTERPOLATION_TABLE_SIZE = 1024;                                     // Interpolation coefficient table size
 const int PARTICLE_ANGLE_DIVISIONS = 360;                                      // Precalculated particle angles
 const int YUV_LOOKUP_SIZE = 256;                                               // YUV to RGB conversion lookup size
+const int YUV_RGB_TABLE_DIVISIONS = 64;                                        // Y, U and V steps in the reduced YUV to RGB table
+const int YUV_RGB_TABLE_ENTRIES = YUV_RGB_TABLE_DIVISIONS * YUV_RGB_TABLE_DIVISIONS * YUV_RGB_TABLE_DIVISIONS * 3;  // RGB bytes (768KB)
+const int CLAMP_TABLE_SIZE = 512;                                              // Extended clamp range [-256, 255]
+const int TRANSPARENCY_TABLE_SIZE = 1024;                                      // Text fade transparency curve entries
 
 // Precision factors for lookup table indexing
 const float TRIG_PRECISION_FACTOR = static_cast<float>(TRIG_TABLE_SIZE) / (2.0f * XM_PI);
@@ -74,6 +84,30 @@ const float COLLISION_RESPONSE_PRECISION = static_cast<float>(COLLISION_RESPONSE
 const float AUDIO_DISTANCE_PRECISION = static_cast<float>(AUDIO_ATTENUATION_TABLE_SIZE) / 500.0f;     // Maps distance [0, 500] to table
 const float ORBITAL_DISTANCE_PRECISION = static_cast<float>(ORBITAL_MECHANICS_TABLE_SIZE) / 10000.0f; // Maps distance [0, 10000] to table
 
+//==============================================================================
+// Table Families
+//==============================================================================
+// Lookup tables are grouped into families. Each family is built (or bound to generated data) on its
+// first lookup after Initialize(), so a build only pays for the tables it actually uses.
+enum class MathTableFamily : uint8_t {
+    Trigonometric = 0,                                                          // Sin/cos/tan/cot table
+    SquareRoot,                                                                 // FastSqrt table
+    InverseTrigonometric,                                                       // Asin/acos/atan table
+    ColorConversion,                                                            // YUV to RGB, clamp and conversion coefficient tables
+    Interpolation,                                                              // Lerp, smooth step and easing coefficients
+    Particle,                                                                   // Particle directions and explosion patterns
+    MatrixCache,                                                                // Common scale and rotation matrices
+    Text,                                                                       // Character widths and text fade curve
+    Physics,                                                                    // Gravity, reflection, inertia, collision, audio and orbital tables
+    Count
+};
+
+const int MATH_TABLE_FAMILY_COUNT = static_cast<int>(MathTableFamily::Count);
+const uint32_t MATH_TABLE_FAMILIES_ALL = (1u << MATH_TABLE_FAMILY_COUNT) - 1u;
+
+// Bit for a family in MathPrecalculationConfig::preloadFamilies
+inline uint32_t MathTableFamilyBit(MathTableFamily family) { return 1u << static_cast<uint32_t>(family); }
+
 //==============================================================================
 // Precalculated Data Structures
 //==============================================================================
@@ -170,6 +204,78 @@ struct OrbitalMechanicsData {
     float eccentricity;                                                         // Orbital eccentricity coefficient
 };
 
+// Measured accuracy of the batch SIMD kernels against the C runtime (double precision reference)
+struct MathBatchAccuracy {
+    float sinMaxError;                                                          // Max absolute error of FastSinCosBatch sine
+    float cosMaxError;                                                          // Max absolute error of FastSinCosBatch cosine
+    float sqrtMaxRelativeError;                                                 // Max relative error of FastSqrtBatch
+    float angleRange;                                                           // Angles sampled in [-angleRange, angleRange]
+    size_t sampleCount;                                                         // Samples per function
+    const char* kernelName;                                                     // "AVX2", "SSE4.1", "NEON" or "Scalar"
+};
+
+// Table sizes, families built by Initialize() and the heap budget for lookup tables. A size other
+// than the default trades accuracy for memory; it is built at runtime even in builds with generated
+// tables, which only contain the default sizes.
+struct MathPrecalculationConfig {
+    int trigonometricTableSize = TRIG_TABLE_SIZE;                               // Entries over [0, 2π)
+    int sqrtTableSize = SQRT_TABLE_SIZE;                                        // Entries over [0, 1000)
+    int inverseTrigTableSize = INVERSE_TRIG_TABLE_SIZE;                         // Entries over [-1, 1]
+    int yuvTableDivisions = YUV_RGB_TABLE_DIVISIONS;                            // Steps per Y, U and V axis (divisions^3 * 3 bytes)
+    int interpolationTableSize = INTERPOLATION_TABLE_SIZE;                      // Entries over [0, 1]
+    int particleAngleDivisions = PARTICLE_ANGLE_DIVISIONS;                      // Precalculated directions around the circle
+    int transparencyTableSize = TRANSPARENCY_TABLE_SIZE;                        // Text fade curve entries
+    uint32_t preloadFamilies = 0;                                               // MathTableFamilyBit() mask built by Initialize()
+    size_t memoryBudgetBytes = 0;                                               // Heap bytes the tables may allocate (0 = unlimited)
+};
+
+// One family's entry in the memory budget report
+struct MathTableFamilyUsage {
+    const char* name;                                                           // Family name for logs and tools
+    int tableSize;                                                              // Configured entries (0 for the fixed caches)
+    bool isReady;                                                               // Built or bound, lookups read the tables
+    bool isOverBudget;                                                          // Refused by the budget, lookups compute directly
+    size_t heapBytes;                                                           // Bytes allocated by the runtime builders
+    size_t readOnlyBytes;                                                       // Bytes bound from build-time generated data
+    size_t projectedHeapBytes;                                                  // Heap bytes the family allocates when built
+};
+
+// Memory report for every table family (see GetMemoryBudget)
+struct MathMemoryBudget {
+    size_t budgetBytes;                                                         // Configured heap budget (0 = unlimited)
+    size_t heapBytes;                                                           // Heap bytes allocated by ready families
+    size_t readOnlyBytes;                                                       // Generated read-only bytes bound by ready families
+    size_t projectedHeapBytes;                                                  // Heap bytes if every family were built
+    MathTableFamilyUsage families[MATH_TABLE_FAMILY_COUNT];                     // Indexed by MathTableFamily
+};
+
+//==============================================================================
+// Read-only Lookup Table View
+//==============================================================================
+// The deterministic tables (trig, inverse trig, sqrt, interpolation, YUV, clamp, transparency) are
+// either generated at build time into read-only data (MATHPRECALC_GENERATED_TABLES, produced by
+// Tools/MathTableGenerator.cpp) or built into heap storage by their family builder as a fallback.
+// Lookups read both through this view, which keeps the std::vector read interface they were
+// written for.
+template<typename T>
+class MathTableView {
+public:
+    MathTableView() : m_data(nullptr), m_size(0) {}
+
+    void Bind(const T* data, size_t size) { m_data = data; m_size = size; }
+    void Bind(const std::vector<T>& storage) { Bind(storage.data(), storage.size()); }
+    void Reset() { m_data = nullptr; m_size = 0; }
+
+    const T& operator[](size_t index) const { return m_data[index]; }
+    const T* data() const { return m_data; }
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+
+private:
+    const T* m_data;
+    size_t m_size;
+};
+
 //==============================================================================
 // MathPrecalculation Class Declaration
 //==============================================================================
@@ -178,11 +284,30 @@ public:
     // Singleton pattern implementation for global access
     static MathPrecalculation& GetInstance();
 
-    // Initialization and cleanup methods
+    // Initialization and cleanup methods. Initialize() records the configuration and builds only the
+    // families in config.preloadFamilies; every other family is built on its first lookup. Call
+    // Cleanup() before initializing again with a different configuration.
     bool Initialize();
+    bool Initialize(const MathPrecalculationConfig& config);
     void Cleanup();
     bool IsInitialized() const { return m_bIsInitialized.load(); }
 
+    //==========================================================================
+    // Table Family Methods
+    //==========================================================================
+    // Build a family now (e.g. behind a loading screen) instead of on its first lookup. Returns false
+    // before Initialize(), if the family does not fit the memory budget or if its builder failed.
+    bool PreloadTableFamily(MathTableFamily family);
+
+    // True once the family's tables serve lookups
+    bool IsTableFamilyReady(MathTableFamily family) const;
+
+    // Per-family sizes, state and bytes against the configured memory budget
+    MathMemoryBudget GetMemoryBudget() const;
+
+    // Family name for logs and tools ("Trigonometric", "ColorConversion", ...)
+    static const char* GetTableFamilyName(MathTableFamily family);
+
     //==========================================================================
     // Trigonometric Lookup Methods
     //==========================================================================
@@ -204,6 +329,21 @@ public:
     // Fast square root lookup for values 0-1000 with interpolation
     float FastSqrt(float value) const;
 
+    //==========================================================================
+    // Batch SIMD Methods
+    //==========================================================================
+    // Sine and cosine of count angles (radians) with minimax polynomials in SIMD lanes (AVX2, SSE4.1,
+    // NEON or scalar). No table lookups, no lookup statistics and no Initialize() required. Accurate
+    // to a few float ulps for |angle| <= 8192 - see MeasureBatchAccuracy. outSin or outCos may be null.
+    void FastSinCosBatch(const float* angles, float* outSin, float* outCos, size_t count) const;
+
+    // Square roots of count values using the hardware square root (negative and NaN inputs give 0
+    // like FastSqrt, but there is no upper range limit). outResults may alias values.
+    void FastSqrtBatch(const float* values, float* outResults, size_t count) const;
+
+    // Compare the active batch kernels against std::sin / std::cos / std::sqrt over evenly spaced samples
+    MathBatchAccuracy MeasureBatchAccuracy(float angleRange = 8192.0f, size_t sampleCount = 1 << 20) const;
+
     //==========================================================================
     // Inverse Trigonometric Lookup Methods
     //==========================================================================
@@ -292,6 +432,42 @@ public:
     // Get precalculated view matrix for camera positions
     XMMATRIX GetViewMatrix(const XMFLOAT3& position, const XMFLOAT3& target, const XMFLOAT3& up) const;
 
+    //==========================================================================
+    // Batch Matrix Transform Methods
+    //==========================================================================
+    // SIMD kernels over contiguous buffers (AVX, SSE2 or scalar, picked per call) for scene graph and
+    // particle transforms. Matrices are row-major and use row vectors like DirectXMath: translation
+    // is row 3 and a child's world matrix is local * parentWorld. All kernel paths give bit-identical
+    // results (no fused multiply-add). Matrix4x4 is the storage type on every build.
+
+    // outMatrices[i] = Scaling(scales[i]) * RotationQuaternion(rotations[i]) * Translation(positions[i]).
+    // Rotations are unit quaternions (x, y, z, w); scales may be null for unit scale.
+    void ComposeTransformsBatch(const XMFLOAT3* positions, const XMFLOAT4* rotations, const XMFLOAT3* scales,
+        Matrix4x4* outMatrices, size_t count) const;
+
+    // outMatrices[i] = locals[i] * parents[i]; outMatrices may alias either input
+    void MultiplyMatricesBatch(const Matrix4x4* locals, const Matrix4x4* parents, Matrix4x4* outMatrices, size_t count) const;
+
+    // Resolve a flattened hierarchy: outWorld[i] = locals[i] * outWorld[parentIndices[i]], or locals[i]
+    // for roots (parent index < 0). Returns false without writing if a parent does not precede its child.
+    bool ComputeHierarchyBatch(const Matrix4x4* locals, const int* parentIndices, Matrix4x4* outWorld, size_t count) const;
+
+    // Transform points (w = 1, no perspective divide) or directions (w = 0) by one matrix; the output
+    // may alias the input. Like XMVector3TransformNormal, normals under non-uniform scale need the
+    // inverse transpose as the matrix.
+    void TransformPointsBatch(const Matrix4x4& matrix, const XMFLOAT3* points, XMFLOAT3* outPoints, size_t count) const;
+    void TransformNormalsBatch(const Matrix4x4& matrix, const XMFLOAT3* normals, XMFLOAT3* outNormals, size_t count) const;
+
+#if defined(__USE_DIRECTX_11__) || defined(__USE_DIRECTX_12__) || (defined(__USE_VULKAN__) && defined(PLATFORM_WINDOWS))
+    // XMMATRIX overloads for the DirectXMath builds - same row layout, so they share the kernels above
+    void ComposeTransformsBatch(const XMFLOAT3* positions, const XMFLOAT4* rotations, const XMFLOAT3* scales,
+        XMMATRIX* outMatrices, size_t count) const;
+    void MultiplyMatricesBatch(const XMMATRIX* locals, const XMMATRIX* parents, XMMATRIX* outMatrices, size_t count) const;
+    bool ComputeHierarchyBatch(const XMMATRIX* locals, const int* parentIndices, XMMATRIX* outWorld, size_t count) const;
+    void TransformPointsBatch(const XMMATRIX& matrix, const XMFLOAT3* points, XMFLOAT3* outPoints, size_t count) const;
+    void TransformNormalsBatch(const XMMATRIX& matrix, const XMFLOAT3* normals, XMFLOAT3* outNormals, size_t count) const;
+#endif
+
     //==========================================================================
     // Text Rendering Optimization Methods
     //==========================================================================
@@ -304,15 +480,28 @@ public:
     //==========================================================================
     // Utility Methods
     //==========================================================================
-    // Get memory usage statistics for debugging
+    // Get memory usage statistics for debugging (bytes of the families built so far)
     size_t GetMemoryUsage() const;
 
-    // Validate all lookup tables for debugging
+    // Validate the lookup tables of the families built so far
     bool ValidateTables() const;
 
     // Dump table statistics to debug output
     void DumpTableStatistics() const;
 
+    // Lookups performed on all threads since the last reset (sums the per-thread shards; 0 when
+    // statistics are compiled out with _NO_MATHPRECALC_STATISTICS_)
+    size_t GetLookupCount() const;
+    void ResetLookupCount();
+
+    // True when the deterministic tables come from build-time generated read-only data
+    bool UsesGeneratedTables() const;
+
+    // Write the deterministic tables as a C++ source of const arrays (the MathTableGenerator build
+    // step). Requires Initialize() with the default table sizes and builds the exported families;
+    // returns false if they cannot be built or the file cannot be written.
+    bool ExportGeneratedTables(const std::string& filePath) const;
+
     //==========================================================================
     // Compression and Checksum Optimization Methods
     //==========================================================================
@@ -386,6 +575,9 @@ private:
     // Initialize trigonometric lookup tables
     void InitializeTrigonometricTables();
 
+    // Initialize square root lookup table
+    void InitializeSqrtTables();
+
     // Initialize inverse trigonometric lookup tables
     void InitializeInverseTrigonometricTables();
 
@@ -413,6 +605,35 @@ private:
     void InitializeOrbitalMechanicsTables();
     void InitializePhysicsPrecalculations();
 
+    //==========================================================================
+    // Table Family Management
+    //==========================================================================
+    // Lifecycle of one table family
+    enum class TableFamilyState : uint8_t {
+        Unbuilt = 0,                                                            // Built on the next lookup after Initialize()
+        Ready,                                                                  // Tables published, lookups read them
+        OverBudget,                                                             // Refused by the memory budget
+        Failed                                                                  // Builder threw, lookups compute directly
+    };
+
+    // True when the family's tables can be read - builds the family on its first call after Initialize()
+    bool AcquireTableFamily(MathTableFamily family) const;
+
+    // Slow path of AcquireTableFamily: takes m_tablesMutex and builds the family
+    bool BuildTableFamily(MathTableFamily family) const;
+
+    // Run the family's builders, check the budget and publish the family (m_tablesMutex held)
+    bool BuildTableFamilyLocked(MathTableFamily family);
+
+    // Bytes currently held by the family's tables, split into heap storage and generated read-only data
+    void MeasureTableFamily(MathTableFamily family, size_t& outHeapBytes, size_t& outReadOnlyBytes) const;
+
+    // Heap bytes the family allocates when built with the current configuration
+    size_t ProjectTableFamilyHeapBytes(MathTableFamily family) const;
+
+    // Configured entries for the family (0 for the fixed caches)
+    int GetTableFamilySize(MathTableFamily family) const;
+
     //==========================================================================
     // Helper Methods
     //==========================================================================
@@ -430,27 +651,38 @@ private:
     T ClampValue(T value, T minVal, T maxVal) const;
 
 private:
-    // Initialization state
+    // Initialization state - Initialize() records the configuration and publishes it with a release
+    // store of m_bIsInitialized. Each family is then built under m_tablesMutex on first use and
+    // published with a release store of its state. Built tables are immutable until Cleanup(), so
+    // lookups are plain reads after one acquire check of their family state: no locks and no shared
+    // writes once the family is ready.
     std::atomic<bool> m_bIsInitialized;
     std::atomic<bool> m_bHasCleanedUp;
+    std::atomic<TableFamilyState> m_tableFamilyState[MATH_TABLE_FAMILY_COUNT];
 
     // Thread safety
     mutable std::mutex m_tablesMutex;
 
+    // Table sizes and budget from Initialize(), with the precision factors derived from the sizes
+    MathPrecalculationConfig m_config;
+    float m_trigPrecisionFactor;                                                // Maps [0, 2π) to the trigonometric table
+    float m_sqrtPrecisionFactor;                                                // Maps [0, 1000) to the square root table
+    float m_inverseTrigPrecisionFactor;                                         // Maps [-1, 1] to the inverse trigonometric table
+
     // Trigonometric lookup tables
-    std::vector<TrigonometricData> m_trigonometricTable;
-    std::vector<float> m_sqrtTable;
+    MathTableView<TrigonometricData> m_trigonometricTable;
+    MathTableView<float> m_sqrtTable;
 
     // Inverse trigonometric lookup tables
-    std::vector<InverseTrigonometricData> m_inverseTrigonometricTable;
+    MathTableView<InverseTrigonometricData> m_inverseTrigonometricTable;
 
     // Color conversion lookup tables
     std::vector<ColorConversionData> m_colorConversionTable;
-    std::vector<uint8_t> m_yuvToRgbLookup;                                      // Dynamic YUV to RGB lookup table
-    std::array<uint8_t, 512> m_clampTable;                                      // Extended range for clamping
+    MathTableView<uint8_t> m_yuvToRgbLookup;                                    // YUV to RGB lookup table
+    MathTableView<uint8_t> m_clampTable;                                        // Extended range for clamping
 
     // Interpolation coefficient tables
-    std::vector<InterpolationData> m_interpolationTable;
+    MathTableView<InterpolationData> m_interpolationTable;
 
     // Particle system precalculations
     std::vector<ParticleData> m_particleDirections;
@@ -462,11 +694,20 @@ private:
 
     // Text rendering optimizations
     std::unordered_map<wchar_t, float> m_characterWidthCache;
-    std::vector<float> m_transparencyLookup;
+    MathTableView<float> m_transparencyLookup;
+
+    // Runtime-built storage behind the views above when the build has no generated tables
+    std::vector<TrigonometricData> m_trigonometricStorage;
+    std::vector<float> m_sqrtStorage;
+    std::vector<InverseTrigonometricData> m_inverseTrigonometricStorage;
+    std::vector<uint8_t> m_yuvToRgbStorage;
+    std::vector<uint8_t> m_clampStorage;
+    std::vector<InterpolationData> m_interpolationStorage;
+    std::vector<float> m_transparencyStorage;
 
     // Debug and statistics
     mutable std::atomic<size_t> m_totalMemoryUsage;
-    mutable std::atomic<size_t> m_lookupCount;
+    std::atomic<size_t> m_lookupCountBaseline;                                  // Shard total at the last ResetLookupCount()
 
     // Physics-specific lookup tables
     std::vector<GravityIntensityData> m_gravityIntensityTable;                  // Gravity intensity lookup table
@@ -10,6 +10,10 @@
 #include "Debug.h"
 #include "ExceptionHandler.h"
 #include "MathPrecalculation.h"
+#include "PUNPack.h"
+
+#include <cassert>
+#include <limits>
 
 // External references
 extern Debug debug;
@@ -18,6 +22,41 @@ extern ExceptionHandler exceptionHandler;
 // Global physics instance
 Physics* g_pPhysics = nullptr;
 
+#if defined(_DEBUG_PHYSICS_ALLOCATIONS_)
+//==============================================================================
+// Step Allocation Counter
+//==============================================================================
+// Replaces the program-wide allocator so heap allocations made on physics threads (the stepping
+// thread while inside a step, and the solver workers) can be counted. Debug builds only.
+static thread_local bool t_countPhysicsAllocations = false;
+static std::atomic<uint64_t> g_physicsAllocationCount(0);
+
+void* operator new(size_t size)
+{
+    if (t_countPhysicsAllocations)
+    {
+        g_physicsAllocationCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void* memory = std::malloc(size > 0 ? size : 1);
+    if (!memory)
+    {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept
+{
+    std::free(memory);
+}
+#endif
+
 //==============================================================================
 // PhysicsVector2D Implementation
 //==============================================================================
@@ -107,6 +146,7 @@ void CurvedPath2D::CalculateTangentsAndCurvatures()
     // Clear existing data
     tangents.clear();
     curvatures.clear();
+    arcLengths.clear();
     totalLength = 0.0f;
     
     // Need at least 2 points for tangent calculation
@@ -118,6 +158,7 @@ void CurvedPath2D::CalculateTangentsAndCurvatures()
     // Reserve memory for efficiency
     tangents.reserve(coordinates.size());
     curvatures.reserve(coordinates.size());
+    arcLengths.reserve(coordinates.size());
     
     // Calculate tangents and curvatures for each point
     for (size_t i = 0; i < coordinates.size(); ++i)
@@ -165,12 +206,14 @@ void CurvedPath2D::CalculateTangentsAndCurvatures()
         tangents.push_back(angle);
         curvatures.push_back(curvature);
         
-        // Add to total length (except for first point)
+        // Add to total length (except for first point) and record the running distance so
+        // distance lookups can binary search instead of re-measuring every segment
         if (i > 0)
         {
             PhysicsVector2D segment = coordinates[i] - coordinates[i - 1];
             totalLength += segment.Magnitude();
         }
+        arcLengths.push_back(totalLength);
     }
     
 #if defined(_DEBUG_PHYSICS_)
@@ -187,7 +230,8 @@ PhysicsVector2D CurvedPath2D::GetPointAtDistance(float distance) const
         return PhysicsVector2D();
     }
     
-    if (coordinates.size() == 1)
+    // Single point, or points added directly without rebuilding the tables
+    if (coordinates.size() == 1 || arcLengths.size() != coordinates.size())
     {
         return coordinates[0];
     }
@@ -195,25 +239,8 @@ PhysicsVector2D CurvedPath2D::GetPointAtDistance(float distance) const
     // Clamp distance to valid range
     distance = std::clamp(distance, 0.0f, totalLength);
     
-    // Find the segment that contains this distance
-    float currentDistance = 0.0f;
-    for (size_t i = 1; i < coordinates.size(); ++i)
-    {
-        PhysicsVector2D segment = coordinates[i] - coordinates[i - 1];
-        float segmentLength = segment.Magnitude();
-        
-        if (currentDistance + segmentLength >= distance)
-        {
-            // Interpolate within this segment
-            float t = (distance - currentDistance) / segmentLength;
-            return coordinates[i - 1] + segment * t;
-        }
-        
-        currentDistance += segmentLength;
-    }
-    
-    // Return last point if we somehow didn't find the segment
-    return coordinates.back();
+    // Interpolate within the segment that contains this distance
+    return InterpolateSegment(FindSegmentAtDistance(distance), distance);
 }
 
 PhysicsVector2D CurvedPath2D::GetTangentAtDistance(float distance) const
@@ -224,27 +251,78 @@ PhysicsVector2D CurvedPath2D::GetTangentAtDistance(float distance) const
         return PhysicsVector2D(1.0f, 0.0f); // Default to right direction
     }
     
-    // Find corresponding point index for this distance
-    float currentDistance = 0.0f;
-    size_t pointIndex = 0;
+    size_t segmentIndex = 0;
+    if (arcLengths.size() == coordinates.size())
+    {
+        segmentIndex = FindSegmentAtDistance(std::clamp(distance, 0.0f, totalLength));
+    }
     
-    for (size_t i = 1; i < coordinates.size(); ++i)
+    // Get tangent angle and convert to vector
+    const float angle = tangents[segmentIndex];
+    return PhysicsVector2D(FAST_COS(angle), FAST_SIN(angle));
+}
+
+void CurvedPath2D::GetPointsAtDistances(const float* distances, size_t count, PhysicsVector2D* outPoints,
+    PhysicsVector2D* outTangents) const
+{
+    // Paths without complete tables take the single-distance fallbacks
+    const bool hasTables = coordinates.size() >= 2 && arcLengths.size() == coordinates.size() &&
+        tangents.size() == coordinates.size();
+    bool isSorted = hasTables;
+    for (size_t i = 1; isSorted && i < count; ++i)
     {
-        PhysicsVector2D segment = coordinates[i] - coordinates[i - 1];
-        float segmentLength = segment.Magnitude();
-        
-        if (currentDistance + segmentLength >= distance)
+        isSorted = distances[i] >= distances[i - 1];
+    }
+
+    if (!isSorted)
+    {
+        for (size_t i = 0; i < count; ++i)
         {
-            pointIndex = i - 1;
-            break;
+            outPoints[i] = GetPointAtDistance(distances[i]);
+            if (outTangents)
+            {
+                outTangents[i] = GetTangentAtDistance(distances[i]);
+            }
         }
-        
-        currentDistance += segmentLength;
+        return;
+    }
+
+    // Ascending distances walk the arc-length table once instead of searching it per distance
+    const size_t lastSegment = arcLengths.size() - 2;
+    size_t segmentIndex = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        const float distance = std::clamp(distances[i], 0.0f, totalLength);
+        while (segmentIndex < lastSegment && arcLengths[segmentIndex + 1] < distance)
+        {
+            ++segmentIndex;
+        }
+
+        outPoints[i] = InterpolateSegment(segmentIndex, distance);
+        if (outTangents)
+        {
+            outTangents[i] = PhysicsVector2D(FAST_COS(tangents[segmentIndex]), FAST_SIN(tangents[segmentIndex]));
+        }
+    }
+}
+
+PhysicsVector2D CurvedPath2D::InterpolateSegment(size_t segmentIndex, float distance) const
+{
+    const float segmentLength = arcLengths[segmentIndex + 1] - arcLengths[segmentIndex];
+    const float t = (segmentLength > 0.0f) ? (distance - arcLengths[segmentIndex]) / segmentLength : 0.0f;
+    return coordinates[segmentIndex] + (coordinates[segmentIndex + 1] - coordinates[segmentIndex]) * t;
+}
+
+size_t CurvedPath2D::FindSegmentAtDistance(float distance) const
+{
+    // The first point whose running distance reaches the target ends the segment
+    const auto segmentEnd = std::lower_bound(arcLengths.begin() + 1, arcLengths.end(), distance);
+    if (segmentEnd == arcLengths.end())
+    {
+        return arcLengths.size() - 2;
     }
     
-    // Get tangent angle and convert to vector
-    float angle = tangents[pointIndex];
-    return PhysicsVector2D(FAST_COS(angle), FAST_SIN(angle));
+    return static_cast<size_t>(segmentEnd - arcLengths.begin()) - 1;
 }
 
 void CurvedPath2D::Clear()
@@ -253,6 +331,7 @@ void CurvedPath2D::Clear()
     coordinates.clear();
     tangents.clear();
     curvatures.clear();
+    arcLengths.clear();
     totalLength = 0.0f;
     isLooped = false;
     
@@ -290,6 +369,7 @@ void CurvedPath3D::CalculateTangentsAndCurvatures()
     // Clear existing data
     tangents.clear();
     curvatures.clear();
+    arcLengths.clear();
     totalLength = 0.0f;
     
     // Need at least 2 points for tangent calculation
@@ -301,6 +381,7 @@ void CurvedPath3D::CalculateTangentsAndCurvatures()
     // Reserve memory for efficiency
     tangents.reserve(coordinates.size());
     curvatures.reserve(coordinates.size());
+    arcLengths.reserve(coordinates.size());
     
     // Calculate tangents and curvatures for each point
     for (size_t i = 0; i < coordinates.size(); ++i)
@@ -347,12 +428,14 @@ void CurvedPath3D::CalculateTangentsAndCurvatures()
         tangents.push_back(normalizedTangent);
         curvatures.push_back(curvature);
         
-        // Add to total length (except for first point)
+        // Add to total length (except for first point) and record the running distance so
+        // distance lookups can binary search instead of re-measuring every segment
         if (i > 0)
         {
             PhysicsVector3D segment = coordinates[i] - coordinates[i - 1];
             totalLength += segment.Magnitude();
         }
+        arcLengths.push_back(totalLength);
     }
     
 #if defined(_DEBUG_PHYSICS_)
@@ -369,7 +452,8 @@ PhysicsVector3D CurvedPath3D::GetPointAtDistance(float distance) const
         return PhysicsVector3D();
     }
     
-    if (coordinates.size() == 1)
+    // Single point, or points added directly without rebuilding the tables
+    if (coordinates.size() == 1 || arcLengths.size() != coordinates.size())
     {
         return coordinates[0];
     }
@@ -377,25 +461,8 @@ PhysicsVector3D CurvedPath3D::GetPointAtDistance(float distance) const
     // Clamp distance to valid range
     distance = std::clamp(distance, 0.0f, totalLength);
     
-    // Find the segment that contains this distance
-    float currentDistance = 0.0f;
-    for (size_t i = 1; i < coordinates.size(); ++i)
-    {
-        PhysicsVector3D segment = coordinates[i] - coordinates[i - 1];
-        float segmentLength = segment.Magnitude();
-        
-        if (currentDistance + segmentLength >= distance)
-        {
-            // Interpolate within this segment
-            float t = (distance - currentDistance) / segmentLength;
-            return coordinates[i - 1] + segment * t;
-        }
-        
-        currentDistance += segmentLength;
-    }
-    
-    // Return last point if we somehow didn't find the segment
-    return coordinates.back();
+    // Interpolate within the segment that contains this distance
+    return InterpolateSegment(FindSegmentAtDistance(distance), distance);
 }
 
 PhysicsVector3D CurvedPath3D::GetTangentAtDistance(float distance) const
@@ -406,26 +473,77 @@ PhysicsVector3D CurvedPath3D::GetTangentAtDistance(float distance) const
         return PhysicsVector3D(1.0f, 0.0f, 0.0f); // Default to forward direction
     }
     
-    // Find corresponding point index for this distance
-    float currentDistance = 0.0f;
-    size_t pointIndex = 0;
+    size_t segmentIndex = 0;
+    if (arcLengths.size() == coordinates.size())
+    {
+        segmentIndex = FindSegmentAtDistance(std::clamp(distance, 0.0f, totalLength));
+    }
     
-    for (size_t i = 1; i < coordinates.size(); ++i)
+    // Return tangent vector at the segment start
+    return tangents[segmentIndex];
+}
+
+void CurvedPath3D::GetPointsAtDistances(const float* distances, size_t count, PhysicsVector3D* outPoints,
+    PhysicsVector3D* outTangents) const
+{
+    // Paths without complete tables take the single-distance fallbacks
+    const bool hasTables = coordinates.size() >= 2 && arcLengths.size() == coordinates.size() &&
+        tangents.size() == coordinates.size();
+    bool isSorted = hasTables;
+    for (size_t i = 1; isSorted && i < count; ++i)
     {
-        PhysicsVector3D segment = coordinates[i] - coordinates[i - 1];
-        float segmentLength = segment.Magnitude();
-        
-        if (currentDistance + segmentLength >= distance)
+        isSorted = distances[i] >= distances[i - 1];
+    }
+
+    if (!isSorted)
+    {
+        for (size_t i = 0; i < count; ++i)
         {
-            pointIndex = i - 1;
-            break;
+            outPoints[i] = GetPointAtDistance(distances[i]);
+            if (outTangents)
+            {
+                outTangents[i] = GetTangentAtDistance(distances[i]);
+            }
         }
-        
-        currentDistance += segmentLength;
+        return;
+    }
+
+    // Ascending distances walk the arc-length table once instead of searching it per distance
+    const size_t lastSegment = arcLengths.size() - 2;
+    size_t segmentIndex = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        const float distance = std::clamp(distances[i], 0.0f, totalLength);
+        while (segmentIndex < lastSegment && arcLengths[segmentIndex + 1] < distance)
+        {
+            ++segmentIndex;
+        }
+
+        outPoints[i] = InterpolateSegment(segmentIndex, distance);
+        if (outTangents)
+        {
+            outTangents[i] = tangents[segmentIndex];
+        }
+    }
+}
+
+PhysicsVector3D CurvedPath3D::InterpolateSegment(size_t segmentIndex, float distance) const
+{
+    const float segmentLength = arcLengths[segmentIndex + 1] - arcLengths[segmentIndex];
+    const float t = (segmentLength > 0.0f) ? (distance - arcLengths[segmentIndex]) / segmentLength : 0.0f;
+    return coordinates[segmentIndex] + (coordinates[segmentIndex + 1] - coordinates[segmentIndex]) * t;
+}
+
+size_t CurvedPath3D::FindSegmentAtDistance(float distance) const
+{
+    // The first point whose running distance reaches the target ends the segment
+    const auto segmentEnd = std::lower_bound(arcLengths.begin() + 1, arcLengths.end(), distance);
+    if (segmentEnd == arcLengths.end())
+    {
+        return arcLengths.size() - 2;
     }
     
-    // Return tangent vector at this point
-    return tangents[pointIndex];
+    return static_cast<size_t>(segmentEnd - arcLengths.begin()) - 1;
 }
 
 void CurvedPath3D::Clear()
@@ -434,6 +552,7 @@ void CurvedPath3D::Clear()
     coordinates.clear();
     tangents.clear();
     curvatures.clear();
+    arcLengths.clear();
     totalLength = 0.0f;
     isLooped = false;
     
@@ -481,6 +600,196 @@ PhysicsVector3D GravityField::CalculateGravityVector(const PhysicsVector3D& posi
     return normalizedDirection * force;
 }
 
+//==============================================================================
+// PhysicsGravityTree Implementation
+//==============================================================================
+void PhysicsGravityTree::Build(const std::vector<GravityField>& fields)
+{
+    Clear();
+    
+    // Split fields the monopole approximation can represent from those it cannot
+    for (const auto& field : fields)
+    {
+        if (field.isBlackHole || field.intensity * field.mass <= 0.0f)
+        {
+            m_exactFields.push_back(field);
+        }
+        else
+        {
+            m_fields.push_back(field);
+        }
+    }
+    
+    if (m_fields.empty())
+    {
+        return;
+    }
+    
+    PhysicsVector3D boundsMin = m_fields[0].center;
+    PhysicsVector3D boundsMax = m_fields[0].center;
+    for (const auto& field : m_fields)
+    {
+        boundsMin = PhysicsVector3D(std::min(boundsMin.x, field.center.x), std::min(boundsMin.y, field.center.y), std::min(boundsMin.z, field.center.z));
+        boundsMax = PhysicsVector3D(std::max(boundsMax.x, field.center.x), std::max(boundsMax.y, field.center.y), std::max(boundsMax.z, field.center.z));
+    }
+    
+    // Root cell is the bounding cube of all approximable fields
+    const PhysicsVector3D rootCenter = (boundsMin + boundsMax) * 0.5f;
+    const float rootHalfSize = std::max(0.5f * std::max({ boundsMax.x - boundsMin.x, boundsMax.y - boundsMin.y, boundsMax.z - boundsMin.z }), 0.001f);
+    
+    m_partitionScratch.resize(m_fields.size());
+    BuildNode(0, static_cast<int>(m_fields.size()), rootCenter, rootHalfSize, 0);
+}
+
+void PhysicsGravityTree::Clear()
+{
+    m_nodes.clear();
+    m_fields.clear();
+    m_exactFields.clear();
+}
+
+void PhysicsGravityTree::BuildNode(int firstField, int fieldCount, const PhysicsVector3D& cellCenter, float halfSize, int depth)
+{
+    const int nodeIndex = static_cast<int>(m_nodes.size());
+    m_nodes.emplace_back();
+    
+    // Combined strength and strength-weighted centre of the fields in this cell
+    Node node;
+    node.strength = 0.0f;
+    node.cellCenter = cellCenter;
+    node.halfSize = halfSize;
+    node.firstField = firstField;
+    node.fieldCount = 0;
+    
+    PhysicsVector3D weightedCenter;
+    for (int i = firstField; i < firstField + fieldCount; ++i)
+    {
+        const float strength = m_fields[i].intensity * m_fields[i].mass;
+        weightedCenter += m_fields[i].center * strength;
+        node.strength += strength;
+    }
+    node.centerOfMass = weightedCenter * (1.0f / node.strength);
+    
+    if (fieldCount <= GRAVITY_TREE_LEAF_SIZE || depth >= GRAVITY_TREE_MAX_DEPTH)
+    {
+        node.fieldCount = fieldCount;
+        node.nextSibling = nodeIndex + 1;
+        m_nodes[nodeIndex] = node;
+        return;
+    }
+    
+    // Counting sort of the range by octant (bit 0 = +x, bit 1 = +y, bit 2 = +z)
+    auto octantOf = [&cellCenter](const GravityField& field) {
+        return (field.center.x >= cellCenter.x ? 1 : 0) | (field.center.y >= cellCenter.y ? 2 : 0) | (field.center.z >= cellCenter.z ? 4 : 0);
+    };
+    
+    int octantStart[9] = { 0 };
+    for (int i = firstField; i < firstField + fieldCount; ++i)
+    {
+        ++octantStart[octantOf(m_fields[i]) + 1];
+    }
+    for (int octant = 0; octant < 8; ++octant)
+    {
+        octantStart[octant + 1] += octantStart[octant];
+    }
+    
+    int octantCursor[8];
+    std::copy(octantStart, octantStart + 8, octantCursor);
+    for (int i = firstField; i < firstField + fieldCount; ++i)
+    {
+        m_partitionScratch[firstField + octantCursor[octantOf(m_fields[i])]++] = m_fields[i];
+    }
+    std::copy(m_partitionScratch.begin() + firstField, m_partitionScratch.begin() + firstField + fieldCount, m_fields.begin() + firstField);
+    
+    // Children follow their parent directly in depth-first order
+    const float childHalfSize = halfSize * 0.5f;
+    for (int octant = 0; octant < 8; ++octant)
+    {
+        const int childCount = octantStart[octant + 1] - octantStart[octant];
+        if (childCount == 0)
+        {
+            continue;
+        }
+        
+        const PhysicsVector3D childCenter(
+            cellCenter.x + ((octant & 1) ? childHalfSize : -childHalfSize),
+            cellCenter.y + ((octant & 2) ? childHalfSize : -childHalfSize),
+            cellCenter.z + ((octant & 4) ? childHalfSize : -childHalfSize));
+        BuildNode(firstField + octantStart[octant], childCount, childCenter, childHalfSize, depth + 1);
+    }
+    
+    node.nextSibling = static_cast<int>(m_nodes.size());
+    m_nodes[nodeIndex] = node;
+}
+
+PhysicsVector3D PhysicsGravityTree::Evaluate(const PhysicsVector3D& position, float openingAngle) const
+{
+    PhysicsVector3D gravity;
+    
+    for (const auto& field : m_exactFields)
+    {
+        gravity += field.CalculateGravityVector(position);
+    }
+    
+    // Compare squared quantities: width^2 < theta^2 * distance^2
+    const float openingAngleSquared = openingAngle * openingAngle;
+    const int nodeCount = static_cast<int>(m_nodes.size());
+    int nodeIndex = 0;
+    while (nodeIndex < nodeCount)
+    {
+        const Node& node = m_nodes[nodeIndex];
+        
+        if (node.fieldCount > 0)
+        {
+            // Leaves are summed exactly - same law as GravityField::CalculateGravityVector, which
+            // for these fields reduces to strength / distance^2 with a single square root
+            for (int i = node.firstField; i < node.firstField + node.fieldCount; ++i)
+            {
+                const PhysicsVector3D fieldOffset = m_fields[i].center - position;
+                const float fieldDistance = fieldOffset.Magnitude();
+                if (fieldDistance >= MIN_VELOCITY_THRESHOLD)
+                {
+                    const float clampedDistance = std::max(fieldDistance, 0.1f);
+                    const float force = m_fields[i].intensity * m_fields[i].mass / (clampedDistance * clampedDistance);
+                    gravity += fieldOffset * (force / fieldDistance);
+                }
+            }
+            nodeIndex = node.nextSibling;
+            continue;
+        }
+        
+        const PhysicsVector3D offset = node.centerOfMass - position;
+        const float distanceSquared = offset.MagnitudeSquared();
+        const float width = node.halfSize * 2.0f;
+        const bool isInsideCell =
+            std::abs(position.x - node.cellCenter.x) <= node.halfSize &&
+            std::abs(position.y - node.cellCenter.y) <= node.halfSize &&
+            std::abs(position.z - node.cellCenter.z) <= node.halfSize;
+        
+        if (!isInsideCell && width * width < openingAngleSquared * distanceSquared)
+        {
+            // Far enough away - the whole cell acts as one attractor at its centre of mass
+            const float distance = offset.Magnitude();
+            const float clampedDistance = std::max(distance, 0.1f);
+            const float force = node.strength / (clampedDistance * clampedDistance);
+            gravity += offset * (force / distance);
+            nodeIndex = node.nextSibling;
+        }
+        else
+        {
+            ++nodeIndex;
+        }
+    }
+    
+    return gravity;
+}
+
+size_t PhysicsGravityTree::GetMemoryUsage() const
+{
+    return m_nodes.capacity() * sizeof(Node) +
+        (m_fields.capacity() + m_exactFields.capacity() + m_partitionScratch.capacity()) * sizeof(GravityField);
+}
+
 //==============================================================================
 // PhysicsBody Implementation
 //==============================================================================
@@ -507,6 +816,8 @@ void PhysicsBody::ApplyForce(const PhysicsVector3D& force)
     // Only apply force to dynamic bodies
     if (!isStatic && isActive)
     {
+        isSleeping = false;
+
         // F = ma, therefore a = F/m = F * inverseMass
         acceleration += force * inverseMass;
     }
@@ -517,6 +828,8 @@ void PhysicsBody::ApplyImpulse(const PhysicsVector3D& impulse)
     // Only apply impulse to dynamic bodies
     if (!isStatic && isActive)
     {
+        isSleeping = false;
+
         // Impulse directly changes velocity: Δv = J/m = J * inverseMass
         velocity += impulse * inverseMass;
     }
@@ -554,2355 +867,9320 @@ void PhysicsBody::IntegratePosition(float deltaTime)
 }
 
 //==============================================================================
-// ContactPoint and CollisionManifold Implementation
+// PhysicsWorldWriter / PhysicsWorldReader Implementation
 //==============================================================================
-void CollisionManifold::AddContact(const ContactPoint& contact)
+void PhysicsWorldWriter::WriteBytes(const void* data, size_t size)
 {
-    // Ensure we don't exceed maximum contact points
-    if (contacts.size() >= MAX_COLLISION_CONTACTS)
+    if (size == 0)
     {
-#if defined(_DEBUG_PHYSICS_)
-        debug.logLevelMessage(LogLevel::LOG_WARNING, L"[Physics] Maximum collision contacts reached");
-#endif
         return;
     }
-    
-    contacts.push_back(contact);
+
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    m_buffer.insert(m_buffer.end(), bytes, bytes + size);
 }
 
-void CollisionManifold::ResolveCollision()
+bool PhysicsWorldReader::CanRead(size_t count, size_t elementSize)
 {
-    // Ensure we have valid bodies
-    if (!bodyA || !bodyB || contacts.empty())
+    if (m_hasFailed || (elementSize != 0 && count > GetRemaining() / elementSize))
     {
-        return;
+        m_hasFailed = true;
+        return false;
     }
-    
-    // Calculate relative velocity
-    PhysicsVector3D relativeVelocity = bodyB->velocity - bodyA->velocity;
-    separatingVelocity = relativeVelocity.Dot(normal);
-    
-    // Don't resolve if velocities are separating
-    if (separatingVelocity > 0.0f)
+
+    return true;
+}
+
+bool PhysicsWorldReader::ReadBytes(void* data, size_t size)
+{
+    if (!CanRead(size, 1))
     {
-        return;
+        return false;
     }
-    
-    // Calculate restitution coefficient (bounce)
-    float restitution = std::min(bodyA->restitution, bodyB->restitution);
-    
-    // Calculate impulse magnitude
-    float impulseMagnitude = -(1.0f + restitution) * separatingVelocity;
-    impulseMagnitude /= (bodyA->inverseMass + bodyB->inverseMass);
-    
-    // Apply impulse to both bodies
-    PhysicsVector3D impulse = normal * impulseMagnitude;
-    bodyA->ApplyImpulse(impulse * -1.0f);
-    bodyB->ApplyImpulse(impulse);
-    
-#if defined(_DEBUG_PHYSICS_)
-    debug.logDebugMessage(LogLevel::LOG_DEBUG, L"[Physics] Resolved collision with impulse magnitude: %.3f", impulseMagnitude);
-#endif
+
+    if (size > 0)
+    {
+        std::memcpy(data, m_data + m_offset, size);
+        m_offset += size;
+    }
+    return true;
+}
+
+bool PhysicsWorldReader::ExpectTag(uint32_t tag)
+{
+    uint32_t value = 0;
+    if (Read(value) && value != tag)
+    {
+        m_hasFailed = true;
+    }
+    return !m_hasFailed;
 }
 
 //==============================================================================
-// RagdollJoint Implementation
+// PhysicsBodyStore Implementation
 //==============================================================================
-void RagdollJoint::ApplyConstraints()
+void PhysicsBodyStore::Resize(size_t count)
 {
-    // Ensure we have valid bodies
-    if (!bodyA || !bodyB || !isActive)
+    positionX.resize(count, 0.0f);
+    positionY.resize(count, 0.0f);
+    positionZ.resize(count, 0.0f);
+    previousPositionX.resize(count, 0.0f);
+    previousPositionY.resize(count, 0.0f);
+    previousPositionZ.resize(count, 0.0f);
+    velocityX.resize(count, 0.0f);
+    velocityY.resize(count, 0.0f);
+    velocityZ.resize(count, 0.0f);
+    accelerationX.resize(count, 0.0f);
+    accelerationY.resize(count, 0.0f);
+    accelerationZ.resize(count, 0.0f);
+    angularVelocityX.resize(count, 0.0f);
+    angularVelocityY.resize(count, 0.0f);
+    angularVelocityZ.resize(count, 0.0f);
+    mass.resize(count, 1.0f);
+    inverseMass.resize(count, 1.0f);
+    restitution.resize(count, DEFAULT_RESTITUTION);
+    friction.resize(count, DEFAULT_FRICTION);
+    drag.resize(count, DEFAULT_AIR_RESISTANCE);
+    radius.resize(count, DEFAULT_BODY_RADIUS);
+    collisionLayer.resize(count, COLLISION_LAYER_DEFAULT);
+    collisionMask.resize(count, COLLISION_MASK_ALL);
+    collisionGroup.resize(count, COLLISION_GROUP_NONE);
+    linearEnergy.resize(count, 0.0f);
+    angularEnergy.resize(count, 0.0f);
+    sleepTimer.resize(count, 0.0f);
+    sleepLink.resize(count, -1);
+    flags.resize(count, 0u);
+}
+
+void PhysicsBodyStore::Reserve(size_t count)
+{
+    positionX.reserve(count);
+    positionY.reserve(count);
+    positionZ.reserve(count);
+    previousPositionX.reserve(count);
+    previousPositionY.reserve(count);
+    previousPositionZ.reserve(count);
+    velocityX.reserve(count);
+    velocityY.reserve(count);
+    velocityZ.reserve(count);
+    accelerationX.reserve(count);
+    accelerationY.reserve(count);
+    accelerationZ.reserve(count);
+    angularVelocityX.reserve(count);
+    angularVelocityY.reserve(count);
+    angularVelocityZ.reserve(count);
+    mass.reserve(count);
+    inverseMass.reserve(count);
+    restitution.reserve(count);
+    friction.reserve(count);
+    drag.reserve(count);
+    radius.reserve(count);
+    collisionLayer.reserve(count);
+    collisionMask.reserve(count);
+    collisionGroup.reserve(count);
+    linearEnergy.reserve(count);
+    angularEnergy.reserve(count);
+    sleepTimer.reserve(count);
+    sleepLink.reserve(count);
+    flags.reserve(count);
+}
+
+void PhysicsBodyStore::Clear()
+{
+    Resize(0);
+}
+
+void PhysicsBodyStore::Store(int index, const PhysicsBody& body)
+{
+    positionX[index] = body.position.x;
+    positionY[index] = body.position.y;
+    positionZ[index] = body.position.z;
+    previousPositionX[index] = body.position.x;
+    previousPositionY[index] = body.position.y;
+    previousPositionZ[index] = body.position.z;
+    velocityX[index] = body.velocity.x;
+    velocityY[index] = body.velocity.y;
+    velocityZ[index] = body.velocity.z;
+    accelerationX[index] = body.acceleration.x;
+    accelerationY[index] = body.acceleration.y;
+    accelerationZ[index] = body.acceleration.z;
+    angularVelocityX[index] = body.angularVelocity.x;
+    angularVelocityY[index] = body.angularVelocity.y;
+    angularVelocityZ[index] = body.angularVelocity.z;
+    mass[index] = body.mass;
+    inverseMass[index] = body.inverseMass;
+    restitution[index] = body.restitution;
+    friction[index] = body.friction;
+    drag[index] = body.drag;
+    radius[index] = body.radius;
+    collisionLayer[index] = body.collisionLayer;
+    collisionMask[index] = body.collisionMask;
+    collisionGroup[index] = body.collisionGroup;
+
+    // A body stored awake wakes the island it was sleeping with
+    if (!body.isSleeping && IsSleeping(index))
     {
-        return;
+        WakeUp(index);
     }
-    
-    // Calculate current relative position
-    PhysicsVector3D relativePosition = bodyB->position - bodyA->position;
-    PhysicsVector3D targetPosition = anchorB - anchorA;
-    
-    // Calculate constraint violation
-    PhysicsVector3D constraint = relativePosition - targetPosition;
-    float constraintMagnitude = constraint.Magnitude();
-    
-    // Apply position correction if constraint is violated
-    if (constraintMagnitude > MIN_VELOCITY_THRESHOLD)
+
+    // Slot ownership is managed by Physics, only the body state bits are copied
+    uint32_t bodyFlags = flags[index] & (FLAG_IN_USE | FLAG_SLEEPING);
+    if (body.isActive) bodyFlags |= FLAG_ACTIVE;
+    if (body.isStatic) bodyFlags |= FLAG_STATIC;
+
+    // A body stored asleep on its own forms a single-body island
+    if (body.isSleeping && !body.isStatic && !(bodyFlags & FLAG_SLEEPING))
     {
-        PhysicsVector3D correction = constraint.Normalized() * (constraintMagnitude * 0.5f);
-        
-        // Apply correction based on inverse mass ratio
-        float totalInverseMass = bodyA->inverseMass + bodyB->inverseMass;
-        if (totalInverseMass > 0.0f)
+        bodyFlags |= FLAG_SLEEPING;
+        sleepLink[index] = index;
+    }
+    flags[index] = bodyFlags;
+}
+
+PhysicsBody PhysicsBodyStore::Load(int index) const
+{
+    PhysicsBody body;
+    body.position = PhysicsVector3D(positionX[index], positionY[index], positionZ[index]);
+    body.velocity = PhysicsVector3D(velocityX[index], velocityY[index], velocityZ[index]);
+    body.acceleration = PhysicsVector3D(accelerationX[index], accelerationY[index], accelerationZ[index]);
+    body.angularVelocity = PhysicsVector3D(angularVelocityX[index], angularVelocityY[index], angularVelocityZ[index]);
+    body.mass = mass[index];
+    body.inverseMass = inverseMass[index];
+    body.restitution = restitution[index];
+    body.friction = friction[index];
+    body.drag = drag[index];
+    body.radius = radius[index];
+    body.collisionLayer = collisionLayer[index];
+    body.collisionMask = collisionMask[index];
+    body.collisionGroup = collisionGroup[index];
+    body.isActive = (flags[index] & FLAG_ACTIVE) != 0;
+    body.isStatic = (flags[index] & FLAG_STATIC) != 0;
+    body.isSleeping = (flags[index] & FLAG_SLEEPING) != 0;
+    return body;
+}
+
+void PhysicsBodyStore::WakeUp(int index)
+{
+    if (!IsSleeping(index))
+    {
+        return;
+    }
+
+    // Bodies that fell asleep together are linked in a ring - wake the whole ring
+    int current = index;
+    do
+    {
+        const int next = sleepLink[current];
+        flags[current] &= ~FLAG_SLEEPING;
+        sleepLink[current] = -1;
+        sleepTimer[current] = 0.0f;
+        current = next;
+    } while (current >= 0 && current != index);
+}
+
+void PhysicsBodyStore::CapturePreviousPositions()
+{
+    // Same-size copies reuse the existing buffers
+    previousPositionX = positionX;
+    previousPositionY = positionY;
+    previousPositionZ = positionZ;
+}
+
+size_t PhysicsBodyStore::GetMemoryUsage() const
+{
+    // 24 float streams plus the collision filter, sleep link and flag streams
+    return flags.capacity() * (24 * sizeof(float) + 2 * sizeof(int) + 3 * sizeof(uint32_t));
+}
+
+void PhysicsBodyStore::Serialize(PhysicsWorldWriter& writer) const
+{
+    const std::vector<float>* floatStreams[] = { &positionX, &positionY, &positionZ,
+        &previousPositionX, &previousPositionY, &previousPositionZ, &velocityX, &velocityY, &velocityZ,
+        &accelerationX, &accelerationY, &accelerationZ, &angularVelocityX, &angularVelocityY, &angularVelocityZ,
+        &mass, &inverseMass, &restitution, &friction, &drag, &radius, &linearEnergy, &angularEnergy, &sleepTimer };
+    const std::vector<uint32_t>* bitStreams[] = { &collisionLayer, &collisionMask, &flags };
+    const std::vector<int>* indexStreams[] = { &collisionGroup, &sleepLink };
+
+    // One count for the whole store, then every stream as a raw run
+    const size_t count = Size();
+    writer.Write(static_cast<uint32_t>(count));
+    for (const std::vector<float>* stream : floatStreams)
+    {
+        writer.WriteBytes(stream->data(), count * sizeof(float));
+    }
+    for (const std::vector<uint32_t>* stream : bitStreams)
+    {
+        writer.WriteBytes(stream->data(), count * sizeof(uint32_t));
+    }
+    for (const std::vector<int>* stream : indexStreams)
+    {
+        writer.WriteBytes(stream->data(), count * sizeof(int));
+    }
+}
+
+bool PhysicsBodyStore::Deserialize(PhysicsWorldReader& reader)
+{
+    std::vector<float>* floatStreams[] = { &positionX, &positionY, &positionZ,
+        &previousPositionX, &previousPositionY, &previousPositionZ, &velocityX, &velocityY, &velocityZ,
+        &accelerationX, &accelerationY, &accelerationZ, &angularVelocityX, &angularVelocityY, &angularVelocityZ,
+        &mass, &inverseMass, &restitution, &friction, &drag, &radius, &linearEnergy, &angularEnergy, &sleepTimer };
+    std::vector<uint32_t>* bitStreams[] = { &collisionLayer, &collisionMask, &flags };
+    std::vector<int>* indexStreams[] = { &collisionGroup, &sleepLink };
+    const size_t bytesPerBody = std::size(floatStreams) * sizeof(float) + std::size(bitStreams) * sizeof(uint32_t) +
+        std::size(indexStreams) * sizeof(int);
+
+    // Size every stream once from the stored count, then fill each with a single copy
+    uint32_t count = 0;
+    if (!reader.Read(count) || !reader.CanRead(count, bytesPerBody))
+    {
+        return false;
+    }
+
+    Resize(count);
+    for (std::vector<float>* stream : floatStreams)
+    {
+        reader.ReadBytes(stream->data(), count * sizeof(float));
+    }
+    for (std::vector<uint32_t>* stream : bitStreams)
+    {
+        reader.ReadBytes(stream->data(), count * sizeof(uint32_t));
+    }
+    for (std::vector<int>* stream : indexStreams)
+    {
+        reader.ReadBytes(stream->data(), count * sizeof(int));
+    }
+
+    // Sleep links are followed without bounds checks by WakeUp
+    for (int link : sleepLink)
+    {
+        if (link < -1 || link >= static_cast<int>(count))
         {
-            float massRatioA = bodyA->inverseMass / totalInverseMass;
-            float massRatioB = bodyB->inverseMass / totalInverseMass;
-            
-            bodyA->position += correction * massRatioA;
-            bodyB->position -= correction * massRatioB;
+            return false;
         }
     }
-    
-    // Apply angular constraints (simplified)
-    PhysicsVector3D relativeVelocity = bodyB->velocity - bodyA->velocity;
-    PhysicsVector3D dampingForce = relativeVelocity * (-damping);
-    
-    bodyA->ApplyForce(dampingForce * -1.0f);
-    bodyB->ApplyForce(dampingForce);
+    return !reader.HasFailed();
 }
 
 //==============================================================================
-// AudioPhysicsData Implementation
+// PhysicsBodyHandle Implementation
 //==============================================================================
-void AudioPhysicsData::CalculateAudioProperties(float speedOfSound)
+bool PhysicsBodyHandle::IsValid() const
 {
-    // Calculate distance between source and listener
-    PhysicsVector3D distanceVector = sourcePosition - listenerPosition;
-    distance = distanceVector.Magnitude();
-    
-    // Calculate volume falloff based on inverse square law
-    if (distance > 0.1f)
+    return m_store && m_index >= 0 && static_cast<size_t>(m_index) < m_store->Size() &&
+        (m_store->flags[m_index] & PhysicsBodyStore::FLAG_IN_USE) != 0;
+}
+
+PhysicsVector3D PhysicsBodyHandle::GetPosition() const
+{
+    return IsValid() ? m_store->GetPosition(m_index) : PhysicsVector3D();
+}
+
+void PhysicsBodyHandle::SetPosition(const PhysicsVector3D& position)
+{
+    if (!IsValid()) return;
+    m_store->WakeUp(m_index);
+    m_store->positionX[m_index] = position.x;
+    m_store->positionY[m_index] = position.y;
+    m_store->positionZ[m_index] = position.z;
+
+    // Teleports are not smoothed by render interpolation
+    m_store->previousPositionX[m_index] = position.x;
+    m_store->previousPositionY[m_index] = position.y;
+    m_store->previousPositionZ[m_index] = position.z;
+}
+
+PhysicsVector3D PhysicsBodyHandle::GetVelocity() const
+{
+    return IsValid() ? m_store->GetVelocity(m_index) : PhysicsVector3D();
+}
+
+void PhysicsBodyHandle::SetVelocity(const PhysicsVector3D& velocity)
+{
+    if (!IsValid()) return;
+    m_store->WakeUp(m_index);
+    m_store->velocityX[m_index] = velocity.x;
+    m_store->velocityY[m_index] = velocity.y;
+    m_store->velocityZ[m_index] = velocity.z;
+}
+
+PhysicsVector3D PhysicsBodyHandle::GetAcceleration() const
+{
+    if (!IsValid()) return PhysicsVector3D();
+    return PhysicsVector3D(m_store->accelerationX[m_index], m_store->accelerationY[m_index], m_store->accelerationZ[m_index]);
+}
+
+void PhysicsBodyHandle::SetAcceleration(const PhysicsVector3D& acceleration)
+{
+    if (!IsValid()) return;
+    m_store->accelerationX[m_index] = acceleration.x;
+    m_store->accelerationY[m_index] = acceleration.y;
+    m_store->accelerationZ[m_index] = acceleration.z;
+}
+
+PhysicsVector3D PhysicsBodyHandle::GetAngularVelocity() const
+{
+    if (!IsValid()) return PhysicsVector3D();
+    return PhysicsVector3D(m_store->angularVelocityX[m_index], m_store->angularVelocityY[m_index], m_store->angularVelocityZ[m_index]);
+}
+
+void PhysicsBodyHandle::SetAngularVelocity(const PhysicsVector3D& angularVelocity)
+{
+    if (!IsValid()) return;
+    m_store->angularVelocityX[m_index] = angularVelocity.x;
+    m_store->angularVelocityY[m_index] = angularVelocity.y;
+    m_store->angularVelocityZ[m_index] = angularVelocity.z;
+}
+
+float PhysicsBodyHandle::GetMass() const { return IsValid() ? m_store->mass[m_index] : 0.0f; }
+float PhysicsBodyHandle::GetInverseMass() const { return IsValid() ? m_store->inverseMass[m_index] : 0.0f; }
+float PhysicsBodyHandle::GetRestitution() const { return IsValid() ? m_store->restitution[m_index] : 0.0f; }
+void PhysicsBodyHandle::SetRestitution(float restitution) { if (IsValid()) m_store->restitution[m_index] = restitution; }
+float PhysicsBodyHandle::GetFriction() const { return IsValid() ? m_store->friction[m_index] : 0.0f; }
+void PhysicsBodyHandle::SetFriction(float friction) { if (IsValid()) m_store->friction[m_index] = friction; }
+float PhysicsBodyHandle::GetDrag() const { return IsValid() ? m_store->drag[m_index] : 0.0f; }
+void PhysicsBodyHandle::SetDrag(float drag) { if (IsValid()) m_store->drag[m_index] = drag; }
+float PhysicsBodyHandle::GetRadius() const { return IsValid() ? m_store->radius[m_index] : 0.0f; }
+
+void PhysicsBodyHandle::SetRadius(float radius)
+{
+    if (IsValid())
     {
-        volumeFalloff = 1.0f / (1.0f + distance * distance * 0.01f);
+        m_store->radius[m_index] = (radius > 0.0f) ? radius : DEFAULT_BODY_RADIUS;
+    }
+}
+
+uint32_t PhysicsBodyHandle::GetCollisionLayer() const { return IsValid() ? m_store->collisionLayer[m_index] : 0u; }
+uint32_t PhysicsBodyHandle::GetCollisionMask() const { return IsValid() ? m_store->collisionMask[m_index] : 0u; }
+int PhysicsBodyHandle::GetCollisionGroup() const { return IsValid() ? m_store->collisionGroup[m_index] : COLLISION_GROUP_NONE; }
+
+void PhysicsBodyHandle::SetCollisionFilter(uint32_t layer, uint32_t mask, int group)
+{
+    if (IsValid())
+    {
+        m_store->collisionLayer[m_index] = layer;
+        m_store->collisionMask[m_index] = mask;
+        m_store->collisionGroup[m_index] = group;
+    }
+}
+
+bool PhysicsBodyHandle::IsStatic() const
+{
+    return IsValid() && (m_store->flags[m_index] & PhysicsBodyStore::FLAG_STATIC) != 0;
+}
+
+void PhysicsBodyHandle::SetStatic(bool isStatic)
+{
+    if (!IsValid()) return;
+
+    if (isStatic)
+    {
+        m_store->flags[m_index] |= PhysicsBodyStore::FLAG_STATIC;
     }
     else
     {
-        volumeFalloff = 1.0f;
+        m_store->flags[m_index] &= ~PhysicsBodyStore::FLAG_STATIC;
     }
-    
-    // Calculate Doppler shift
-    if (distance > MIN_VELOCITY_THRESHOLD)
+
+    // Keep inverse mass consistent with the static flag
+    m_store->inverseMass[m_index] = isStatic ? 0.0f : (1.0f / m_store->mass[m_index]);
+}
+
+bool PhysicsBodyHandle::IsActive() const
+{
+    return IsValid() && (m_store->flags[m_index] & PhysicsBodyStore::FLAG_ACTIVE) != 0;
+}
+
+void PhysicsBodyHandle::SetActive(bool isActive)
+{
+    if (!IsValid()) return;
+
+    if (isActive)
     {
-        PhysicsVector3D direction = distanceVector.Normalized();
-        float relativeVelocity = sourceVelocity.Dot(direction);
-        dopplerShift = speedOfSound / (speedOfSound - relativeVelocity);
-        
-        // Clamp Doppler shift to reasonable range
-        dopplerShift = std::clamp(dopplerShift, 0.5f, 2.0f);
+        m_store->flags[m_index] |= PhysicsBodyStore::FLAG_ACTIVE;
     }
     else
     {
-        dopplerShift = 1.0f;
+        m_store->flags[m_index] &= ~PhysicsBodyStore::FLAG_ACTIVE;
     }
-    
-    // Calculate basic reverb based on distance
-    reverb = std::min(0.8f, distance * 0.01f);
-    
+}
+
+bool PhysicsBodyHandle::IsSleeping() const
+{
+    return IsValid() && m_store->IsSleeping(m_index);
+}
+
+void PhysicsBodyHandle::WakeUp()
+{
+    if (IsValid())
+    {
+        m_store->WakeUp(m_index);
+    }
+}
+
+void PhysicsBodyHandle::SetMass(float newMass)
+{
+    if (!IsValid()) return;
+
+    // Ensure mass is positive
+    if (newMass <= 0.0f)
+    {
 #if defined(_DEBUG_PHYSICS_)
-    debug.logDebugMessage(LogLevel::LOG_DEBUG, L"[Physics] Audio properties - Distance: %.2f, Doppler: %.3f, Volume: %.3f", 
-                         distance, dopplerShift, volumeFalloff);
+        debug.logLevelMessage(LogLevel::LOG_WARNING, L"[Physics] Attempting to set non-positive mass, using default value");
 #endif
+        newMass = 1.0f;
+    }
+
+    m_store->mass[m_index] = newMass;
+    m_store->inverseMass[m_index] = IsStatic() ? 0.0f : (1.0f / newMass);
 }
 
-//==============================================================================
-// PhysicsParticle Implementation
-//==============================================================================
-void PhysicsParticle::Update(float deltaTime)
+void PhysicsBodyHandle::ApplyForce(const PhysicsVector3D& force)
 {
-    // Only update active particles
-    if (!isActive)
+    // Only apply force to dynamic bodies
+    if (IsValid() && IsActive() && !IsStatic())
     {
-        return;
+        m_store->WakeUp(m_index);
+        const float inverseMass = m_store->inverseMass[m_index];
+        m_store->accelerationX[m_index] += force.x * inverseMass;
+        m_store->accelerationY[m_index] += force.y * inverseMass;
+        m_store->accelerationZ[m_index] += force.z * inverseMass;
     }
-    
-    // Update velocity with acceleration
-    velocity += acceleration * deltaTime;
-    
-    // Apply drag
-    float dragFactor = 1.0f - (drag * deltaTime);
-    dragFactor = std::max(0.0f, dragFactor);
-    velocity *= dragFactor;
-    
-    // Update position
-    position += velocity * deltaTime;
-    
-    // Update lifetime
-    life -= deltaTime;
-    
-    // Deactivate particle if lifetime expired
-    if (life <= 0.0f)
+}
+
+void PhysicsBodyHandle::ApplyImpulse(const PhysicsVector3D& impulse)
+{
+    // Only apply impulse to dynamic bodies
+    if (IsValid() && IsActive() && !IsStatic())
     {
-        isActive = false;
+        m_store->WakeUp(m_index);
+        const float inverseMass = m_store->inverseMass[m_index];
+        m_store->velocityX[m_index] += impulse.x * inverseMass;
+        m_store->velocityY[m_index] += impulse.y * inverseMass;
+        m_store->velocityZ[m_index] += impulse.z * inverseMass;
     }
-    
-    // Reset acceleration for next frame
-    acceleration = PhysicsVector3D();
 }
 
-//==============================================================================
-// Physics Class Constructor and Destructor
-//==============================================================================
-Physics::Physics() :
-    m_bIsInitialized(false),
-    m_bHasCleanedUp(false),
-    m_lastUpdateTime(0.0f),
-    m_activeBodyCount(0),
-    m_collisionCount(0),
-    m_particleCount(0),
-    m_mathPrecalc(MathPrecalculation::GetInstance()),
-m_exceptionHandler(ExceptionHandler::GetInstance())
+void PhysicsBodyHandle::IntegrateVelocity(float deltaTime)
 {
-   PHYSICS_RECORD_FUNCTION();
-   
-   // Reserve memory for physics collections to avoid frequent reallocations
-   m_physicsBodies.reserve(1000);
-   m_gravityFields.reserve(10);
-   m_ragdollJoints.reserve(MAX_RAGDOLL_JOINTS);
-   m_collisionManifolds.reserve(100);
-   m_debugLines.reserve(1000);
-   
-#if defined(_DEBUG_PHYSICS_)
-   debug.logLevelMessage(LogLevel::LOG_INFO, L"[Physics] Constructor called - Memory reserved for physics systems");
-#endif
+    if (!IsValid()) return;
+
+    PhysicsBody body = m_store->Load(m_index);
+    body.IntegrateVelocity(deltaTime);
+    SetVelocity(body.velocity);
+    SetAcceleration(body.acceleration);
 }
 
-Physics::~Physics()
+void PhysicsBodyHandle::IntegratePosition(float deltaTime)
 {
-   PHYSICS_RECORD_FUNCTION();
-   
-   // Ensure cleanup is performed
-   if (!m_bHasCleanedUp.load())
-   {
-       Cleanup();
-   }
-   
-#if defined(_DEBUG_PHYSICS_)
-   debug.logLevelMessage(LogLevel::LOG_INFO, L"[Physics] Destructor called - All resources cleaned up");
-#endif
+    if (!IsValid()) return;
+
+    PhysicsBody body = m_store->Load(m_index);
+    body.IntegratePosition(deltaTime);
+    SetPosition(body.position);
+}
+
+PhysicsBody PhysicsBodyHandle::ToBody() const
+{
+    return IsValid() ? m_store->Load(m_index) : PhysicsBody();
+}
+
+void PhysicsBodyHandle::FromBody(const PhysicsBody& body)
+{
+    if (IsValid())
+    {
+        m_store->Store(m_index, body);
+    }
 }
 
 //==============================================================================
-// Initialization and Cleanup Methods
+// Body Store Integration Kernels
 //==============================================================================
-bool Physics::Initialize()
+// Velocity Verlet step shared by every kernel, applied to awake simulated dynamic bodies only:
+//   a  = accumulated acceleration + uniformGravity * inverseMass
+//   p += v * dt + 0.5 * a * dt^2
+//   v  = (v + a * dt) * max(0, 1 - drag * dt)
+//   accumulated acceleration is cleared for the next step
+static const uint32_t INTEGRATION_FLAG_MASK = PhysicsBodyStore::FLAG_SIMULATED | PhysicsBodyStore::FLAG_STATIC |
+    PhysicsBodyStore::FLAG_SLEEPING;
+
+static void IntegrateBodyStoreScalar(PhysicsBodyStore& store, size_t begin, size_t end,
+    const PhysicsVector3D& gravity, float deltaTime)
 {
-   PHYSICS_RECORD_FUNCTION();
-   
-   // Check if already initialized to prevent double initialization
-   if (m_bIsInitialized.load())
-   {
-#if defined(_DEBUG_PHYSICS_)
-       debug.logLevelMessage(LogLevel::LOG_WARNING, L"[Physics] Already initialized - skipping");
-#endif
-       return true;
-   }
-   
-   // Thread-safe initialization using mutex
-   std::lock_guard<std::mutex> lock(m_physicsMutex);
-   
-   // Double-check pattern to ensure thread safety
-   if (m_bIsInitialized.load())
-   {
-       return true;
-   }
-   
-#if defined(_DEBUG_PHYSICS_)
-   debug.logLevelMessage(LogLevel::LOG_INFO, L"[Physics] Starting initialization of physics systems");
-#endif
-   
-   try
-   {
-       // Initialize MathPrecalculation if not already done
-       if (!m_mathPrecalc.IsInitialized())
-       {
-           if (!m_mathPrecalc.Initialize())
-           {
-               throw std::runtime_error("Failed to initialize MathPrecalculation system");
-           }
-       }
-       
-       // Initialize exception handler if not already done
-       if (!m_exceptionHandler.Initialize())
-       {
-#if defined(_DEBUG_PHYSICS_)
-           debug.logLevelMessage(LogLevel::LOG_WARNING, L"[Physics] ExceptionHandler initialization failed, continuing without it");
+    const float halfDeltaTimeSquared = 0.5f * deltaTime * deltaTime;
+
+    for (size_t i = begin; i < end; ++i)
+    {
+        if ((store.flags[i] & INTEGRATION_FLAG_MASK) != PhysicsBodyStore::FLAG_SIMULATED)
+        {
+            continue;
+        }
+
+        const float inverseMass = store.inverseMass[i];
+        const float ax = store.accelerationX[i] + gravity.x * inverseMass;
+        const float ay = store.accelerationY[i] + gravity.y * inverseMass;
+        const float az = store.accelerationZ[i] + gravity.z * inverseMass;
+
+        store.positionX[i] += store.velocityX[i] * deltaTime + ax * halfDeltaTimeSquared;
+        store.positionY[i] += store.velocityY[i] * deltaTime + ay * halfDeltaTimeSquared;
+        store.positionZ[i] += store.velocityZ[i] * deltaTime + az * halfDeltaTimeSquared;
+
+        const float dragFactor = std::max(0.0f, 1.0f - store.drag[i] * deltaTime);
+        store.velocityX[i] = (store.velocityX[i] + ax * deltaTime) * dragFactor;
+        store.velocityY[i] = (store.velocityY[i] + ay * deltaTime) * dragFactor;
+        store.velocityZ[i] = (store.velocityZ[i] + az * deltaTime) * dragFactor;
+
+        store.accelerationX[i] = 0.0f;
+        store.accelerationY[i] = 0.0f;
+        store.accelerationZ[i] = 0.0f;
+    }
+}
+
+#if defined(CPUFEATURES_X86)
+// SSE2 - 4 bodies per iteration, masked lanes keep their previous values
+static size_t IntegrateBodyStoreSSE2(PhysicsBodyStore& store, size_t count, const PhysicsVector3D& gravity, float deltaTime)
+{
+    const __m128 dt = _mm_set1_ps(deltaTime);
+    const __m128 halfDt2 = _mm_set1_ps(0.5f * deltaTime * deltaTime);
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 gx = _mm_set1_ps(gravity.x);
+    const __m128 gy = _mm_set1_ps(gravity.y);
+    const __m128 gz = _mm_set1_ps(gravity.z);
+    const __m128i flagMask = _mm_set1_epi32(static_cast<int>(INTEGRATION_FLAG_MASK));
+    const __m128i flagWanted = _mm_set1_epi32(static_cast<int>(PhysicsBodyStore::FLAG_SIMULATED));
+
+    auto select = [](__m128 mask, __m128 a, __m128 b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); };
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128i laneFlags = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&store.flags[i]));
+        const __m128 mask = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(laneFlags, flagMask), flagWanted));
+        if (_mm_movemask_ps(mask) == 0)
+        {
+            continue;
+        }
+
+        const __m128 inverseMass = _mm_loadu_ps(&store.inverseMass[i]);
+        const __m128 dragFactor = _mm_max_ps(zero, _mm_sub_ps(one, _mm_mul_ps(_mm_loadu_ps(&store.drag[i]), dt)));
+
+        float* position[3] = { &store.positionX[i], &store.positionY[i], &store.positionZ[i] };
+        float* velocity[3] = { &store.velocityX[i], &store.velocityY[i], &store.velocityZ[i] };
+        float* acceleration[3] = { &store.accelerationX[i], &store.accelerationY[i], &store.accelerationZ[i] };
+        const __m128 gravityAxis[3] = { gx, gy, gz };
+
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            const __m128 p = _mm_loadu_ps(position[axis]);
+            const __m128 v = _mm_loadu_ps(velocity[axis]);
+            const __m128 accumulated = _mm_loadu_ps(acceleration[axis]);
+            const __m128 a = _mm_add_ps(accumulated, _mm_mul_ps(gravityAxis[axis], inverseMass));
+
+            const __m128 newP = _mm_add_ps(p, _mm_add_ps(_mm_mul_ps(v, dt), _mm_mul_ps(a, halfDt2)));
+            const __m128 newV = _mm_mul_ps(_mm_add_ps(v, _mm_mul_ps(a, dt)), dragFactor);
+
+            _mm_storeu_ps(position[axis], select(mask, newP, p));
+            _mm_storeu_ps(velocity[axis], select(mask, newV, v));
+            _mm_storeu_ps(acceleration[axis], select(mask, zero, accumulated));
+        }
+    }
+
+    return i;
+}
+
+// AVX2 + FMA - 8 bodies per iteration
+CPUFEATURES_TARGET_AVX2
+static size_t IntegrateBodyStoreAVX2(PhysicsBodyStore& store, size_t count, const PhysicsVector3D& gravity, float deltaTime)
+{
+    const __m256 dt = _mm256_set1_ps(deltaTime);
+    const __m256 halfDt2 = _mm256_set1_ps(0.5f * deltaTime * deltaTime);
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 gravityAxis[3] = { _mm256_set1_ps(gravity.x), _mm256_set1_ps(gravity.y), _mm256_set1_ps(gravity.z) };
+    const __m256i flagMask = _mm256_set1_epi32(static_cast<int>(INTEGRATION_FLAG_MASK));
+    const __m256i flagWanted = _mm256_set1_epi32(static_cast<int>(PhysicsBodyStore::FLAG_SIMULATED));
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m256i laneFlags = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&store.flags[i]));
+        const __m256 mask = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(laneFlags, flagMask), flagWanted));
+        if (_mm256_movemask_ps(mask) == 0)
+        {
+            continue;
+        }
+
+        const __m256 inverseMass = _mm256_loadu_ps(&store.inverseMass[i]);
+        const __m256 dragFactor = _mm256_max_ps(zero, _mm256_fnmadd_ps(_mm256_loadu_ps(&store.drag[i]), dt, one));
+
+        float* position[3] = { &store.positionX[i], &store.positionY[i], &store.positionZ[i] };
+        float* velocity[3] = { &store.velocityX[i], &store.velocityY[i], &store.velocityZ[i] };
+        float* acceleration[3] = { &store.accelerationX[i], &store.accelerationY[i], &store.accelerationZ[i] };
+
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            const __m256 p = _mm256_loadu_ps(position[axis]);
+            const __m256 v = _mm256_loadu_ps(velocity[axis]);
+            const __m256 accumulated = _mm256_loadu_ps(acceleration[axis]);
+            const __m256 a = _mm256_fmadd_ps(gravityAxis[axis], inverseMass, accumulated);
+
+            const __m256 newP = _mm256_fmadd_ps(a, halfDt2, _mm256_fmadd_ps(v, dt, p));
+            const __m256 newV = _mm256_mul_ps(_mm256_fmadd_ps(a, dt, v), dragFactor);
+
+            _mm256_storeu_ps(position[axis], _mm256_blendv_ps(p, newP, mask));
+            _mm256_storeu_ps(velocity[axis], _mm256_blendv_ps(v, newV, mask));
+            _mm256_storeu_ps(acceleration[axis], _mm256_blendv_ps(accumulated, zero, mask));
+        }
+    }
+
+    return i;
+}
 #endif
-       }
-       
-       // Initialize physics-specific precalculations
-       InitializePhysicsPrecalculations();
-       
-       // Allocate physics memory pools
-       AllocatePhysicsMemory();
-       
-       // Reset performance counters
-       ResetPerformanceCounters();
-       
-       // Set global physics instance
-       g_pPhysics = this;
-       
-       // Mark as successfully initialized
-       m_bIsInitialized.store(true);
-       
+
+//==============================================================================
+// PhysicsFrameArena Implementation
+//==============================================================================
+PhysicsFrameArena::PhysicsFrameArena() :
+    m_offset(0),
+    m_usedSize(0),
+    m_peakSize(0),
+    m_generation(1),
+    m_blockAllocationCount(0)
+{
+}
+
+PhysicsFrameArena::~PhysicsFrameArena()
+{
+    Release();
+}
+
+void* PhysicsFrameArena::Allocate(size_t size, size_t alignment)
+{
+    if (!m_blocks.empty())
+    {
+        const Block& block = m_blocks.back();
+        const uintptr_t base = reinterpret_cast<uintptr_t>(block.data);
+        const uintptr_t aligned = (base + m_offset + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1);
+        const size_t alignedOffset = static_cast<size_t>(aligned - base);
+        if (alignedOffset + size <= block.size)
+        {
+            m_usedSize += (alignedOffset - m_offset) + size;
+            m_peakSize = std::max(m_peakSize, m_usedSize);
+            m_offset = alignedOffset + size;
+            return block.data + alignedOffset;
+        }
+    }
+
+    // Out of room - spill into an overflow block (folded into the main block by the next Reset)
+    AddBlock(size + alignment);
+    return Allocate(size, alignment);
+}
+
+bool PhysicsFrameArena::Extend(void* allocation, size_t oldSize, size_t newSize)
+{
+    if (m_blocks.empty() || newSize < oldSize)
+    {
+        return false;
+    }
+
+    const Block& block = m_blocks.back();
+    const uintptr_t base = reinterpret_cast<uintptr_t>(block.data);
+    const uintptr_t start = reinterpret_cast<uintptr_t>(allocation);
+    if (start < base || start + oldSize != base + m_offset || (start - base) + newSize > block.size)
+    {
+        return false;
+    }
+
+    m_offset += newSize - oldSize;
+    m_usedSize += newSize - oldSize;
+    m_peakSize = std::max(m_peakSize, m_usedSize);
+    return true;
+}
+
+void PhysicsFrameArena::Reset()
+{
+    // A step that needed overflow blocks gets one block covering all of them from now on
+    if (m_blocks.size() > 1)
+    {
+        const size_t capacity = GetCapacity();
+        Release();
+        AddBlock(capacity);
+    }
+
+    m_offset = 0;
+    m_usedSize = 0;
+    ++m_generation;
+}
+
+void PhysicsFrameArena::Release()
+{
+    for (const Block& block : m_blocks)
+    {
+        delete[] block.data;
+    }
+
+    m_blocks.clear();
+    m_offset = 0;
+    m_usedSize = 0;
+    ++m_generation;
+}
+
+void PhysicsFrameArena::Reserve(size_t size)
+{
+    if (GetCapacity() >= size)
+    {
+        return;
+    }
+
+    Release();
+    AddBlock(size);
+}
+
+size_t PhysicsFrameArena::GetCapacity() const
+{
+    size_t capacity = 0;
+    for (const Block& block : m_blocks)
+    {
+        capacity += block.size;
+    }
+    return capacity;
+}
+
+void PhysicsFrameArena::AddBlock(size_t minimumSize)
+{
+    // Grow geometrically so a step that overflows needs few extra blocks
+    size_t size = std::max(minimumSize, DEFAULT_FRAME_ARENA_SIZE);
+    if (!m_blocks.empty())
+    {
+        size = std::max(size, m_blocks.back().size * 2);
+    }
+
+    Block block;
+    block.data = new unsigned char[size];
+    block.size = size;
+    m_blocks.push_back(block);
+    m_offset = 0;
+    ++m_blockAllocationCount;
+
 #if defined(_DEBUG_PHYSICS_)
-       debug.logDebugMessage(LogLevel::LOG_INFO, L"[Physics] Initialization completed successfully - Memory usage: %zu bytes", 
-                            GetPhysicsMemoryUsage());
+    debug.logDebugMessage(LogLevel::LOG_DEBUG, L"[Physics] Frame arena block allocated - %zu bytes (%zu blocks)",
+        size, m_blocks.size());
 #endif
-       
-       return true;
-   }
-   catch (const std::exception& e)
-   {
-       // Convert exception message to wide string for logging
-       std::string errorMsg = e.what();
-       std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
-       
-       debug.logLevelMessage(LogLevel::LOG_CRITICAL, L"[Physics] Initialization failed with exception: " + wErrorMsg);
-       
-       // Clean up any partially initialized resources
-       Cleanup();
-       return false;
-   }
-   catch (...)
-   {
-       debug.logLevelMessage(LogLevel::LOG_CRITICAL, L"[Physics] Initialization failed with unknown exception");
-       
-       // Clean up any partially initialized resources
-       Cleanup();
-       return false;
-   }
 }
 
-void Physics::Cleanup()
+//==============================================================================
+// ContactPoint and CollisionManifold Implementation
+//==============================================================================
+void CollisionManifold::AddContact(const ContactPoint& contact)
 {
-   PHYSICS_RECORD_FUNCTION();
-   
-   // Check if already cleaned up
-   if (m_bHasCleanedUp.load())
-   {
-       return;
-   }
-   
-   // Thread-safe cleanup using mutex
-   std::lock_guard<std::mutex> lock(m_physicsMutex);
-   
-   // Double-check pattern to ensure thread safety
-   if (m_bHasCleanedUp.load())
-   {
-       return;
-   }
-   
+    // Contacts live inline - ensure we don't exceed the fixed capacity
+    if (!contacts.push_back(contact))
+    {
 #if defined(_DEBUG_PHYSICS_)
-   debug.logLevelMessage(LogLevel::LOG_INFO, L"[Physics] Starting cleanup of physics systems");
+        debug.logLevelMessage(LogLevel::LOG_WARNING, L"[Physics] Maximum collision contacts reached");
 #endif
-   
-   // Deallocate physics memory
-   DeallocatePhysicsMemory();
-   
-   // Clear all physics collections
-   m_physicsBodies.clear();
-   m_gravityFields.clear();
-   m_ragdollJoints.clear();
-   m_collisionManifolds.clear();
-   m_debugLines.clear();
-   
-   // Shrink collections to free memory
-   m_physicsBodies.shrink_to_fit();
-   m_gravityFields.shrink_to_fit();
-   m_ragdollJoints.shrink_to_fit();
-   m_collisionManifolds.shrink_to_fit();
-   m_debugLines.shrink_to_fit();
-   
-   // Reset counters
-   m_activeBodyCount.store(0);
-   m_collisionCount.store(0);
-   m_particleCount.store(0);
-   m_lastUpdateTime = 0.0f;
-   
-   // Clear global physics instance
-   if (g_pPhysics == this)
-   {
-       g_pPhysics = nullptr;
-   }
-   
-   // Reset state flags
-   m_bIsInitialized.store(false);
-   m_bHasCleanedUp.store(true);
-   
+    }
+}
+
+void CollisionManifold::ResolveCollision()
+{
+    // Ensure we have valid bodies
+    if (!bodyA || !bodyB || contacts.empty())
+    {
+        return;
+    }
+    
+    // Calculate relative velocity
+    PhysicsVector3D relativeVelocity = bodyB->velocity - bodyA->velocity;
+    separatingVelocity = relativeVelocity.Dot(normal);
+    
+    // Don't resolve if velocities are separating
+    if (separatingVelocity > 0.0f)
+    {
+        return;
+    }
+    
+    // Calculate restitution coefficient (bounce)
+    float restitution = std::min(bodyA->restitution, bodyB->restitution);
+    
+    // Calculate impulse magnitude
+    float impulseMagnitude = -(1.0f + restitution) * separatingVelocity;
+    impulseMagnitude /= (bodyA->inverseMass + bodyB->inverseMass);
+    
+    // Apply impulse to both bodies
+    PhysicsVector3D impulse = normal * impulseMagnitude;
+    bodyA->ApplyImpulse(impulse * -1.0f);
+    bodyB->ApplyImpulse(impulse);
+    
 #if defined(_DEBUG_PHYSICS_)
-   debug.logLevelMessage(LogLevel::LOG_INFO, L"[Physics] Cleanup completed successfully");
+    debug.logDebugMessage(LogLevel::LOG_DEBUG, L"[Physics] Resolved collision with impulse magnitude: %.3f", impulseMagnitude);
 #endif
 }
 
 //==============================================================================
-// Main Physics Update Method
+// RagdollJoint Implementation
 //==============================================================================
-void Physics::Update(float deltaTime)
+void RagdollJoint::ApplyConstraints()
 {
-   PHYSICS_RECORD_FUNCTION();
-   
-   // Ensure physics system is initialized
-   if (!m_bIsInitialized.load())
-   {
-#if defined(_DEBUG_PHYSICS_)
-       debug.logLevelMessage(LogLevel::LOG_WARNING, L"[Physics] Update called before initialization");
-#endif
-       return;
-   }
-   
-   // Measure update time for performance profiling
+    // Ensure we have valid bodies
+    if (!bodyA || !bodyB || !isActive)
+    {
+        return;
+    }
+    
+    // Calculate current relative position
+    PhysicsVector3D relativePosition = bodyB->position - bodyA->position;
+    PhysicsVector3D targetPosition = anchorB - anchorA;
+    
+    // Calculate constraint violation
+    PhysicsVector3D constraint = relativePosition - targetPosition;
+    float constraintMagnitude = constraint.Magnitude();
+    
+    // Apply position correction if constraint is violated
+    if (constraintMagnitude > MIN_VELOCITY_THRESHOLD)
+    {
+        PhysicsVector3D correction = constraint.Normalized() * (constraintMagnitude * 0.5f);
+        
+        // Apply correction based on inverse mass ratio
+        float totalInverseMass = bodyA->inverseMass + bodyB->inverseMass;
+        if (totalInverseMass > 0.0f)
+        {
+            float massRatioA = bodyA->inverseMass / totalInverseMass;
+            float massRatioB = bodyB->inverseMass / totalInverseMass;
+            
+            bodyA->position += correction * massRatioA;
+            bodyB->position -= correction * massRatioB;
+        }
+    }
+    
+    // Apply angular constraints (simplified)
+    PhysicsVector3D relativeVelocity = bodyB->velocity - bodyA->velocity;
+    PhysicsVector3D dampingForce = relativeVelocity * (-damping);
+    
+    bodyA->ApplyForce(dampingForce * -1.0f);
+    bodyB->ApplyForce(dampingForce);
+}
+
+//==============================================================================
+// AudioPhysicsData Implementation
+//==============================================================================
+void AudioPhysicsData::CalculateAudioProperties(float speedOfSound)
+{
+    // Calculate distance between source and listener
+    PhysicsVector3D distanceVector = sourcePosition - listenerPosition;
+    distance = distanceVector.Magnitude();
+    
+    // Calculate volume falloff based on inverse square law
+    if (distance > 0.1f)
+    {
+        volumeFalloff = 1.0f / (1.0f + distance * distance * 0.01f);
+    }
+    else
+    {
+        volumeFalloff = 1.0f;
+    }
+    
+    // Calculate Doppler shift
+    if (distance > MIN_VELOCITY_THRESHOLD)
+    {
+        PhysicsVector3D direction = distanceVector.Normalized();
+        float relativeVelocity = sourceVelocity.Dot(direction);
+        dopplerShift = speedOfSound / (speedOfSound - relativeVelocity);
+        
+        // Clamp Doppler shift to reasonable range
+        dopplerShift = std::clamp(dopplerShift, 0.5f, 2.0f);
+    }
+    else
+    {
+        dopplerShift = 1.0f;
+    }
+    
+    // Calculate basic reverb based on distance
+    reverb = std::min(0.8f, distance * 0.01f);
+    
+#if defined(_DEBUG_PHYSICS_)
+    debug.logDebugMessage(LogLevel::LOG_DEBUG, L"[Physics] Audio properties - Distance: %.2f, Doppler: %.3f, Volume: %.3f", 
+                         distance, dopplerShift, volumeFalloff);
+#endif
+}
+
+//==============================================================================
+// PhysicsParticle Implementation
+//==============================================================================
+void PhysicsParticle::Update(float deltaTime)
+{
+    // Only update active particles
+    if (!isActive)
+    {
+        return;
+    }
+    
+    // Update velocity with acceleration
+    velocity += acceleration * deltaTime;
+    
+    // Apply drag
+    float dragFactor = 1.0f - (drag * deltaTime);
+    dragFactor = std::max(0.0f, dragFactor);
+    velocity *= dragFactor;
+    
+    // Update position
+    position += velocity * deltaTime;
+    
+    // Update lifetime
+    life -= deltaTime;
+    
+    // Deactivate particle if lifetime expired
+    if (life <= 0.0f)
+    {
+        isActive = false;
+    }
+    
+    // Reset acceleration for next frame
+    acceleration = PhysicsVector3D();
+}
+
+//==============================================================================
+// PhysicsParticlePool Implementation
+//==============================================================================
+PhysicsParticlePool::PhysicsParticlePool(int capacity) :
+    m_capacity(0),
+    m_count(0)
+{
+    SetCapacity(capacity);
+}
+
+void PhysicsParticlePool::SetCapacity(int capacity)
+{
+    capacity = std::clamp(capacity, 0, MAX_PARTICLE_POOL_CAPACITY);
+
+    std::vector<float>* streams[] = { &positionX, &positionY, &positionZ, &velocityX, &velocityY, &velocityZ,
+        &accelerationX, &accelerationY, &accelerationZ, &life, &mass, &drag };
+    for (std::vector<float>* stream : streams)
+    {
+        stream->resize(static_cast<size_t>(capacity), 0.0f);
+        stream->shrink_to_fit();
+    }
+
+    m_capacity = capacity;
+    m_count = std::min(m_count, capacity);
+}
+
+bool PhysicsParticlePool::Emit(const PhysicsParticle& particle)
+{
+    if (m_count >= m_capacity)
+    {
+        return false;
+    }
+
+    const int i = m_count++;
+    positionX[i] = particle.position.x;
+    positionY[i] = particle.position.y;
+    positionZ[i] = particle.position.z;
+    velocityX[i] = particle.velocity.x;
+    velocityY[i] = particle.velocity.y;
+    velocityZ[i] = particle.velocity.z;
+    accelerationX[i] = particle.acceleration.x;
+    accelerationY[i] = particle.acceleration.y;
+    accelerationZ[i] = particle.acceleration.z;
+    life[i] = particle.life;
+    mass[i] = particle.mass;
+    drag[i] = particle.drag;
+    return true;
+}
+
+void PhysicsParticlePool::Kill(int index)
+{
+    if (index < 0 || index >= m_count)
+    {
+        return;
+    }
+
+    // Move the last live particle into the hole to keep the live range packed
+    const int last = --m_count;
+    if (index != last)
+    {
+        positionX[index] = positionX[last];
+        positionY[index] = positionY[last];
+        positionZ[index] = positionZ[last];
+        velocityX[index] = velocityX[last];
+        velocityY[index] = velocityY[last];
+        velocityZ[index] = velocityZ[last];
+        accelerationX[index] = accelerationX[last];
+        accelerationY[index] = accelerationY[last];
+        accelerationZ[index] = accelerationZ[last];
+        life[index] = life[last];
+        mass[index] = mass[last];
+        drag[index] = drag[last];
+    }
+}
+
+void PhysicsParticlePool::RemoveExpired()
+{
+    // Swapped-in particles are re-checked before moving on
+    int i = 0;
+    while (i < m_count)
+    {
+        if (life[i] <= 0.0f)
+        {
+            Kill(i);
+        }
+        else
+        {
+            ++i;
+        }
+    }
+}
+
+PhysicsParticle PhysicsParticlePool::GetParticle(int index) const
+{
+    PhysicsParticle particle;
+    if (index < 0 || index >= m_count)
+    {
+        return particle;
+    }
+
+    particle.position = PhysicsVector3D(positionX[index], positionY[index], positionZ[index]);
+    particle.velocity = PhysicsVector3D(velocityX[index], velocityY[index], velocityZ[index]);
+    particle.acceleration = PhysicsVector3D(accelerationX[index], accelerationY[index], accelerationZ[index]);
+    particle.life = life[index];
+    particle.mass = mass[index];
+    particle.drag = drag[index];
+    particle.isActive = true;
+    return particle;
+}
+
+size_t PhysicsParticlePool::GetMemoryUsage() const
+{
+    // 12 float streams
+    return positionX.capacity() * 12 * sizeof(float);
+}
+
+void PhysicsParticlePool::Serialize(PhysicsWorldWriter& writer) const
+{
+    const std::vector<float>* streams[] = { &positionX, &positionY, &positionZ, &velocityX, &velocityY, &velocityZ,
+        &accelerationX, &accelerationY, &accelerationZ, &life, &mass, &drag };
+
+    // Only the live range is stored - the rest of the pool is scratch
+    writer.Write(static_cast<int32_t>(m_capacity));
+    writer.Write(static_cast<int32_t>(m_count));
+    for (const std::vector<float>* stream : streams)
+    {
+        writer.WriteBytes(stream->data(), static_cast<size_t>(m_count) * sizeof(float));
+    }
+}
+
+bool PhysicsParticlePool::Deserialize(PhysicsWorldReader& reader)
+{
+    std::vector<float>* streams[] = { &positionX, &positionY, &positionZ, &velocityX, &velocityY, &velocityZ,
+        &accelerationX, &accelerationY, &accelerationZ, &life, &mass, &drag };
+
+    // Validate everything before the pool is modified
+    int32_t capacity = 0;
+    int32_t count = 0;
+    if (!reader.Read(capacity) || !reader.Read(count) || capacity < 0 || capacity > MAX_PARTICLE_POOL_CAPACITY ||
+        count < 0 || count > capacity || !reader.CanRead(count, std::size(streams) * sizeof(float)))
+    {
+        return false;
+    }
+
+    if (capacity != m_capacity)
+    {
+        SetCapacity(capacity);
+    }
+    for (std::vector<float>* stream : streams)
+    {
+        reader.ReadBytes(stream->data(), static_cast<size_t>(count) * sizeof(float));
+    }
+    m_count = count;
+    return true;
+}
+
+//==============================================================================
+// Particle Pool Kernels
+//==============================================================================
+// Same step as PhysicsParticle::Update, applied to the packed live range:
+//   v  = (v + a * dt) * max(0, 1 - drag * dt)
+//   p += v * dt
+//   life -= dt, accumulated acceleration is cleared
+static void UpdateParticlePoolScalar(PhysicsParticlePool& pool, int begin, int end, float deltaTime)
+{
+    for (int i = begin; i < end; ++i)
+    {
+        const float dragFactor = std::max(0.0f, 1.0f - pool.drag[i] * deltaTime);
+
+        pool.velocityX[i] = (pool.velocityX[i] + pool.accelerationX[i] * deltaTime) * dragFactor;
+        pool.velocityY[i] = (pool.velocityY[i] + pool.accelerationY[i] * deltaTime) * dragFactor;
+        pool.velocityZ[i] = (pool.velocityZ[i] + pool.accelerationZ[i] * deltaTime) * dragFactor;
+
+        pool.positionX[i] += pool.velocityX[i] * deltaTime;
+        pool.positionY[i] += pool.velocityY[i] * deltaTime;
+        pool.positionZ[i] += pool.velocityZ[i] * deltaTime;
+
+        pool.accelerationX[i] = 0.0f;
+        pool.accelerationY[i] = 0.0f;
+        pool.accelerationZ[i] = 0.0f;
+        pool.life[i] -= deltaTime;
+    }
+}
+
+// Adds direction * scale[i] (or direction alone when scale is null) to every live acceleration
+static void AccumulateParticleAcceleration(PhysicsParticlePool& pool, const PhysicsVector3D& direction,
+    const float* scaleA, const float* scaleB)
+{
+    // Plain stream loops - simple enough for the compiler to vectorize at every SIMD level
+    const int count = pool.Size();
+    float* accelerationX = pool.accelerationX.data();
+    float* accelerationY = pool.accelerationY.data();
+    float* accelerationZ = pool.accelerationZ.data();
+
+    for (int i = 0; i < count; ++i)
+    {
+        const float scale = (scaleA ? scaleA[i] : 1.0f) * (scaleB ? scaleB[i] : 1.0f);
+        accelerationX[i] += direction.x * scale;
+        accelerationY[i] += direction.y * scale;
+        accelerationZ[i] += direction.z * scale;
+    }
+}
+
+#if defined(CPUFEATURES_X86)
+// SSE2 - 4 particles per iteration, returns the number of particles processed
+static int UpdateParticlePoolSSE2(PhysicsParticlePool& pool, int count, float deltaTime)
+{
+    const __m128 dt = _mm_set1_ps(deltaTime);
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 zero = _mm_setzero_ps();
+
+    int i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128 dragFactor = _mm_max_ps(zero, _mm_sub_ps(one, _mm_mul_ps(_mm_loadu_ps(&pool.drag[i]), dt)));
+
+        float* position[3] = { &pool.positionX[i], &pool.positionY[i], &pool.positionZ[i] };
+        float* velocity[3] = { &pool.velocityX[i], &pool.velocityY[i], &pool.velocityZ[i] };
+        float* acceleration[3] = { &pool.accelerationX[i], &pool.accelerationY[i], &pool.accelerationZ[i] };
+
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            const __m128 v = _mm_mul_ps(_mm_add_ps(_mm_loadu_ps(velocity[axis]), _mm_mul_ps(_mm_loadu_ps(acceleration[axis]), dt)), dragFactor);
+            _mm_storeu_ps(velocity[axis], v);
+            _mm_storeu_ps(position[axis], _mm_add_ps(_mm_loadu_ps(position[axis]), _mm_mul_ps(v, dt)));
+            _mm_storeu_ps(acceleration[axis], zero);
+        }
+
+        _mm_storeu_ps(&pool.life[i], _mm_sub_ps(_mm_loadu_ps(&pool.life[i]), dt));
+    }
+
+    return i;
+}
+
+// AVX2 + FMA - 8 particles per iteration
+CPUFEATURES_TARGET_AVX2
+static int UpdateParticlePoolAVX2(PhysicsParticlePool& pool, int count, float deltaTime)
+{
+    const __m256 dt = _mm256_set1_ps(deltaTime);
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 zero = _mm256_setzero_ps();
+
+    int i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m256 dragFactor = _mm256_max_ps(zero, _mm256_fnmadd_ps(_mm256_loadu_ps(&pool.drag[i]), dt, one));
+
+        float* position[3] = { &pool.positionX[i], &pool.positionY[i], &pool.positionZ[i] };
+        float* velocity[3] = { &pool.velocityX[i], &pool.velocityY[i], &pool.velocityZ[i] };
+        float* acceleration[3] = { &pool.accelerationX[i], &pool.accelerationY[i], &pool.accelerationZ[i] };
+
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            const __m256 v = _mm256_mul_ps(_mm256_fmadd_ps(_mm256_loadu_ps(acceleration[axis]), dt, _mm256_loadu_ps(velocity[axis])), dragFactor);
+            _mm256_storeu_ps(velocity[axis], v);
+            _mm256_storeu_ps(position[axis], _mm256_fmadd_ps(v, dt, _mm256_loadu_ps(position[axis])));
+            _mm256_storeu_ps(acceleration[axis], zero);
+        }
+
+        _mm256_storeu_ps(&pool.life[i], _mm256_sub_ps(_mm256_loadu_ps(&pool.life[i]), dt));
+    }
+
+    return i;
+}
+#endif
+
+//==============================================================================
+// PhysicsSpatialHash Implementation
+//==============================================================================
+PhysicsSpatialHash::PhysicsSpatialHash() :
+    m_cellSize(DEFAULT_SPATIAL_HASH_CELL_SIZE),
+    m_inverseCellSize(1.0f / DEFAULT_SPATIAL_HASH_CELL_SIZE),
+    m_emptyCellCount(0),
+    m_cellAllocationCount(0)
+{
+}
+
+bool PhysicsSpatialHash::CellRange::operator==(const CellRange& other) const
+{
+    return isValid == other.isValid && isOversized == other.isOversized &&
+        minX == other.minX && minY == other.minY && minZ == other.minZ &&
+        maxX == other.maxX && maxY == other.maxY && maxZ == other.maxZ;
+}
+
+size_t PhysicsSpatialHash::CellKeyHasher::operator()(uint64_t key) const
+{
+    // SplitMix64 finalizer - packed coordinates hash poorly on their own
+    key ^= key >> 30;
+    key *= 0xBF58476D1CE4E5B9ULL;
+    key ^= key >> 27;
+    key *= 0x94D049BB133111EBULL;
+    key ^= key >> 31;
+    return static_cast<size_t>(key);
+}
+
+uint64_t PhysicsSpatialHash::MakeCellKey(int x, int y, int z)
+{
+    // 21 bits per axis, biased so negative coordinates pack correctly
+    const uint64_t mask = (1ULL << 21) - 1ULL;
+    const int bias = 1 << 20;
+    return  (static_cast<uint64_t>(x + bias) & mask) |
+           ((static_cast<uint64_t>(y + bias) & mask) << 21) |
+           ((static_cast<uint64_t>(z + bias) & mask) << 42);
+}
+
+void PhysicsSpatialHash::SetCellSize(float cellSize)
+{
+    if (cellSize <= MIN_VELOCITY_THRESHOLD)
+    {
+#if defined(_DEBUG_PHYSICS_)
+        debug.logLevelMessage(LogLevel::LOG_WARNING, L"[Physics] Invalid spatial hash cell size, using default value");
+#endif
+        cellSize = DEFAULT_SPATIAL_HASH_CELL_SIZE;
+    }
+
+    m_cellSize = cellSize;
+    m_inverseCellSize = 1.0f / cellSize;
+
+    // Cached ranges are expressed in the old cell size - force full re-insertion
+    Clear();
+}
+
+PhysicsSpatialHash::CellRange PhysicsSpatialHash::ComputeRange(const PhysicsVector3D& center, float radius) const
+{
+    // Clamp to the packed key range so distant bodies cannot alias across the grid
+    const float limit = static_cast<float>((1 << 20) - 1);
+    auto toCell = [&](float value) -> int {
+        return static_cast<int>(std::floor(std::clamp(value * m_inverseCellSize, -limit, limit)));
+    };
+
+    CellRange range;
+    range.minX = toCell(center.x - radius);
+    range.minY = toCell(center.y - radius);
+    range.minZ = toCell(center.z - radius);
+    range.maxX = toCell(center.x + radius);
+    range.maxY = toCell(center.y + radius);
+    range.maxZ = toCell(center.z + radius);
+    range.isValid = true;
+
+    const int64_t cellCount = static_cast<int64_t>(range.maxX - range.minX + 1) *
+        static_cast<int64_t>(range.maxY - range.minY + 1) *
+        static_cast<int64_t>(range.maxZ - range.minZ + 1);
+    range.isOversized = cellCount > MAX_SPATIAL_HASH_CELLS_PER_BODY;
+
+    return range;
+}
+
+void PhysicsSpatialHash::InsertRange(int bodyIndex, const CellRange& range)
+{
+    if (range.isOversized)
+    {
+        m_oversizedBodies.push_back(bodyIndex);
+        return;
+    }
+
+    for (int z = range.minZ; z <= range.maxZ; ++z)
+    {
+        for (int y = range.minY; y <= range.maxY; ++y)
+        {
+            for (int x = range.minX; x <= range.maxX; ++x)
+            {
+                auto result = m_cells.try_emplace(MakeCellKey(x, y, z));
+                Cell& cell = result.first->second;
+                if (result.second)
+                {
+                    cell.x = x;
+                    cell.y = y;
+                    cell.z = z;
+                    ++m_cellAllocationCount;
+                }
+                else if (cell.bodies.empty())
+                {
+                    --m_emptyCellCount;                                         // Reusing a retained cell
+                }
+
+                m_cellAllocationCount += (cell.bodies.size() == cell.bodies.capacity()) ? 1 : 0;
+                cell.bodies.push_back(bodyIndex);
+            }
+        }
+    }
+}
+
+void PhysicsSpatialHash::RemoveRange(int bodyIndex, const CellRange& range)
+{
+    if (range.isOversized)
+    {
+        auto it = std::find(m_oversizedBodies.begin(), m_oversizedBodies.end(), bodyIndex);
+        if (it != m_oversizedBodies.end())
+        {
+            *it = m_oversizedBodies.back();
+            m_oversizedBodies.pop_back();
+        }
+        return;
+    }
+
+    for (int z = range.minZ; z <= range.maxZ; ++z)
+    {
+        for (int y = range.minY; y <= range.maxY; ++y)
+        {
+            for (int x = range.minX; x <= range.maxX; ++x)
+            {
+                auto cellIt = m_cells.find(MakeCellKey(x, y, z));
+                if (cellIt == m_cells.end())
+                {
+                    continue;
+                }
+
+                // Swap-remove, cells hold only a handful of bodies
+                std::vector<int>& bodies = cellIt->second.bodies;
+                auto it = std::find(bodies.begin(), bodies.end(), bodyIndex);
+                if (it != bodies.end())
+                {
+                    *it = bodies.back();
+                    bodies.pop_back();
+
+                    // Keep empty cells (and their capacity) around so moving bodies do not thrash the allocator
+                    if (bodies.empty())
+                    {
+                        ++m_emptyCellCount;
+                    }
+                }
+            }
+        }
+    }
+}
+
+void PhysicsSpatialHash::PruneEmptyCells()
+{
+    // Only prune once retained empty cells dominate the table
+    if (m_emptyCellCount < 1024 || m_emptyCellCount * 2 < m_cells.size())
+    {
+        return;
+    }
+
+    for (auto it = m_cells.begin(); it != m_cells.end(); )
+    {
+        if (it->second.bodies.empty())
+        {
+            it = m_cells.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    m_emptyCellCount = 0;
+}
+
+bool PhysicsSpatialHash::UpdateBody(int bodyIndex, const PhysicsVector3D& center, float radius)
+{
+    if (bodyIndex < 0)
+    {
+        return false;
+    }
+
+    // Non-finite positions cannot be hashed - drop the body until it recovers
+    if (!std::isfinite(center.x) || !std::isfinite(center.y) || !std::isfinite(center.z) || !std::isfinite(radius))
+    {
+        RemoveBody(bodyIndex);
+        return false;
+    }
+
+    if (static_cast<size_t>(bodyIndex) >= m_bodyRanges.size())
+    {
+        m_bodyRanges.resize(static_cast<size_t>(bodyIndex) + 1);
+    }
+
+    CellRange newRange = ComputeRange(center, std::max(radius, 0.0f));
+    CellRange& oldRange = m_bodyRanges[bodyIndex];
+
+    // Incremental update - nothing to do while the body stays within the same cells
+    if (newRange == oldRange)
+    {
+        return false;
+    }
+
+    if (oldRange.isValid)
+    {
+        RemoveRange(bodyIndex, oldRange);
+    }
+
+    InsertRange(bodyIndex, newRange);
+    oldRange = newRange;
+
+    PruneEmptyCells();
+    return true;
+}
+
+void PhysicsSpatialHash::RemoveBody(int bodyIndex)
+{
+    if (bodyIndex < 0 || static_cast<size_t>(bodyIndex) >= m_bodyRanges.size())
+    {
+        return;
+    }
+
+    CellRange& range = m_bodyRanges[bodyIndex];
+    if (range.isValid)
+    {
+        RemoveRange(bodyIndex, range);
+        range = CellRange();
+        PruneEmptyCells();
+    }
+}
+
+void PhysicsSpatialHash::Clear()
+{
+    m_cells.clear();
+    m_bodyRanges.clear();
+    m_oversizedBodies.clear();
+    m_inertBodies.clear();
+    m_emptyCellCount = 0;
+}
+
+void PhysicsSpatialHash::SetBodyInert(int bodyIndex, bool isInert)
+{
+    if (bodyIndex < 0)
+    {
+        return;
+    }
+
+    if (static_cast<size_t>(bodyIndex) >= m_inertBodies.size())
+    {
+        m_inertBodies.resize(static_cast<size_t>(bodyIndex) + 1, 0);
+    }
+    m_inertBodies[bodyIndex] = isInert ? 1 : 0;
+}
+
+void PhysicsSpatialHash::CollectPairs(std::vector<std::pair<int, int>>& outPairs, const PhysicsBodyStore* filterStore) const
+{
+    outPairs.clear();
+
+    auto isInert = [this](int bodyIndex) {
+        return static_cast<size_t>(bodyIndex) < m_inertBodies.size() && m_inertBodies[bodyIndex] != 0;
+    };
+    auto isFiltered = [filterStore](int indexA, int indexB) {
+        return filterStore && !filterStore->ShouldCollide(indexA, indexB);
+    };
+
+    for (const auto& entry : m_cells)
+    {
+        const Cell& cell = entry.second;
+        const size_t bodyCount = cell.bodies.size();
+
+        for (size_t i = 0; i < bodyCount; ++i)
+        {
+            const int indexA = cell.bodies[i];
+            const CellRange& rangeA = m_bodyRanges[indexA];
+            const bool inertA = isInert(indexA);
+
+            for (size_t j = i + 1; j < bodyCount; ++j)
+            {
+                const int indexB = cell.bodies[j];
+                if ((inertA && isInert(indexB)) || isFiltered(indexA, indexB))
+                {
+                    continue;
+                }
+
+                const CellRange& rangeB = m_bodyRanges[indexB];
+
+                // A pair sharing several cells is reported only from the lowest shared cell
+                if (cell.x != std::max(rangeA.minX, rangeB.minX) ||
+                    cell.y != std::max(rangeA.minY, rangeB.minY) ||
+                    cell.z != std::max(rangeA.minZ, rangeB.minZ))
+                {
+                    continue;
+                }
+
+                outPairs.emplace_back(std::min(indexA, indexB), std::max(indexA, indexB));
+            }
+        }
+    }
+
+    // Oversized bodies are paired with every other body in the hash
+    for (int oversizedIndex : m_oversizedBodies)
+    {
+        for (size_t other = 0; other < m_bodyRanges.size(); ++other)
+        {
+            const CellRange& range = m_bodyRanges[other];
+            const int otherIndex = static_cast<int>(other);
+
+            if (!range.isValid || otherIndex == oversizedIndex ||
+                (isInert(oversizedIndex) && isInert(otherIndex)) || isFiltered(oversizedIndex, otherIndex))
+            {
+                continue;
+            }
+
+            // Oversized-oversized pairs are reported once
+            if (range.isOversized && otherIndex < oversizedIndex)
+            {
+                continue;
+            }
+
+            outPairs.emplace_back(std::min(oversizedIndex, otherIndex), std::max(oversizedIndex, otherIndex));
+        }
+    }
+}
+
+size_t PhysicsSpatialHash::GetMemoryUsage() const
+{
+    size_t totalMemory = m_cells.size() * (sizeof(uint64_t) + sizeof(Cell));
+    for (const auto& entry : m_cells)
+    {
+        totalMemory += entry.second.bodies.capacity() * sizeof(int);
+    }
+
+    totalMemory += m_bodyRanges.capacity() * sizeof(CellRange);
+    totalMemory += m_oversizedBodies.capacity() * sizeof(int);
+    totalMemory += m_inertBodies.capacity() * sizeof(uint8_t);
+    return totalMemory;
+}
+
+//==============================================================================
+// PhysicsContactCache Implementation
+//==============================================================================
+size_t PhysicsContactCache::KeyHasher::operator()(const Key& key) const
+{
+    // SplitMix64 finalizer over the packed pair, feature folded in first
+    uint64_t value = (static_cast<uint64_t>(static_cast<uint32_t>(key.bodyA)) << 32) |
+        static_cast<uint32_t>(key.bodyB);
+    value ^= static_cast<uint64_t>(static_cast<uint32_t>(key.featureId)) * 0x9E3779B97F4A7C15ULL;
+    value ^= value >> 30;
+    value *= 0xBF58476D1CE4E5B9ULL;
+    value ^= value >> 27;
+    value *= 0x94D049BB133111EBULL;
+    value ^= value >> 31;
+    return static_cast<size_t>(value);
+}
+
+void PhysicsContactCache::Reserve(size_t entryCount)
+{
+    // Keep the table at most half full so probe runs stay short
+    size_t slotCount = 16;
+    while (slotCount < entryCount * 2)
+    {
+        slotCount *= 2;
+    }
+    if (slotCount > m_slots.size())
+    {
+        Rehash(slotCount);
+    }
+}
+
+void PhysicsContactCache::Clear()
+{
+    // The table keeps its size so a cleared world refills it without allocating
+    for (Slot& slot : m_slots)
+    {
+        slot.isUsed = false;
+    }
+    m_size = 0;
+}
+
+size_t PhysicsContactCache::FindSlot(const Key& key) const
+{
+    // Returns the slot holding key, or the empty slot ending its probe run
+    const size_t mask = m_slots.size() - 1;
+    size_t slot = KeyHasher()(key) & mask;
+    while (m_slots[slot].isUsed && !(m_slots[slot].key == key))
+    {
+        slot = (slot + 1) & mask;
+    }
+    return slot;
+}
+
+const PhysicsContactCache::Entry* PhysicsContactCache::Find(int bodyA, int bodyB, int featureId) const
+{
+    if (m_size == 0)
+    {
+        return nullptr;
+    }
+
+    const Slot& slot = m_slots[FindSlot(Key{ bodyA, bodyB, featureId })];
+    return slot.isUsed ? &slot.entry : nullptr;
+}
+
+void PhysicsContactCache::Store(int bodyA, int bodyB, int featureId, const PhysicsVector3D& normal, float normalImpulse,
+    const PhysicsVector3D& tangentImpulse)
+{
+    Entry entry;
+    entry.normal = normal;
+    entry.normalImpulse = normalImpulse;
+    entry.tangentImpulse = tangentImpulse;
+    entry.lastStep = m_step;
+    Insert(Key{ bodyA, bodyB, featureId }, entry);
+}
+
+void PhysicsContactCache::Insert(const Key& key, const Entry& entry)
+{
+    if ((m_size + 1) * 2 > m_slots.size())
+    {
+        Reserve(m_size + 1);
+    }
+
+    Slot& slot = m_slots[FindSlot(key)];
+    if (!slot.isUsed)
+    {
+        slot.key = key;
+        slot.isUsed = true;
+        ++m_size;
+    }
+    slot.entry = entry;
+}
+
+void PhysicsContactCache::EraseSlot(size_t slot)
+{
+    // Backward-shift deletion - pull later entries of the probe run into the hole so lookups
+    // never need tombstones
+    const size_t mask = m_slots.size() - 1;
+    size_t hole = slot;
+    for (size_t next = (hole + 1) & mask; m_slots[next].isUsed; next = (next + 1) & mask)
+    {
+        const size_t home = KeyHasher()(m_slots[next].key) & mask;
+        if (((next - home) & mask) >= ((next - hole) & mask))
+        {
+            m_slots[hole] = m_slots[next];
+            hole = next;
+        }
+    }
+    m_slots[hole].isUsed = false;
+    --m_size;
+}
+
+void PhysicsContactCache::Rehash(size_t slotCount)
+{
+    std::vector<Slot> previous(slotCount);
+    previous.swap(m_slots);
+    m_size = 0;
+    ++m_growthCount;
+
+    for (const Slot& slot : previous)
+    {
+        if (slot.isUsed)
+        {
+            Insert(slot.key, slot.entry);
+        }
+    }
+}
+
+void PhysicsContactCache::EvictStale(const KeepAliveCallback& keepAlive)
+{
+    for (size_t slot = 0; slot < m_slots.size();)
+    {
+        const Slot& current = m_slots[slot];
+        if (current.isUsed && current.entry.lastStep != m_step &&
+            !(keepAlive && keepAlive(current.key.bodyA, current.key.bodyB)))
+        {
+            // The hole may be refilled from later in the run, so look at this slot again
+            EraseSlot(slot);
+        }
+        else
+        {
+            ++slot;
+        }
+    }
+}
+
+size_t PhysicsContactCache::GetMemoryUsage() const
+{
+    return m_slots.capacity() * sizeof(Slot);
+}
+
+void PhysicsContactCache::Serialize(PhysicsWorldWriter& writer) const
+{
+    writer.Write(m_step);
+    writer.Write(static_cast<uint32_t>(m_size));
+    for (const Slot& slot : m_slots)
+    {
+        if (!slot.isUsed)
+        {
+            continue;
+        }
+        writer.Write(slot.key.bodyA);
+        writer.Write(slot.key.bodyB);
+        writer.Write(slot.key.featureId);
+        writer.Write(slot.entry.normal);
+        writer.Write(slot.entry.normalImpulse);
+        writer.Write(slot.entry.tangentImpulse);
+        writer.Write(slot.entry.lastStep);
+    }
+}
+
+bool PhysicsContactCache::Deserialize(PhysicsWorldReader& reader)
+{
+    const size_t bytesPerEntry = 3 * sizeof(int) + 2 * sizeof(PhysicsVector3D) + sizeof(float) + sizeof(uint32_t);
+
+    uint32_t count = 0;
+    if (!reader.Read(m_step) || !reader.Read(count) || !reader.CanRead(count, bytesPerEntry))
+    {
+        return false;
+    }
+
+    Clear();
+    Reserve(std::max(static_cast<size_t>(count), DEFAULT_CONTACT_CACHE_CAPACITY));
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        Key key;
+        Entry entry;
+        reader.Read(key.bodyA);
+        reader.Read(key.bodyB);
+        reader.Read(key.featureId);
+        reader.Read(entry.normal);
+        reader.Read(entry.normalImpulse);
+        reader.Read(entry.tangentImpulse);
+        reader.Read(entry.lastStep);
+        Insert(key, entry);
+    }
+    return !reader.HasFailed();
+}
+
+//==============================================================================
+// PhysicsAABB and PhysicsDynamicTree Implementation
+//==============================================================================
+PhysicsAABB PhysicsAABB::FromSphere(const PhysicsVector3D& center, float radius)
+{
+    PhysicsVector3D extent(radius, radius, radius);
+    return PhysicsAABB(center - extent, center + extent);
+}
+
+bool PhysicsAABB::Contains(const PhysicsAABB& other) const
+{
+    return min.x <= other.min.x && min.y <= other.min.y && min.z <= other.min.z &&
+        other.max.x <= max.x && other.max.y <= max.y && other.max.z <= max.z;
+}
+
+bool PhysicsAABB::Overlaps(const PhysicsAABB& other) const
+{
+    return !(other.min.x > max.x || other.max.x < min.x ||
+        other.min.y > max.y || other.max.y < min.y ||
+        other.min.z > max.z || other.max.z < min.z);
+}
+
+PhysicsAABB PhysicsAABB::Union(const PhysicsAABB& other) const
+{
+    return PhysicsAABB(
+        PhysicsVector3D(std::min(min.x, other.min.x), std::min(min.y, other.min.y), std::min(min.z, other.min.z)),
+        PhysicsVector3D(std::max(max.x, other.max.x), std::max(max.y, other.max.y), std::max(max.z, other.max.z)));
+}
+
+float PhysicsAABB::SurfaceArea() const
+{
+    PhysicsVector3D extent = max - min;
+    return 2.0f * (extent.x * extent.y + extent.y * extent.z + extent.z * extent.x);
+}
+
+PhysicsDynamicTree::PhysicsDynamicTree() :
+    m_root(NULL_NODE),
+    m_freeList(NULL_NODE),
+    m_proxyCount(0)
+{
+}
+
+int PhysicsDynamicTree::AllocateNode()
+{
+    int nodeId;
+    if (m_freeList != NULL_NODE)
+    {
+        nodeId = m_freeList;
+        m_freeList = m_nodes[nodeId].parent;
+    }
+    else
+    {
+        nodeId = static_cast<int>(m_nodes.size());
+        m_nodes.emplace_back();
+    }
+
+    TreeNode& node = m_nodes[nodeId];
+    node.parent = NULL_NODE;
+    node.child1 = NULL_NODE;
+    node.child2 = NULL_NODE;
+    node.height = 0;
+    node.userData = -1;
+    return nodeId;
+}
+
+void PhysicsDynamicTree::FreeNode(int nodeId)
+{
+    m_nodes[nodeId].parent = m_freeList;
+    m_nodes[nodeId].height = -1;
+    m_freeList = nodeId;
+}
+
+void PhysicsDynamicTree::Clear()
+{
+    m_nodes.clear();
+    m_root = NULL_NODE;
+    m_freeList = NULL_NODE;
+    m_proxyCount = 0;
+}
+
+int PhysicsDynamicTree::CreateProxy(const PhysicsAABB& aabb, int userData)
+{
+    const PhysicsVector3D margin(DYNAMIC_TREE_AABB_MARGIN, DYNAMIC_TREE_AABB_MARGIN, DYNAMIC_TREE_AABB_MARGIN);
+
+    int proxyId = AllocateNode();
+    m_nodes[proxyId].aabb = PhysicsAABB(aabb.min - margin, aabb.max + margin);
+    m_nodes[proxyId].userData = userData;
+
+    InsertLeaf(proxyId);
+    ++m_proxyCount;
+    return proxyId;
+}
+
+void PhysicsDynamicTree::DestroyProxy(int proxyId)
+{
+    if (proxyId < 0 || proxyId >= static_cast<int>(m_nodes.size()) || !m_nodes[proxyId].IsLeaf() || m_nodes[proxyId].height < 0)
+    {
+        return;
+    }
+
+    RemoveLeaf(proxyId);
+    FreeNode(proxyId);
+    --m_proxyCount;
+}
+
+bool PhysicsDynamicTree::MoveProxy(int proxyId, const PhysicsAABB& aabb, const PhysicsVector3D& displacement)
+{
+    const PhysicsVector3D margin(DYNAMIC_TREE_AABB_MARGIN, DYNAMIC_TREE_AABB_MARGIN, DYNAMIC_TREE_AABB_MARGIN);
+
+    // Fatten and extend along the predicted displacement
+    PhysicsAABB fatAABB(aabb.min - margin, aabb.max + margin);
+    PhysicsVector3D predicted = displacement * DYNAMIC_TREE_DISPLACEMENT_MULTIPLIER;
+    (predicted.x < 0.0f ? fatAABB.min.x : fatAABB.max.x) += predicted.x;
+    (predicted.y < 0.0f ? fatAABB.min.y : fatAABB.max.y) += predicted.y;
+    (predicted.z < 0.0f ? fatAABB.min.z : fatAABB.max.z) += predicted.z;
+
+    const PhysicsAABB& treeAABB = m_nodes[proxyId].aabb;
+    if (treeAABB.Contains(aabb))
+    {
+        // Still enclosed - keep the leaf unless its bounds have become far too loose
+        const PhysicsVector3D hugeMargin = margin * 4.0f;
+        PhysicsAABB hugeAABB(fatAABB.min - hugeMargin, fatAABB.max + hugeMargin);
+        if (hugeAABB.Contains(treeAABB))
+        {
+            return false;
+        }
+    }
+
+    RemoveLeaf(proxyId);
+    m_nodes[proxyId].aabb = fatAABB;
+    InsertLeaf(proxyId);
+    return true;
+}
+
+void PhysicsDynamicTree::InsertLeaf(int leaf)
+{
+    if (m_root == NULL_NODE)
+    {
+        m_root = leaf;
+        m_nodes[m_root].parent = NULL_NODE;
+        return;
+    }
+
+    // Descend choosing the child with the lowest surface area cost
+    const PhysicsAABB leafAABB = m_nodes[leaf].aabb;
+    int index = m_root;
+    while (!m_nodes[index].IsLeaf())
+    {
+        const int child1 = m_nodes[index].child1;
+        const int child2 = m_nodes[index].child2;
+
+        const float area = m_nodes[index].aabb.SurfaceArea();
+        const float combinedArea = m_nodes[index].aabb.Union(leafAABB).SurfaceArea();
+
+        // Cost of creating a new parent for this node and the new leaf
+        const float cost = 2.0f * combinedArea;
+
+        // Minimum cost of pushing the leaf further down the tree
+        const float inheritanceCost = 2.0f * (combinedArea - area);
+
+        auto descendCost = [&](int child) -> float {
+            const PhysicsAABB combined = leafAABB.Union(m_nodes[child].aabb);
+            if (m_nodes[child].IsLeaf())
+            {
+                return combined.SurfaceArea() + inheritanceCost;
+            }
+            return (combined.SurfaceArea() - m_nodes[child].aabb.SurfaceArea()) + inheritanceCost;
+        };
+
+        const float cost1 = descendCost(child1);
+        const float cost2 = descendCost(child2);
+
+        if (cost < cost1 && cost < cost2)
+        {
+            break;
+        }
+
+        index = (cost1 < cost2) ? child1 : child2;
+    }
+
+    const int sibling = index;
+
+    // Create a new parent (allocation may grow the pool, so no node references are held across it)
+    const int oldParent = m_nodes[sibling].parent;
+    const int newParent = AllocateNode();
+    m_nodes[newParent].parent = oldParent;
+    m_nodes[newParent].aabb = leafAABB.Union(m_nodes[sibling].aabb);
+    m_nodes[newParent].height = m_nodes[sibling].height + 1;
+    m_nodes[newParent].child1 = sibling;
+    m_nodes[newParent].child2 = leaf;
+    m_nodes[sibling].parent = newParent;
+    m_nodes[leaf].parent = newParent;
+
+    if (oldParent != NULL_NODE)
+    {
+        if (m_nodes[oldParent].child1 == sibling)
+        {
+            m_nodes[oldParent].child1 = newParent;
+        }
+        else
+        {
+            m_nodes[oldParent].child2 = newParent;
+        }
+    }
+    else
+    {
+        m_root = newParent;
+    }
+
+    // Walk back up refitting bounds and rebalancing
+    index = m_nodes[leaf].parent;
+    while (index != NULL_NODE)
+    {
+        index = Balance(index);
+
+        const int child1 = m_nodes[index].child1;
+        const int child2 = m_nodes[index].child2;
+        m_nodes[index].height = 1 + std::max(m_nodes[child1].height, m_nodes[child2].height);
+        m_nodes[index].aabb = m_nodes[child1].aabb.Union(m_nodes[child2].aabb);
+
+        index = m_nodes[index].parent;
+    }
+}
+
+void PhysicsDynamicTree::RemoveLeaf(int leaf)
+{
+    if (leaf == m_root)
+    {
+        m_root = NULL_NODE;
+        return;
+    }
+
+    const int parent = m_nodes[leaf].parent;
+    const int grandParent = m_nodes[parent].parent;
+    const int sibling = (m_nodes[parent].child1 == leaf) ? m_nodes[parent].child2 : m_nodes[parent].child1;
+
+    if (grandParent == NULL_NODE)
+    {
+        m_root = sibling;
+        m_nodes[sibling].parent = NULL_NODE;
+        FreeNode(parent);
+        return;
+    }
+
+    // Replace the parent with the sibling and refit the ancestors
+    if (m_nodes[grandParent].child1 == parent)
+    {
+        m_nodes[grandParent].child1 = sibling;
+    }
+    else
+    {
+        m_nodes[grandParent].child2 = sibling;
+    }
+    m_nodes[sibling].parent = grandParent;
+    FreeNode(parent);
+
+    int index = grandParent;
+    while (index != NULL_NODE)
+    {
+        index = Balance(index);
+
+        const int child1 = m_nodes[index].child1;
+        const int child2 = m_nodes[index].child2;
+        m_nodes[index].aabb = m_nodes[child1].aabb.Union(m_nodes[child2].aabb);
+        m_nodes[index].height = 1 + std::max(m_nodes[child1].height, m_nodes[child2].height);
+
+        index = m_nodes[index].parent;
+    }
+}
+
+int PhysicsDynamicTree::Balance(int iA)
+{
+    // Rotate the taller grandchild subtree up when node A is out of balance
+    TreeNode& A = m_nodes[iA];
+    if (A.IsLeaf() || A.height < 2)
+    {
+        return iA;
+    }
+
+    const int iB = A.child1;
+    const int iC = A.child2;
+    TreeNode& B = m_nodes[iB];
+    TreeNode& C = m_nodes[iC];
+
+    const int balance = C.height - B.height;
+
+    // Rotate C up
+    if (balance > 1)
+    {
+        const int iF = C.child1;
+        const int iG = C.child2;
+        TreeNode& F = m_nodes[iF];
+        TreeNode& G = m_nodes[iG];
+
+        C.child1 = iA;
+        C.parent = A.parent;
+        A.parent = iC;
+
+        if (C.parent != NULL_NODE)
+        {
+            if (m_nodes[C.parent].child1 == iA)
+            {
+                m_nodes[C.parent].child1 = iC;
+            }
+            else
+            {
+                m_nodes[C.parent].child2 = iC;
+            }
+        }
+        else
+        {
+            m_root = iC;
+        }
+
+        if (F.height > G.height)
+        {
+            C.child2 = iF;
+            A.child2 = iG;
+            G.parent = iA;
+            A.aabb = B.aabb.Union(G.aabb);
+            C.aabb = A.aabb.Union(F.aabb);
+            A.height = 1 + std::max(B.height, G.height);
+            C.height = 1 + std::max(A.height, F.height);
+        }
+        else
+        {
+            C.child2 = iG;
+            A.child2 = iF;
+            F.parent = iA;
+            A.aabb = B.aabb.Union(F.aabb);
+            C.aabb = A.aabb.Union(G.aabb);
+            A.height = 1 + std::max(B.height, F.height);
+            C.height = 1 + std::max(A.height, G.height);
+        }
+
+        return iC;
+    }
+
+    // Rotate B up
+    if (balance < -1)
+    {
+        const int iD = B.child1;
+        const int iE = B.child2;
+        TreeNode& D = m_nodes[iD];
+        TreeNode& E = m_nodes[iE];
+
+        B.child1 = iA;
+        B.parent = A.parent;
+        A.parent = iB;
+
+        if (B.parent != NULL_NODE)
+        {
+            if (m_nodes[B.parent].child1 == iA)
+            {
+                m_nodes[B.parent].child1 = iB;
+            }
+            else
+            {
+                m_nodes[B.parent].child2 = iB;
+            }
+        }
+        else
+        {
+            m_root = iB;
+        }
+
+        if (D.height > E.height)
+        {
+            B.child2 = iD;
+            A.child1 = iE;
+            E.parent = iA;
+            A.aabb = C.aabb.Union(E.aabb);
+            B.aabb = A.aabb.Union(D.aabb);
+            A.height = 1 + std::max(C.height, E.height);
+            B.height = 1 + std::max(A.height, D.height);
+        }
+        else
+        {
+            B.child2 = iE;
+            A.child1 = iD;
+            D.parent = iA;
+            A.aabb = C.aabb.Union(D.aabb);
+            B.aabb = A.aabb.Union(E.aabb);
+            A.height = 1 + std::max(C.height, D.height);
+            B.height = 1 + std::max(A.height, E.height);
+        }
+
+        return iB;
+    }
+
+    return iA;
+}
+
+// Traversal stack for the tree queries - a fixed array that AVL balancing keeps well within, with
+// a heap spill so a degenerate tree (e.g. one loaded from a world image) is still searched fully
+class DynamicTreeTraversalStack {
+public:
+    DynamicTreeTraversalStack() : m_count(0) {}
+
+    bool IsEmpty() const { return m_count == 0 && m_overflow.empty(); }
+
+    void Push(int nodeId)
+    {
+        if (m_count < DYNAMIC_TREE_STACK_SIZE)
+        {
+            m_nodes[m_count++] = nodeId;
+        }
+        else
+        {
+            m_overflow.push_back(nodeId);
+        }
+    }
+
+    int Pop()
+    {
+        if (!m_overflow.empty())
+        {
+            const int nodeId = m_overflow.back();
+            m_overflow.pop_back();
+            return nodeId;
+        }
+        return m_nodes[--m_count];
+    }
+
+private:
+    int m_nodes[DYNAMIC_TREE_STACK_SIZE];
+    int m_count;
+    std::vector<int> m_overflow;                                                // Only allocated once the fixed stack is full
+};
+
+void PhysicsDynamicTree::Query(const PhysicsAABB& aabb, const QueryCallback& callback) const
+{
+    if (m_root == NULL_NODE)
+    {
+        return;
+    }
+
+    DynamicTreeTraversalStack stack;
+    stack.Push(m_root);
+
+    while (!stack.IsEmpty())
+    {
+        const TreeNode& node = m_nodes[stack.Pop()];
+        if (!node.aabb.Overlaps(aabb))
+        {
+            continue;
+        }
+
+        if (node.IsLeaf())
+        {
+            if (!callback(node.userData))
+            {
+                return;
+            }
+        }
+        else
+        {
+            stack.Push(node.child1);
+            stack.Push(node.child2);
+        }
+    }
+}
+
+void PhysicsDynamicTree::RayQuery(const PhysicsVector3D& origin, const PhysicsVector3D& direction, float maxDistance,
+    float inflateRadius, const QueryCallback& callback) const
+{
+    if (m_root == NULL_NODE)
+    {
+        return;
+    }
+
+    // Slab test of the segment [0, maxDistance] against a node box inflated by the cast radius
+    auto segmentHitsBox = [&](const PhysicsAABB& box) -> bool {
+        const float boxMin[3] = { box.min.x - inflateRadius, box.min.y - inflateRadius, box.min.z - inflateRadius };
+        const float boxMax[3] = { box.max.x + inflateRadius, box.max.y + inflateRadius, box.max.z + inflateRadius };
+        const float rayOrigin[3] = { origin.x, origin.y, origin.z };
+        const float rayDirection[3] = { direction.x, direction.y, direction.z };
+
+        float tMin = 0.0f;
+        float tMax = maxDistance;
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            if (std::fabs(rayDirection[axis]) < 1e-8f)
+            {
+                // Parallel to this slab - origin must lie inside it
+                if (rayOrigin[axis] < boxMin[axis] || rayOrigin[axis] > boxMax[axis])
+                {
+                    return false;
+                }
+                continue;
+            }
+
+            const float inverse = 1.0f / rayDirection[axis];
+            float t1 = (boxMin[axis] - rayOrigin[axis]) * inverse;
+            float t2 = (boxMax[axis] - rayOrigin[axis]) * inverse;
+            if (t1 > t2)
+            {
+                std::swap(t1, t2);
+            }
+
+            tMin = std::max(tMin, t1);
+            tMax = std::min(tMax, t2);
+            if (tMin > tMax)
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    DynamicTreeTraversalStack stack;
+    stack.Push(m_root);
+
+    while (!stack.IsEmpty())
+    {
+        const TreeNode& node = m_nodes[stack.Pop()];
+        if (!segmentHitsBox(node.aabb))
+        {
+            continue;
+        }
+
+        if (node.IsLeaf())
+        {
+            if (!callback(node.userData))
+            {
+                return;
+            }
+        }
+        else
+        {
+            stack.Push(node.child1);
+            stack.Push(node.child2);
+        }
+    }
+}
+
+void PhysicsDynamicTree::Serialize(PhysicsWorldWriter& writer) const
+{
+    writer.Write(static_cast<int32_t>(m_root));
+    writer.Write(static_cast<int32_t>(m_freeList));
+    writer.Write(static_cast<int32_t>(m_proxyCount));
+    writer.WriteArray(m_nodes);
+}
+
+bool PhysicsDynamicTree::Deserialize(PhysicsWorldReader& reader)
+{
+    int32_t root = NULL_NODE;
+    int32_t freeList = NULL_NODE;
+    int32_t proxyCount = 0;
+    reader.Read(root);
+    reader.Read(freeList);
+    reader.Read(proxyCount);
+    if (!reader.ReadArray(m_nodes))
+    {
+        Clear();
+        return false;
+    }
+    m_root = root;
+    m_freeList = freeList;
+    m_proxyCount = proxyCount;
+
+    // Queries follow child links without checks - every node must be reached exactly once, either
+    // from the root through consistent parent links or along the free list
+    const int nodeCount = static_cast<int>(m_nodes.size());
+    const auto isNode = [nodeCount](int nodeId) { return nodeId >= 0 && nodeId < nodeCount; };
+    std::vector<uint8_t> isReached(m_nodes.size(), 0);
+    std::vector<int> pending;
+    int leafCount = 0;
+    int reachedCount = 0;
+    bool isValid = (m_root == NULL_NODE) || (isNode(m_root) && m_nodes[m_root].parent == NULL_NODE);
+    if (isValid && m_root != NULL_NODE)
+    {
+        pending.push_back(m_root);
+    }
+    while (isValid && !pending.empty())
+    {
+        const int nodeId = pending.back();
+        pending.pop_back();
+        const TreeNode& node = m_nodes[nodeId];
+        isValid = !isReached[nodeId] && node.height >= 0;
+        isReached[nodeId] = 1;
+        ++reachedCount;
+        if (!isValid || node.IsLeaf())
+        {
+            leafCount += node.IsLeaf() ? 1 : 0;
+            isValid = isValid && node.child2 == NULL_NODE && node.height == 0;
+            continue;
+        }
+        for (int child : { node.child1, node.child2 })
+        {
+            isValid = isValid && isNode(child) && m_nodes[child].parent == nodeId;
+            if (isValid)
+            {
+                pending.push_back(child);
+            }
+        }
+    }
+    for (int nodeId = m_freeList; isValid && nodeId != NULL_NODE; nodeId = m_nodes[nodeId].parent)
+    {
+        isValid = isNode(nodeId) && !isReached[nodeId] && m_nodes[nodeId].height == -1;
+        if (isValid)
+        {
+            isReached[nodeId] = 1;
+            ++reachedCount;
+        }
+    }
+
+    if (!isValid || reachedCount != nodeCount || leafCount != m_proxyCount)
+    {
+        Clear();
+        return false;
+    }
+    return true;
+}
+
+//==============================================================================
+// PhysicsWorkerPool Implementation
+//==============================================================================
+PhysicsWorkerPool::PhysicsWorkerPool() :
+    m_task(nullptr),
+    m_taskCount(0),
+    m_nextTask(0),
+    m_busyWorkers(0),
+    m_generation(0),
+    m_isStopping(false)
+{
+}
+
+PhysicsWorkerPool::~PhysicsWorkerPool()
+{
+    Stop();
+}
+
+void PhysicsWorkerPool::Start(int workerCount)
+{
+    Stop();
+
+    m_isStopping = false;
+    workerCount = std::clamp(workerCount, 0, MAX_SOLVER_THREADS);
+    m_workers.reserve(workerCount);
+    for (int i = 0; i < workerCount; ++i)
+    {
+        m_workers.emplace_back(&PhysicsWorkerPool::WorkerLoop, this);
+    }
+}
+
+void PhysicsWorkerPool::Stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isStopping = true;
+    }
+    m_wakeCondition.notify_all();
+
+    for (auto& worker : m_workers)
+    {
+        if (worker.joinable())
+        {
+            worker.join();
+        }
+    }
+    m_workers.clear();
+}
+
+void PhysicsWorkerPool::RunTasks(const TaskFunction* task, int taskCount)
+{
+    for (int taskIndex = m_nextTask.fetch_add(1); taskIndex < taskCount; taskIndex = m_nextTask.fetch_add(1))
+    {
+        (*task)(taskIndex);
+    }
+}
+
+void PhysicsWorkerPool::WorkerLoop()
+{
+    uint64_t lastGeneration = 0;
+
+#if defined(_DEBUG_PHYSICS_ALLOCATIONS_)
+    // Workers only run physics tasks, so everything they allocate counts against the step
+    t_countPhysicsAllocations = true;
+#endif
+
+    while (true)
+    {
+        const TaskFunction* task = nullptr;
+        int taskCount = 0;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wakeCondition.wait(lock, [&]() { return m_isStopping || m_generation != lastGeneration; });
+            if (m_isStopping)
+            {
+                return;
+            }
+
+            lastGeneration = m_generation;
+            task = m_task;
+            taskCount = m_taskCount;
+            ++m_busyWorkers;
+        }
+
+        RunTasks(task, taskCount);
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (--m_busyWorkers == 0)
+            {
+                m_doneCondition.notify_all();
+            }
+        }
+    }
+}
+
+void PhysicsWorkerPool::ParallelFor(int taskCount, const TaskFunction& task)
+{
+    if (taskCount <= 0)
+    {
+        return;
+    }
+
+    // Nothing to share - run inline
+    if (m_workers.empty() || taskCount == 1)
+    {
+        for (int taskIndex = 0; taskIndex < taskCount; ++taskIndex)
+        {
+            task(taskIndex);
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_task = &task;
+        m_taskCount = taskCount;
+        m_nextTask.store(0);
+        ++m_generation;
+    }
+    m_wakeCondition.notify_all();
+
+    // The calling thread works through the batch as well
+    RunTasks(&task, taskCount);
+
+    // Every task has been claimed - wait for workers still finishing theirs
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_doneCondition.wait(lock, [&]() { return m_busyWorkers == 0; });
+    m_task = nullptr;
+    m_taskCount = 0;
+}
+
+//==============================================================================
+// PhysicsRagdollSolver Implementation
+//==============================================================================
+PhysicsRagdollSolver::PhysicsRagdollSolver() :
+    m_serialBatch(-1),
+    m_nextRagdollId(0),
+    m_substeps(DEFAULT_RAGDOLL_SUBSTEPS),
+    m_damping(DEFAULT_RAGDOLL_DAMPING),
+    m_groundHeight(0.0f),
+    m_groundFriction(DEFAULT_RAGDOLL_GROUND_FRICTION),
+    m_groundEnabled(false),
+    m_batchesDirty(false)
+{
+    m_batchStarts.push_back(0);
+}
+
+int PhysicsRagdollSolver::AddRagdoll(const std::vector<PhysicsVector3D>& jointPositions,
+    const std::vector<std::pair<int, int>>& connections, float compliance, float coneAngle)
+{
+    const int jointCount = static_cast<int>(jointPositions.size());
+    if (jointCount == 0 || connections.empty())
+    {
+        return -1;
+    }
+    
+    for (const auto& connection : connections)
+    {
+        if (connection.first < 0 || connection.first >= jointCount ||
+            connection.second < 0 || connection.second >= jointCount ||
+            connection.first == connection.second)
+        {
+            return -1;
+        }
+    }
+    
+    Ragdoll ragdoll;
+    ragdoll.id = m_nextRagdollId++;
+    ragdoll.firstParticle = GetParticleCount();
+    ragdoll.particleCount = jointCount;
+    ragdoll.firstConstraint = GetConstraintCount();
+    
+    // One unit-mass particle per joint, starting at rest
+    for (const auto& position : jointPositions)
+    {
+        positionX.push_back(position.x);
+        positionY.push_back(position.y);
+        positionZ.push_back(position.z);
+        previousX.push_back(position.x);
+        previousY.push_back(position.y);
+        previousZ.push_back(position.z);
+        velocityX.push_back(0.0f);
+        velocityY.push_back(0.0f);
+        velocityZ.push_back(0.0f);
+        inverseMass.push_back(1.0f);
+    }
+    
+    auto distanceBetween = [&jointPositions](int a, int b) {
+        const PhysicsVector3D offset = jointPositions[b] - jointPositions[a];
+        return std::sqrt(offset.MagnitudeSquared());
+    };
+    
+    // Bones keep their creation length
+    for (const auto& connection : connections)
+    {
+        Constraint bone;
+        bone.particleA = ragdoll.firstParticle + connection.first;
+        bone.particleB = ragdoll.firstParticle + connection.second;
+        bone.restLength = distanceBetween(connection.first, connection.second);
+        bone.compliance = std::max(compliance, 0.0f);
+        bone.lambda = 0.0f;
+        bone.isLimit = 0;
+        m_constraints.push_back(bone);
+    }
+    
+    // Cone limit for every parent bone (P, A) followed by a child bone (A, B): a bend of phi gives
+    // |PB|^2 = |PA|^2 + |AB|^2 + 2 |PA| |AB| cos(phi), so phi <= coneAngle means |PB| >= minimum
+    if (coneAngle < XM_PI)
+    {
+        const float cosCone = std::cos(std::max(coneAngle, 0.0f));
+        for (const auto& parentBone : connections)
+        {
+            for (const auto& childBone : connections)
+            {
+                if (childBone.first != parentBone.second || childBone.second == parentBone.first)
+                {
+                    continue;
+                }
+                
+                const float parentLength = distanceBetween(parentBone.first, parentBone.second);
+                const float childLength = distanceBetween(childBone.first, childBone.second);
+                const float minimumSquared = parentLength * parentLength + childLength * childLength +
+                    2.0f * parentLength * childLength * cosCone;
+                
+                // Never tighter than the creation pose, so the ragdoll does not snap on its first step
+                const float minimumDistance = std::min(std::sqrt(std::max(minimumSquared, 0.0f)),
+                    distanceBetween(parentBone.first, childBone.second));
+                if (minimumDistance <= 0.0f)
+                {
+                    continue;
+                }
+                
+                Constraint limit;
+                limit.particleA = ragdoll.firstParticle + parentBone.first;
+                limit.particleB = ragdoll.firstParticle + childBone.second;
+                limit.restLength = minimumDistance;
+                limit.compliance = DEFAULT_RAGDOLL_LIMIT_COMPLIANCE;
+                limit.lambda = 0.0f;
+                limit.isLimit = 1;
+                m_constraints.push_back(limit);
+            }
+        }
+    }
+    
+    ragdoll.constraintCount = GetConstraintCount() - ragdoll.firstConstraint;
+    m_ragdolls.push_back(ragdoll);
+    m_batchesDirty = true;
+    
+    return ragdoll.id;
+}
+
+bool PhysicsRagdollSolver::RemoveRagdoll(int ragdollId)
+{
+    const Ragdoll* found = FindRagdoll(ragdollId);
+    if (!found)
+    {
+        return false;
+    }
+    
+    const Ragdoll removed = *found;
+    const int particleBegin = removed.firstParticle;
+    const int particleEnd = removed.firstParticle + removed.particleCount;
+    for (std::vector<float>* stream : { &positionX, &positionY, &positionZ, &previousX, &previousY, &previousZ,
+                                        &velocityX, &velocityY, &velocityZ, &inverseMass })
+    {
+        stream->erase(stream->begin() + particleBegin, stream->begin() + particleEnd);
+    }
+    
+    m_constraints.erase(m_constraints.begin() + removed.firstConstraint,
+        m_constraints.begin() + removed.firstConstraint + removed.constraintCount);
+    
+    // Later ragdolls move down to close the gap
+    for (auto& constraint : m_constraints)
+    {
+        if (constraint.particleA >= particleEnd)
+        {
+            constraint.particleA -= removed.particleCount;
+            constraint.particleB -= removed.particleCount;
+        }
+    }
+    
+    for (auto it = m_ragdolls.begin(); it != m_ragdolls.end();)
+    {
+        if (it->id == ragdollId)
+        {
+            it = m_ragdolls.erase(it);
+            continue;
+        }
+        
+        if (it->firstParticle >= particleEnd)
+        {
+            it->firstParticle -= removed.particleCount;
+            it->firstConstraint -= removed.constraintCount;
+        }
+        ++it;
+    }
+    
+    m_batchesDirty = true;
+    return true;
+}
+
+void PhysicsRagdollSolver::Clear()
+{
+    for (std::vector<float>* stream : { &positionX, &positionY, &positionZ, &previousX, &previousY, &previousZ,
+                                        &velocityX, &velocityY, &velocityZ, &inverseMass })
+    {
+        stream->clear();
+    }
+    
+    m_ragdolls.clear();
+    m_constraints.clear();
+    m_batchedConstraints.clear();
+    m_batchStarts.assign(1, 0);
+    m_serialBatch = -1;
+    m_batchesDirty = false;
+}
+
+void PhysicsRagdollSolver::SetGround(bool enabled, float height, float friction)
+{
+    m_groundEnabled = enabled;
+    m_groundHeight = height;
+    m_groundFriction = std::clamp(friction, 0.0f, 1.0f);
+}
+
+const PhysicsRagdollSolver::Ragdoll* PhysicsRagdollSolver::FindRagdoll(int ragdollId) const
+{
+    for (const auto& ragdoll : m_ragdolls)
+    {
+        if (ragdoll.id == ragdollId)
+        {
+            return &ragdoll;
+        }
+    }
+    
+    return nullptr;
+}
+
+void PhysicsRagdollSolver::BuildBatches()
+{
+    // Greedy colouring - each constraint takes the lowest colour unused by both of its particles
+    const int constraintCount = GetConstraintCount();
+    std::vector<uint64_t> particleColors(positionX.size(), 0);
+    std::vector<int> constraintColors(constraintCount);
+    int colorCount = 0;
+    bool hasOverflow = false;
+    
+    for (int i = 0; i < constraintCount; ++i)
+    {
+        const Constraint& constraint = m_constraints[i];
+        const uint64_t usedColors = particleColors[constraint.particleA] | particleColors[constraint.particleB];
+        
+        int color = 0;
+        while (color < MAX_XPBD_COLORS && (usedColors & (uint64_t(1) << color)))
+        {
+            ++color;
+        }
+        
+        if (color == MAX_XPBD_COLORS)
+        {
+            // Overflow constraints are solved serially after the coloured batches
+            hasOverflow = true;
+        }
+        else
+        {
+            particleColors[constraint.particleA] |= uint64_t(1) << color;
+            particleColors[constraint.particleB] |= uint64_t(1) << color;
+            colorCount = std::max(colorCount, color + 1);
+        }
+        constraintColors[i] = color;
+    }
+    
+    // Pack constraints by colour (counting sort keeps ragdoll order within a batch)
+    const int batchCount = colorCount + (hasOverflow ? 1 : 0);
+    m_serialBatch = hasOverflow ? colorCount : -1;
+    m_batchStarts.assign(batchCount + 1, 0);
+    for (int i = 0; i < constraintCount; ++i)
+    {
+        const int batch = (constraintColors[i] == MAX_XPBD_COLORS) ? colorCount : constraintColors[i];
+        ++m_batchStarts[batch + 1];
+    }
+    for (int batch = 0; batch < batchCount; ++batch)
+    {
+        m_batchStarts[batch + 1] += m_batchStarts[batch];
+    }
+    
+    std::vector<int> cursor(m_batchStarts.begin(), m_batchStarts.end() - 1);
+    m_batchedConstraints.resize(constraintCount);
+    for (int i = 0; i < constraintCount; ++i)
+    {
+        const int batch = (constraintColors[i] == MAX_XPBD_COLORS) ? colorCount : constraintColors[i];
+        m_batchedConstraints[cursor[batch]++] = m_constraints[i];
+    }
+    
+    m_batchesDirty = false;
+}
+
+void PhysicsRagdollSolver::SolveConstraints(int begin, int end, float inverseSubstepSquared)
+{
+    for (int i = begin; i < end; ++i)
+    {
+        Constraint& constraint = m_batchedConstraints[i];
+        const int a = constraint.particleA;
+        const int b = constraint.particleB;
+        
+        const float dx = positionX[a] - positionX[b];
+        const float dy = positionY[a] - positionY[b];
+        const float dz = positionZ[a] - positionZ[b];
+        const float length = std::sqrt(dx * dx + dy * dy + dz * dz);
+        const float error = length - constraint.restLength;
+        
+        // Limits only push particles apart
+        if (constraint.isLimit && error >= 0.0f)
+        {
+            continue;
+        }
+        
+        const float weightSum = inverseMass[a] + inverseMass[b];
+        if (weightSum <= 0.0f || length < MIN_VELOCITY_THRESHOLD)
+        {
+            continue;
+        }
+        
+        // XPBD update: dLambda = (-C - alpha~ * lambda) / (w + alpha~) with alpha~ = compliance / h^2
+        const float alphaTilde = constraint.compliance * inverseSubstepSquared;
+        const float deltaLambda = (-error - alphaTilde * constraint.lambda) / (weightSum + alphaTilde);
+        constraint.lambda += deltaLambda;
+        
+        const float scale = deltaLambda / length;
+        positionX[a] += dx * scale * inverseMass[a];
+        positionY[a] += dy * scale * inverseMass[a];
+        positionZ[a] += dz * scale * inverseMass[a];
+        positionX[b] -= dx * scale * inverseMass[b];
+        positionY[b] -= dy * scale * inverseMass[b];
+        positionZ[b] -= dz * scale * inverseMass[b];
+    }
+}
+
+void PhysicsRagdollSolver::SolveGroundContacts(const PhysicsHeightfield* const* heightfields, int heightfieldCount)
+{
+    if (!m_groundEnabled && heightfieldCount == 0)
+    {
+        return;
+    }
+    
+    // Penetrating particles are lifted straight up onto the highest surface under them; friction then
+    // takes back part of the sliding this substep, so the derived velocity loses it too
+    const float noGround = -std::numeric_limits<float>::max();
+    const int particleCount = GetParticleCount();
+    for (int i = 0; i < particleCount; ++i)
+    {
+        if (inverseMass[i] <= 0.0f)
+        {
+            continue;
+        }
+        
+        float surfaceHeight = m_groundEnabled ? m_groundHeight : noGround;
+        const PhysicsVector3D position = GetParticlePosition(i);
+        for (int h = 0; h < heightfieldCount; ++h)
+        {
+            if (heightfields[h]->OverlapsSphereBounds(position, 0.0f))
+            {
+                surfaceHeight = std::max(surfaceHeight, heightfields[h]->GetHeight(position.x, position.z));
+            }
+        }
+        
+        if (positionY[i] >= surfaceHeight)
+        {
+            continue;
+        }
+        
+        positionY[i] = surfaceHeight;
+        positionX[i] -= (positionX[i] - previousX[i]) * m_groundFriction;
+        positionZ[i] -= (positionZ[i] - previousZ[i]) * m_groundFriction;
+    }
+}
+
+void PhysicsRagdollSolver::Step(float deltaTime, const PhysicsVector3D& gravity, const PhysicsVector3D* fieldGravity,
+    const PhysicsHeightfield* const* heightfields, int heightfieldCount, PhysicsWorkerPool& workerPool)
+{
+    if (m_ragdolls.empty() || deltaTime <= 0.0f)
+    {
+        return;
+    }
+    
+    if (m_batchesDirty)
+    {
+        BuildBatches();
+    }
+    
+    // Small substeps with one constraint pass each converge better than many iterations per step
+    const int particleCount = GetParticleCount();
+    const float substep = deltaTime / static_cast<float>(m_substeps);
+    const float inverseSubstep = 1.0f / substep;
+    const float inverseSubstepSquared = inverseSubstep * inverseSubstep;
+    const float dampingFactor = std::max(0.0f, 1.0f - m_damping * substep);
+    
+    // Built once and pointed at each batch in turn, so dispatching a batch does not allocate
+    int batchBegin = 0;
+    int batchEnd = 0;
+    const PhysicsWorkerPool::TaskFunction solveTask = [&](int taskIndex) {
+        const int begin = batchBegin + taskIndex * XPBD_CONSTRAINTS_PER_TASK;
+        const int end = std::min(begin + XPBD_CONSTRAINTS_PER_TASK, batchEnd);
+        SolveConstraints(begin, end, inverseSubstepSquared);
+    };
+    
+    for (int step = 0; step < m_substeps; ++step)
+    {
+        // Predict positions
+        for (int i = 0; i < particleCount; ++i)
+        {
+            if (inverseMass[i] <= 0.0f)
+            {
+                continue;
+            }
+            
+            PhysicsVector3D acceleration = gravity;
+            if (fieldGravity)
+            {
+                acceleration += fieldGravity[i];
+            }
+            
+            velocityX[i] = (velocityX[i] + acceleration.x * substep) * dampingFactor;
+            velocityY[i] = (velocityY[i] + acceleration.y * substep) * dampingFactor;
+            velocityZ[i] = (velocityZ[i] + acceleration.z * substep) * dampingFactor;
+            previousX[i] = positionX[i];
+            previousY[i] = positionY[i];
+            previousZ[i] = positionZ[i];
+            positionX[i] += velocityX[i] * substep;
+            positionY[i] += velocityY[i] * substep;
+            positionZ[i] += velocityZ[i] * substep;
+        }
+        
+        for (auto& constraint : m_batchedConstraints)
+        {
+            constraint.lambda = 0.0f;
+        }
+        
+        // Batches run in order; constraints inside a coloured batch touch disjoint particles
+        for (int batch = 0; batch + 1 < static_cast<int>(m_batchStarts.size()); ++batch)
+        {
+            batchBegin = m_batchStarts[batch];
+            batchEnd = m_batchStarts[batch + 1];
+            const int taskCount = (batchEnd - batchBegin + XPBD_CONSTRAINTS_PER_TASK - 1) / XPBD_CONSTRAINTS_PER_TASK;
+            
+            if (batch != m_serialBatch && taskCount > 1)
+            {
+                workerPool.ParallelFor(taskCount, solveTask);
+            }
+            else
+            {
+                SolveConstraints(batchBegin, batchEnd, inverseSubstepSquared);
+            }
+        }
+        
+        // Contacts last, so a constraint can never leave a particle below the ground
+        SolveGroundContacts(heightfields, heightfieldCount);
+        
+        // Derive velocities from the corrected positions
+        for (int i = 0; i < particleCount; ++i)
+        {
+            if (inverseMass[i] > 0.0f)
+            {
+                velocityX[i] = (positionX[i] - previousX[i]) * inverseSubstep;
+                velocityY[i] = (positionY[i] - previousY[i]) * inverseSubstep;
+                velocityZ[i] = (positionZ[i] - previousZ[i]) * inverseSubstep;
+            }
+        }
+    }
+}
+
+bool PhysicsRagdollSolver::GetPositions(int ragdollId, std::vector<PhysicsVector3D>& outPositions) const
+{
+    const Ragdoll* ragdoll = FindRagdoll(ragdollId);
+    if (!ragdoll)
+    {
+        return false;
+    }
+    
+    outPositions.resize(ragdoll->particleCount);
+    for (int i = 0; i < ragdoll->particleCount; ++i)
+    {
+        outPositions[i] = GetParticlePosition(ragdoll->firstParticle + i);
+    }
+    
+    return true;
+}
+
+bool PhysicsRagdollSolver::BlendPositions(int ragdollId, const std::vector<PhysicsVector3D>& targetPositions, float blendFactor)
+{
+    const Ragdoll* ragdoll = FindRagdoll(ragdollId);
+    if (!ragdoll)
+    {
+        return false;
+    }
+    
+    // Interpolates the ragdoll's own particles only - stored velocities are kept, so the blend
+    // does not inject velocity on the next substep
+    blendFactor = std::clamp(blendFactor, 0.0f, 1.0f);
+    const int count = std::min(ragdoll->particleCount, static_cast<int>(targetPositions.size()));
+    for (int i = 0; i < count; ++i)
+    {
+        const int particle = ragdoll->firstParticle + i;
+        positionX[particle] += (targetPositions[i].x - positionX[particle]) * blendFactor;
+        positionY[particle] += (targetPositions[i].y - positionY[particle]) * blendFactor;
+        positionZ[particle] += (targetPositions[i].z - positionZ[particle]) * blendFactor;
+        previousX[particle] = positionX[particle];
+        previousY[particle] = positionY[particle];
+        previousZ[particle] = positionZ[particle];
+    }
+    
+    return true;
+}
+
+bool PhysicsRagdollSolver::ApplyImpulse(int ragdollId, int jointIndex, const PhysicsVector3D& impulse)
+{
+    const Ragdoll* ragdoll = FindRagdoll(ragdollId);
+    if (!ragdoll || jointIndex < 0 || jointIndex >= ragdoll->particleCount)
+    {
+        return false;
+    }
+    
+    const int particle = ragdoll->firstParticle + jointIndex;
+    velocityX[particle] += impulse.x * inverseMass[particle];
+    velocityY[particle] += impulse.y * inverseMass[particle];
+    velocityZ[particle] += impulse.z * inverseMass[particle];
+    return true;
+}
+
+size_t PhysicsRagdollSolver::GetMemoryUsage() const
+{
+    return positionX.capacity() * sizeof(float) * 10 +
+        (m_constraints.capacity() + m_batchedConstraints.capacity()) * sizeof(Constraint) +
+        m_batchStarts.capacity() * sizeof(int) +
+        m_ragdolls.capacity() * sizeof(Ragdoll);
+}
+
+void PhysicsRagdollSolver::Serialize(PhysicsWorldWriter& writer) const
+{
+    const std::vector<float>* streams[] = { &positionX, &positionY, &positionZ, &previousX, &previousY, &previousZ,
+        &velocityX, &velocityY, &velocityZ, &inverseMass };
+
+    writer.Write(static_cast<int32_t>(m_nextRagdollId));
+    writer.Write(static_cast<int32_t>(m_substeps));
+    writer.Write(m_damping);
+    writer.Write(static_cast<uint8_t>(m_groundEnabled ? 1 : 0));
+    writer.Write(m_groundHeight);
+    writer.Write(m_groundFriction);
+    for (const std::vector<float>* stream : streams)
+    {
+        writer.WriteArray(*stream);
+    }
+    writer.WriteArray(m_ragdolls);
+    writer.WriteArray(m_constraints);
+}
+
+bool PhysicsRagdollSolver::Deserialize(PhysicsWorldReader& reader)
+{
+    std::vector<float>* streams[] = { &positionX, &positionY, &positionZ, &previousX, &previousY, &previousZ,
+        &velocityX, &velocityY, &velocityZ, &inverseMass };
+
+    int32_t nextRagdollId = 0;
+    int32_t substeps = 0;
+    uint8_t groundEnabled = 0;
+    float groundHeight = 0.0f;
+    float groundFriction = 0.0f;
+    reader.Read(nextRagdollId);
+    reader.Read(substeps);
+    reader.Read(m_damping);
+    reader.Read(groundEnabled);
+    reader.Read(groundHeight);
+    reader.Read(groundFriction);
+    for (std::vector<float>* stream : streams)
+    {
+        reader.ReadArray(*stream);
+    }
+    reader.ReadArray(m_ragdolls);
+    reader.ReadArray(m_constraints);
+    if (reader.HasFailed())
+    {
+        return false;
+    }
+
+    // Every ragdoll and constraint must stay inside the streams it indexes
+    const int particleCount = static_cast<int>(positionX.size());
+    const int constraintCount = static_cast<int>(m_constraints.size());
+    for (const std::vector<float>* stream : streams)
+    {
+        if (static_cast<int>(stream->size()) != particleCount)
+        {
+            return false;
+        }
+    }
+    for (const Ragdoll& ragdoll : m_ragdolls)
+    {
+        if (ragdoll.firstParticle < 0 || ragdoll.particleCount < 0 || ragdoll.particleCount > particleCount - ragdoll.firstParticle ||
+            ragdoll.firstConstraint < 0 || ragdoll.constraintCount < 0 || ragdoll.constraintCount > constraintCount - ragdoll.firstConstraint)
+        {
+            return false;
+        }
+    }
+    for (const Constraint& constraint : m_constraints)
+    {
+        if (constraint.particleA < 0 || constraint.particleA >= particleCount ||
+            constraint.particleB < 0 || constraint.particleB >= particleCount)
+        {
+            return false;
+        }
+    }
+
+    m_nextRagdollId = nextRagdollId;
+    SetSubsteps(substeps);
+    SetGround(groundEnabled != 0, groundHeight, groundFriction);
+
+    // Colour batches are derived data - rebuild them on the next step
+    m_batchedConstraints.clear();
+    m_batchStarts.assign(1, 0);
+    m_serialBatch = -1;
+    m_batchesDirty = !m_constraints.empty();
+    return true;
+}
+
+//==============================================================================
+// PhysicsHeightfield Implementation
+//==============================================================================
+// Grid parameters shared by the batched height kernels
+struct HeightfieldSampler {
+    const float* heights;                                                       // Absolute sample heights
+    int width;                                                                  // Samples per row
+    float originX;                                                              // World x of sample column 0
+    float originZ;                                                              // World z of sample row 0
+    float inverseCellSize;                                                      // 1 / distance between samples
+    float cellsX;                                                               // Cells along x (clamp limit)
+    float cellsZ;                                                               // Cells along z (clamp limit)
+};
+
+// Upward normal of one cell triangle from its corners (p00, p10, p01, p11)
+// Triangle 0 is (p00, p10, p11) and covers fx >= fz, triangle 1 is (p00, p11, p01).
+static PhysicsVector3D HeightfieldTriangleNormal(const PhysicsVector3D corners[4], int triangle, float inverseCellSize)
+{
+    const float slopeX = (triangle == 0) ? corners[1].y - corners[0].y : corners[3].y - corners[2].y;
+    const float slopeZ = (triangle == 0) ? corners[3].y - corners[1].y : corners[2].y - corners[0].y;
+    const PhysicsVector3D normal(-slopeX * inverseCellSize, 1.0f, -slopeZ * inverseCellSize);
+    return normal * (1.0f / std::sqrt(normal.MagnitudeSquared()));
+}
+
+// Moller-Trumbore ray/triangle test (both faces)
+static bool RayTriangleDistance(const PhysicsVector3D& origin, const PhysicsVector3D& direction, const PhysicsVector3D& a,
+    const PhysicsVector3D& b, const PhysicsVector3D& c, float& outDistance)
+{
+    const PhysicsVector3D edge1 = b - a;
+    const PhysicsVector3D edge2 = c - a;
+    const PhysicsVector3D p = direction.Cross(edge2);
+    const float determinant = edge1.Dot(p);
+    if (std::fabs(determinant) < 1e-12f)
+    {
+        return false;
+    }
+
+    const float inverseDeterminant = 1.0f / determinant;
+    const PhysicsVector3D offset = origin - a;
+    const float u = offset.Dot(p) * inverseDeterminant;
+    if (u < 0.0f || u > 1.0f)
+    {
+        return false;
+    }
+
+    const PhysicsVector3D q = offset.Cross(edge1);
+    const float v = direction.Dot(q) * inverseDeterminant;
+    if (v < 0.0f || u + v > 1.0f)
+    {
+        return false;
+    }
+
+    outDistance = edge2.Dot(q) * inverseDeterminant;
+    return outDistance >= 0.0f;
+}
+
+// Closest point on triangle (a, b, c) to point p, by Voronoi region (Ericson, Real-Time Collision Detection 5.1.5)
+static PhysicsVector3D ClosestPointOnTriangle(const PhysicsVector3D& p, const PhysicsVector3D& a, const PhysicsVector3D& b,
+    const PhysicsVector3D& c)
+{
+    const PhysicsVector3D ab = b - a;
+    const PhysicsVector3D ac = c - a;
+    const PhysicsVector3D ap = p - a;
+    const float d1 = ab.Dot(ap);
+    const float d2 = ac.Dot(ap);
+    if (d1 <= 0.0f && d2 <= 0.0f)
+    {
+        return a;
+    }
+
+    const PhysicsVector3D bp = p - b;
+    const float d3 = ab.Dot(bp);
+    const float d4 = ac.Dot(bp);
+    if (d3 >= 0.0f && d4 <= d3)
+    {
+        return b;
+    }
+
+    const float vc = d1 * d4 - d3 * d2;
+    if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f)
+    {
+        return a + ab * (d1 / (d1 - d3));
+    }
+
+    const PhysicsVector3D cp = p - c;
+    const float d5 = ab.Dot(cp);
+    const float d6 = ac.Dot(cp);
+    if (d6 >= 0.0f && d5 <= d6)
+    {
+        return c;
+    }
+
+    const float vb = d5 * d2 - d1 * d6;
+    if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f)
+    {
+        return a + ac * (d2 / (d2 - d6));
+    }
+
+    const float va = d3 * d6 - d5 * d4;
+    if (va <= 0.0f && (d4 - d3) >= 0.0f && (d5 - d6) >= 0.0f)
+    {
+        return b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+    }
+
+    const float denominator = 1.0f / (va + vb + vc);
+    return a + ab * (vb * denominator) + ac * (vc * denominator);
+}
+
+// Keep the deepest contacts with distinct normals - a sphere touching a shared edge or vertex is
+// reported once by every triangle around it
+static void AddHeightfieldContact(const ContactPoint& contact, ContactPoint* contacts, int maxContacts, int& contactCount)
+{
+    int shallowest = -1;
+    for (int i = 0; i < contactCount; ++i)
+    {
+        if (contacts[i].normal.Dot(contact.normal) > HEIGHTFIELD_CONTACT_MERGE_COSINE)
+        {
+            if (contact.penetrationDepth > contacts[i].penetrationDepth)
+            {
+                contacts[i] = contact;
+            }
+            return;
+        }
+
+        if (shallowest < 0 || contacts[i].penetrationDepth < contacts[shallowest].penetrationDepth)
+        {
+            shallowest = i;
+        }
+    }
+
+    if (contactCount < maxContacts)
+    {
+        contacts[contactCount++] = contact;
+    }
+    else if (contact.penetrationDepth > contacts[shallowest].penetrationDepth)
+    {
+        contacts[shallowest] = contact;
+    }
+}
+
+#if defined(CPUFEATURES_X86)
+// SSE2 - 4 points per iteration (SSE2 has no gather, so corner heights are loaded per lane)
+static int SampleHeightfieldSSE2(const HeightfieldSampler& sampler, const float* x, const float* z, float* outHeights, int count)
+{
+    const __m128 originX = _mm_set1_ps(sampler.originX);
+    const __m128 originZ = _mm_set1_ps(sampler.originZ);
+    const __m128 inverseCellSize = _mm_set1_ps(sampler.inverseCellSize);
+    const __m128 cellsX = _mm_set1_ps(sampler.cellsX);
+    const __m128 cellsZ = _mm_set1_ps(sampler.cellsZ);
+    const __m128 lastCellX = _mm_set1_ps(sampler.cellsX - 1.0f);
+    const __m128 lastCellZ = _mm_set1_ps(sampler.cellsZ - 1.0f);
+    const __m128 width = _mm_set1_ps(static_cast<float>(sampler.width));
+    const __m128 zero = _mm_setzero_ps();
+    const float* heights = sampler.heights;
+    const int row = sampler.width;
+    alignas(16) int sample[4];
+
+    int i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        // max(value, 0) also maps NaN coordinates onto the grid
+        const __m128 fx = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(x + i), originX), inverseCellSize), zero), cellsX);
+        const __m128 fz = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(z + i), originZ), inverseCellSize), zero), cellsZ);
+        const __m128 cellX = _mm_cvtepi32_ps(_mm_cvttps_epi32(_mm_min_ps(fx, lastCellX)));
+        const __m128 cellZ = _mm_cvtepi32_ps(_mm_cvttps_epi32(_mm_min_ps(fz, lastCellZ)));
+        const __m128 tx = _mm_sub_ps(fx, cellX);
+        const __m128 tz = _mm_sub_ps(fz, cellZ);
+
+        // Sample indices stay below 2^24 (MAX_HEIGHTFIELD_RESOLUTION), so they are exact in float lanes
+        _mm_store_si128(reinterpret_cast<__m128i*>(sample), _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(cellZ, width), cellX)));
+        const __m128 h00 = _mm_setr_ps(heights[sample[0]], heights[sample[1]], heights[sample[2]], heights[sample[3]]);
+        const __m128 h10 = _mm_setr_ps(heights[sample[0] + 1], heights[sample[1] + 1], heights[sample[2] + 1], heights[sample[3] + 1]);
+        const __m128 h01 = _mm_setr_ps(heights[sample[0] + row], heights[sample[1] + row], heights[sample[2] + row], heights[sample[3] + row]);
+        const __m128 h11 = _mm_setr_ps(heights[sample[0] + row + 1], heights[sample[1] + row + 1], heights[sample[2] + row + 1],
+            heights[sample[3] + row + 1]);
+
+        const __m128 lower = _mm_add_ps(h00, _mm_add_ps(_mm_mul_ps(tx, _mm_sub_ps(h10, h00)), _mm_mul_ps(tz, _mm_sub_ps(h11, h10))));
+        const __m128 upper = _mm_add_ps(h00, _mm_add_ps(_mm_mul_ps(tz, _mm_sub_ps(h01, h00)), _mm_mul_ps(tx, _mm_sub_ps(h11, h01))));
+        const __m128 mask = _mm_cmpge_ps(tx, tz);
+        _mm_storeu_ps(outHeights + i, _mm_or_ps(_mm_and_ps(mask, lower), _mm_andnot_ps(mask, upper)));
+    }
+
+    return i;
+}
+
+// AVX2 + FMA - 8 points per iteration with gathered corner heights
+CPUFEATURES_TARGET_AVX2
+static int SampleHeightfieldAVX2(const HeightfieldSampler& sampler, const float* x, const float* z, float* outHeights, int count)
+{
+    const __m256 originX = _mm256_set1_ps(sampler.originX);
+    const __m256 originZ = _mm256_set1_ps(sampler.originZ);
+    const __m256 inverseCellSize = _mm256_set1_ps(sampler.inverseCellSize);
+    const __m256 cellsX = _mm256_set1_ps(sampler.cellsX);
+    const __m256 cellsZ = _mm256_set1_ps(sampler.cellsZ);
+    const __m256 lastCellX = _mm256_set1_ps(sampler.cellsX - 1.0f);
+    const __m256 lastCellZ = _mm256_set1_ps(sampler.cellsZ - 1.0f);
+    const __m256i width = _mm256_set1_epi32(sampler.width);
+    const __m256 zero = _mm256_setzero_ps();
+    const float* heights = sampler.heights;
+    const int row = sampler.width;
+
+    int i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const __m256 fx = _mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(x + i), originX), inverseCellSize), zero), cellsX);
+        const __m256 fz = _mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(z + i), originZ), inverseCellSize), zero), cellsZ);
+        const __m256i cellX = _mm256_cvttps_epi32(_mm256_min_ps(fx, lastCellX));
+        const __m256i cellZ = _mm256_cvttps_epi32(_mm256_min_ps(fz, lastCellZ));
+        const __m256 tx = _mm256_sub_ps(fx, _mm256_cvtepi32_ps(cellX));
+        const __m256 tz = _mm256_sub_ps(fz, _mm256_cvtepi32_ps(cellZ));
+
+        const __m256i sample = _mm256_add_epi32(_mm256_mullo_epi32(cellZ, width), cellX);
+        const __m256 h00 = _mm256_i32gather_ps(heights, sample, 4);
+        const __m256 h10 = _mm256_i32gather_ps(heights + 1, sample, 4);
+        const __m256 h01 = _mm256_i32gather_ps(heights + row, sample, 4);
+        const __m256 h11 = _mm256_i32gather_ps(heights + row + 1, sample, 4);
+
+        const __m256 lower = _mm256_fmadd_ps(tz, _mm256_sub_ps(h11, h10), _mm256_fmadd_ps(tx, _mm256_sub_ps(h10, h00), h00));
+        const __m256 upper = _mm256_fmadd_ps(tx, _mm256_sub_ps(h11, h01), _mm256_fmadd_ps(tz, _mm256_sub_ps(h01, h00), h00));
+        _mm256_storeu_ps(outHeights + i, _mm256_blendv_ps(upper, lower, _mm256_cmp_ps(tx, tz, _CMP_GE_OQ)));
+    }
+
+    return i;
+}
+#endif
+
+PhysicsHeightfield::PhysicsHeightfield() :
+    m_cellSize(1.0f),
+    m_inverseCellSize(1.0f),
+    m_width(0),
+    m_depth(0),
+    m_minHeight(0.0f),
+    m_maxHeight(0.0f),
+    m_maxSlope(0.0f),
+    m_restitution(DEFAULT_RESTITUTION),
+    m_friction(DEFAULT_FRICTION),
+    m_collisionLayer(COLLISION_LAYER_DEFAULT),
+    m_collisionMask(COLLISION_MASK_ALL)
+{
+}
+
+static bool IsValidHeightfieldGrid(double width, double depth, float cellSize)
+{
+    return width >= 2.0 && depth >= 2.0 && width <= MAX_HEIGHTFIELD_RESOLUTION && depth <= MAX_HEIGHTFIELD_RESOLUTION &&
+        cellSize > 0.0f && std::isfinite(cellSize);
+}
+
+bool PhysicsHeightfield::BuildFromHeights(const float* heights, int width, int depth, float cellSize, const PhysicsVector3D& origin)
+{
+    Clear();
+
+    if (!heights || !IsValidHeightfieldGrid(width, depth, cellSize))
+    {
+        debug.logLevelMessage(LogLevel::LOG_WARNING, L"[Physics] Invalid heightfield grid, heightfield left empty");
+        return false;
+    }
+
+    m_heights.resize(static_cast<size_t>(width) * depth);
+    for (size_t i = 0; i < m_heights.size(); ++i)
+    {
+        m_heights[i] = origin.y + heights[i];
+    }
+
+    m_width = width;
+    m_depth = depth;
+    m_cellSize = cellSize;
+    m_origin = origin;
+    return Finalize();
+}
+
+bool PhysicsHeightfield::BuildFromImage(const unsigned char* pixels, int width, int depth, int channels, int bytesPerChannel,
+    float cellSize, float heightScale, const PhysicsVector3D& origin)
+{
+    if (!pixels || channels < 1 || (bytesPerChannel != 1 && bytesPerChannel != 2) || !IsValidHeightfieldGrid(width, depth, cellSize))
+    {
+        Clear();
+        debug.logLevelMessage(LogLevel::LOG_WARNING, L"[Physics] Invalid heightfield image, heightfield left empty");
+        return false;
+    }
+
+    // 16-bit images are expected in native byte order (as returned by stbi_load_16)
+    const size_t pixelStride = static_cast<size_t>(channels) * bytesPerChannel;
+    const float scale = heightScale / ((bytesPerChannel == 1) ? 255.0f : 65535.0f);
+    std::vector<float> heights(static_cast<size_t>(width) * depth);
+    for (size_t i = 0; i < heights.size(); ++i)
+    {
+        const unsigned char* pixel = pixels + i * pixelStride;
+        uint16_t value = pixel[0];
+        if (bytesPerChannel == 2)
+        {
+            std::memcpy(&value, pixel, sizeof(value));
+        }
+        heights[i] = value * scale;
+    }
+
+    return BuildFromHeights(heights.data(), width, depth, cellSize, origin);
+}
+
+bool PhysicsHeightfield::BuildFromMesh(const float* positions, size_t vertexCount, size_t vertexStride, const uint32_t* indices,
+    size_t indexCount, float cellSize)
+{
+    Clear();
+
+    const size_t triangleCount = indices ? indexCount / 3 : vertexCount / 3;
+    if (!positions || vertexCount < 3 || vertexStride < 3 * sizeof(float) || triangleCount == 0 || !(cellSize > 0.0f))
+    {
+        debug.logLevelMessage(LogLevel::LOG_WARNING, L"[Physics] Invalid heightfield mesh, heightfield left empty");
+        return false;
+    }
+
+    const unsigned char* vertexBytes = reinterpret_cast<const unsigned char*>(positions);
+    auto vertexAt = [&](size_t vertex) {
+        float position[3];
+        std::memcpy(position, vertexBytes + vertex * vertexStride, sizeof(position));
+        return PhysicsVector3D(position[0], position[1], position[2]);
+    };
+
+    PhysicsVector3D minimum = vertexAt(0);
+    PhysicsVector3D maximum = minimum;
+    for (size_t i = 1; i < vertexCount; ++i)
+    {
+        const PhysicsVector3D vertex = vertexAt(i);
+        minimum = PhysicsVector3D(std::min(minimum.x, vertex.x), std::min(minimum.y, vertex.y), std::min(minimum.z, vertex.z));
+        maximum = PhysicsVector3D(std::max(maximum.x, vertex.x), std::max(maximum.y, vertex.y), std::max(maximum.z, vertex.z));
+    }
+
+    const double width = std::ceil((static_cast<double>(maximum.x) - minimum.x) / cellSize) + 1.0;
+    const double depth = std::ceil((static_cast<double>(maximum.z) - minimum.z) / cellSize) + 1.0;
+    if (!IsValidHeightfieldGrid(width, depth, cellSize))
+    {
+        debug.logLevelMessage(LogLevel::LOG_WARNING, L"[Physics] Heightfield mesh needs more samples than MAX_HEIGHTFIELD_RESOLUTION");
+        return false;
+    }
+
+    m_width = static_cast<int>(width);
+    m_depth = static_cast<int>(depth);
+    m_cellSize = cellSize;
+    m_inverseCellSize = 1.0f / cellSize;
+    m_origin = PhysicsVector3D(minimum.x, 0.0f, minimum.z);
+
+    // Rasterize every triangle onto the samples under it, keeping the highest surface
+    const float unset = -std::numeric_limits<float>::max();
+    m_heights.assign(static_cast<size_t>(m_width) * m_depth, unset);
+    const float edgeTolerance = -1e-5f;
+    for (size_t t = 0; t < triangleCount; ++t)
+    {
+        const size_t i0 = indices ? indices[t * 3] : t * 3;
+        const size_t i1 = indices ? indices[t * 3 + 1] : t * 3 + 1;
+        const size_t i2 = indices ? indices[t * 3 + 2] : t * 3 + 2;
+        if (i0 >= vertexCount || i1 >= vertexCount || i2 >= vertexCount)
+        {
+            continue;
+        }
+
+        const PhysicsVector3D a = vertexAt(i0);
+        const PhysicsVector3D b = vertexAt(i1);
+        const PhysicsVector3D c = vertexAt(i2);
+        const float area = (b.x - a.x) * (c.z - a.z) - (c.x - a.x) * (b.z - a.z);
+        if (std::fabs(area) < 1e-12f)
+        {
+            continue;                                                           // Vertical triangle - covers no samples
+        }
+
+        const float inverseArea = 1.0f / area;
+        const int firstX = std::max(0, static_cast<int>(std::ceil((std::min({ a.x, b.x, c.x }) - m_origin.x) * m_inverseCellSize)));
+        const int lastX = std::min(m_width - 1, static_cast<int>(std::floor((std::max({ a.x, b.x, c.x }) - m_origin.x) * m_inverseCellSize)));
+        const int firstZ = std::max(0, static_cast<int>(std::ceil((std::min({ a.z, b.z, c.z }) - m_origin.z) * m_inverseCellSize)));
+        const int lastZ = std::min(m_depth - 1, static_cast<int>(std::floor((std::max({ a.z, b.z, c.z }) - m_origin.z) * m_inverseCellSize)));
+
+        for (int sampleZ = firstZ; sampleZ <= lastZ; ++sampleZ)
+        {
+            const float pz = m_origin.z + sampleZ * cellSize;
+            for (int sampleX = firstX; sampleX <= lastX; ++sampleX)
+            {
+                const float px = m_origin.x + sampleX * cellSize;
+                const float weightA = ((b.x - px) * (c.z - pz) - (c.x - px) * (b.z - pz)) * inverseArea;
+                const float weightB = ((c.x - px) * (a.z - pz) - (a.x - px) * (c.z - pz)) * inverseArea;
+                const float weightC = 1.0f - weightA - weightB;
+                if (weightA < edgeTolerance || weightB < edgeTolerance || weightC < edgeTolerance)
+                {
+                    continue;
+                }
+
+                float& height = m_heights[static_cast<size_t>(sampleZ) * m_width + sampleX];
+                height = std::max(height, weightA * a.y + weightB * b.y + weightC * c.y);
+            }
+        }
+    }
+
+    for (float& height : m_heights)
+    {
+        height = (height == unset) ? minimum.y : height;
+    }
+
+    return Finalize();
+}
+
+void PhysicsHeightfield::Clear()
+{
+    // Terrain grids are large - release the storage rather than keeping it for reuse
+    std::vector<float>().swap(m_heights);
+    std::vector<HeightRange>().swap(m_ranges);
+    m_levelOffsets.clear();
+    m_levelWidths.clear();
+    m_levelDepths.clear();
+    m_width = 0;
+    m_depth = 0;
+    m_minHeight = 0.0f;
+    m_maxHeight = 0.0f;
+    m_maxSlope = 0.0f;
+}
+
+void PhysicsHeightfield::SetMaterial(float restitution, float friction)
+{
+    m_restitution = std::clamp(restitution, 0.0f, 1.0f);
+    m_friction = std::max(friction, 0.0f);
+}
+
+bool PhysicsHeightfield::Finalize()
+{
+    m_inverseCellSize = 1.0f / m_cellSize;
+
+    for (float height : m_heights)
+    {
+        if (!std::isfinite(height))
+        {
+            Clear();
+            debug.logLevelMessage(LogLevel::LOG_WARNING, L"[Physics] Heightfield contains non-finite heights, heightfield left empty");
+            return false;
+        }
+    }
+
+    // Steepest triangle gradient bounds how far the surface can rise within any horizontal distance
+    float maxSlopeSquared = 0.0f;
+    PhysicsVector3D corners[4];
+    for (int cellZ = 0; cellZ < m_depth - 1; ++cellZ)
+    {
+        for (int cellX = 0; cellX < m_width - 1; ++cellX)
+        {
+            GetCellCorners(cellX, cellZ, corners);
+            for (int triangle = 0; triangle < 2; ++triangle)
+            {
+                const PhysicsVector3D normal = HeightfieldTriangleNormal(corners, triangle, m_inverseCellSize);
+                const float horizontalSquared = normal.x * normal.x + normal.z * normal.z;
+                maxSlopeSquared = std::max(maxSlopeSquared, horizontalSquared / (normal.y * normal.y));
+            }
+        }
+    }
+    m_maxSlope = std::sqrt(maxSlopeSquared);
+
+    BuildQuadtree();
+    const HeightRange& root = m_ranges.back();
+    m_minHeight = root.minHeight;
+    m_maxHeight = root.maxHeight;
+
+#if defined(_DEBUG_PHYSICS_)
+    debug.logDebugMessage(LogLevel::LOG_INFO, L"[Physics] Heightfield built: %dx%d samples, %d quadtree levels, heights %.2f..%.2f",
+        m_width, m_depth, GetQuadtreeLevelCount(), m_minHeight, m_maxHeight);
+#endif
+    return true;
+}
+
+void PhysicsHeightfield::BuildQuadtree()
+{
+    m_ranges.clear();
+    m_levelOffsets.clear();
+    m_levelWidths.clear();
+    m_levelDepths.clear();
+
+    // Level 0 - one node per cell, bounded by its four samples
+    int levelWidth = m_width - 1;
+    int levelDepth = m_depth - 1;
+    m_levelOffsets.push_back(0);
+    m_levelWidths.push_back(levelWidth);
+    m_levelDepths.push_back(levelDepth);
+    m_ranges.resize(static_cast<size_t>(levelWidth) * levelDepth);
+    for (int cellZ = 0; cellZ < levelDepth; ++cellZ)
+    {
+        const float* row = &m_heights[static_cast<size_t>(cellZ) * m_width];
+        for (int cellX = 0; cellX < levelWidth; ++cellX)
+        {
+            const float h00 = row[cellX];
+            const float h10 = row[cellX + 1];
+            const float h01 = row[cellX + m_width];
+            const float h11 = row[cellX + m_width + 1];
+            HeightRange& range = m_ranges[static_cast<size_t>(cellZ) * levelWidth + cellX];
+            range.minHeight = std::min({ h00, h10, h01, h11 });
+            range.maxHeight = std::max({ h00, h10, h01, h11 });
+        }
+    }
+
+    // Each coarser level merges 2x2 nodes until a single root covers the grid
+    while (levelWidth > 1 || levelDepth > 1)
+    {
+        const int childLevel = static_cast<int>(m_levelOffsets.size()) - 1;
+        levelWidth = (levelWidth + 1) / 2;
+        levelDepth = (levelDepth + 1) / 2;
+        const int offset = static_cast<int>(m_ranges.size());
+        m_levelOffsets.push_back(offset);
+        m_levelWidths.push_back(levelWidth);
+        m_levelDepths.push_back(levelDepth);
+        m_ranges.resize(m_ranges.size() + static_cast<size_t>(levelWidth) * levelDepth);
+
+        for (int nodeZ = 0; nodeZ < levelDepth; ++nodeZ)
+        {
+            for (int nodeX = 0; nodeX < levelWidth; ++nodeX)
+            {
+                HeightRange merged = GetRange(childLevel, nodeX * 2, nodeZ * 2);
+                for (int child = 1; child < 4; ++child)
+                {
+                    const int childX = nodeX * 2 + (child & 1);
+                    const int childZ = nodeZ * 2 + (child >> 1);
+                    if (childX < m_levelWidths[childLevel] && childZ < m_levelDepths[childLevel])
+                    {
+                        const HeightRange& range = GetRange(childLevel, childX, childZ);
+                        merged.minHeight = std::min(merged.minHeight, range.minHeight);
+                        merged.maxHeight = std::max(merged.maxHeight, range.maxHeight);
+                    }
+                }
+                m_ranges[offset + static_cast<size_t>(nodeZ) * levelWidth + nodeX] = merged;
+            }
+        }
+    }
+}
+
+void PhysicsHeightfield::GetCellCorners(int cellX, int cellZ, PhysicsVector3D corners[4]) const
+{
+    const float* row = &m_heights[static_cast<size_t>(cellZ) * m_width + cellX];
+    const float x0 = m_origin.x + cellX * m_cellSize;
+    const float z0 = m_origin.z + cellZ * m_cellSize;
+    corners[0] = PhysicsVector3D(x0, row[0], z0);
+    corners[1] = PhysicsVector3D(x0 + m_cellSize, row[1], z0);
+    corners[2] = PhysicsVector3D(x0, row[m_width], z0 + m_cellSize);
+    corners[3] = PhysicsVector3D(x0 + m_cellSize, row[m_width + 1], z0 + m_cellSize);
+}
+
+void PhysicsHeightfield::LocateCell(float x, float z, int& outCellX, int& outCellZ, float& outFractionX, float& outFractionZ) const
+{
+    // max(0, value) first so NaN coordinates land on the grid
+    const float cellsX = static_cast<float>(m_width - 1);
+    const float cellsZ = static_cast<float>(m_depth - 1);
+    const float fx = std::min(std::max(0.0f, (x - m_origin.x) * m_inverseCellSize), cellsX);
+    const float fz = std::min(std::max(0.0f, (z - m_origin.z) * m_inverseCellSize), cellsZ);
+    outCellX = static_cast<int>(std::min(fx, cellsX - 1.0f));
+    outCellZ = static_cast<int>(std::min(fz, cellsZ - 1.0f));
+    outFractionX = fx - outCellX;
+    outFractionZ = fz - outCellZ;
+}
+
+float PhysicsHeightfield::GetHeight(float x, float z) const
+{
+    if (!IsValid())
+    {
+        return -std::numeric_limits<float>::max();
+    }
+
+    int cellX, cellZ;
+    float tx, tz;
+    LocateCell(x, z, cellX, cellZ, tx, tz);
+
+    const float* row = &m_heights[static_cast<size_t>(cellZ) * m_width + cellX];
+    const float h00 = row[0];
+    const float h10 = row[1];
+    const float h01 = row[m_width];
+    const float h11 = row[m_width + 1];
+    return (tx >= tz) ? h00 + tx * (h10 - h00) + tz * (h11 - h10) : h00 + tz * (h01 - h00) + tx * (h11 - h01);
+}
+
+PhysicsVector3D PhysicsHeightfield::GetNormal(float x, float z) const
+{
+    if (!IsValid())
+    {
+        return PhysicsVector3D(0.0f, 1.0f, 0.0f);
+    }
+
+    int cellX, cellZ;
+    float tx, tz;
+    LocateCell(x, z, cellX, cellZ, tx, tz);
+
+    PhysicsVector3D corners[4];
+    GetCellCorners(cellX, cellZ, corners);
+    return HeightfieldTriangleNormal(corners, (tx >= tz) ? 0 : 1, m_inverseCellSize);
+}
+
+void PhysicsHeightfield::SampleHeights(const float* x, const float* z, float* outHeights, int count, PhysicsSIMDPath path) const
+{
+    if (!IsValid())
+    {
+        std::fill(outHeights, outHeights + std::max(count, 0), -std::numeric_limits<float>::max());
+        return;
+    }
+
+    // Vector kernels handle whole lanes, the scalar loop finishes the remainder
+    int processed = 0;
+#if defined(CPUFEATURES_X86)
+    const HeightfieldSampler sampler = { m_heights.data(), m_width, m_origin.x, m_origin.z, m_inverseCellSize,
+        static_cast<float>(m_width - 1), static_cast<float>(m_depth - 1) };
+    if (path == PhysicsSIMDPath::AVX2)
+    {
+        processed = SampleHeightfieldAVX2(sampler, x, z, outHeights, count);
+    }
+    else if (path == PhysicsSIMDPath::SSE2)
+    {
+        processed = SampleHeightfieldSSE2(sampler, x, z, outHeights, count);
+    }
+#endif
+    for (int i = processed; i < count; ++i)
+    {
+        outHeights[i] = GetHeight(x[i], z[i]);
+    }
+}
+
+void PhysicsHeightfield::SampleHeights(const float* x, const float* z, float* outHeights, int count) const
+{
+    const CPUFeatureFlags& cpu = GetCPUFeatures();
+    const PhysicsSIMDPath path = (cpu.hasAVX2 && cpu.hasFMA) ? PhysicsSIMDPath::AVX2 :
+        (cpu.hasSSE2 ? PhysicsSIMDPath::SSE2 : PhysicsSIMDPath::Scalar);
+    SampleHeights(x, z, outHeights, count, path);
+}
+
+bool PhysicsHeightfield::NodeRayInterval(const QuadNode& node, const PhysicsVector3D& origin, const PhysicsVector3D& inverseDirection,
+    float maxDistance, float& outEnter, float& outExit) const
+{
+    const int firstCellX = node.x << node.level;
+    const int firstCellZ = node.z << node.level;
+    const int endCellX = std::min((node.x + 1) << node.level, m_width - 1);
+    const int endCellZ = std::min((node.z + 1) << node.level, m_depth - 1);
+    const HeightRange& range = GetRange(node.level, node.x, node.z);
+
+    // Slab test against the node box - the height range is the node's y extent
+    const float minimum[3] = { m_origin.x + firstCellX * m_cellSize, range.minHeight, m_origin.z + firstCellZ * m_cellSize };
+    const float maximum[3] = { m_origin.x + endCellX * m_cellSize, range.maxHeight, m_origin.z + endCellZ * m_cellSize };
+    const float start[3] = { origin.x, origin.y, origin.z };
+    const float inverse[3] = { inverseDirection.x, inverseDirection.y, inverseDirection.z };
+
+    float enter = 0.0f;
+    float exit = maxDistance;
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        const float t0 = (minimum[axis] - start[axis]) * inverse[axis];
+        const float t1 = (maximum[axis] - start[axis]) * inverse[axis];
+        enter = std::max(enter, std::min(t0, t1));
+        exit = std::min(exit, std::max(t0, t1));
+    }
+
+    outEnter = enter;
+    outExit = exit;
+    return enter <= exit;
+}
+
+bool PhysicsHeightfield::RaycastCell(int cellX, int cellZ, const PhysicsVector3D& origin, const PhysicsVector3D& direction,
+    float maxDistance, PhysicsHeightfieldHit& outHit) const
+{
+    PhysicsVector3D corners[4];
+    GetCellCorners(cellX, cellZ, corners);
+
+    int hitTriangle = -1;
+    float nearest = maxDistance;
+    float distance = 0.0f;
+    if (RayTriangleDistance(origin, direction, corners[0], corners[1], corners[3], distance) && distance <= nearest)
+    {
+        nearest = distance;
+        hitTriangle = 0;
+    }
+    if (RayTriangleDistance(origin, direction, corners[0], corners[3], corners[2], distance) && distance <= nearest)
+    {
+        nearest = distance;
+        hitTriangle = 1;
+    }
+
+    if (hitTriangle < 0)
+    {
+        return false;
+    }
+
+    outHit.position = origin + direction * nearest;
+    outHit.normal = HeightfieldTriangleNormal(corners, hitTriangle, m_inverseCellSize);
+    outHit.distance = nearest;
+    outHit.featureId = (cellZ * (m_width - 1) + cellX) * 2 + hitTriangle;
+    return true;
+}
+
+bool PhysicsHeightfield::WalkCells(const QuadNode& node, const PhysicsVector3D& origin, const PhysicsVector3D& direction,
+    float enter, float exit, float maxDistance, PhysicsHeightfieldHit& outHit) const
+{
+    const int firstCellX = node.x << node.level;
+    const int firstCellZ = node.z << node.level;
+    const int lastCellX = std::min((node.x + 1) << node.level, m_width - 1) - 1;
+    const int lastCellZ = std::min((node.z + 1) << node.level, m_depth - 1) - 1;
+
+    // Digital differential analyser over the cells of the node, nearest cell first
+    const PhysicsVector3D start = origin + direction * enter;
+    int cellX = std::clamp(static_cast<int>(std::floor((start.x - m_origin.x) * m_inverseCellSize)), firstCellX, lastCellX);
+    int cellZ = std::clamp(static_cast<int>(std::floor((start.z - m_origin.z) * m_inverseCellSize)), firstCellZ, lastCellZ);
+
+    const float infinity = std::numeric_limits<float>::infinity();
+    const int stepX = (direction.x > 0.0f) ? 1 : -1;
+    const int stepZ = (direction.z > 0.0f) ? 1 : -1;
+    const float deltaX = (direction.x != 0.0f) ? m_cellSize / std::fabs(direction.x) : infinity;
+    const float deltaZ = (direction.z != 0.0f) ? m_cellSize / std::fabs(direction.z) : infinity;
+    float nextX = (direction.x != 0.0f) ? (m_origin.x + (cellX + (stepX > 0 ? 1 : 0)) * m_cellSize - origin.x) / direction.x : infinity;
+    float nextZ = (direction.z != 0.0f) ? (m_origin.z + (cellZ + (stepZ > 0 ? 1 : 0)) * m_cellSize - origin.z) / direction.z : infinity;
+
+    // Cells whose height range the ray segment cannot reach skip the triangle tests
+    const float tolerance = 1e-4f * (1.0f + std::fabs(m_maxHeight) + std::fabs(m_minHeight));
+    float cellEnter = enter;
+    for (;;)
+    {
+        const float cellExit = std::min(std::min(nextX, nextZ), exit);
+        const HeightRange& range = GetRange(0, cellX, cellZ);
+        const float y0 = origin.y + direction.y * cellEnter;
+        const float y1 = origin.y + direction.y * cellExit;
+        if (std::min(y0, y1) <= range.maxHeight + tolerance && std::max(y0, y1) >= range.minHeight - tolerance &&
+            RaycastCell(cellX, cellZ, origin, direction, maxDistance, outHit))
+        {
+            return true;
+        }
+
+        if (cellExit >= exit)
+        {
+            return false;
+        }
+
+        cellEnter = cellExit;
+        if (nextX < nextZ)
+        {
+            cellX += stepX;
+            nextX += deltaX;
+        }
+        else
+        {
+            cellZ += stepZ;
+            nextZ += deltaZ;
+        }
+
+        if (cellX < firstCellX || cellX > lastCellX || cellZ < firstCellZ || cellZ > lastCellZ)
+        {
+            return false;
+        }
+    }
+}
+
+bool PhysicsHeightfield::Raycast(const PhysicsVector3D& origin, const PhysicsVector3D& direction, float maxDistance,
+    PhysicsHeightfieldHit& outHit) const
+{
+    const float length = std::sqrt(direction.MagnitudeSquared());
+    if (!IsValid() || !(maxDistance > 0.0f) || length < MIN_VELOCITY_THRESHOLD)
+    {
+        return false;
+    }
+
+    // Axis-parallel rays get a huge (not infinite) inverse so the slab test never computes 0 * inf
+    const PhysicsVector3D unitDirection = direction * (1.0f / length);
+    const float huge = std::numeric_limits<float>::max();
+    const PhysicsVector3D inverseDirection(
+        (unitDirection.x != 0.0f) ? 1.0f / unitDirection.x : huge,
+        (unitDirection.y != 0.0f) ? 1.0f / unitDirection.y : huge,
+        (unitDirection.z != 0.0f) ? 1.0f / unitDirection.z : huge);
+
+    // Children are pushed far to near so nodes pop in the order the ray crosses them - the first
+    // cell hit is the nearest hit
+    const int nearX = (unitDirection.x >= 0.0f) ? 0 : 1;
+    const int nearZ = (unitDirection.z >= 0.0f) ? 0 : 1;
+    QuadNode stack[HEIGHTFIELD_QUERY_STACK_SIZE];
+    int stackSize = 0;
+    stack[stackSize++] = QuadNode{ GetQuadtreeLevelCount() - 1, 0, 0 };
+
+    while (stackSize > 0)
+    {
+        const QuadNode node = stack[--stackSize];
+        float enter = 0.0f;
+        float exit = 0.0f;
+        if (!NodeRayInterval(node, origin, inverseDirection, maxDistance, enter, exit))
+        {
+            continue;
+        }
+
+        if (node.level <= HEIGHTFIELD_RAY_WALK_LEVEL)
+        {
+            if (WalkCells(node, origin, unitDirection, enter, exit, maxDistance, outHit))
+            {
+                return true;
+            }
+            continue;
+        }
+
+        const int childLevel = node.level - 1;
+        for (int order = 3; order >= 0 && stackSize < HEIGHTFIELD_QUERY_STACK_SIZE; --order)
+        {
+            const int childX = node.x * 2 + ((order & 1) ^ nearX);
+            const int childZ = node.z * 2 + ((order >> 1) ^ nearZ);
+            if (childX < m_levelWidths[childLevel] && childZ < m_levelDepths[childLevel])
+            {
+                stack[stackSize++] = QuadNode{ childLevel, childX, childZ };
+            }
+        }
+    }
+
+    return false;
+}
+
+bool PhysicsHeightfield::OverlapsSphereBounds(const PhysicsVector3D& center, float radius) const
+{
+    // Nothing below the surface is open, so the bounds extend downwards without limit
+    return IsValid() &&
+        center.x + radius >= m_origin.x && center.x - radius <= m_origin.x + (m_width - 1) * m_cellSize &&
+        center.z + radius >= m_origin.z && center.z - radius <= m_origin.z + (m_depth - 1) * m_cellSize &&
+        center.y - radius <= m_maxHeight;
+}
+
+void PhysicsHeightfield::CollideSphereCell(int cellX, int cellZ, const PhysicsVector3D& center, float radius, ContactPoint* contacts,
+    int maxContacts, int& contactCount) const
+{
+    PhysicsVector3D corners[4];
+    GetCellCorners(cellX, cellZ, corners);
+    const int triangleCorners[2][3] = { { 0, 1, 3 }, { 0, 3, 2 } };
+
+    for (int triangle = 0; triangle < 2; ++triangle)
+    {
+        const int* corner = triangleCorners[triangle];
+        const PhysicsVector3D closest = ClosestPointOnTriangle(center, corners[corner[0]], corners[corner[1]], corners[corner[2]]);
+        const PhysicsVector3D offset = center - closest;
+        const float distanceSquared = offset.MagnitudeSquared();
+        if (distanceSquared >= radius * radius)
+        {
+            continue;
+        }
+
+        // Centres behind a face are handled by the solid-below test or by a neighbouring face
+        const PhysicsVector3D faceNormal = HeightfieldTriangleNormal(corners, triangle, m_inverseCellSize);
+        if (offset.Dot(faceNormal) < 0.0f)
+        {
+            continue;
+        }
+
+        const float distance = std::sqrt(distanceSquared);
+        ContactPoint contact;
+        contact.position = closest;
+        contact.normal = (distance > MIN_VELOCITY_THRESHOLD) ? offset * (1.0f / distance) : faceNormal;
+        contact.penetrationDepth = radius - distance;
+        contact.restitution = m_restitution;
+        contact.friction = m_friction;
+        contact.featureId = (cellZ * (m_width - 1) + cellX) * 2 + triangle;
+        AddHeightfieldContact(contact, contacts, maxContacts, contactCount);
+    }
+}
+
+int PhysicsHeightfield::CollideSphere(const PhysicsVector3D& center, float radius, ContactPoint* outContacts, int maxContacts) const
+{
+    if (maxContacts <= 0 || !OverlapsSphereBounds(center, radius))
+    {
+        return 0;
+    }
+
+    int cellX, cellZ;
+    float tx, tz;
+    LocateCell(center.x, center.z, cellX, cellZ, tx, tz);
+    const int cellsX = m_width - 1;
+    const int cellsZ = m_depth - 1;
+
+    // Centre under the surface - the terrain is solid, so push out along the surface normal
+    const float localX = (center.x - m_origin.x) * m_inverseCellSize;
+    const float localZ = (center.z - m_origin.z) * m_inverseCellSize;
+    if (localX >= 0.0f && localX <= cellsX && localZ >= 0.0f && localZ <= cellsZ)
+    {
+        const float height = GetHeight(center.x, center.z);
+        if (center.y < height)
+        {
+            PhysicsVector3D corners[4];
+            GetCellCorners(cellX, cellZ, corners);
+            const int triangle = (tx >= tz) ? 0 : 1;
+
+            ContactPoint& contact = outContacts[0];
+            contact = ContactPoint();
+            contact.normal = HeightfieldTriangleNormal(corners, triangle, m_inverseCellSize);
+            contact.position = PhysicsVector3D(center.x, height, center.z);
+            contact.penetrationDepth = (height - center.y) * contact.normal.y + radius;
+            contact.restitution = m_restitution;
+            contact.friction = m_friction;
+            contact.featureId = (cellZ * cellsX + cellX) * 2 + triangle;
+            return 1;
+        }
+    }
+
+    // Cells under the sphere's footprint
+    const int minCellX = std::clamp(static_cast<int>(std::floor((center.x - radius - m_origin.x) * m_inverseCellSize)), 0, cellsX - 1);
+    const int maxCellX = std::clamp(static_cast<int>(std::floor((center.x + radius - m_origin.x) * m_inverseCellSize)), 0, cellsX - 1);
+    const int minCellZ = std::clamp(static_cast<int>(std::floor((center.z - radius - m_origin.z) * m_inverseCellSize)), 0, cellsZ - 1);
+    const int maxCellZ = std::clamp(static_cast<int>(std::floor((center.z + radius - m_origin.z) * m_inverseCellSize)), 0, cellsZ - 1);
+
+    // Start at the finest level where the footprint spans at most 2x2 nodes
+    int level = 0;
+    while (level + 1 < GetQuadtreeLevelCount() &&
+        ((maxCellX >> level) - (minCellX >> level) > 1 || (maxCellZ >> level) - (minCellZ >> level) > 1))
+    {
+        ++level;
+    }
+
+    QuadNode stack[HEIGHTFIELD_QUERY_STACK_SIZE];
+    int stackSize = 0;
+    for (int nodeZ = minCellZ >> level; nodeZ <= (maxCellZ >> level); ++nodeZ)
+    {
+        for (int nodeX = minCellX >> level; nodeX <= (maxCellX >> level); ++nodeX)
+        {
+            stack[stackSize++] = QuadNode{ level, nodeX, nodeZ };
+        }
+    }
+
+    // Nodes whose height range lies entirely above or below the sphere cannot touch it
+    int contactCount = 0;
+    while (stackSize > 0)
+    {
+        const QuadNode node = stack[--stackSize];
+        const HeightRange& range = GetRange(node.level, node.x, node.z);
+        if (range.maxHeight < center.y - radius || range.minHeight > center.y + radius)
+        {
+            continue;
+        }
+
+        if (node.level == 0)
+        {
+            CollideSphereCell(node.x, node.z, center, radius, outContacts, maxContacts, contactCount);
+            continue;
+        }
+
+        const int childLevel = node.level - 1;
+        for (int child = 0; child < 4 && stackSize < HEIGHTFIELD_QUERY_STACK_SIZE; ++child)
+        {
+            const int childX = node.x * 2 + (child & 1);
+            const int childZ = node.z * 2 + (child >> 1);
+            if (childX < m_levelWidths[childLevel] && childZ < m_levelDepths[childLevel] &&
+                (childX << childLevel) <= maxCellX && ((childX + 1) << childLevel) > minCellX &&
+                (childZ << childLevel) <= maxCellZ && ((childZ + 1) << childLevel) > minCellZ)
+            {
+                stack[stackSize++] = QuadNode{ childLevel, childX, childZ };
+            }
+        }
+    }
+
+    return contactCount;
+}
+
+size_t PhysicsHeightfield::GetMemoryUsage() const
+{
+    return m_heights.capacity() * sizeof(float) + m_ranges.capacity() * sizeof(HeightRange) +
+        (m_levelOffsets.capacity() + m_levelWidths.capacity() + m_levelDepths.capacity()) * sizeof(int);
+}
+
+void PhysicsHeightfield::Serialize(PhysicsWorldWriter& writer) const
+{
+    writer.Write(static_cast<int32_t>(m_width));
+    writer.Write(static_cast<int32_t>(m_depth));
+    writer.Write(m_cellSize);
+    writer.Write(m_origin);
+    writer.Write(m_restitution);
+    writer.Write(m_friction);
+    writer.Write(m_collisionLayer);
+    writer.Write(m_collisionMask);
+    writer.WriteArray(m_heights);
+}
+
+bool PhysicsHeightfield::Deserialize(PhysicsWorldReader& reader)
+{
+    Clear();
+
+    int32_t width = 0;
+    int32_t depth = 0;
+    reader.Read(width);
+    reader.Read(depth);
+    reader.Read(m_cellSize);
+    reader.Read(m_origin);
+    reader.Read(m_restitution);
+    reader.Read(m_friction);
+    reader.Read(m_collisionLayer);
+    reader.Read(m_collisionMask);
+    reader.ReadArray(m_heights);
+    if (reader.HasFailed())
+    {
+        Clear();
+        return false;
+    }
+
+    // Removed heightfields keep their slot as an empty grid
+    if (m_heights.empty() && width == 0 && depth == 0)
+    {
+        return true;
+    }
+
+    // Heights are stored absolute, so only the quadtree and slope bound need rebuilding
+    if (!IsValidHeightfieldGrid(width, depth, m_cellSize) || m_heights.size() != static_cast<size_t>(width) * depth)
+    {
+        Clear();
+        return false;
+    }
+    m_width = width;
+    m_depth = depth;
+    return Finalize();
+}
+
+//==============================================================================
+// PhysicsProfiler Implementation
+//==============================================================================
+PhysicsProfiler::PhysicsProfiler()
+{
+    Reset();
+}
+
+void PhysicsProfiler::BeginStep()
+{
+    m_stepPhases.fill(0.0f);
+    m_stepCounters.fill(0.0f);
+}
+
+void PhysicsProfiler::EndStep()
+{
+    for (int phase = 0; phase < PHASE_COUNT; ++phase)
+    {
+        m_phaseSamples[phase][m_head] = m_stepPhases[phase];
+    }
+    for (int counter = 0; counter < COUNTER_COUNT; ++counter)
+    {
+        m_counterSamples[counter][m_head] = m_stepCounters[counter];
+    }
+
+    m_head = (m_head + 1) % PHYSICS_PROFILE_WINDOW;
+    m_sampleCount = std::min(m_sampleCount + 1, PHYSICS_PROFILE_WINDOW);
+}
+
+void PhysicsProfiler::Reset()
+{
+    m_stepPhases.fill(0.0f);
+    m_stepCounters.fill(0.0f);
+    for (SampleWindow& samples : m_phaseSamples)
+    {
+        samples.fill(0.0f);
+    }
+    for (SampleWindow& samples : m_counterSamples)
+    {
+        samples.fill(0.0f);
+    }
+    m_head = 0;
+    m_sampleCount = 0;
+}
+
+PhysicsProfileSeries PhysicsProfiler::GetPhaseSeries(PhysicsProfilePhase phase) const
+{
+    const int index = static_cast<int>(phase);
+    return (index >= 0 && index < PHASE_COUNT) ? Summarize(m_phaseSamples[index]) : PhysicsProfileSeries();
+}
+
+PhysicsProfileSeries PhysicsProfiler::GetCounterSeries(PhysicsProfileCounter counter) const
+{
+    const int index = static_cast<int>(counter);
+    return (index >= 0 && index < COUNTER_COUNT) ? Summarize(m_counterSamples[index]) : PhysicsProfileSeries();
+}
+
+PhysicsProfileSeries PhysicsProfiler::Summarize(const SampleWindow& samples) const
+{
+    PhysicsProfileSeries series;
+    if (m_sampleCount == 0)
+    {
+        return series;
+    }
+
+    // Until the ring has wrapped the valid samples are the first m_sampleCount slots
+    const int count = m_sampleCount;
+    series.last = samples[(m_head + PHYSICS_PROFILE_WINDOW - 1) % PHYSICS_PROFILE_WINDOW];
+    series.min = samples[0];
+    series.max = samples[0];
+    double sum = 0.0;
+    for (int i = 0; i < count; ++i)
+    {
+        series.min = std::min(series.min, samples[i]);
+        series.max = std::max(series.max, samples[i]);
+        sum += samples[i];
+    }
+    series.avg = static_cast<float>(sum / count);
+
+    // Nearest-rank percentile on a stack copy so the ring keeps its order
+    SampleWindow sorted;
+    std::copy(samples.begin(), samples.begin() + count, sorted.begin());
+    const int rank = std::max(1, static_cast<int>(std::ceil(0.99 * count)));
+    std::nth_element(sorted.begin(), sorted.begin() + (rank - 1), sorted.begin() + count);
+    series.p99 = sorted[rank - 1];
+
+    return series;
+}
+
+const char* PhysicsProfiler::GetPhaseName(PhysicsProfilePhase phase)
+{
+    switch (phase)
+    {
+    case PhysicsProfilePhase::Integrate:           return "Integrate";
+    case PhysicsProfilePhase::DynamicTree:         return "DynamicTree";
+    case PhysicsProfilePhase::ContinuousCollision: return "ContinuousCollision";
+    case PhysicsProfilePhase::BroadPhase:          return "BroadPhase";
+    case PhysicsProfilePhase::NarrowPhase:         return "NarrowPhase";
+    case PhysicsProfilePhase::Islands:             return "Islands";
+    case PhysicsProfilePhase::Solver:              return "Solver";
+    case PhysicsProfilePhase::Sleep:               return "Sleep";
+    case PhysicsProfilePhase::Ragdolls:            return "Ragdolls";
+    case PhysicsProfilePhase::Step:                return "Step";
+    default:                                       return "Unknown";
+    }
+}
+
+const char* PhysicsProfiler::GetCounterName(PhysicsProfileCounter counter)
+{
+    switch (counter)
+    {
+    case PhysicsProfileCounter::AwakeBodies:      return "AwakeBodies";
+    case PhysicsProfileCounter::BroadPhasePairs:  return "BroadPhasePairs";
+    case PhysicsProfileCounter::TerrainPairs:     return "TerrainPairs";
+    case PhysicsProfileCounter::Manifolds:        return "Manifolds";
+    case PhysicsProfileCounter::Contacts:         return "Contacts";
+    case PhysicsProfileCounter::Islands:          return "Islands";
+    case PhysicsProfileCounter::SolverIterations: return "SolverIterations";
+    case PhysicsProfileCounter::SweptBodies:      return "SweptBodies";
+    case PhysicsProfileCounter::RagdollParticles: return "RagdollParticles";
+    default:                                      return "Unknown";
+    }
+}
+
+//==============================================================================
+// Physics Class Constructor and Destructor
+//==============================================================================
+Physics::Physics() :
+    m_bIsInitialized(false),
+    m_bHasCleanedUp(false),
+    m_gravityApproximationEnabled(false),
+    m_gravityTreeDirty(true),
+    m_gravityOpeningAngle(DEFAULT_GRAVITY_OPENING_ANGLE),
+    m_gravityExactFieldLimit(GRAVITY_TREE_MIN_FIELDS),
+    m_integrationPath(PhysicsSIMDPath::Scalar),
+    m_sleepingEnabled(true),
+    m_velocityIterations(DEFAULT_VELOCITY_ITERATIONS),
+    m_positionIterations(DEFAULT_POSITION_ITERATIONS),
+    m_fixedTimestepEnabled(false),
+    m_fixedTimestep(1.0f / DEFAULT_FIXED_TIMESTEP_HZ),
+    m_maxSubsteps(DEFAULT_MAX_SUBSTEPS),
+    m_accumulator(0.0f),
+    m_interpolationAlpha(1.0f),
+    m_stepCount(0),
+    m_continuousCollisionEnabled(true),
+    m_ccdMaxSubsteps(DEFAULT_CCD_SUBSTEPS),
+    m_ccdSweptBodyCount(0),
+    m_ccdImpactCount(0),
+    m_lastUpdateTime(0.0f),
+    m_activeBodyCount(0),
+    m_collisionCount(0),
+    m_sleepingBodyCount(0),
+    m_particleCount(0),
+    m_lastStepAllocationCount(0),
+    m_mathPrecalc(MathPrecalculation::GetInstance()),
+m_exceptionHandler(ExceptionHandler::GetInstance())
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   // Reserve memory for physics collections to avoid frequent reallocations
+   m_bodyStore.Reserve(1000);
+   m_gravityFields.reserve(10);
+   m_ragdollJoints.reserve(MAX_RAGDOLL_JOINTS);
+   m_frameArena.Reserve(DEFAULT_FRAME_ARENA_SIZE);
+   m_contactCache.Reserve(DEFAULT_CONTACT_CACHE_CAPACITY);
+   m_collisionManifolds.SetArena(&m_frameArena);
+   m_debugLines.reserve(1000);
+   
+#if defined(_DEBUG_PHYSICS_)
+   debug.logLevelMessage(LogLevel::LOG_INFO, L"[Physics] Constructor called - Memory reserved for physics systems");
+#endif
+}
+
+Physics::~Physics()
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   // Ensure cleanup is performed
+   if (!m_bHasCleanedUp.load())
+   {
+       Cleanup();
+   }
+   
+#if defined(_DEBUG_PHYSICS_)
+   debug.logLevelMessage(LogLevel::LOG_INFO, L"[Physics] Destructor called - All resources cleaned up");
+#endif
+}
+
+//==============================================================================
+// Initialization and Cleanup Methods
+//==============================================================================
+bool Physics::Initialize()
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   // Check if already initialized to prevent double initialization
+   if (m_bIsInitialized.load())
+   {
+#if defined(_DEBUG_PHYSICS_)
+       debug.logLevelMessage(LogLevel::LOG_WARNING, L"[Physics] Already initialized - skipping");
+#endif
+       return true;
+   }
+   
+   // Thread-safe initialization using mutex
+   std::lock_guard<std::mutex> lock(m_physicsMutex);
+   
+   // Double-check pattern to ensure thread safety
+   if (m_bIsInitialized.load())
+   {
+       return true;
+   }
+   
+#if defined(_DEBUG_PHYSICS_)
+   debug.logLevelMessage(LogLevel::LOG_INFO, L"[Physics] Starting initialization of physics systems");
+#endif
+   
+   try
+   {
+       // Initialize MathPrecalculation if not already done
+       if (!m_mathPrecalc.IsInitialized())
+       {
+           if (!m_mathPrecalc.Initialize())
+           {
+               throw std::runtime_error("Failed to initialize MathPrecalculation system");
+           }
+       }
+       
+       // Initialize exception handler if not already done
+       if (!m_exceptionHandler.Initialize())
+       {
+#if defined(_DEBUG_PHYSICS_)
+           debug.logLevelMessage(LogLevel::LOG_WARNING, L"[Physics] ExceptionHandler initialization failed, continuing without it");
+#endif
+       }
+       
+       // Initialize physics-specific precalculations
+       InitializePhysicsPrecalculations();
+       
+       // Allocate physics memory pools
+       AllocatePhysicsMemory();
+       
+       // Select the widest integration kernel the CPU supports
+       if (!SetIntegrationPath(PhysicsSIMDPath::AVX2) && !SetIntegrationPath(PhysicsSIMDPath::SSE2))
+       {
+           SetIntegrationPath(PhysicsSIMDPath::Scalar);
+       }
+       
+       // One island solver worker per spare hardware thread
+       const int hardwareThreads = static_cast<int>(std::thread::hardware_concurrency());
+       m_workerPool.Start(std::max(0, hardwareThreads - 1));
+       
+       // Reset performance counters
+       ResetPerformanceCounters();
+       
+       // Set global physics instance
+       g_pPhysics = this;
+       
+       // Mark as successfully initialized
+       m_bIsInitialized.store(true);
+       
+#if defined(_DEBUG_PHYSICS_)
+       debug.logDebugMessage(LogLevel::LOG_INFO, L"[Physics] Initialization completed successfully - Memory usage: %zu bytes", 
+                            GetPhysicsMemoryUsage());
+#endif
+       
+       return true;
+   }
+   catch (const std::exception& e)
+   {
+       // Convert exception message to wide string for logging
+       std::string errorMsg = e.what();
+       std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
+       
+       debug.logLevelMessage(LogLevel::LOG_CRITICAL, L"[Physics] Initialization failed with exception: " + wErrorMsg);
+       
+       // Clean up any partially initialized resources
+       Cleanup();
+       return false;
+   }
+   catch (...)
+   {
+       debug.logLevelMessage(LogLevel::LOG_CRITICAL, L"[Physics] Initialization failed with unknown exception");
+       
+       // Clean up any partially initialized resources
+       Cleanup();
+       return false;
+   }
+}
+
+void Physics::Cleanup()
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   // Check if already cleaned up
+   if (m_bHasCleanedUp.load())
+   {
+       return;
+   }
+   
+   // Thread-safe cleanup using mutex
+   std::lock_guard<std::mutex> lock(m_physicsMutex);
+   
+   // Double-check pattern to ensure thread safety
+   if (m_bHasCleanedUp.load())
+   {
+       return;
+   }
+   
+#if defined(_DEBUG_PHYSICS_)
+   debug.logLevelMessage(LogLevel::LOG_INFO, L"[Physics] Starting cleanup of physics systems");
+#endif
+   
+   // Stop island solver workers before releasing the data they reference
+   m_workerPool.Stop();
+   
+   // Deallocate physics memory
+   DeallocatePhysicsMemory();
+   
+   // Clear all physics collections
+   m_bodyStore.Clear();
+   m_gravityFields.clear();
+   m_gravityTree.Clear();
+   m_gravityTreeDirty = true;
+   m_ragdollJoints.clear();
+   m_ragdollSolver.Clear();
+   m_ragdollFieldGravity.clear();
+   m_ragdollHeightfields.clear();
+   m_collisionManifolds.clear();
+   m_debugLines.clear();
+   m_freeBodySlots.clear();
+   m_solverBodies.clear();
+   m_solverBodyIndices.clear();
+   m_solverSlots.clear();
+   m_manifoldSlots.clear();
+   m_islands.clear();
+   m_islandManifolds.clear();
+   m_islandJoints.clear();
+   m_islandParents.clear();
+   m_islandOfRoot.clear();
+   m_manifoldIslands.clear();
+   m_jointIslands.clear();
+   m_jointBodyNodes.clear();
+   m_islandSleepTimers.clear();
+   m_islandSleepHeads.clear();
+   m_contactCache.Clear();
+   m_broadPhasePairs.clear();
+   m_spatialHash.Clear();
+   m_bodyTree.Clear();
+   m_bodyProxies.clear();
+   m_heightfields.clear();
+   m_freeHeightfieldSlots.clear();
+   m_terrainHeights.clear();
+   m_terrainPairs.clear();
+   
+   // Shrink collections to free memory
+   m_gravityFields.shrink_to_fit();
+   m_ragdollJoints.shrink_to_fit();
+   m_frameArena.Release();
+   m_debugLines.shrink_to_fit();
+   
+   // Reset counters
+   m_activeBodyCount.store(0);
+   m_collisionCount.store(0);
+   m_sleepingBodyCount.store(0);
+   m_particleCount.store(0);
+   m_lastUpdateTime = 0.0f;
+   m_accumulator = 0.0f;
+   m_interpolationAlpha = 1.0f;
+   m_stepCount = 0;
+   
+   // Clear global physics instance
+   if (g_pPhysics == this)
+   {
+       g_pPhysics = nullptr;
+   }
+   
+   // Reset state flags
+   m_bIsInitialized.store(false);
+   m_bHasCleanedUp.store(true);
+   
+#if defined(_DEBUG_PHYSICS_)
+   debug.logLevelMessage(LogLevel::LOG_INFO, L"[Physics] Cleanup completed successfully");
+#endif
+}
+
+//==============================================================================
+// Main Physics Update Method
+//==============================================================================
+void Physics::Update(float deltaTime)
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   // Ensure physics system is initialized
+   if (!m_bIsInitialized.load())
+   {
+#if defined(_DEBUG_PHYSICS_)
+       debug.logLevelMessage(LogLevel::LOG_WARNING, L"[Physics] Update called before initialization");
+#endif
+       return;
+   }
+   
+   // Measure update time for performance profiling
    auto startTime = std::chrono::high_resolution_clock::now();
    
    try
    {
-       // Thread-safe update using mutex
-       std::lock_guard<std::mutex> lock(m_physicsMutex);
+       // Thread-safe update using mutex
+       std::lock_guard<std::mutex> lock(m_physicsMutex);
+       
+       if (!m_fixedTimestepEnabled)
+       {
+           StepSimulation(deltaTime);
+           m_interpolationAlpha = 1.0f;
+       }
+       else
+       {
+           // Cap the backlog so a long frame cannot demand ever more steps (spiral of death)
+           m_accumulator = std::min(m_accumulator + std::max(deltaTime, 0.0f), m_fixedTimestep * m_maxSubsteps);
+           
+           while (m_accumulator >= m_fixedTimestep)
+           {
+               m_bodyStore.CapturePreviousPositions();
+               StepSimulation(m_fixedTimestep);
+               m_accumulator -= m_fixedTimestep;
+           }
+           
+           m_interpolationAlpha = m_accumulator / m_fixedTimestep;
+       }
+   }
+   catch (const std::exception& e)
+   {
+       // Log exception and continue (don't crash the game)
+       std::string errorMsg = e.what();
+       std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
+       
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Exception during update: " + wErrorMsg);
+       
+       // Record exception for debugging
+       m_exceptionHandler.LogException(e, "Physics::Update");
+   }
+   catch (...)
+   {
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Unknown exception during update");
+       
+       // Record unknown exception
+       m_exceptionHandler.LogCustomException("Unknown exception in Physics::Update", "Physics::Update");
+   }
+   
+   // Calculate update time
+   auto endTime = std::chrono::high_resolution_clock::now();
+   auto duration = std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime);
+   m_lastUpdateTime = duration.count() / 1000.0f; // Convert to milliseconds
+}
+
+void Physics::StepSimulation(float deltaTime)
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   // Caller holds m_physicsMutex and handles exceptions
+   
+#if defined(PHYSICS_PROFILING_ENABLED)
+   m_profiler.BeginStep();
+#endif
+   PHYSICS_PROFILE_BEGIN(Step);
+   
+#if defined(_DEBUG_PHYSICS_ALLOCATIONS_)
+   const uint64_t allocationsBefore = g_physicsAllocationCount.load(std::memory_order_relaxed);
+   t_countPhysicsAllocations = true;
+#endif
+   
+   // Positions before integration are where continuous collision sweeps start
+   if (m_continuousCollisionEnabled)
+   {
+       m_ccdStartX.assign(m_bodyStore.positionX.begin(), m_bodyStore.positionX.end());
+       m_ccdStartY.assign(m_bodyStore.positionY.begin(), m_bodyStore.positionY.end());
+       m_ccdStartZ.assign(m_bodyStore.positionZ.begin(), m_bodyStore.positionZ.end());
+   }
+   
+   // Apply gravity and integrate every body through the SoA kernels
+   PHYSICS_PROFILE_BEGIN(Integrate);
+   IntegrateBodies(deltaTime);
+   PHYSICS_PROFILE_END(Integrate);
+   
+   int activeBodies = 0;
+   for (size_t i = 0; i < m_bodyStore.Size(); ++i)
+   {
+       activeBodies += m_bodyStore.IsSimulated(static_cast<int>(i)) ? 1 : 0;
+   }
+   
+   // Update active body count
+   m_activeBodyCount.store(activeBodies);
+   
+   // Refit the query tree with the integrated positions
+   PHYSICS_PROFILE_BEGIN(DynamicTree);
+   UpdateDynamicTree(deltaTime);
+   PHYSICS_PROFILE_END(DynamicTree);
+   
+   // Fast bodies are swept so they cannot pass through what they hit during the step
+   if (m_continuousCollisionEnabled)
+   {
+       PHYSICS_PROFILE_BEGIN(ContinuousCollision);
+       SolveContinuousCollisions(deltaTime);
+       PHYSICS_PROFILE_END(ContinuousCollision);
+   }
+   
+   // Perform collision detection and response
+   PHYSICS_PROFILE_BEGIN(BroadPhase);
+   BroadPhaseCollisionDetection();
+   PHYSICS_PROFILE_END(BroadPhase);
+   
+   PHYSICS_PROFILE_BEGIN(NarrowPhase);
+   NarrowPhaseCollisionDetection();
+   PHYSICS_PROFILE_END(NarrowPhase);
+   
+   // Sleeping bodies touched by an awake body rejoin the simulation
+   PHYSICS_PROFILE_BEGIN(Islands);
+   WakeTouchedBodies();
+   
+   int collisionCount = static_cast<int>(m_collisionManifolds.size());
+   m_collisionCount.store(collisionCount);
+   
+   // Split manifolds and ragdoll joints into independent islands
+   BuildIslands();
+   PHYSICS_PROFILE_END(Islands);
+   
+   // Islands share no bodies, so they can be solved concurrently and each island's
+   // result is independent of scheduling
+   const int islandCount = static_cast<int>(m_islands.size());
+   const size_t constraintCount = m_collisionManifolds.size() + m_islandJoints.size();
+   const PhysicsWorkerPool::TaskFunction solveTask = [this](int islandIndex) {
+       SolveIsland(m_islands[islandIndex]);
+   };
+   
+   PHYSICS_PROFILE_BEGIN(Solver);
+   if (islandCount > 1 && constraintCount >= static_cast<size_t>(MIN_CONSTRAINTS_FOR_PARALLEL_SOLVE))
+   {
+       m_workerPool.ParallelFor(islandCount, solveTask);
+   }
+   else
+   {
+       for (int islandIndex = 0; islandIndex < islandCount; ++islandIndex)
+       {
+           solveTask(islandIndex);
+       }
+   }
+   
+   // Keep the accumulated impulses for warm starting the next step
+   StoreContactImpulses();
+   PHYSICS_PROFILE_END(Solver);
+   
+   // Put islands that have rested long enough to sleep, then write solver results back
+   PHYSICS_PROFILE_BEGIN(Sleep);
+   UpdateSleepState(deltaTime);
+   ScatterSolverBodies();
+   PHYSICS_PROFILE_END(Sleep);
+   
+   // XPBD ragdolls do not touch world bodies and run their own substeps
+   PHYSICS_PROFILE_BEGIN(Ragdolls);
+   StepRagdolls(deltaTime);
+   PHYSICS_PROFILE_END(Ragdolls);
+   
+#if defined(PHYSICS_PROFILING_ENABLED)
+   int contactCount = 0;
+   for (const CollisionManifold& manifold : m_collisionManifolds)
+   {
+       contactCount += static_cast<int>(manifold.contacts.size());
+   }
+   PHYSICS_PROFILE_COUNTER(AwakeBodies, activeBodies - m_sleepingBodyCount.load());
+   PHYSICS_PROFILE_COUNTER(BroadPhasePairs, m_broadPhasePairs.size());
+   PHYSICS_PROFILE_COUNTER(TerrainPairs, m_terrainPairs.size());
+   PHYSICS_PROFILE_COUNTER(Manifolds, collisionCount);
+   PHYSICS_PROFILE_COUNTER(Contacts, contactCount);
+   PHYSICS_PROFILE_COUNTER(Islands, islandCount);
+   PHYSICS_PROFILE_COUNTER(SolverIterations, constraintCount * static_cast<size_t>(m_velocityIterations + m_positionIterations));
+   PHYSICS_PROFILE_COUNTER(SweptBodies, m_continuousCollisionEnabled ? m_ccdBodies.size() : 0);
+   PHYSICS_PROFILE_COUNTER(RagdollParticles, m_ragdollSolver.GetParticleCount());
+#endif
+   
+   // Clear collision manifolds for next frame
+   m_collisionManifolds.clear();
+   
+#if defined(_DEBUG_PHYSICS_ALLOCATIONS_)
+   // Workers have joined, so every allocation of this step has been counted
+   t_countPhysicsAllocations = false;
+   m_lastStepAllocationCount = g_physicsAllocationCount.load(std::memory_order_relaxed) - allocationsBefore;
+   
+   // Growth (more bodies, pairs, cells or cached contacts than ever before) may allocate -
+   // a steady-state step must not
+   const bool grew = UpdateStepHighWaterMarks();
+   if (!grew && m_stepCount > 0 && m_lastStepAllocationCount > 0)
+   {
+       debug.logDebugMessage(LogLevel::LOG_WARNING, L"[Physics] Steady-state step %llu made %llu heap allocations",
+           static_cast<unsigned long long>(m_stepCount), static_cast<unsigned long long>(m_lastStepAllocationCount));
+       assert(m_lastStepAllocationCount == 0 && "Physics step allocated from the heap in steady state");
+   }
+#endif
+   
+#if defined(_DEBUG_PHYSICS_)
+   if (activeBodies > 0 || collisionCount > 0)
+   {
+       debug.logDebugMessage(LogLevel::LOG_DEBUG, L"[Physics] Updated %d active bodies, %d collisions", 
+                            activeBodies, collisionCount);
+   }
+#endif
+   
+   m_stepCount++;
+   
+   PHYSICS_PROFILE_END(Step);
+#if defined(PHYSICS_PROFILING_ENABLED)
+   m_profiler.EndStep();
+#endif
+}
+
+#if defined(_DEBUG_PHYSICS_ALLOCATIONS_)
+bool Physics::UpdateStepHighWaterMarks()
+{
+   StepHighWaterMarks& marks = m_stepHighWaterMarks;
+   bool grew = false;
+   
+   auto raise = [&grew](size_t& mark, size_t value) {
+       if (value > mark)
+       {
+           mark = value;
+           grew = true;
+       }
+   };
+   raise(marks.bodyCount, m_bodyStore.Size());
+   raise(marks.jointCount, m_ragdollJoints.size());
+   raise(marks.gravityFieldCount, m_gravityFields.size());
+   raise(marks.ragdollParticleCount, static_cast<size_t>(m_ragdollSolver.GetParticleCount()));
+   raise(marks.pairCount, m_broadPhasePairs.size());
+   raise(marks.sweptBodyCount, m_ccdBodies.size());
+   raise(marks.terrainPairCount, m_terrainPairs.size());
+   raise(marks.candidateCount, m_manifoldSlots.size());
+   raise(marks.manifoldCount, static_cast<size_t>(m_collisionCount.load()));
+   raise(marks.solverNodeCount, m_islandParents.size());
+   raise(marks.islandCount, m_islands.size());
+   
+   // Counters only move forward - any change means new storage was allocated this step
+   auto advance = [&grew](uint64_t& mark, uint64_t value) {
+       if (value != mark)
+       {
+           mark = value;
+           grew = true;
+       }
+   };
+   advance(marks.arenaBlocks, m_frameArena.GetBlockAllocationCount());
+   advance(marks.hashCellAllocations, m_spatialHash.GetCellAllocationCount());
+   advance(marks.contactCacheGrowths, m_contactCache.GetGrowthCount());
+   
+   return grew;
+}
+#endif
+
+void Physics::SetFixedTimestep(bool enabled, float stepsPerSecond, int maxSubsteps)
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   std::lock_guard<std::mutex> lock(m_physicsMutex);
+   
+   m_fixedTimestepEnabled = enabled;
+   m_fixedTimestep = 1.0f / std::clamp(stepsPerSecond, MIN_FIXED_TIMESTEP_HZ, MAX_FIXED_TIMESTEP_HZ);
+   m_maxSubsteps = std::max(1, maxSubsteps);
+   m_accumulator = 0.0f;
+   m_interpolationAlpha = 1.0f;
+   
+   // Start interpolating from the current state
+   m_bodyStore.CapturePreviousPositions();
+   
+#if defined(_DEBUG_PHYSICS_)
+   debug.logDebugMessage(LogLevel::LOG_INFO, L"[Physics] Fixed timestep %s - %.1f Hz, %d max substeps",
+       enabled ? L"enabled" : L"disabled", 1.0f / m_fixedTimestep, m_maxSubsteps);
+#endif
+}
+
+void Physics::SetContinuousCollision(bool enabled, int maxSubsteps)
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   std::lock_guard<std::mutex> lock(m_physicsMutex);
+   
+   m_continuousCollisionEnabled = enabled;
+   m_ccdMaxSubsteps = std::clamp(maxSubsteps, 1, MAX_CCD_SUBSTEPS);
+   if (!enabled)
+   {
+       m_ccdSweptBodyCount.store(0);
+       m_ccdImpactCount.store(0);
+   }
+   
+#if defined(_DEBUG_PHYSICS_)
+   debug.logDebugMessage(LogLevel::LOG_INFO, L"[Physics] Continuous collision %s - %d substeps",
+       enabled ? L"enabled" : L"disabled", m_ccdMaxSubsteps);
+#endif
+}
+
+void Physics::GetContinuousCollisionStatistics(int& sweptBodyCount, int& impactCount) const
+{
+   sweptBodyCount = m_ccdSweptBodyCount.load();
+   impactCount = m_ccdImpactCount.load();
+}
+
+PhysicsVector3D Physics::GetInterpolatedPosition(int bodyIndex) const
+{
+   std::lock_guard<std::mutex> lock(m_physicsMutex);
+   
+   if (bodyIndex < 0 || static_cast<size_t>(bodyIndex) >= m_bodyStore.Size())
+   {
+       return PhysicsVector3D();
+   }
+   
+   const PhysicsVector3D previous = m_bodyStore.GetPreviousPosition(bodyIndex);
+   return previous + (m_bodyStore.GetPosition(bodyIndex) - previous) * m_interpolationAlpha;
+}
+
+void Physics::GetInterpolatedPositions(std::vector<PhysicsVector3D>& outPositions) const
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   std::lock_guard<std::mutex> lock(m_physicsMutex);
+   
+   // Indexed by body index - unused slots hold their last stored position
+   const size_t bodyCount = m_bodyStore.Size();
+   const float alpha = m_interpolationAlpha;
+   outPositions.resize(bodyCount);
+   for (size_t i = 0; i < bodyCount; ++i)
+   {
+       outPositions[i].x = m_bodyStore.previousPositionX[i] + (m_bodyStore.positionX[i] - m_bodyStore.previousPositionX[i]) * alpha;
+       outPositions[i].y = m_bodyStore.previousPositionY[i] + (m_bodyStore.positionY[i] - m_bodyStore.previousPositionY[i]) * alpha;
+       outPositions[i].z = m_bodyStore.previousPositionZ[i] + (m_bodyStore.positionZ[i] - m_bodyStore.previousPositionZ[i]) * alpha;
+   }
+}
+
+void Physics::SaveSnapshot(PhysicsWorldSnapshot& snapshot) const
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   std::lock_guard<std::mutex> lock(m_physicsMutex);
+   
+   snapshot.bodies = m_bodyStore;
+   snapshot.freeBodySlots = m_freeBodySlots;
+   snapshot.contactCache = m_contactCache;
+   snapshot.ragdolls = m_ragdollSolver;
+   snapshot.accumulator = m_accumulator;
+   snapshot.stepCount = m_stepCount;
+}
+
+bool Physics::RestoreSnapshot(const PhysicsWorldSnapshot& snapshot)
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   try
+   {
+       std::lock_guard<std::mutex> lock(m_physicsMutex);
+       
+       const size_t previousBodyCount = m_bodyStore.Size();
+       m_bodyStore = snapshot.bodies;
+       m_freeBodySlots = snapshot.freeBodySlots;
+       m_contactCache = snapshot.contactCache;
+       m_ragdollSolver = snapshot.ragdolls;
+       m_accumulator = snapshot.accumulator;
+       m_stepCount = snapshot.stepCount;
+       m_interpolationAlpha = m_fixedTimestepEnabled ? (m_accumulator / m_fixedTimestep) : 1.0f;
+       m_collisionManifolds.clear();
+       
+       // Bodies beyond the restored range leave the acceleration structures
+       for (size_t i = m_bodyStore.Size(); i < previousBodyCount; ++i)
+       {
+           m_spatialHash.RemoveBody(static_cast<int>(i));
+           if (i < m_bodyProxies.size() && m_bodyProxies[i] != PhysicsDynamicTree::NULL_NODE)
+           {
+               m_bodyTree.DestroyProxy(m_bodyProxies[i]);
+               m_bodyProxies[i] = PhysicsDynamicTree::NULL_NODE;
+           }
+       }
+       
+       // Resynchronise the rest with the restored positions
+       for (size_t i = 0; i < m_bodyStore.Size(); ++i)
+       {
+           SyncBodyProxy(static_cast<int>(i), PhysicsVector3D());
+       }
+       UpdateSpatialHash();
+       
+       int sleepingBodies = 0;
+       for (size_t i = 0; i < m_bodyStore.Size(); ++i)
+       {
+           sleepingBodies += (m_bodyStore.IsSimulated(static_cast<int>(i)) && m_bodyStore.IsSleeping(static_cast<int>(i))) ? 1 : 0;
+       }
+       m_sleepingBodyCount.store(sleepingBodies);
+       
+       return true;
+   }
+   catch (const std::exception& e)
+   {
+       std::string errorMsg = e.what();
+       std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error restoring world snapshot: " + wErrorMsg);
+       return false;
+   }
+}
+
+//==============================================================================
+// World Serialization
+//==============================================================================
+// Section tags catch truncated or mismatched images before their data is trusted
+static constexpr uint32_t MakeWorldSectionTag(char a, char b, char c, char d)
+{
+    return static_cast<uint32_t>(a) | (static_cast<uint32_t>(b) << 8) | (static_cast<uint32_t>(c) << 16) | (static_cast<uint32_t>(d) << 24);
+}
+
+static constexpr uint32_t WORLD_SECTION_SETTINGS = MakeWorldSectionTag('S', 'E', 'T', 'T');
+static constexpr uint32_t WORLD_SECTION_GRAVITY = MakeWorldSectionTag('G', 'R', 'A', 'V');
+static constexpr uint32_t WORLD_SECTION_TERRAIN = MakeWorldSectionTag('T', 'E', 'R', 'R');
+static constexpr uint32_t WORLD_SECTION_BODIES = MakeWorldSectionTag('B', 'O', 'D', 'Y');
+static constexpr uint32_t WORLD_SECTION_CONTACTS = MakeWorldSectionTag('C', 'A', 'C', 'H');
+static constexpr uint32_t WORLD_SECTION_RAGDOLLS = MakeWorldSectionTag('R', 'A', 'G', 'D');
+static constexpr uint32_t WORLD_SECTION_PARTICLES = MakeWorldSectionTag('P', 'A', 'R', 'T');
+
+static constexpr uint32_t WORLD_FLAG_PUNPACKED = 1u << 0;                      // Payload is PUNPack compressed
+
+// Fixed-size header in front of the payload - the stored sizes and checksums describe the PUNPack
+// packet when the payload is compressed
+struct PhysicsWorldFileHeader {
+    uint32_t magic;                                                             // PHYSICS_WORLD_FILE_MAGIC
+    uint32_t version;                                                           // Layout version of the payload
+    uint32_t flags;                                                             // WORLD_FLAG_* bits
+    uint32_t compressionType;                                                   // PUNPack CompressionType of the stored payload
+    uint64_t payloadSize;                                                       // Decoded payload bytes
+    uint64_t storedSize;                                                        // Payload bytes following the header
+    uint32_t payloadChecksum;                                                   // CRC32 of the decoded payload (compressed images only)
+    uint32_t storedChecksum;                                                    // CRC32 of the stored payload (compressed images only)
+};
+static_assert(sizeof(PhysicsWorldFileHeader) == 40, "PhysicsWorldFileHeader must not contain padding");
+
+bool Physics::SerializeWorld(std::vector<uint8_t>& outData, bool compress,
+                             const std::vector<const PhysicsParticlePool*>& particlePools) const
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   try
+   {
+       for (const PhysicsParticlePool* pool : particlePools)
+       {
+           if (!pool)
+           {
+               debug.logLevelMessage(LogLevel::LOG_WARNING, L"[Physics] Cannot serialize world with a null particle pool");
+               return false;
+           }
+       }
+       
+       // The payload is written straight after a header placeholder, so uncompressed images need no extra copy
+       PhysicsWorldFileHeader header = {};
+       outData.clear();
+       PhysicsWorldWriter writer(outData);
+       writer.Write(header);
+       
+       {
+           std::lock_guard<std::mutex> lock(m_physicsMutex);
+           
+           writer.Write(WORLD_SECTION_SETTINGS);
+           writer.Write(static_cast<uint8_t>(m_fixedTimestepEnabled ? 1 : 0));
+           writer.Write(m_fixedTimestep);
+           writer.Write(static_cast<int32_t>(m_maxSubsteps));
+           writer.Write(m_accumulator);
+           writer.Write(m_stepCount);
+           writer.Write(static_cast<uint8_t>(m_sleepingEnabled ? 1 : 0));
+           writer.Write(static_cast<int32_t>(m_velocityIterations));
+           writer.Write(static_cast<int32_t>(m_positionIterations));
+           writer.Write(static_cast<uint8_t>(m_continuousCollisionEnabled ? 1 : 0));
+           writer.Write(static_cast<int32_t>(m_ccdMaxSubsteps));
+           writer.Write(static_cast<uint8_t>(m_gravityApproximationEnabled ? 1 : 0));
+           writer.Write(m_gravityOpeningAngle);
+           writer.Write(static_cast<int32_t>(m_gravityExactFieldLimit));
+           writer.Write(m_spatialHash.GetCellSize());
+           
+           writer.Write(WORLD_SECTION_GRAVITY);
+           writer.Write(static_cast<uint32_t>(m_gravityFields.size()));
+           for (const GravityField& field : m_gravityFields)
+           {
+               writer.Write(field.center);
+               writer.Write(field.mass);
+               writer.Write(field.radius);
+               writer.Write(field.intensity);
+               writer.Write(static_cast<uint8_t>(field.isBlackHole ? 1 : 0));
+           }
+           
+           writer.Write(WORLD_SECTION_TERRAIN);
+           writer.Write(static_cast<uint32_t>(m_heightfields.size()));
+           for (const PhysicsHeightfield& heightfield : m_heightfields)
+           {
+               heightfield.Serialize(writer);
+           }
+           writer.WriteArray(m_freeHeightfieldSlots);
+           
+           writer.Write(WORLD_SECTION_BODIES);
+           m_bodyStore.Serialize(writer);
+           writer.WriteArray(m_freeBodySlots);
+           m_bodyTree.Serialize(writer);
+           writer.WriteArray(m_bodyProxies);
+           
+           writer.Write(WORLD_SECTION_CONTACTS);
+           m_contactCache.Serialize(writer);
+           
+           writer.Write(WORLD_SECTION_RAGDOLLS);
+           m_ragdollSolver.Serialize(writer);
+       }
+       
+       // Particle pools are owned by the caller and not guarded by the physics lock
+       writer.Write(WORLD_SECTION_PARTICLES);
+       writer.Write(static_cast<uint32_t>(particlePools.size()));
+       for (const PhysicsParticlePool* pool : particlePools)
+       {
+           pool->Serialize(writer);
+       }
+       
+       header.magic = PHYSICS_WORLD_FILE_MAGIC;
+       header.version = PHYSICS_WORLD_FILE_VERSION;
+       header.compressionType = static_cast<uint32_t>(CompressionType::NONE);
+       header.payloadSize = outData.size() - sizeof(header);
+       header.storedSize = header.payloadSize;
+       
+       // Keep the packed payload only when it is actually smaller
+       if (compress && header.payloadSize >= PUNPACK_MIN_COMPRESS_SIZE)
+       {
+           PUNPack packer;
+           if (packer.Initialize())
+           {
+               const PackResult packed = packer.PackBuffer(outData.data() + sizeof(header), static_cast<size_t>(header.payloadSize),
+                                                           CompressionType::RLE, false);
+               if (packed.IsValid() && packed.compressedData.size() < header.payloadSize)
+               {
+                   header.flags |= WORLD_FLAG_PUNPACKED;
+                   header.compressionType = static_cast<uint32_t>(packed.compressionType);
+                   header.storedSize = packed.compressedData.size();
+                   header.payloadChecksum = packed.checksum;
+                   header.storedChecksum = packed.compressedChecksum;
+                   outData.resize(sizeof(header));
+                   outData.insert(outData.end(), packed.compressedData.begin(), packed.compressedData.end());
+               }
+           }
+       }
+       std::memcpy(outData.data(), &header, sizeof(header));
+       
+#if defined(_DEBUG_PHYSICS_)
+       debug.logDebugMessage(LogLevel::LOG_INFO, L"[Physics] Serialized world - %zu bytes (%llu byte payload%ls)",
+                            outData.size(), static_cast<unsigned long long>(header.payloadSize),
+                            (header.flags & WORLD_FLAG_PUNPACKED) ? L", PUNPack compressed" : L"");
+#endif
+       return true;
+   }
+   catch (const std::exception& e)
+   {
+       outData.clear();
+       std::string errorMsg = e.what();
+       std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error serializing world: " + wErrorMsg);
+       return false;
+   }
+}
+
+bool Physics::DeserializeWorld(const uint8_t* data, size_t size, const std::vector<PhysicsParticlePool*>& particlePools)
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   try
+   {
+       PhysicsWorldFileHeader header = {};
+       if (!data || size < sizeof(header))
+       {
+           debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] World image is too small to hold a header");
+           return false;
+       }
+       std::memcpy(&header, data, sizeof(header));
+       
+       // Older layouts would be upgraded here - newer ones cannot be read
+       if (header.magic != PHYSICS_WORLD_FILE_MAGIC || header.version == 0 || header.version > PHYSICS_WORLD_FILE_VERSION ||
+           header.storedSize > size - sizeof(header))
+       {
+           debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] World image header mismatch (wrong file, newer version or truncated)");
+           return false;
+       }
+       for (const PhysicsParticlePool* pool : particlePools)
+       {
+           if (!pool)
+           {
+               debug.logLevelMessage(LogLevel::LOG_WARNING, L"[Physics] Cannot deserialize world into a null particle pool");
+               return false;
+           }
+       }
+       
+       // Uncompressed payloads are decoded in place, compressed ones are unpacked first
+       const uint8_t* payload = data + sizeof(header);
+       UnpackResult unpacked;
+       if (header.flags & WORLD_FLAG_PUNPACKED)
+       {
+           PUNPack packer;
+           PackResult packed;
+           packed.compressionType = static_cast<CompressionType>(header.compressionType);
+           packed.originalSize = static_cast<size_t>(header.payloadSize);
+           packed.compressedSize = static_cast<size_t>(header.storedSize);
+           packed.checksum = header.payloadChecksum;
+           packed.compressedChecksum = header.storedChecksum;
+           packed.compressedData.assign(payload, payload + header.storedSize);
+           
+           if (packer.Initialize())
+           {
+               unpacked = packer.UnpackBuffer(packed);
+           }
+           if (!unpacked.success)
+           {
+               std::wstring wErrorMsg(unpacked.errorMessage.begin(), unpacked.errorMessage.end());
+               debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] World image could not be unpacked: " + wErrorMsg);
+               return false;
+           }
+           payload = unpacked.data.data();
+       }
+       else if (header.payloadSize != header.storedSize)
+       {
+           debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] World image payload size mismatch");
+           return false;
+       }
+       
+       PhysicsWorldReader reader(payload, static_cast<size_t>(header.payloadSize));
+       
+       // Decode into staging storage first - the world is only replaced once every section is valid
+       uint8_t fixedTimestepEnabled = 0;
+       float fixedTimestep = 0.0f;
+       int32_t maxSubsteps = 0;
+       float accumulator = 0.0f;
+       uint64_t stepCount = 0;
+       uint8_t sleepingEnabled = 0;
+       int32_t velocityIterations = 0;
+       int32_t positionIterations = 0;
+       uint8_t continuousCollisionEnabled = 0;
+       int32_t ccdMaxSubsteps = 0;
+       uint8_t gravityApproximationEnabled = 0;
+       float gravityOpeningAngle = 0.0f;
+       int32_t gravityExactFieldLimit = 0;
+       float spatialHashCellSize = 0.0f;
+       
+       reader.ExpectTag(WORLD_SECTION_SETTINGS);
+       reader.Read(fixedTimestepEnabled);
+       reader.Read(fixedTimestep);
+       reader.Read(maxSubsteps);
+       reader.Read(accumulator);
+       reader.Read(stepCount);
+       reader.Read(sleepingEnabled);
+       reader.Read(velocityIterations);
+       reader.Read(positionIterations);
+       reader.Read(continuousCollisionEnabled);
+       reader.Read(ccdMaxSubsteps);
+       reader.Read(gravityApproximationEnabled);
+       reader.Read(gravityOpeningAngle);
+       reader.Read(gravityExactFieldLimit);
+       reader.Read(spatialHashCellSize);
+       bool isValid = std::isfinite(fixedTimestep) && fixedTimestep > 0.0f && std::isfinite(accumulator) &&
+           std::isfinite(gravityOpeningAngle) && std::isfinite(spatialHashCellSize) && spatialHashCellSize > 0.0f;
+       
+       const size_t bytesPerField = sizeof(PhysicsVector3D) + 3 * sizeof(float) + sizeof(uint8_t);
+       uint32_t fieldCount = 0;
+       std::vector<GravityField> gravityFields;
+       if (reader.ExpectTag(WORLD_SECTION_GRAVITY) && reader.Read(fieldCount) && reader.CanRead(fieldCount, bytesPerField))
+       {
+           gravityFields.resize(fieldCount);
+           for (GravityField& field : gravityFields)
+           {
+               uint8_t isBlackHole = 0;
+               reader.Read(field.center);
+               reader.Read(field.mass);
+               reader.Read(field.radius);
+               reader.Read(field.intensity);
+               reader.Read(isBlackHole);
+               field.isBlackHole = isBlackHole != 0;
+           }
+       }
+       
+       // Every heightfield holds at least its settings and sample count
+       const size_t minimumHeightfieldBytes = 2 * sizeof(int32_t) + 3 * sizeof(float) + sizeof(PhysicsVector3D) + 3 * sizeof(uint32_t);
+       uint32_t heightfieldCount = 0;
+       std::deque<PhysicsHeightfield> heightfields;
+       std::vector<int> freeHeightfieldSlots;
+       if (reader.ExpectTag(WORLD_SECTION_TERRAIN) && reader.Read(heightfieldCount) &&
+           reader.CanRead(heightfieldCount, minimumHeightfieldBytes))
+       {
+           heightfields.resize(heightfieldCount);
+           for (PhysicsHeightfield& heightfield : heightfields)
+           {
+               isValid = isValid && heightfield.Deserialize(reader);
+           }
+           reader.ReadArray(freeHeightfieldSlots);
+           for (int slot : freeHeightfieldSlots)
+           {
+               isValid = isValid && slot >= 0 && slot < static_cast<int>(heightfieldCount) && !heightfields[slot].IsValid();
+           }
+       }
+       
+       // The query tree is stored rather than rebuilt - reinserting every body costs more than the rest of the load
+       PhysicsBodyStore bodies;
+       std::vector<int> freeBodySlots;
+       PhysicsDynamicTree bodyTree;
+       std::vector<int> bodyProxies;
+       reader.ExpectTag(WORLD_SECTION_BODIES);
+       isValid = isValid && bodies.Deserialize(reader);
+       reader.ReadArray(freeBodySlots);
+       isValid = isValid && bodyTree.Deserialize(reader);
+       reader.ReadArray(bodyProxies);
+       for (int slot : freeBodySlots)
+       {
+           isValid = isValid && slot >= 0 && static_cast<size_t>(slot) < bodies.Size() &&
+               (bodies.flags[slot] & PhysicsBodyStore::FLAG_IN_USE) == 0;
+       }
+       // Tree queries hand leaf user data straight to body lookups - every leaf must be the proxy of
+       // exactly one body in use, so the proxies found here must account for every leaf in the tree
+       isValid = isValid && bodyProxies.size() <= bodies.Size();
+       int proxiedBodyCount = 0;
+       for (size_t i = 0; isValid && i < bodyProxies.size(); ++i)
+       {
+           if (bodyProxies[i] == PhysicsDynamicTree::NULL_NODE)
+           {
+               continue;
+           }
+           isValid = bodyTree.IsProxy(bodyProxies[i]) && bodyTree.GetUserData(bodyProxies[i]) == static_cast<int>(i) &&
+               (bodies.flags[i] & PhysicsBodyStore::FLAG_IN_USE) != 0;
+           ++proxiedBodyCount;
+       }
+       isValid = isValid && proxiedBodyCount == bodyTree.GetProxyCount();
+       
+       PhysicsContactCache contactCache;
+       reader.ExpectTag(WORLD_SECTION_CONTACTS);
+       isValid = isValid && contactCache.Deserialize(reader);
+       
+       PhysicsRagdollSolver ragdolls;
+       reader.ExpectTag(WORLD_SECTION_RAGDOLLS);
+       isValid = isValid && ragdolls.Deserialize(reader);
+       
+       if (!isValid || reader.HasFailed())
+       {
+           debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] World image is corrupt - world left unchanged");
+           return false;
+       }
+       
+       // Stored pools are restored in order into the pools given, extra stored pools are ignored.
+       // They are staged like the world, so a bad pool leaves every caller pool untouched.
+       uint32_t poolCount = 0;
+       reader.ExpectTag(WORLD_SECTION_PARTICLES);
+       reader.Read(poolCount);
+       std::vector<PhysicsParticlePool> stagedPools(std::min(static_cast<size_t>(poolCount), particlePools.size()),
+           PhysicsParticlePool(0));
+       for (size_t i = 0; i < stagedPools.size() && isValid; ++i)
+       {
+           isValid = stagedPools[i].Deserialize(reader);
+       }
+       if (!isValid || reader.HasFailed())
+       {
+           debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] World image particle pools are corrupt - world left unchanged");
+           return false;
+       }
+       
+       for (size_t i = 0; i < stagedPools.size(); ++i)
+       {
+           std::swap(*particlePools[i], stagedPools[i]);
+       }
+       
+       {
+           std::lock_guard<std::mutex> lock(m_physicsMutex);
+           
+           m_fixedTimestepEnabled = fixedTimestepEnabled != 0;
+           m_fixedTimestep = std::clamp(fixedTimestep, 1.0f / MAX_FIXED_TIMESTEP_HZ, 1.0f / MIN_FIXED_TIMESTEP_HZ);
+           m_maxSubsteps = std::max(1, static_cast<int>(maxSubsteps));
+           m_accumulator = accumulator;
+           m_stepCount = stepCount;
+           m_sleepingEnabled = sleepingEnabled != 0;
+           m_velocityIterations = std::clamp(static_cast<int>(velocityIterations), 1, MAX_SOLVER_ITERATIONS);
+           m_positionIterations = std::clamp(static_cast<int>(positionIterations), 0, MAX_SOLVER_ITERATIONS);
+           m_continuousCollisionEnabled = continuousCollisionEnabled != 0;
+           m_ccdMaxSubsteps = std::clamp(static_cast<int>(ccdMaxSubsteps), 1, MAX_CCD_SUBSTEPS);
+           m_gravityApproximationEnabled = gravityApproximationEnabled != 0;
+           m_gravityOpeningAngle = std::clamp(gravityOpeningAngle, 0.0f, 1.0f);
+           m_gravityExactFieldLimit = std::max(static_cast<int>(gravityExactFieldLimit), 0);
+           
+           // Swapping hands the previous world's storage to the staging objects, which free it on return
+           m_gravityFields.swap(gravityFields);
+           m_gravityTreeDirty = true;
+           m_heightfields.swap(heightfields);
+           m_freeHeightfieldSlots.swap(freeHeightfieldSlots);
+           m_terrainPairs.clear();
+           std::swap(m_bodyStore, bodies);
+           m_freeBodySlots.swap(freeBodySlots);
+           std::swap(m_bodyTree, bodyTree);
+           m_bodyProxies.swap(bodyProxies);
+           std::swap(m_contactCache, contactCache);
+           std::swap(m_ragdollSolver, ragdolls);
+           m_interpolationAlpha = m_fixedTimestepEnabled ? (m_accumulator / m_fixedTimestep) : 1.0f;
+           m_collisionManifolds.clear();
+           
+           // The spatial hash only serves the broad phase, which refills it at the start of the next step
+           m_spatialHash.Clear();
+           m_spatialHash.SetCellSize(spatialHashCellSize);
+           
+           int activeBodies = 0;
+           int sleepingBodies = 0;
+           for (size_t i = 0; i < m_bodyStore.Size(); ++i)
+           {
+               const bool isSimulated = m_bodyStore.IsSimulated(static_cast<int>(i));
+               activeBodies += isSimulated ? 1 : 0;
+               sleepingBodies += (isSimulated && m_bodyStore.IsSleeping(static_cast<int>(i))) ? 1 : 0;
+           }
+           m_activeBodyCount.store(activeBodies);
+           m_sleepingBodyCount.store(sleepingBodies);
+           
+#if defined(_DEBUG_PHYSICS_)
+           debug.logDebugMessage(LogLevel::LOG_INFO, L"[Physics] Deserialized world - %zu bodies, %zu gravity fields, %d ragdolls, %u particle pools",
+                                m_bodyStore.Size(), m_gravityFields.size(), m_ragdollSolver.GetRagdollCount(), poolCount);
+#endif
+       }
+       return true;
+   }
+   catch (const std::exception& e)
+   {
+       std::string errorMsg = e.what();
+       std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error deserializing world: " + wErrorMsg);
+       return false;
+   }
+}
+
+bool Physics::SaveWorld(const std::string& filepath, bool compress, const std::vector<const PhysicsParticlePool*>& particlePools) const
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   std::vector<uint8_t> image;
+   if (!SerializeWorld(image, compress, particlePools))
+   {
+       return false;
+   }
+   
+   std::ofstream file(filepath, std::ios::binary | std::ios::trunc);
+   if (!file.is_open())
+   {
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Failed to open '" +
+           std::wstring(filepath.begin(), filepath.end()) + L"' for writing the world image");
+       return false;
+   }
+   
+   file.write(reinterpret_cast<const char*>(image.data()), static_cast<std::streamsize>(image.size()));
+   if (!file.good())
+   {
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Failed writing the world image to '" +
+           std::wstring(filepath.begin(), filepath.end()) + L"'");
+       return false;
+   }
+   return true;
+}
+
+bool Physics::LoadWorld(const std::string& filepath, const std::vector<PhysicsParticlePool*>& particlePools)
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   std::ifstream file(filepath, std::ios::binary | std::ios::ate);
+   if (!file.is_open())
+   {
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Failed to open world image '" +
+           std::wstring(filepath.begin(), filepath.end()) + L"'");
+       return false;
+   }
+   
+   // Read the whole image in one go and decode it from memory
+   const std::streamoff fileSize = file.tellg();
+   std::vector<uint8_t> image(static_cast<size_t>(std::max<std::streamoff>(fileSize, 0)));
+   file.seekg(0, std::ios::beg);
+   if (!file.read(reinterpret_cast<char*>(image.data()), static_cast<std::streamsize>(image.size())))
+   {
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Failed reading world image '" +
+           std::wstring(filepath.begin(), filepath.end()) + L"'");
+       return false;
+   }
+   return DeserializeWorld(image, particlePools);
+}
+
+//==============================================================================
+// Physics Body Management Methods
+//==============================================================================
+int Physics::AddPhysicsBody(const PhysicsBody& body)
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   try
+   {
+       std::lock_guard<std::mutex> lock(m_physicsMutex);
+       
+       PhysicsBody newBody = body;
+       if (newBody.radius <= 0.0f)
+       {
+           newBody.radius = DEFAULT_BODY_RADIUS;
+       }
+       
+       // Keep inverse mass consistent with the static flag
+       newBody.SetMass(newBody.mass);
+       
+       // Reuse a removed slot first so existing indices stay stable
+       int bodyIndex;
+       if (!m_freeBodySlots.empty())
+       {
+           bodyIndex = m_freeBodySlots.back();
+           m_freeBodySlots.pop_back();
+       }
+       else
+       {
+           bodyIndex = static_cast<int>(m_bodyStore.Size());
+           m_bodyStore.Resize(m_bodyStore.Size() + 1);
+       }
+       
+       m_bodyStore.flags[bodyIndex] = PhysicsBodyStore::FLAG_IN_USE;
+       m_bodyStore.Store(bodyIndex, newBody);
+       
+       // Make the body visible to spatial queries immediately
+       SyncBodyProxy(bodyIndex, PhysicsVector3D());
+       
+#if defined(_DEBUG_PHYSICS_)
+       debug.logDebugMessage(LogLevel::LOG_DEBUG, L"[Physics] Added physics body at index %d", bodyIndex);
+#endif
+       
+       return bodyIndex;
+   }
+   catch (const std::exception& e)
+   {
+       std::string errorMsg = e.what();
+       std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error adding physics body: " + wErrorMsg);
+       return -1;
+   }
+}
+
+bool Physics::RemovePhysicsBody(int bodyIndex)
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   try
+   {
+       std::lock_guard<std::mutex> lock(m_physicsMutex);
+       
+       if (!PhysicsBodyHandle(&m_bodyStore, bodyIndex).IsValid())
+       {
+#if defined(_DEBUG_PHYSICS_)
+           debug.logDebugMessage(LogLevel::LOG_WARNING, L"[Physics] Invalid physics body index for removal: %d", bodyIndex);
+#endif
+           return false;
+       }
+       
+       // Bodies resting on the removed one must not stay asleep in mid-air
+       const PhysicsAABB removedBounds = PhysicsAABB::FromSphere(m_bodyStore.GetPosition(bodyIndex),
+           m_bodyStore.radius[bodyIndex] * BROAD_PHASE_MARGIN);
+       m_bodyTree.Query(removedBounds, [this](int touchingIndex) -> bool {
+           m_bodyStore.WakeUp(touchingIndex);
+           return true;
+       });
+       
+       // Deactivate the slot rather than erasing so other indices are unaffected
+       m_bodyStore.Store(bodyIndex, PhysicsBody());
+       m_bodyStore.flags[bodyIndex] = 0;
+       m_freeBodySlots.push_back(bodyIndex);
+       m_spatialHash.RemoveBody(bodyIndex);
+       SyncBodyProxy(bodyIndex, PhysicsVector3D());
+       
+#if defined(_DEBUG_PHYSICS_)
+       debug.logDebugMessage(LogLevel::LOG_DEBUG, L"[Physics] Removed physics body at index %d", bodyIndex);
+#endif
+       
+       return true;
+   }
+   catch (const std::exception& e)
+   {
+       std::string errorMsg = e.what();
+       std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error removing physics body: " + wErrorMsg);
+       return false;
+   }
+}
+
+void Physics::ClearPhysicsBodies()
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   std::lock_guard<std::mutex> lock(m_physicsMutex);
+   
+   m_bodyStore.Clear();
+   m_freeBodySlots.clear();
+   m_collisionManifolds.clear();
+   m_contactCache.Clear();
+   m_spatialHash.Clear();
+   m_bodyTree.Clear();
+   m_bodyProxies.clear();
+   m_activeBodyCount.store(0);
+   
+#if defined(_DEBUG_PHYSICS_)
+   debug.logLevelMessage(LogLevel::LOG_INFO, L"[Physics] Cleared all physics bodies");
+#endif
+}
+
+PhysicsBodyHandle Physics::GetPhysicsBody(int bodyIndex)
+{
+   std::lock_guard<std::mutex> lock(m_physicsMutex);
+   
+   PhysicsBodyHandle handle(&m_bodyStore, bodyIndex);
+   return handle.IsValid() ? handle : PhysicsBodyHandle();
+}
+
+int Physics::GetPhysicsBodyCount() const
+{
+   std::lock_guard<std::mutex> lock(m_physicsMutex);
+   return static_cast<int>(m_bodyStore.Size() - m_freeBodySlots.size());
+}
+
+bool Physics::SetIntegrationPath(PhysicsSIMDPath path)
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   const CPUFeatureFlags& cpu = GetCPUFeatures();
+   bool isSupported = (path == PhysicsSIMDPath::Scalar);
+#if defined(CPUFEATURES_X86)
+   isSupported = isSupported ||
+       (path == PhysicsSIMDPath::SSE2 && cpu.hasSSE2) ||
+       (path == PhysicsSIMDPath::AVX2 && cpu.hasAVX2 && cpu.hasFMA);
+#endif
+   
+   if (!isSupported)
+   {
+       return false;
+   }
+   
+   m_integrationPath = path;
+   
+#if defined(_DEBUG_PHYSICS_)
+   const wchar_t* pathNames[] = { L"Scalar", L"SSE2", L"AVX2" };
+   debug.logDebugMessage(LogLevel::LOG_INFO, L"[Physics] Body integration path: %ls", pathNames[static_cast<int>(path)]);
+#endif
+   
+   return true;
+}
+
+void Physics::SetSolverThreadCount(int threadCount)
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   // Workers must not be restarted while a step is using them
+   std::lock_guard<std::mutex> lock(m_physicsMutex);
+   m_workerPool.Start(std::clamp(threadCount, 0, MAX_SOLVER_THREADS));
+   
+#if defined(_DEBUG_PHYSICS_)
+   debug.logDebugMessage(LogLevel::LOG_INFO, L"[Physics] Island solver using %d worker threads", m_workerPool.GetWorkerCount());
+#endif
+}
+
+void Physics::SetSolverIterations(int velocityIterations, int positionIterations)
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   std::lock_guard<std::mutex> lock(m_physicsMutex);
+   m_velocityIterations = std::clamp(velocityIterations, 1, MAX_SOLVER_ITERATIONS);
+   m_positionIterations = std::clamp(positionIterations, 0, MAX_SOLVER_ITERATIONS);
+}
+
+void Physics::SetSleepingEnabled(bool enabled)
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   std::lock_guard<std::mutex> lock(m_physicsMutex);
+   m_sleepingEnabled = enabled;
+   
+   // Disabling sleep wakes everything immediately
+   if (!enabled)
+   {
+       for (size_t i = 0; i < m_bodyStore.Size(); ++i)
+       {
+           m_bodyStore.WakeUp(static_cast<int>(i));
+       }
+       m_sleepingBodyCount.store(0);
+   }
+}
+
+void Physics::SetSpatialHashCellSize(float cellSize)
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   std::lock_guard<std::mutex> lock(m_physicsMutex);
+   
+   // Cell ranges are rebuilt lazily by the next UpdateSpatialHash
+   m_spatialHash.SetCellSize(cellSize);
+   
+#if defined(_DEBUG_PHYSICS_)
+   debug.logDebugMessage(LogLevel::LOG_INFO, L"[Physics] Spatial hash cell size set to %.3f", m_spatialHash.GetCellSize());
+#endif
+}
+
+//==============================================================================
+// Spatial Query Methods Implementation
+//==============================================================================
+void Physics::QueryAABB(const PhysicsVector3D& minimum, const PhysicsVector3D& maximum, const BodyQueryCallback& callback) const
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   if (!callback)
+   {
+       return;
+   }
+   
+   try
+   {
+       std::lock_guard<std::mutex> lock(m_physicsMutex);
+       
+       const PhysicsAABB queryBox(minimum, maximum);
+       m_bodyTree.Query(queryBox, [&](int bodyIndex) -> bool {
+           // Tree bounds are fattened - confirm against the body's tight bounds
+           if (!PhysicsAABB::FromSphere(m_bodyStore.GetPosition(bodyIndex), m_bodyStore.radius[bodyIndex]).Overlaps(queryBox))
+           {
+               return true;
+           }
+           return callback(bodyIndex);
+       });
+   }
+   catch (const std::exception& e)
+   {
+       std::string errorMsg = e.what();
+       std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error in AABB query: " + wErrorMsg);
+   }
+}
+
+void Physics::Raycast(const PhysicsVector3D& origin, const PhysicsVector3D& direction, float maxDistance,
+                      const BodyRaycastCallback& callback) const
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   try
+   {
+       std::lock_guard<std::mutex> lock(m_physicsMutex);
+       SweepSphereQuery(origin, direction, 0.0f, maxDistance, callback);
+   }
+   catch (const std::exception& e)
+   {
+       std::string errorMsg = e.what();
+       std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error in raycast query: " + wErrorMsg);
+   }
+}
+
+void Physics::SphereCast(const PhysicsVector3D& origin, const PhysicsVector3D& direction, float radius, float maxDistance,
+                         const BodyRaycastCallback& callback) const
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   try
+   {
+       std::lock_guard<std::mutex> lock(m_physicsMutex);
+       SweepSphereQuery(origin, direction, std::max(radius, 0.0f), maxDistance, callback);
+   }
+   catch (const std::exception& e)
+   {
+       std::string errorMsg = e.what();
+       std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error in sphere cast query: " + wErrorMsg);
+   }
+}
+
+void Physics::QuerySphere(const PhysicsVector3D& center, float radius, uint32_t layerMask, const BodyQueryCallback& callback) const
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   if (!callback)
+   {
+       return;
+   }
+   
+   try
+   {
+       std::lock_guard<std::mutex> lock(m_physicsMutex);
+       
+       radius = std::max(radius, 0.0f);
+       m_bodyTree.Query(PhysicsAABB::FromSphere(center, radius), [&](int bodyIndex) -> bool {
+           // Layer test first - it is cheaper than the distance test
+           if ((m_bodyStore.collisionLayer[bodyIndex] & layerMask) == 0 || !m_bodyStore.IsSimulated(bodyIndex))
+           {
+               return true;
+           }
+           
+           const PhysicsVector3D offset = m_bodyStore.GetPosition(bodyIndex) - center;
+           const float combinedRadius = m_bodyStore.radius[bodyIndex] + radius;
+           if (offset.MagnitudeSquared() > combinedRadius * combinedRadius)
+           {
+               return true;
+           }
+           return callback(bodyIndex);
+       });
+   }
+   catch (const std::exception& e)
+   {
+       std::string errorMsg = e.what();
+       std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error in sphere query: " + wErrorMsg);
+   }
+}
+
+uint32_t Physics::GetCollisionLayerForEntityType(const std::string& entityType)
+{
+   // Entity type names used by ScriptManager DETECT_COLLISION rules (case-insensitive)
+   static const std::pair<const char*, uint32_t> entityLayers[] = {
+       { "DEFAULT", COLLISION_LAYER_DEFAULT },
+       { "PLAYER", COLLISION_LAYER_PLAYER },
+       { "ENEMY", COLLISION_LAYER_ENEMY },
+       { "OBJECT", COLLISION_LAYER_OBJECT },
+       { "ZONE", COLLISION_LAYER_ZONE },
+       { "WALL", COLLISION_LAYER_WALL },
+       { "PROJECTILE", COLLISION_LAYER_PROJECTILE },
+       { "PICKUP", COLLISION_LAYER_PICKUP }
+   };
+   
+   std::string upperType = entityType;
+   std::transform(upperType.begin(), upperType.end(), upperType.begin(),
+       [](unsigned char character) { return static_cast<char>(std::toupper(character)); });
+   
+   for (const auto& entry : entityLayers)
+   {
+       if (upperType == entry.first)
+       {
+           return entry.second;
+       }
+   }
+   
+   return 0u;
+}
+
+void Physics::SweepSphereQuery(const PhysicsVector3D& origin, const PhysicsVector3D& direction, float radius, float maxDistance,
+                               const BodyRaycastCallback& callback) const
+{
+   // Caller holds m_physicsMutex
+   if (!callback || maxDistance <= 0.0f)
+   {
+       return;
+   }
+   
+   float directionLength = direction.Magnitude();
+   if (directionLength < MIN_VELOCITY_THRESHOLD)
+   {
+       return;
+   }
+   
+   const PhysicsVector3D unitDirection = direction * (1.0f / directionLength);
+   
+   m_bodyTree.RayQuery(origin, unitDirection, maxDistance, radius, [&](int bodyIndex) -> bool {
+       const PhysicsVector3D bodyPosition = m_bodyStore.GetPosition(bodyIndex);
+       const float combinedRadius = m_bodyStore.radius[bodyIndex] + radius;
+       
+       // Casts starting inside a body report an immediate hit
+       float hitDistance = 0.0f;
+       if ((origin - bodyPosition).MagnitudeSquared() > combinedRadius * combinedRadius)
+       {
+           if (!RaySphereIntersection(origin, unitDirection, bodyPosition, combinedRadius, hitDistance) ||
+               hitDistance > maxDistance)
+           {
+               return true;
+           }
+       }
+       
+       return callback(bodyIndex, hitDistance);
+   });
+}
+
+//==============================================================================
+// Heightfield Terrain Methods
+//==============================================================================
+int Physics::AddHeightfield(PhysicsHeightfield heightfield)
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   if (!heightfield.IsValid())
+   {
+       debug.logLevelMessage(LogLevel::LOG_WARNING, L"[Physics] Cannot add an empty heightfield");
+       return -1;
+   }
+   
+   try
+   {
+       std::lock_guard<std::mutex> lock(m_physicsMutex);
+       
+       int heightfieldId;
+       if (!m_freeHeightfieldSlots.empty())
+       {
+           heightfieldId = m_freeHeightfieldSlots.back();
+           m_freeHeightfieldSlots.pop_back();
+           m_heightfields[heightfieldId] = std::move(heightfield);
+       }
+       else
+       {
+           heightfieldId = static_cast<int>(m_heightfields.size());
+           m_heightfields.push_back(std::move(heightfield));
+       }
+       
+#if defined(_DEBUG_PHYSICS_)
+       const PhysicsHeightfield& added = m_heightfields[heightfieldId];
+       debug.logDebugMessage(LogLevel::LOG_INFO, L"[Physics] Added heightfield %d (%dx%d samples, %zu bytes)",
+                            heightfieldId, added.GetWidth(), added.GetDepth(), added.GetMemoryUsage());
+#endif
+       return heightfieldId;
+   }
+   catch (const std::exception& e)
+   {
+       std::string errorMsg = e.what();
+       std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error adding heightfield: " + wErrorMsg);
+       return -1;
+   }
+}
+
+bool Physics::RemoveHeightfield(int heightfieldId)
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   std::lock_guard<std::mutex> lock(m_physicsMutex);
+   
+   if (heightfieldId < 0 || heightfieldId >= static_cast<int>(m_heightfields.size()) || !m_heightfields[heightfieldId].IsValid())
+   {
+#if defined(_DEBUG_PHYSICS_)
+       debug.logDebugMessage(LogLevel::LOG_WARNING, L"[Physics] Invalid heightfield id: %d", heightfieldId);
+#endif
+       return false;
+   }
+   
+   // Cached terrain contacts of this id are not refreshed any more and drop out of the cache
+   m_heightfields[heightfieldId].Clear();
+   m_freeHeightfieldSlots.push_back(heightfieldId);
+   return true;
+}
+
+void Physics::ClearHeightfields()
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   std::lock_guard<std::mutex> lock(m_physicsMutex);
+   m_heightfields.clear();
+   m_freeHeightfieldSlots.clear();
+   m_terrainPairs.clear();
+}
+
+int Physics::GetHeightfieldCount() const
+{
+   std::lock_guard<std::mutex> lock(m_physicsMutex);
+   return static_cast<int>(m_heightfields.size() - m_freeHeightfieldSlots.size());
+}
+
+const PhysicsHeightfield* Physics::GetHeightfield(int heightfieldId) const
+{
+   std::lock_guard<std::mutex> lock(m_physicsMutex);
+   
+   if (heightfieldId < 0 || heightfieldId >= static_cast<int>(m_heightfields.size()) || !m_heightfields[heightfieldId].IsValid())
+   {
+       return nullptr;
+   }
+   return &m_heightfields[heightfieldId];
+}
+
+bool Physics::RaycastTerrain(const PhysicsVector3D& origin, const PhysicsVector3D& direction, float maxDistance,
+                             PhysicsHeightfieldHit& outHit) const
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   try
+   {
+       std::lock_guard<std::mutex> lock(m_physicsMutex);
+       
+       // Each later heightfield only has to beat the nearest hit so far
+       bool hasHit = false;
+       float nearest = maxDistance;
+       PhysicsHeightfieldHit hit;
+       for (int heightfieldId = 0; heightfieldId < static_cast<int>(m_heightfields.size()); ++heightfieldId)
+       {
+           if (m_heightfields[heightfieldId].Raycast(origin, direction, nearest, hit))
+           {
+               hasHit = true;
+               nearest = hit.distance;
+               outHit = hit;
+               outHit.heightfieldId = heightfieldId;
+           }
+       }
+       return hasHit;
+   }
+   catch (const std::exception& e)
+   {
+       std::string errorMsg = e.what();
+       std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error in terrain raycast: " + wErrorMsg);
+       return false;
+   }
+}
+
+void Physics::CollectTerrainPairs()
+{
+   // Caller holds m_physicsMutex
+   m_terrainPairs.clear();
+   const size_t bodyCount = m_bodyStore.Size();
+   if (bodyCount == 0 || m_heightfields.size() == m_freeHeightfieldSlots.size())
+   {
+       return;
+   }
+   
+   const uint32_t terrainFlags = PhysicsBodyStore::FLAG_SIMULATED | PhysicsBodyStore::FLAG_STATIC | PhysicsBodyStore::FLAG_SLEEPING;
+   m_terrainHeights.resize(bodyCount);
+   
+   for (int heightfieldId = 0; heightfieldId < static_cast<int>(m_heightfields.size()); ++heightfieldId)
+   {
+       const PhysicsHeightfield& heightfield = m_heightfields[heightfieldId];
+       if (!heightfield.IsValid())
+       {
+           continue;
+       }
+       
+       // Height under every body in one vector pass - only bodies the slope bound cannot clear
+       // go on to the exact quadtree query
+       heightfield.SampleHeights(m_bodyStore.positionX.data(), m_bodyStore.positionZ.data(), m_terrainHeights.data(),
+           static_cast<int>(bodyCount), m_integrationPath);
+       
+       for (size_t i = 0; i < bodyCount; ++i)
+       {
+           if ((m_bodyStore.flags[i] & terrainFlags) != PhysicsBodyStore::FLAG_SIMULATED)
+           {
+               continue;
+           }
+           
+           const PhysicsVector3D center = m_bodyStore.GetPosition(static_cast<int>(i));
+           const float radius = m_bodyStore.radius[i];
+           if (!heightfield.OverlapsSphereBounds(center, radius) || heightfield.IsSphereClear(center, radius, m_terrainHeights[i]) ||
+               !PhysicsBody::ShouldCollide(m_bodyStore.collisionLayer[i], m_bodyStore.collisionMask[i], m_bodyStore.collisionGroup[i],
+                   heightfield.GetCollisionLayer(), heightfield.GetCollisionMask(), COLLISION_GROUP_NONE))
+           {
+               continue;
+           }
+           
+           m_terrainPairs.emplace_back(static_cast<int>(i), heightfieldId);
+       }
+   }
+}
+
+void Physics::GenerateTerrainManifolds(size_t firstSlot)
+{
+   // Caller holds m_physicsMutex - the terrain is bodyB, so contact normals point into it
+   for (size_t k = 0; k < m_terrainPairs.size(); ++k)
+   {
+       const int heightfieldId = m_terrainPairs[k].second;
+       PhysicsBody& body = m_solverBodies[m_manifoldSlots[firstSlot + k].first];
+       PhysicsBody& terrain = m_solverBodies[m_manifoldSlots[firstSlot + k].second];
+       
+       ContactPoint contacts[MAX_MANIFOLD_CONTACTS];
+       const int contactCount = m_heightfields[heightfieldId].CollideSphere(body.position, body.radius, contacts, MAX_MANIFOLD_CONTACTS);
+       if (contactCount == 0)
+       {
+           continue;
+       }
+       
+       CollisionManifold manifold;
+       manifold.bodyA = &body;
+       manifold.bodyB = &terrain;
+       manifold.indexA = m_terrainPairs[k].first;
+       manifold.indexB = HEIGHTFIELD_MANIFOLD_INDEX_BASE - heightfieldId;
+       for (int c = 0; c < contactCount; ++c)
+       {
+           ContactPoint& contact = contacts[c];
+           contact.normal = contact.normal * -1.0f;
+           contact.restitution = std::min(body.restitution, terrain.restitution);
+           contact.friction = std::sqrt(body.friction * terrain.friction);
+           manifold.AddContact(contact);
+       }
+       
+       manifold.normal = contacts[0].normal;
+       manifold.separatingVelocity = (terrain.velocity - body.velocity).Dot(manifold.normal);
+       m_collisionManifolds.push_back(manifold);
+   }
+}
+
+//==============================================================================
+// Curved Path Calculation Methods
+//==============================================================================
+CurvedPath2D Physics::CreateCurvedPath2D(const std::vector<PhysicsVector2D>& controlPoints, int resolution)
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   CurvedPath2D path;
+   
+   // Validate input parameters
+   if (controlPoints.size() < 2)
+   {
+#if defined(_DEBUG_PHYSICS_)
+       debug.logLevelMessage(LogLevel::LOG_WARNING, L"[Physics] Need at least 2 control points for curved path");
+#endif
+       return path;
+   }
+   
+   if (resolution <= 0)
+   {
+       resolution = 100; // Default resolution
+   }
+   
+   // Ensure we don't exceed maximum path coordinates
+   resolution = std::min(resolution, MAX_PATH_COORDINATES - static_cast<int>(controlPoints.size()));
+   
+#if defined(_DEBUG_PHYSICS_)
+   debug.logDebugMessage(LogLevel::LOG_INFO, L"[Physics] Creating 2D curved path with %zu control points, resolution %d", 
+                        controlPoints.size(), resolution);
+#endif
+   
+   try
+   {
+       // Generate smooth curve using Catmull-Rom spline interpolation
+       for (int i = 0; i < resolution; ++i)
+       {
+           float t = static_cast<float>(i) / static_cast<float>(resolution - 1);
+           
+           // Find the appropriate segment for this t value
+           float segmentT = t * static_cast<float>(controlPoints.size() - 1);
+           int segmentIndex = static_cast<int>(segmentT);
+           float localT = segmentT - static_cast<float>(segmentIndex);
+           
+           // Ensure we stay within bounds
+           segmentIndex = std::clamp(segmentIndex, 0, static_cast<int>(controlPoints.size()) - 2);
+           
+           // Get control points for Catmull-Rom interpolation
+           PhysicsVector2D p0 = (segmentIndex > 0) ? controlPoints[segmentIndex - 1] : controlPoints[segmentIndex];
+           PhysicsVector2D p1 = controlPoints[segmentIndex];
+           PhysicsVector2D p2 = controlPoints[segmentIndex + 1];
+           PhysicsVector2D p3 = (segmentIndex + 2 < static_cast<int>(controlPoints.size())) ? 
+                                 controlPoints[segmentIndex + 2] : controlPoints[segmentIndex + 1];
+           
+           // Calculate interpolated point using Catmull-Rom spline
+           PhysicsVector2D interpolatedPoint = CatmullRomInterpolation2D(p0, p1, p2, p3, localT);
+           path.AddPoint(interpolatedPoint);
+       }
+       
+       // Add original control points to ensure path passes through them
+       for (const auto& controlPoint : controlPoints)
+       {
+           path.AddPoint(controlPoint);
+       }
+       
+#if defined(_DEBUG_PHYSICS_)
+       debug.logDebugMessage(LogLevel::LOG_INFO, L"[Physics] Created 2D curved path with %zu total points", 
+                            path.coordinates.size());
+#endif
+   }
+   catch (const std::exception& e)
+   {
+       std::string errorMsg = e.what();
+       std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error creating 2D curved path: " + wErrorMsg);
+       
+       // Return empty path on error
+       path.Clear();
+   }
+   
+   return path;
+}
+
+CurvedPath3D Physics::CreateCurvedPath3D(const std::vector<PhysicsVector3D>& controlPoints, int resolution)
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   CurvedPath3D path;
+   
+   // Validate input parameters
+   if (controlPoints.size() < 2)
+   {
+#if defined(_DEBUG_PHYSICS_)
+       debug.logLevelMessage(LogLevel::LOG_WARNING, L"[Physics] Need at least 2 control points for curved path");
+#endif
+       return path;
+   }
+   
+   if (resolution <= 0)
+   {
+       resolution = 100; // Default resolution
+   }
+   
+   // Ensure we don't exceed maximum path coordinates
+   resolution = std::min(resolution, MAX_PATH_COORDINATES - static_cast<int>(controlPoints.size()));
+   
+#if defined(_DEBUG_PHYSICS_)
+   debug.logDebugMessage(LogLevel::LOG_INFO, L"[Physics] Creating 3D curved path with %zu control points, resolution %d", 
+                        controlPoints.size(), resolution);
+#endif
+   
+   try
+   {
+       // Generate smooth curve using Catmull-Rom spline interpolation
+       for (int i = 0; i < resolution; ++i)
+       {
+           float t = static_cast<float>(i) / static_cast<float>(resolution - 1);
+           
+           // Find the appropriate segment for this t value
+           float segmentT = t * static_cast<float>(controlPoints.size() - 1);
+           int segmentIndex = static_cast<int>(segmentT);
+           float localT = segmentT - static_cast<float>(segmentIndex);
+           
+           // Ensure we stay within bounds
+           segmentIndex = std::clamp(segmentIndex, 0, static_cast<int>(controlPoints.size()) - 2);
+           
+           // Get control points for Catmull-Rom interpolation
+           PhysicsVector3D p0 = (segmentIndex > 0) ? controlPoints[segmentIndex - 1] : controlPoints[segmentIndex];
+           PhysicsVector3D p1 = controlPoints[segmentIndex];
+           PhysicsVector3D p2 = controlPoints[segmentIndex + 1];
+           PhysicsVector3D p3 = (segmentIndex + 2 < static_cast<int>(controlPoints.size())) ? 
+                                 controlPoints[segmentIndex + 2] : controlPoints[segmentIndex + 1];
+           
+           // Calculate interpolated point using Catmull-Rom spline
+           PhysicsVector3D interpolatedPoint = CatmullRomInterpolation3D(p0, p1, p2, p3, localT);
+           path.AddPoint(interpolatedPoint);
+       }
+       
+       // Add original control points to ensure path passes through them
+       for (const auto& controlPoint : controlPoints)
+       {
+           path.AddPoint(controlPoint);
+       }
+       
+#if defined(_DEBUG_PHYSICS_)
+       debug.logDebugMessage(LogLevel::LOG_INFO, L"[Physics] Created 3D curved path with %zu total points", 
+                            path.coordinates.size());
+#endif
+   }
+   catch (const std::exception& e)
+   {
+       std::string errorMsg = e.what();
+       std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error creating 3D curved path: " + wErrorMsg);
+       
+       // Return empty path on error
+       path.Clear();
+   }
+   
+   return path;
+}
+
+PhysicsVector2D Physics::GetCurvePoint2D(const CurvedPath2D& path, float t) const
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   // Clamp t to valid range [0, 1]
+   t = std::clamp(t, 0.0f, 1.0f);
+   
+   // Handle edge cases
+   if (path.coordinates.empty())
+   {
+       return PhysicsVector2D();
+   }
+   
+   if (path.coordinates.size() == 1)
+   {
+       return path.coordinates[0];
+   }
+   
+   // Calculate distance along path
+   float targetDistance = t * path.totalLength;
+   return path.GetPointAtDistance(targetDistance);
+}
+
+PhysicsVector3D Physics::GetCurvePoint3D(const CurvedPath3D& path, float t) const
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   // Clamp t to valid range [0, 1]
+   t = std::clamp(t, 0.0f, 1.0f);
+   
+   // Handle edge cases
+   if (path.coordinates.empty())
+   {
+       return PhysicsVector3D();
+   }
+   
+   if (path.coordinates.size() == 1)
+   {
+       return path.coordinates[0];
+   }
+   
+   // Calculate distance along path
+   float targetDistance = t * path.totalLength;
+   return path.GetPointAtDistance(targetDistance);
+}
+
+PhysicsVector2D Physics::GetCurveTangent2D(const CurvedPath2D& path, float t) const
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   // Clamp t to valid range [0, 1]
+   t = std::clamp(t, 0.0f, 1.0f);
+   
+   // Handle edge cases
+   if (path.tangents.empty())
+   {
+       return PhysicsVector2D(1.0f, 0.0f); // Default to right direction
+   }
+   
+   // Calculate distance along path
+   float targetDistance = t * path.totalLength;
+   return path.GetTangentAtDistance(targetDistance);
+}
+
+PhysicsVector3D Physics::GetCurveTangent3D(const CurvedPath3D& path, float t) const
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   // Clamp t to valid range [0, 1]
+   t = std::clamp(t, 0.0f, 1.0f);
+   
+   // Handle edge cases
+   if (path.tangents.empty())
+   {
+       return PhysicsVector3D(1.0f, 0.0f, 0.0f); // Default to forward direction
+   }
+   
+   // Calculate distance along path
+   float targetDistance = t * path.totalLength;
+   return path.GetTangentAtDistance(targetDistance);
+}
+
+float Physics::CalculateCurveLength2D(const CurvedPath2D& path, float startT, float endT) const
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   // Ensure valid t range
+   startT = std::clamp(startT, 0.0f, 1.0f);
+   endT = std::clamp(endT, 0.0f, 1.0f);
+   
+   if (startT > endT)
+   {
+       std::swap(startT, endT);
+   }
+   
+   // Calculate distances along path
+   float startDistance = startT * path.totalLength;
+   float endDistance = endT * path.totalLength;
+   
+   return endDistance - startDistance;
+}
+
+float Physics::CalculateCurveLength3D(const CurvedPath3D& path, float startT, float endT) const
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   // Ensure valid t range
+   startT = std::clamp(startT, 0.0f, 1.0f);
+   endT = std::clamp(endT, 0.0f, 1.0f);
+   
+   if (startT > endT)
+   {
+       std::swap(startT, endT);
+   }
+   
+   // Calculate distances along path
+   float startDistance = startT * path.totalLength;
+   float endDistance = endT * path.totalLength;
+   
+   return endDistance - startDistance;
+}
+
+//==============================================================================
+// Reflection Path Calculation Methods
+//==============================================================================
+ReflectionData Physics::CalculateReflection(const PhysicsVector3D& incomingVelocity, const PhysicsVector3D& surfaceNormal, 
+                                          float restitution, float friction)
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   ReflectionData reflectionData;
+   reflectionData.incomingVelocity = incomingVelocity;
+   reflectionData.surfaceNormal = surfaceNormal.Normalized();
+   reflectionData.restitution = std::clamp(restitution, 0.0f, 1.0f);
+   reflectionData.friction = std::clamp(friction, 0.0f, 1.0f);
+   
+   try
+   {
+       // Calculate velocity components relative to surface normal
+       float normalVelocity = FastDotProduct(incomingVelocity, reflectionData.surfaceNormal);
+       PhysicsVector3D normalComponent = reflectionData.surfaceNormal * normalVelocity;
+       PhysicsVector3D tangentialComponent = incomingVelocity - normalComponent;
        
-       // Update all physics bodies
-       int activeBodies = 0;
-       for (auto& body : m_physicsBodies)
-       {
-           if (body.isActive)
-           {
-               // Apply gravity forces
-               PhysicsVector3D gravityForce = CalculateGravityAtPosition(body.position);
-               body.ApplyForce(gravityForce);
-               
-               // Integrate physics using Verlet integration for stability
-               VerletIntegration(body, deltaTime);
-               
-               activeBodies++;
-           }
-       }
+       // Apply reflection to normal component with restitution
+       PhysicsVector3D reflectedNormal = normalComponent * (-reflectionData.restitution);
        
-       // Update active body count
-       m_activeBodyCount.store(activeBodies);
+       // Apply friction to tangential component
+       PhysicsVector3D reflectedTangential = tangentialComponent * (1.0f - reflectionData.friction);
        
-       // Perform collision detection and response
-       BroadPhaseCollisionDetection();
-       NarrowPhaseCollisionDetection();
+       // Combine components for final reflected velocity
+       reflectionData.reflectedVelocity = reflectedNormal + reflectedTangential;
        
-       // Resolve collision manifolds
-       int collisionCount = 0;
-       for (auto& manifold : m_collisionManifolds)
-       {
-           manifold.ResolveCollision();
-           collisionCount++;
-       }
-       m_collisionCount.store(collisionCount);
+       // Calculate energy loss
+       float incomingEnergy = incomingVelocity.MagnitudeSquared();
+       float reflectedEnergy = reflectionData.reflectedVelocity.MagnitudeSquared();
+       reflectionData.energyLoss = (incomingEnergy - reflectedEnergy) / incomingEnergy;
        
-       // Update ragdoll joint constraints
-       for (auto& joint : m_ragdollJoints)
-       {
-           if (joint.isActive)
-           {
-               joint.ApplyConstraints();
-           }
-       }
+#if defined(_DEBUG_PHYSICS_)
+       debug.logDebugMessage(LogLevel::LOG_DEBUG, L"[Physics] Calculated reflection - Energy loss: %.3f, Restitution: %.3f", 
+                            reflectionData.energyLoss, reflectionData.restitution);
+#endif
+   }
+   catch (const std::exception& e)
+   {
+       std::string errorMsg = e.what();
+       std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error calculating reflection: " + wErrorMsg);
+       
+       // Return safe default values
+       reflectionData.reflectedVelocity = PhysicsVector3D();
+       reflectionData.energyLoss = 1.0f;
+   }
+   
+   return reflectionData;
+}
+
+PhysicsVector2D Physics::CalculateReflection2D(const PhysicsVector2D& incomingVelocity, const PhysicsVector2D& surfaceNormal, 
+                                             float restitution)
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   try
+   {
+       // Normalize surface normal
+       PhysicsVector2D normal = surfaceNormal.Normalized();
        
-       // Solve position and velocity constraints
-       SolvePositionConstraints();
-       SolveVelocityConstraints();
+       // Calculate reflection using formula: R = V - 2(V·N)N
+       float dotProduct = incomingVelocity.Dot(normal);
+       PhysicsVector2D reflection = incomingVelocity - normal * (2.0f * dotProduct);
        
-       // Clear collision manifolds for next frame
-       m_collisionManifolds.clear();
+       // Apply restitution coefficient
+       reflection *= std::clamp(restitution, 0.0f, 1.0f);
        
 #if defined(_DEBUG_PHYSICS_)
-       if (activeBodies > 0 || collisionCount > 0)
-       {
-           debug.logDebugMessage(LogLevel::LOG_DEBUG, L"[Physics] Updated %d active bodies, %d collisions", 
-                                activeBodies, collisionCount);
-       }
+       debug.logDebugMessage(LogLevel::LOG_DEBUG, L"[Physics] Calculated 2D reflection with restitution: %.3f", restitution);
+#endif
+       
+       return reflection;
+   }
+   catch (const std::exception& e)
+   {
+       std::string errorMsg = e.what();
+       std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error calculating 2D reflection: " + wErrorMsg);
+       
+       return PhysicsVector2D();
+   }
+}
+
+// Shared by both CalculateMultipleBounces overloads - emitPoint(point) returns false once storage is full
+template<typename EmitPoint>
+static void TraceMultipleBounces(Physics& physics, const PhysicsVector3D& startPosition, const PhysicsVector3D& initialVelocity,
+    const PhysicsVector3D* surfaceNormals, size_t normalCount, int maxBounces, EmitPoint&& emitPoint)
+{
+    PhysicsVector3D currentPosition = startPosition;
+    PhysicsVector3D currentVelocity = initialVelocity;
+
+    // Add starting position
+    bool hasRoom = emitPoint(currentPosition);
+
+    // Calculate each bounce
+    for (int bounce = 0; hasRoom && bounce < maxBounces && bounce < static_cast<int>(normalCount); ++bounce)
+    {
+        // Simulate movement until collision (simplified)
+        currentPosition += currentVelocity * 0.1f; // Simplified time step
+
+        // Calculate reflection
+        ReflectionData reflection = physics.CalculateReflection(currentVelocity, surfaceNormals[bounce]);
+        currentVelocity = reflection.reflectedVelocity;
+
+        // Add bounce position
+        hasRoom = emitPoint(currentPosition);
+
+        // Stop if velocity becomes too small
+        if (currentVelocity.Magnitude() < MIN_VELOCITY_THRESHOLD)
+        {
+            break;
+        }
+    }
+}
+
+std::vector<PhysicsVector3D> Physics::CalculateMultipleBounces(const PhysicsVector3D& startPosition, 
+                                                             const PhysicsVector3D& initialVelocity, 
+                                                             const std::vector<PhysicsVector3D>& surfaceNormals, 
+                                                             int maxBounces)
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   std::vector<PhysicsVector3D> bouncePath;
+   bouncePath.reserve(maxBounces + 1);
+   
+   try
+   {
+       TraceMultipleBounces(*this, startPosition, initialVelocity, surfaceNormals.data(), surfaceNormals.size(), maxBounces,
+           [&bouncePath](const PhysicsVector3D& point) { bouncePath.push_back(point); return true; });
+       
+#if defined(_DEBUG_PHYSICS_)
+       debug.logDebugMessage(LogLevel::LOG_INFO, L"[Physics] Calculated %zu bounce positions with %d max bounces", 
+                            bouncePath.size(), maxBounces);
 #endif
    }
    catch (const std::exception& e)
    {
-       // Log exception and continue (don't crash the game)
        std::string errorMsg = e.what();
        std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
-       
-       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Exception during update: " + wErrorMsg);
-       
-       // Record exception for debugging
-       m_exceptionHandler.LogException(e, "Physics::Update");
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error calculating multiple bounces: " + wErrorMsg);
+   }
+   
+   return bouncePath;
+}
+
+size_t Physics::CalculateMultipleBounces(const PhysicsVector3D& startPosition, const PhysicsVector3D& initialVelocity,
+                                         const PhysicsVector3D* surfaceNormals, size_t normalCount,
+                                         PhysicsVector3D* outPoints, size_t capacity, int maxBounces)
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   size_t pointCount = 0;
+   if (!outPoints || capacity == 0 || (!surfaceNormals && normalCount > 0))
+   {
+       return 0;
+   }
+   
+   try
+   {
+       TraceMultipleBounces(*this, startPosition, initialVelocity, surfaceNormals, normalCount, maxBounces,
+           [&](const PhysicsVector3D& point) { outPoints[pointCount++] = point; return pointCount < capacity; });
+   }
+   catch (const std::exception& e)
+   {
+       std::string errorMsg = e.what();
+       std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error calculating multiple bounces: " + wErrorMsg);
    }
-   catch (...)
+   
+   return pointCount;
+}
+
+//==============================================================================
+// Internal Helper Methods Implementation
+//==============================================================================
+PhysicsVector2D Physics::CatmullRomInterpolation2D(const PhysicsVector2D& p0, const PhysicsVector2D& p1, 
+                                                  const PhysicsVector2D& p2, const PhysicsVector2D& p3, float t) const
+{
+   // Catmull-Rom spline interpolation formula
+   float t2 = t * t;
+   float t3 = t2 * t;
+   
+   // Calculate interpolation coefficients
+   float c0 = -0.5f * t3 + t2 - 0.5f * t;
+   float c1 = 1.5f * t3 - 2.5f * t2 + 1.0f;
+   float c2 = -1.5f * t3 + 2.0f * t2 + 0.5f * t;
+   float c3 = 0.5f * t3 - 0.5f * t2;
+   
+   // Apply coefficients to control points
+   return p0 * c0 + p1 * c1 + p2 * c2 + p3 * c3;
+}
+
+PhysicsVector3D Physics::CatmullRomInterpolation3D(const PhysicsVector3D& p0, const PhysicsVector3D& p1, 
+                                                  const PhysicsVector3D& p2, const PhysicsVector3D& p3, float t) const
+{
+   // Catmull-Rom spline interpolation formula
+   float t2 = t * t;
+   float t3 = t2 * t;
+   
+   // Calculate interpolation coefficients
+   float c0 = -0.5f * t3 + t2 - 0.5f * t;
+   float c1 = 1.5f * t3 - 2.5f * t2 + 1.0f;
+   float c2 = -1.5f * t3 + 2.0f * t2 + 0.5f * t;
+   float c3 = 0.5f * t3 - 0.5f * t2;
+   
+   // Apply coefficients to control points
+   return p0 * c0 + p1 * c1 + p2 * c2 + p3 * c3;
+}
+
+void Physics::VerletIntegration(PhysicsBody& body, float deltaTime)
+{
+    PHYSICS_RECORD_FUNCTION();
+
+    try
+    {
+        // Verlet integration for better stability
+        // x(t+dt) = 2*x(t) - x(t-dt) + a(t)*dt^2
+
+        // Only integrate for dynamic bodies
+        if (!body.isStatic && body.isActive)
+        {
+            // Store previous position for next frame
+            static std::unordered_map<PhysicsBody*, PhysicsVector3D> previousPositions;
+
+            PhysicsVector3D currentPosition = body.position;
+            PhysicsVector3D acceleration = body.acceleration;
+
+            // Get previous position or initialize with current position for first frame
+            auto it = previousPositions.find(&body);
+            PhysicsVector3D previousPosition = (it != previousPositions.end()) ? it->second : currentPosition;
+
+            // Calculate new position using Verlet integration formula
+            PhysicsVector3D newPosition = currentPosition * 2.0f - previousPosition + acceleration * (deltaTime * deltaTime);
+
+            // Calculate velocity using CURRENT and PREVIOUS positions with proper vector scalar division
+            // This is the correct Verlet velocity calculation for PhysicsVector3D
+            if (deltaTime > MIN_VELOCITY_THRESHOLD)
+            {
+                float invDeltaTime = 1.0f / deltaTime;
+                body.velocity = (currentPosition - previousPosition) * invDeltaTime;
+            }
+            else
+            {
+                // Prevent division by zero for very small time steps
+                body.velocity = PhysicsVector3D(0.0f, 0.0f, 0.0f);
+            }
+
+            // Apply drag to velocity
+            float dragFactor = 1.0f - (body.drag * deltaTime);
+            dragFactor = std::max(0.0f, dragFactor);
+            body.velocity *= dragFactor;
+
+            // Store current position as previous for next frame
+            previousPositions[&body] = currentPosition;
+
+            // Update body position to new calculated position
+            body.position = newPosition;
+
+            // Reset acceleration for next frame
+            body.acceleration = PhysicsVector3D();
+        }
+    }
+    catch (const std::exception& e)
+    {
+        std::string errorMsg = e.what();
+        std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
+        debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error in Verlet integration: " + wErrorMsg);
+    }
+}
+
+float Physics::FastMagnitude(const PhysicsVector3D& vector) const
+{
+   // Use MathPrecalculation for fast square root
+   return FAST_SQRT(vector.x * vector.x + vector.y * vector.y + vector.z * vector.z);
+}
+
+PhysicsVector3D Physics::FastNormalize(const PhysicsVector3D& vector) const
+{
+   // Calculate magnitude using fast math
+   float magnitude = FastMagnitude(vector);
+   
+   // Handle zero-length vector
+if (magnitude < MIN_VELOCITY_THRESHOLD)
    {
-       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Unknown exception during update");
-       
-       // Record unknown exception
-       m_exceptionHandler.LogCustomException("Unknown exception in Physics::Update", "Physics::Update");
+       return PhysicsVector3D(0.0f, 0.0f, 0.0f);
    }
    
-   // Calculate update time
-   auto endTime = std::chrono::high_resolution_clock::now();
-   auto duration = std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime);
-   m_lastUpdateTime = duration.count() / 1000.0f; // Convert to milliseconds
+   // Normalize using fast inverse
+   float invMagnitude = 1.0f / magnitude;
+   return PhysicsVector3D(vector.x * invMagnitude, vector.y * invMagnitude, vector.z * invMagnitude);
+}
+
+float Physics::FastDotProduct(const PhysicsVector3D& a, const PhysicsVector3D& b) const
+{
+   // Standard dot product calculation
+   return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+PhysicsVector3D Physics::FastCrossProduct(const PhysicsVector3D& a, const PhysicsVector3D& b) const
+{
+   // Standard cross product calculation
+   return PhysicsVector3D(
+       a.y * b.z - a.z * b.y,
+       a.z * b.x - a.x * b.z,
+       a.x * b.y - a.y * b.x
+   );
+}
+
+float Physics::FastDistance(const PhysicsVector3D& a, const PhysicsVector3D& b) const
+{
+   // Calculate distance using fast magnitude
+   PhysicsVector3D diff = b - a;
+   return FastMagnitude(diff);
 }
 
 //==============================================================================
-// Curved Path Calculation Methods
+// Gravity Field Methods Implementation
 //==============================================================================
-CurvedPath2D Physics::CreateCurvedPath2D(const std::vector<PhysicsVector2D>& controlPoints, int resolution)
+void Physics::AddGravityField(const GravityField& gravityField)
 {
    PHYSICS_RECORD_FUNCTION();
    
-   CurvedPath2D path;
-   
-   // Validate input parameters
-   if (controlPoints.size() < 2)
+   try
    {
+       std::lock_guard<std::mutex> lock(m_physicsMutex);
+       m_gravityFields.push_back(gravityField);
+       m_gravityTreeDirty = true;
+       
 #if defined(_DEBUG_PHYSICS_)
-       debug.logLevelMessage(LogLevel::LOG_WARNING, L"[Physics] Need at least 2 control points for curved path");
+       debug.logDebugMessage(LogLevel::LOG_INFO, L"[Physics] Added gravity field at position (%.2f, %.2f, %.2f) with mass %.2f", 
+                            gravityField.center.x, gravityField.center.y, gravityField.center.z, gravityField.mass);
 #endif
-       return path;
    }
-   
-   if (resolution <= 0)
+   catch (const std::exception& e)
    {
-       resolution = 100; // Default resolution
+       std::string errorMsg = e.what();
+       std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error adding gravity field: " + wErrorMsg);
    }
-   
-   // Ensure we don't exceed maximum path coordinates
-   resolution = std::min(resolution, MAX_PATH_COORDINATES - static_cast<int>(controlPoints.size()));
-   
-#if defined(_DEBUG_PHYSICS_)
-   debug.logDebugMessage(LogLevel::LOG_INFO, L"[Physics] Creating 2D curved path with %zu control points, resolution %d", 
-                        controlPoints.size(), resolution);
-#endif
+}
+
+void Physics::RemoveGravityField(int index)
+{
+   PHYSICS_RECORD_FUNCTION();
    
    try
    {
-       // Generate smooth curve using Catmull-Rom spline interpolation
-       for (int i = 0; i < resolution; ++i)
+       std::lock_guard<std::mutex> lock(m_physicsMutex);
+       
+       if (index >= 0 && index < static_cast<int>(m_gravityFields.size()))
        {
-           float t = static_cast<float>(i) / static_cast<float>(resolution - 1);
-           
-           // Find the appropriate segment for this t value
-           float segmentT = t * static_cast<float>(controlPoints.size() - 1);
-           int segmentIndex = static_cast<int>(segmentT);
-           float localT = segmentT - static_cast<float>(segmentIndex);
-           
-           // Ensure we stay within bounds
-           segmentIndex = std::clamp(segmentIndex, 0, static_cast<int>(controlPoints.size()) - 2);
-           
-           // Get control points for Catmull-Rom interpolation
-           PhysicsVector2D p0 = (segmentIndex > 0) ? controlPoints[segmentIndex - 1] : controlPoints[segmentIndex];
-           PhysicsVector2D p1 = controlPoints[segmentIndex];
-           PhysicsVector2D p2 = controlPoints[segmentIndex + 1];
-           PhysicsVector2D p3 = (segmentIndex + 2 < static_cast<int>(controlPoints.size())) ? 
-                                 controlPoints[segmentIndex + 2] : controlPoints[segmentIndex + 1];
+           m_gravityFields.erase(m_gravityFields.begin() + index);
+           m_gravityTreeDirty = true;
            
-           // Calculate interpolated point using Catmull-Rom spline
-           PhysicsVector2D interpolatedPoint = CatmullRomInterpolation2D(p0, p1, p2, p3, localT);
-           path.AddPoint(interpolatedPoint);
+#if defined(_DEBUG_PHYSICS_)
+           debug.logDebugMessage(LogLevel::LOG_INFO, L"[Physics] Removed gravity field at index %d", index);
+#endif
        }
-       
-       // Add original control points to ensure path passes through them
-       for (const auto& controlPoint : controlPoints)
+       else
        {
-           path.AddPoint(controlPoint);
+#if defined(_DEBUG_PHYSICS_)
+           debug.logDebugMessage(LogLevel::LOG_WARNING, L"[Physics] Invalid gravity field index: %d", index);
+#endif
        }
-       
+   }
+   catch (const std::exception& e)
+   {
+       std::string errorMsg = e.what();
+       std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error removing gravity field: " + wErrorMsg);
+   }
+}
+
+void Physics::ClearGravityFields()
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   std::lock_guard<std::mutex> lock(m_physicsMutex);
+   m_gravityFields.clear();
+   m_gravityTreeDirty = true;
+   
 #if defined(_DEBUG_PHYSICS_)
-       debug.logDebugMessage(LogLevel::LOG_INFO, L"[Physics] Created 2D curved path with %zu total points", 
-                            path.coordinates.size());
+   debug.logLevelMessage(LogLevel::LOG_INFO, L"[Physics] Cleared all gravity fields");
 #endif
+}
+
+PhysicsVector3D Physics::CalculateGravityAtPosition(const PhysicsVector3D& position) const
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   PhysicsVector3D totalGravity(0.0f, -DEFAULT_GRAVITY, 0.0f); // Default downward gravity
+   
+   try
+   {
+       // Add gravitational forces from all gravity fields
+       totalGravity += EvaluateGravityFields(position);
    }
    catch (const std::exception& e)
    {
        std::string errorMsg = e.what();
        std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
-       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error creating 2D curved path: " + wErrorMsg);
-       
-       // Return empty path on error
-       path.Clear();
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error calculating gravity at position: " + wErrorMsg);
    }
    
-   return path;
+   return totalGravity;
 }
 
-CurvedPath3D Physics::CreateCurvedPath3D(const std::vector<PhysicsVector3D>& controlPoints, int resolution)
+void Physics::CalculateGravityAtPositions(const std::vector<PhysicsVector3D>& positions, std::vector<PhysicsVector3D>& outGravity) const
 {
    PHYSICS_RECORD_FUNCTION();
    
-   CurvedPath3D path;
-   
-   // Validate input parameters
-   if (controlPoints.size() < 2)
+   try
    {
-#if defined(_DEBUG_PHYSICS_)
-       debug.logLevelMessage(LogLevel::LOG_WARNING, L"[Physics] Need at least 2 control points for curved path");
-#endif
-       return path;
+       outGravity.resize(positions.size());
+       
+       const PhysicsVector3D uniformGravity(0.0f, -DEFAULT_GRAVITY, 0.0f);
+       for (size_t i = 0; i < positions.size(); ++i)
+       {
+           outGravity[i] = uniformGravity + EvaluateGravityFields(positions[i]);
+       }
    }
-   
-   if (resolution <= 0)
+   catch (const std::exception& e)
    {
-       resolution = 100; // Default resolution
+       std::string errorMsg = e.what();
+       std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error calculating gravity at positions: " + wErrorMsg);
    }
+}
+
+void Physics::SetGravityApproximation(bool enabled, float openingAngle, int exactFieldLimit)
+{
+   PHYSICS_RECORD_FUNCTION();
    
-   // Ensure we don't exceed maximum path coordinates
-   resolution = std::min(resolution, MAX_PATH_COORDINATES - static_cast<int>(controlPoints.size()));
+   std::lock_guard<std::mutex> lock(m_physicsMutex);
+   
+   // Opening angles above 1 let the point sit inside the accepted cell's bounding sphere
+   m_gravityApproximationEnabled = enabled;
+   m_gravityOpeningAngle = std::clamp(openingAngle, 0.0f, 1.0f);
+   m_gravityExactFieldLimit = std::max(exactFieldLimit, 0);
+   m_gravityTreeDirty = true;
    
 #if defined(_DEBUG_PHYSICS_)
-   debug.logDebugMessage(LogLevel::LOG_INFO, L"[Physics] Creating 3D curved path with %zu control points, resolution %d", 
-                        controlPoints.size(), resolution);
+   debug.logDebugMessage(LogLevel::LOG_INFO, L"[Physics] Gravity approximation %ls (opening angle %.2f, exact below %d fields)",
+                        enabled ? L"enabled" : L"disabled", m_gravityOpeningAngle, m_gravityExactFieldLimit);
 #endif
+}
+
+void Physics::RebuildGravityTree()
+{
+   if (!m_gravityTreeDirty)
+   {
+       return;
+   }
    
-   try
+   if (m_gravityApproximationEnabled && static_cast<int>(m_gravityFields.size()) >= m_gravityExactFieldLimit)
    {
-       // Generate smooth curve using Catmull-Rom spline interpolation
-       for (int i = 0; i < resolution; ++i)
+       m_gravityTree.Build(m_gravityFields);
+   }
+   else
+   {
+       m_gravityTree.Clear();
+   }
+   
+   m_gravityTreeDirty = false;
+}
+
+bool Physics::IsGravityTreeUsable() const
+{
+   return m_gravityApproximationEnabled && !m_gravityTreeDirty &&
+       static_cast<int>(m_gravityFields.size()) >= m_gravityExactFieldLimit;
+}
+
+PhysicsVector3D Physics::EvaluateGravityFields(const PhysicsVector3D& position) const
+{
+   if (IsGravityTreeUsable())
+   {
+       return m_gravityTree.Evaluate(position, m_gravityOpeningAngle);
+   }
+   
+   PhysicsVector3D fieldGravity;
+   for (const auto& gravityField : m_gravityFields)
+   {
+       fieldGravity += gravityField.CalculateGravityVector(position);
+   }
+   
+   return fieldGravity;
+}
+
+void Physics::AccumulateGravityFieldForces()
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   // Every body only writes its own acceleration, so batches can run on the solver workers
+   const int bodyCount = static_cast<int>(m_bodyStore.Size());
+   const int taskCount = (bodyCount + GRAVITY_BODIES_PER_TASK - 1) / GRAVITY_BODIES_PER_TASK;
+   const PhysicsWorkerPool::TaskFunction gravityTask = [this, bodyCount](int taskIndex) {
+       const int begin = taskIndex * GRAVITY_BODIES_PER_TASK;
+       const int end = std::min(begin + GRAVITY_BODIES_PER_TASK, bodyCount);
+       for (int bodyIndex = begin; bodyIndex < end; ++bodyIndex)
        {
-           float t = static_cast<float>(i) / static_cast<float>(resolution - 1);
-           
-           // Find the appropriate segment for this t value
-           float segmentT = t * static_cast<float>(controlPoints.size() - 1);
-           int segmentIndex = static_cast<int>(segmentT);
-           float localT = segmentT - static_cast<float>(segmentIndex);
-           
-           // Ensure we stay within bounds
-           segmentIndex = std::clamp(segmentIndex, 0, static_cast<int>(controlPoints.size()) - 2);
-           
-           // Get control points for Catmull-Rom interpolation
-           PhysicsVector3D p0 = (segmentIndex > 0) ? controlPoints[segmentIndex - 1] : controlPoints[segmentIndex];
-           PhysicsVector3D p1 = controlPoints[segmentIndex];
-           PhysicsVector3D p2 = controlPoints[segmentIndex + 1];
-           PhysicsVector3D p3 = (segmentIndex + 2 < static_cast<int>(controlPoints.size())) ? 
-                                 controlPoints[segmentIndex + 2] : controlPoints[segmentIndex + 1];
+           if (!m_bodyStore.IsSimulated(bodyIndex) ||
+               (m_bodyStore.flags[bodyIndex] & (PhysicsBodyStore::FLAG_STATIC | PhysicsBodyStore::FLAG_SLEEPING)))
+           {
+               continue;
+           }
            
-           // Calculate interpolated point using Catmull-Rom spline
-           PhysicsVector3D interpolatedPoint = CatmullRomInterpolation3D(p0, p1, p2, p3, localT);
-           path.AddPoint(interpolatedPoint);
+           const PhysicsVector3D fieldGravity = EvaluateGravityFields(m_bodyStore.GetPosition(bodyIndex));
+           m_bodyStore.accelerationX[bodyIndex] += fieldGravity.x * m_bodyStore.inverseMass[bodyIndex];
+           m_bodyStore.accelerationY[bodyIndex] += fieldGravity.y * m_bodyStore.inverseMass[bodyIndex];
+           m_bodyStore.accelerationZ[bodyIndex] += fieldGravity.z * m_bodyStore.inverseMass[bodyIndex];
        }
+   };
+   
+   if (taskCount > 1)
+   {
+       m_workerPool.ParallelFor(taskCount, gravityTask);
+   }
+   else if (taskCount == 1)
+   {
+       gravityTask(0);
+   }
+}
+
+float Physics::CalculateOrbitalVelocity(const PhysicsVector3D& position, const GravityField& gravityField) const
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   try
+   {
+       // Calculate distance from gravity center
+       float distance = FastDistance(position, gravityField.center);
        
-       // Add original control points to ensure path passes through them
-       for (const auto& controlPoint : controlPoints)
+       // Prevent division by zero
+       if (distance < 0.1f)
        {
-           path.AddPoint(controlPoint);
+           return 0.0f;
        }
        
+       // Orbital velocity formula: v = sqrt(GM/r)
+       // Simplified for gaming: v = sqrt(intensity * mass / distance)
+       float orbitalVelocity = FAST_SQRT((gravityField.intensity * gravityField.mass) / distance);
+       
 #if defined(_DEBUG_PHYSICS_)
-       debug.logDebugMessage(LogLevel::LOG_INFO, L"[Physics] Created 3D curved path with %zu total points", 
-                            path.coordinates.size());
+       debug.logDebugMessage(LogLevel::LOG_DEBUG, L"[Physics] Calculated orbital velocity: %.3f at distance %.2f", 
+                            orbitalVelocity, distance);
 #endif
+       
+       return orbitalVelocity;
    }
    catch (const std::exception& e)
    {
        std::string errorMsg = e.what();
        std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
-       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error creating 3D curved path: " + wErrorMsg);
-       
-       // Return empty path on error
-       path.Clear();
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error calculating orbital velocity: " + wErrorMsg);
+       return 0.0f;
    }
-   
-   return path;
 }
 
-PhysicsVector2D Physics::GetCurvePoint2D(const CurvedPath2D& path, float t) const
+float Physics::CalculateEscapeVelocity(const PhysicsVector3D& position, const GravityField& gravityField) const
 {
    PHYSICS_RECORD_FUNCTION();
    
-   // Clamp t to valid range [0, 1]
-   t = std::clamp(t, 0.0f, 1.0f);
-   
-   // Handle edge cases
-   if (path.coordinates.empty())
+   try
    {
-       return PhysicsVector2D();
+       // Calculate distance from gravity center
+       float distance = FastDistance(position, gravityField.center);
+       
+       // Prevent division by zero
+       if (distance < 0.1f)
+       {
+           return 0.0f;
+       }
+       
+       // Escape velocity formula: v = sqrt(2*GM/r)
+       // Simplified for gaming: v = sqrt(2 * intensity * mass / distance)
+       float escapeVelocity = FAST_SQRT((2.0f * gravityField.intensity * gravityField.mass) / distance);
+       
+#if defined(_DEBUG_PHYSICS_)
+       debug.logDebugMessage(LogLevel::LOG_DEBUG, L"[Physics] Calculated escape velocity: %.3f at distance %.2f", 
+                            escapeVelocity, distance);
+#endif
+       
+       return escapeVelocity;
    }
-   
-   if (path.coordinates.size() == 1)
+   catch (const std::exception& e)
    {
-       return path.coordinates[0];
+       std::string errorMsg = e.what();
+       std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error calculating escape velocity: " + wErrorMsg);
+       return 0.0f;
    }
-   
-   // Calculate distance along path
-   float targetDistance = t * path.totalLength;
-   return path.GetPointAtDistance(targetDistance);
 }
 
-PhysicsVector3D Physics::GetCurvePoint3D(const CurvedPath3D& path, float t) const
+//==============================================================================
+// Bouncing and Trajectory Methods Implementation
+//==============================================================================
+// Shared by both CalculateBouncingTrajectory overloads - emitPoint(point) returns false once storage is full
+// Returns the number of bounces simulated.
+template<typename EmitPoint>
+static int TraceBouncingTrajectory(Physics& physics, const PhysicsVector3D& startPosition, const PhysicsVector3D& initialVelocity,
+    float groundHeight, float restitution, float drag, int maxBounces, EmitPoint&& emitPoint)
 {
-   PHYSICS_RECORD_FUNCTION();
-   
-   // Clamp t to valid range [0, 1]
-   t = std::clamp(t, 0.0f, 1.0f);
-   
-   // Handle edge cases
-   if (path.coordinates.empty())
-   {
-       return PhysicsVector3D();
-   }
-   
-   if (path.coordinates.size() == 1)
-   {
-       return path.coordinates[0];
-   }
-   
-   // Calculate distance along path
-   float targetDistance = t * path.totalLength;
-   return path.GetPointAtDistance(targetDistance);
+    PhysicsVector3D currentPosition = startPosition;
+    PhysicsVector3D currentVelocity = initialVelocity;
+
+    float timeStep = 0.016f; // 60 FPS time step
+    float currentTime = 0.0f;
+    int bounceCount = 0;
+
+    // Add starting position
+    bool hasRoom = emitPoint(currentPosition);
+
+    // Simulate trajectory with bouncing
+    while (hasRoom && bounceCount < maxBounces && currentTime < 30.0f) // Maximum simulation time
+    {
+        // Apply gravity
+        PhysicsVector3D gravity = physics.CalculateGravityAtPosition(currentPosition);
+        currentVelocity += gravity * timeStep;
+
+        // Apply drag
+        float dragFactor = 1.0f - (drag * timeStep);
+        dragFactor = std::max(0.0f, dragFactor);
+        currentVelocity *= dragFactor;
+
+        // Update position
+        PhysicsVector3D nextPosition = currentPosition + currentVelocity * timeStep;
+
+        // Check for ground collision
+        if (nextPosition.y <= groundHeight && currentVelocity.y < 0.0f)
+        {
+            // Calculate exact collision point
+            float collisionTime = (groundHeight - currentPosition.y) / currentVelocity.y;
+            PhysicsVector3D collisionPoint = currentPosition + currentVelocity * collisionTime;
+            collisionPoint.y = groundHeight;
+
+            // Add collision point to trajectory
+            hasRoom = emitPoint(collisionPoint);
+
+            // Calculate reflection
+            PhysicsVector3D surfaceNormal(0.0f, 1.0f, 0.0f); // Ground normal points up
+            ReflectionData reflection = physics.CalculateReflection(currentVelocity, surfaceNormal, restitution, 0.1f);
+            currentVelocity = reflection.reflectedVelocity;
+            currentPosition = collisionPoint;
+
+            bounceCount++;
+
+            // Stop if velocity becomes too small
+            if (currentVelocity.Magnitude() < MIN_VELOCITY_THRESHOLD)
+            {
+                break;
+            }
+        }
+        else
+        {
+            currentPosition = nextPosition;
+            hasRoom = emitPoint(currentPosition);
+        }
+
+        currentTime += timeStep;
+    }
+
+    return bounceCount;
 }
 
-PhysicsVector2D Physics::GetCurveTangent2D(const CurvedPath2D& path, float t) const
+std::vector<PhysicsVector3D> Physics::CalculateBouncingTrajectory(const PhysicsVector3D& startPosition, 
+                                                                 const PhysicsVector3D& initialVelocity, 
+                                                                 float groundHeight, float restitution, 
+                                                                 float drag, int maxBounces)
 {
    PHYSICS_RECORD_FUNCTION();
    
-   // Clamp t to valid range [0, 1]
-   t = std::clamp(t, 0.0f, 1.0f);
+   std::vector<PhysicsVector3D> trajectory;
+   trajectory.reserve(maxBounces * 10); // Reserve space for trajectory points
    
-   // Handle edge cases
-   if (path.tangents.empty())
+   try
    {
-       return PhysicsVector2D(1.0f, 0.0f); // Default to right direction
+#if defined(_DEBUG_PHYSICS_)
+       const int bounceCount =
+#endif
+       TraceBouncingTrajectory(*this, startPosition, initialVelocity, groundHeight, restitution, drag,
+           maxBounces, [&trajectory](const PhysicsVector3D& point) { trajectory.push_back(point); return true; });
+       
+#if defined(_DEBUG_PHYSICS_)
+       debug.logDebugMessage(LogLevel::LOG_INFO, L"[Physics] Calculated bouncing trajectory with %zu points and %d bounces", 
+                            trajectory.size(), bounceCount);
+#endif
+   }
+   catch (const std::exception& e)
+   {
+       std::string errorMsg = e.what();
+       std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error calculating bouncing trajectory: " + wErrorMsg);
    }
    
-   // Calculate distance along path
-   float targetDistance = t * path.totalLength;
-   return path.GetTangentAtDistance(targetDistance);
+   return trajectory;
 }
 
-PhysicsVector3D Physics::GetCurveTangent3D(const CurvedPath3D& path, float t) const
+size_t Physics::CalculateBouncingTrajectory(const PhysicsVector3D& startPosition, const PhysicsVector3D& initialVelocity,
+                                            float groundHeight, PhysicsVector3D* outPoints, size_t capacity,
+                                            float restitution, float drag, int maxBounces)
 {
    PHYSICS_RECORD_FUNCTION();
    
-   // Clamp t to valid range [0, 1]
-   t = std::clamp(t, 0.0f, 1.0f);
+   size_t pointCount = 0;
+   if (!outPoints || capacity == 0)
+   {
+       return 0;
+   }
    
-   // Handle edge cases
-   if (path.tangents.empty())
+   try
    {
-       return PhysicsVector3D(1.0f, 0.0f, 0.0f); // Default to forward direction
+       TraceBouncingTrajectory(*this, startPosition, initialVelocity, groundHeight, restitution, drag, maxBounces,
+           [&](const PhysicsVector3D& point) { outPoints[pointCount++] = point; return pointCount < capacity; });
+   }
+   catch (const std::exception& e)
+   {
+       std::string errorMsg = e.what();
+       std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error calculating bouncing trajectory: " + wErrorMsg);
    }
    
-   // Calculate distance along path
-   float targetDistance = t * path.totalLength;
-   return path.GetTangentAtDistance(targetDistance);
+   return pointCount;
 }
 
-float Physics::CalculateCurveLength2D(const CurvedPath2D& path, float startT, float endT) const
+PhysicsVector3D Physics::CalculateRestingPosition(const PhysicsVector3D& startPosition, 
+                                                 const PhysicsVector3D& initialVelocity, 
+                                                 float groundHeight, float restitution, float drag)
 {
    PHYSICS_RECORD_FUNCTION();
    
-   // Ensure valid t range
-   startT = std::clamp(startT, 0.0f, 1.0f);
-   endT = std::clamp(endT, 0.0f, 1.0f);
-   
-   if (startT > endT)
+   try
    {
-       std::swap(startT, endT);
+       // Calculate final trajectory
+       std::vector<PhysicsVector3D> trajectory = CalculateBouncingTrajectory(startPosition, initialVelocity, 
+                                                                             groundHeight, restitution, drag, 20);
+       
+       // Return last position in trajectory as resting position
+       if (!trajectory.empty())
+       {
+           PhysicsVector3D restingPosition = trajectory.back();
+           restingPosition.y = groundHeight; // Ensure it's on the ground
+           
+#if defined(_DEBUG_PHYSICS_)
+           debug.logDebugMessage(LogLevel::LOG_INFO, L"[Physics] Calculated resting position: (%.2f, %.2f, %.2f)", 
+                                restingPosition.x, restingPosition.y, restingPosition.z);
+#endif
+           
+           return restingPosition;
+       }
+       else
+       {
+           // Fallback to start position on ground
+           PhysicsVector3D fallbackPosition = startPosition;
+           fallbackPosition.y = groundHeight;
+           return fallbackPosition;
+       }
    }
+   catch (const std::exception& e)
+   {
+       std::string errorMsg = e.what();
+       std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error calculating resting position: " + wErrorMsg);
+       
+       // Return safe fallback position
+       PhysicsVector3D fallbackPosition = startPosition;
+       fallbackPosition.y = groundHeight;
+       return fallbackPosition;
+   }
+}
+
+//==============================================================================
+// Collision Detection Methods Implementation
+//==============================================================================
+bool Physics::CheckAABBCollision(const PhysicsVector3D& minA, const PhysicsVector3D& maxA, 
+                                const PhysicsVector3D& minB, const PhysicsVector3D& maxB) const
+{
+   PHYSICS_RECORD_FUNCTION();
    
-   // Calculate distances along path
-   float startDistance = startT * path.totalLength;
-   float endDistance = endT * path.totalLength;
-   
-   return endDistance - startDistance;
+   // AABB collision detection using separating axis theorem
+   return (minA.x <= maxB.x && maxA.x >= minB.x &&
+           minA.y <= maxB.y && maxA.y >= minB.y &&
+           minA.z <= maxB.z && maxA.z >= minB.z);
 }
 
-float Physics::CalculateCurveLength3D(const CurvedPath3D& path, float startT, float endT) const
+bool Physics::CheckSphereCollision(const PhysicsVector3D& centerA, float radiusA, 
+                                  const PhysicsVector3D& centerB, float radiusB) const
 {
    PHYSICS_RECORD_FUNCTION();
    
-   // Ensure valid t range
-   startT = std::clamp(startT, 0.0f, 1.0f);
-   endT = std::clamp(endT, 0.0f, 1.0f);
+   // Sphere collision detection using distance comparison
+   float distance = FastDistance(centerA, centerB);
+   float combinedRadius = radiusA + radiusB;
    
-   if (startT > endT)
+   return distance <= combinedRadius;
+}
+
+bool Physics::RaySphereIntersection(const PhysicsVector3D& rayOrigin, const PhysicsVector3D& rayDirection, 
+                                   const PhysicsVector3D& sphereCenter, float sphereRadius, float& hitDistance) const
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   try
    {
-       std::swap(startT, endT);
+       // Ray-sphere intersection using quadratic formula
+       PhysicsVector3D toSphere = rayOrigin - sphereCenter;
+       
+       float a = FastDotProduct(rayDirection, rayDirection);
+       float b = 2.0f * FastDotProduct(toSphere, rayDirection);
+       float c = FastDotProduct(toSphere, toSphere) - (sphereRadius * sphereRadius);
+       
+       float discriminant = b * b - 4.0f * a * c;
+       
+       if (discriminant < 0.0f)
+       {
+           return false; // No intersection
+       }
+       
+       // Calculate hit distance
+       float sqrtDiscriminant = FAST_SQRT(discriminant);
+       float t1 = (-b - sqrtDiscriminant) / (2.0f * a);
+       float t2 = (-b + sqrtDiscriminant) / (2.0f * a);
+       
+       // Return closest positive intersection
+       if (t1 > 0.0f)
+       {
+           hitDistance = t1;
+           return true;
+       }
+       else if (t2 > 0.0f)
+       {
+           hitDistance = t2;
+           return true;
+       }
+       
+       return false; // Intersection behind ray origin
+   }
+   catch (const std::exception& e)
+   {
+       std::string errorMsg = e.what();
+       std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error in ray-sphere intersection: " + wErrorMsg);
+       return false;
    }
-   
-   // Calculate distances along path
-   float startDistance = startT * path.totalLength;
-   float endDistance = endT * path.totalLength;
-   
-   return endDistance - startDistance;
 }
 
-//==============================================================================
-// Reflection Path Calculation Methods
-//==============================================================================
-ReflectionData Physics::CalculateReflection(const PhysicsVector3D& incomingVelocity, const PhysicsVector3D& surfaceNormal, 
-                                          float restitution, float friction)
+bool Physics::ContinuousCollisionDetection(const PhysicsBody& bodyA, const PhysicsBody& bodyB, float deltaTime) const
 {
    PHYSICS_RECORD_FUNCTION();
    
-   ReflectionData reflectionData;
-   reflectionData.incomingVelocity = incomingVelocity;
-   reflectionData.surfaceNormal = surfaceNormal.Normalized();
-   reflectionData.restitution = std::clamp(restitution, 0.0f, 1.0f);
-   reflectionData.friction = std::clamp(friction, 0.0f, 1.0f);
-   
    try
    {
-       // Calculate velocity components relative to surface normal
-       float normalVelocity = FastDotProduct(incomingVelocity, reflectionData.surfaceNormal);
-       PhysicsVector3D normalComponent = reflectionData.surfaceNormal * normalVelocity;
-       PhysicsVector3D tangentialComponent = incomingVelocity - normalComponent;
+       // Simple CCD using swept sphere test
+       PhysicsVector3D relativeVelocity = bodyA.velocity - bodyB.velocity;
+       PhysicsVector3D relativePosition = bodyA.position - bodyB.position;
        
-       // Apply reflection to normal component with restitution
-       PhysicsVector3D reflectedNormal = normalComponent * (-reflectionData.restitution);
+       // Treat bodies as spheres using their collision radius
+       float combinedRadius = bodyA.radius + bodyB.radius;
        
-       // Apply friction to tangential component
-       PhysicsVector3D reflectedTangential = tangentialComponent * (1.0f - reflectionData.friction);
+       // Check if objects are moving toward each other
+       if (FastDotProduct(relativeVelocity, relativePosition) >= 0.0f)
+       {
+           return false; // Moving away from each other
+       }
        
-       // Combine components for final reflected velocity
-       reflectionData.reflectedVelocity = reflectedNormal + reflectedTangential;
+       // Calculate time to collision
+       float relativeSpeed = relativeVelocity.Magnitude();
+       float currentDistance = relativePosition.Magnitude();
        
-       // Calculate energy loss
-       float incomingEnergy = incomingVelocity.MagnitudeSquared();
-       float reflectedEnergy = reflectionData.reflectedVelocity.MagnitudeSquared();
-       reflectionData.energyLoss = (incomingEnergy - reflectedEnergy) / incomingEnergy;
+       if (relativeSpeed > MIN_VELOCITY_THRESHOLD)
+       {
+           float timeToCollision = (currentDistance - combinedRadius) / relativeSpeed;
+           return timeToCollision <= deltaTime && timeToCollision >= 0.0f;
+       }
        
-#if defined(_DEBUG_PHYSICS_)
-       debug.logDebugMessage(LogLevel::LOG_DEBUG, L"[Physics] Calculated reflection - Energy loss: %.3f, Restitution: %.3f", 
-                            reflectionData.energyLoss, reflectionData.restitution);
-#endif
+       return false;
    }
    catch (const std::exception& e)
    {
        std::string errorMsg = e.what();
        std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
-       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error calculating reflection: " + wErrorMsg);
-       
-       // Return safe default values
-       reflectionData.reflectedVelocity = PhysicsVector3D();
-       reflectionData.energyLoss = 1.0f;
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error in continuous collision detection: " + wErrorMsg);
+       return false;
    }
-   
-   return reflectionData;
 }
 
-PhysicsVector2D Physics::CalculateReflection2D(const PhysicsVector2D& incomingVelocity, const PhysicsVector2D& surfaceNormal, 
-                                             float restitution)
+void Physics::SolveContinuousCollisions(float deltaTime)
 {
    PHYSICS_RECORD_FUNCTION();
    
    try
    {
-       // Normalize surface normal
-       PhysicsVector2D normal = surfaceNormal.Normalized();
+       // Flag bodies whose integrated motion is large compared to their own size
+       const size_t bodyCount = std::min(m_bodyStore.Size(), m_ccdStartX.size());
+       const uint32_t sweepFlags = PhysicsBodyStore::FLAG_SIMULATED | PhysicsBodyStore::FLAG_STATIC | PhysicsBodyStore::FLAG_SLEEPING;
+       m_ccdBodies.clear();
+       for (size_t i = 0; i < bodyCount; ++i)
+       {
+           if ((m_bodyStore.flags[i] & sweepFlags) != PhysicsBodyStore::FLAG_SIMULATED)
+           {
+               continue;
+           }
+           
+           const float dx = m_bodyStore.positionX[i] - m_ccdStartX[i];
+           const float dy = m_bodyStore.positionY[i] - m_ccdStartY[i];
+           const float dz = m_bodyStore.positionZ[i] - m_ccdStartZ[i];
+           const float threshold = m_bodyStore.radius[i] * CCD_MOTION_RADIUS_RATIO;
+           if (dx * dx + dy * dy + dz * dz > threshold * threshold)
+           {
+               m_ccdBodies.push_back(static_cast<int>(i));
+           }
+       }
        
-       // Calculate reflection using formula: R = V - 2(V·N)N
-       float dotProduct = incomingVelocity.Dot(normal);
-       PhysicsVector2D reflection = incomingVelocity - normal * (2.0f * dotProduct);
+       m_ccdSweptBodyCount.store(static_cast<int>(m_ccdBodies.size()));
+       m_ccdImpacts.resize(m_ccdBodies.size());
+       if (m_ccdBodies.empty())
+       {
+           m_ccdImpactCount.store(0);
+           return;
+       }
        
-       // Apply restitution coefficient
-       reflection *= std::clamp(restitution, 0.0f, 1.0f);
+       // Sweeps only read the world, so every fast body is swept concurrently
+       const int sweptCount = static_cast<int>(m_ccdBodies.size());
+       const int taskCount = (sweptCount + CCD_BODIES_PER_TASK - 1) / CCD_BODIES_PER_TASK;
+       const PhysicsWorkerPool::TaskFunction sweepTask = [this](int taskIndex) {
+           const int end = std::min(static_cast<int>(m_ccdBodies.size()), (taskIndex + 1) * CCD_BODIES_PER_TASK);
+           for (int k = taskIndex * CCD_BODIES_PER_TASK; k < end; ++k)
+           {
+               const int bodyIndex = m_ccdBodies[k];
+               const PhysicsVector3D start(m_ccdStartX[bodyIndex], m_ccdStartY[bodyIndex], m_ccdStartZ[bodyIndex]);
+               PhysicsTimeOfImpact& impact = m_ccdImpacts[k];
+               if (!FindTimeOfImpact(bodyIndex, start, m_bodyStore.GetPosition(bodyIndex) - start, impact))
+               {
+                   impact = PhysicsTimeOfImpact();                              // Missed everything - dropped below
+               }
+           }
+       };
+       m_workerPool.ParallelFor(taskCount, sweepTask);
+       
+       // Resolve impacts earliest first - a body hit early is pushed before later sweeps read it
+       m_ccdImpacts.erase(std::remove_if(m_ccdImpacts.begin(), m_ccdImpacts.end(),
+           [](const PhysicsTimeOfImpact& impact) { return impact.otherIndex < 0; }), m_ccdImpacts.end());
+       std::sort(m_ccdImpacts.begin(), m_ccdImpacts.end());
+       m_ccdImpactCount.store(static_cast<int>(m_ccdImpacts.size()));
+       
+       for (const PhysicsTimeOfImpact& impact : m_ccdImpacts)
+       {
+           AdvanceSweptBody(impact.bodyIndex, deltaTime);
+       }
        
 #if defined(_DEBUG_PHYSICS_)
-       debug.logDebugMessage(LogLevel::LOG_DEBUG, L"[Physics] Calculated 2D reflection with restitution: %.3f", restitution);
+       if (!m_ccdImpacts.empty())
+       {
+           debug.logDebugMessage(LogLevel::LOG_DEBUG, L"[Physics] CCD swept %d bodies, %zu impacts (first at %.3f)",
+               sweptCount, m_ccdImpacts.size(), m_ccdImpacts.front().fraction);
+       }
 #endif
-       
-       return reflection;
    }
    catch (const std::exception& e)
    {
        std::string errorMsg = e.what();
        std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
-       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error calculating 2D reflection: " + wErrorMsg);
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error in continuous collision stage: " + wErrorMsg);
+   }
+}
+
+bool Physics::FindTimeOfImpact(int bodyIndex, const PhysicsVector3D& start, const PhysicsVector3D& motion,
+                               PhysicsTimeOfImpact& outImpact) const
+{
+   // Caller holds m_physicsMutex - runs on solver workers, so it must not write shared state
+   const float distance = std::sqrt(motion.MagnitudeSquared());
+   if (distance < MIN_VELOCITY_THRESHOLD)
+   {
+       return false;
+   }
+   
+   struct SweepContext {
+       const PhysicsBodyStore* store;
+       int bodyIndex;
+       PhysicsVector3D start;
+       PhysicsVector3D motion;
+       float fraction;
+       int otherIndex;
+   };
+   SweepContext sweep = { &m_bodyStore, bodyIndex, start, motion, 2.0f, -1 };
+   
+   // Capturing only the context keeps the callback in std::function's inline buffer
+   const PhysicsDynamicTree::QueryCallback visit = [&sweep](int otherIndex) -> bool {
+       const PhysicsBodyStore& store = *sweep.store;
+       if (otherIndex == sweep.bodyIndex || !store.IsSimulated(otherIndex) || !store.ShouldCollide(sweep.bodyIndex, otherIndex))
+       {
+           return true;
+       }
        
-       return PhysicsVector2D();
+       float fraction = 0.0f;
+       const float combinedRadius = store.radius[sweep.bodyIndex] + store.radius[otherIndex];
+       if (SweptSphereFraction(sweep.start, sweep.motion, store.GetPosition(otherIndex), combinedRadius, fraction) &&
+           (fraction < sweep.fraction || (fraction == sweep.fraction && otherIndex < sweep.otherIndex)))
+       {
+           sweep.fraction = fraction;
+           sweep.otherIndex = otherIndex;
+       }
+       return true;
+   };
+   m_bodyTree.RayQuery(start, motion * (1.0f / distance), distance, m_bodyStore.radius[bodyIndex], visit);
+   
+   if (sweep.otherIndex < 0)
+   {
+       return false;
    }
+   
+   outImpact.fraction = sweep.fraction;
+   outImpact.bodyIndex = bodyIndex;
+   outImpact.otherIndex = sweep.otherIndex;
+   return true;
 }
 
-std::vector<PhysicsVector3D> Physics::CalculateMultipleBounces(const PhysicsVector3D& startPosition, 
-                                                             const PhysicsVector3D& initialVelocity, 
-                                                             const std::vector<PhysicsVector3D>& surfaceNormals, 
-                                                             int maxBounces)
+void Physics::AdvanceSweptBody(int bodyIndex, float deltaTime)
 {
-   PHYSICS_RECORD_FUNCTION();
-   
-   std::vector<PhysicsVector3D> bouncePath;
-   bouncePath.reserve(maxBounces + 1);
+   // Caller holds m_physicsMutex
+   PhysicsBodyStore& store = m_bodyStore;
+   PhysicsVector3D position(m_ccdStartX[bodyIndex], m_ccdStartY[bodyIndex], m_ccdStartZ[bodyIndex]);
+   PhysicsVector3D motion = store.GetPosition(bodyIndex) - position;
+   PhysicsVector3D velocity = store.GetVelocity(bodyIndex);
+   float remaining = 1.0f;
    
-   try
+   // The integrated motion is swept first - after every impact the rest of the step is swept again
+   // with the response velocity. A body still hitting things after the last substep stays where it
+   // touched, leaving the remaining contact to the discrete solver.
+   for (int substep = 0; substep < m_ccdMaxSubsteps && remaining > 0.0f; ++substep)
    {
-       PhysicsVector3D currentPosition = startPosition;
-       PhysicsVector3D currentVelocity = initialVelocity;
+       PhysicsTimeOfImpact impact;
+       if (!FindTimeOfImpact(bodyIndex, position, motion, impact))
+       {
+           position += motion;
+           break;
+       }
        
-       // Add starting position
-       bouncePath.push_back(currentPosition);
+       // Stop just short of the surface so the bodies touch without overlapping
+       const float motionLength = std::sqrt(motion.MagnitudeSquared());
+       const float fraction = std::max(0.0f, impact.fraction - CONTACT_LINEAR_SLOP / motionLength);
+       position += motion * fraction;
+       remaining *= 1.0f - fraction;
        
-       // Calculate each bounce
-       for (int bounce = 0; bounce < maxBounces && bounce < static_cast<int>(surfaceNormals.size()); ++bounce)
+       // Restitution impulse along the line of centres, shared by inverse mass (static bodies have none)
+       const int otherIndex = impact.otherIndex;
+       PhysicsVector3D normal = store.GetPosition(otherIndex) - position;
+       const float normalLength = std::sqrt(normal.MagnitudeSquared());
+       if (normalLength > MIN_VELOCITY_THRESHOLD)
        {
-           // Simulate movement until collision (simplified)
-           currentPosition += currentVelocity * 0.1f; // Simplified time step
-           
-           // Calculate reflection
-           ReflectionData reflection = CalculateReflection(currentVelocity, surfaceNormals[bounce]);
-           currentVelocity = reflection.reflectedVelocity;
-           
-           // Add bounce position
-           bouncePath.push_back(currentPosition);
-           
-           // Stop if velocity becomes too small
-           if (currentVelocity.Magnitude() < MIN_VELOCITY_THRESHOLD)
+           normal = normal * (1.0f / normalLength);
+           const PhysicsVector3D otherVelocity = store.GetVelocity(otherIndex);
+           const float approachSpeed = (velocity - otherVelocity).Dot(normal);
+           const float inverseMassA = store.inverseMass[bodyIndex];
+           const float inverseMassB = (store.flags[otherIndex] & PhysicsBodyStore::FLAG_STATIC) ? 0.0f : store.inverseMass[otherIndex];
+           if (approachSpeed > 0.0f && inverseMassA + inverseMassB > 0.0f)
            {
-               break;
+               const float restitution = std::min(store.restitution[bodyIndex], store.restitution[otherIndex]);
+               const float impulse = (1.0f + restitution) * approachSpeed / (inverseMassA + inverseMassB);
+               velocity -= normal * (impulse * inverseMassA);
+               
+               if (inverseMassB > 0.0f)
+               {
+                   const PhysicsVector3D newOtherVelocity = otherVelocity + normal * (impulse * inverseMassB);
+                   store.velocityX[otherIndex] = newOtherVelocity.x;
+                   store.velocityY[otherIndex] = newOtherVelocity.y;
+                   store.velocityZ[otherIndex] = newOtherVelocity.z;
+                   store.WakeUp(otherIndex);
+               }
            }
        }
        
-#if defined(_DEBUG_PHYSICS_)
-       debug.logDebugMessage(LogLevel::LOG_INFO, L"[Physics] Calculated %zu bounce positions with %d max bounces", 
-                            bouncePath.size(), maxBounces);
-#endif
-   }
-   catch (const std::exception& e)
-   {
-       std::string errorMsg = e.what();
-       std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
-       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error calculating multiple bounces: " + wErrorMsg);
+       motion = velocity * (deltaTime * remaining);
    }
    
-   return bouncePath;
+   store.positionX[bodyIndex] = position.x;
+   store.positionY[bodyIndex] = position.y;
+   store.positionZ[bodyIndex] = position.z;
+   store.velocityX[bodyIndex] = velocity.x;
+   store.velocityY[bodyIndex] = velocity.y;
+   store.velocityZ[bodyIndex] = velocity.z;
+   SyncBodyProxy(bodyIndex, velocity * deltaTime);
 }
 
-//==============================================================================
-// Internal Helper Methods Implementation
-//==============================================================================
-PhysicsVector2D Physics::CatmullRomInterpolation2D(const PhysicsVector2D& p0, const PhysicsVector2D& p1, 
-                                                  const PhysicsVector2D& p2, const PhysicsVector2D& p3, float t) const
+bool Physics::SweptSphereFraction(const PhysicsVector3D& start, const PhysicsVector3D& motion, const PhysicsVector3D& target,
+                                  float combinedRadius, float& outFraction)
 {
-   // Catmull-Rom spline interpolation formula
-   float t2 = t * t;
-   float t3 = t2 * t;
+   // First t in [0, 1] with |start + motion * t - target| = combinedRadius
+   const PhysicsVector3D offset = start - target;
+   const float c = offset.MagnitudeSquared() - combinedRadius * combinedRadius;
+   const float b = offset.Dot(motion);
    
-   // Calculate interpolation coefficients
-   float c0 = -0.5f * t3 + t2 - 0.5f * t;
-   float c1 = 1.5f * t3 - 2.5f * t2 + 1.0f;
-   float c2 = -1.5f * t3 + 2.0f * t2 + 0.5f * t;
-   float c3 = 0.5f * t3 - 0.5f * t2;
+   // Pairs already touching belong to the discrete solver, and separating pairs cannot hit
+   if (c <= 0.0f || b >= 0.0f)
+   {
+       return false;
+   }
    
-   // Apply coefficients to control points
-   return p0 * c0 + p1 * c1 + p2 * c2 + p3 * c3;
-}
-
-PhysicsVector3D Physics::CatmullRomInterpolation3D(const PhysicsVector3D& p0, const PhysicsVector3D& p1, 
-                                                  const PhysicsVector3D& p2, const PhysicsVector3D& p3, float t) const
-{
-   // Catmull-Rom spline interpolation formula
-   float t2 = t * t;
-   float t3 = t2 * t;
+   const float a = motion.MagnitudeSquared();
+   const float discriminant = b * b - a * c;
+   if (discriminant < 0.0f)
+   {
+       return false;
+   }
    
-   // Calculate interpolation coefficients
-   float c0 = -0.5f * t3 + t2 - 0.5f * t;
-   float c1 = 1.5f * t3 - 2.5f * t2 + 1.0f;
-   float c2 = -1.5f * t3 + 2.0f * t2 + 0.5f * t;
-   float c3 = 0.5f * t3 - 0.5f * t2;
+   const float t = (-b - std::sqrt(discriminant)) / a;
+   if (t > 1.0f)
+   {
+       return false;
+   }
    
-   // Apply coefficients to control points
-   return p0 * c0 + p1 * c1 + p2 * c2 + p3 * c3;
-}
-
-void Physics::VerletIntegration(PhysicsBody& body, float deltaTime)
-{
-    PHYSICS_RECORD_FUNCTION();
-
-    try
-    {
-        // Verlet integration for better stability
-        // x(t+dt) = 2*x(t) - x(t-dt) + a(t)*dt^2
-
-        // Only integrate for dynamic bodies
-        if (!body.isStatic && body.isActive)
-        {
-            // Store previous position for next frame
-            static std::unordered_map<PhysicsBody*, PhysicsVector3D> previousPositions;
-
-            PhysicsVector3D currentPosition = body.position;
-            PhysicsVector3D acceleration = body.acceleration;
-
-            // Get previous position or initialize with current position for first frame
-            auto it = previousPositions.find(&body);
-            PhysicsVector3D previousPosition = (it != previousPositions.end()) ? it->second : currentPosition;
-
-            // Calculate new position using Verlet integration formula
-            PhysicsVector3D newPosition = currentPosition * 2.0f - previousPosition + acceleration * (deltaTime * deltaTime);
-
-            // Calculate velocity using CURRENT and PREVIOUS positions with proper vector scalar division
-            // This is the correct Verlet velocity calculation for PhysicsVector3D
-            if (deltaTime > MIN_VELOCITY_THRESHOLD)
-            {
-                float invDeltaTime = 1.0f / deltaTime;
-                body.velocity = (currentPosition - previousPosition) * invDeltaTime;
-            }
-            else
-            {
-                // Prevent division by zero for very small time steps
-                body.velocity = PhysicsVector3D(0.0f, 0.0f, 0.0f);
-            }
-
-            // Apply drag to velocity
-            float dragFactor = 1.0f - (body.drag * deltaTime);
-            dragFactor = std::max(0.0f, dragFactor);
-            body.velocity *= dragFactor;
-
-            // Store current position as previous for next frame
-            previousPositions[&body] = currentPosition;
-
-            // Update body position to new calculated position
-            body.position = newPosition;
-
-            // Reset acceleration for next frame
-            body.acceleration = PhysicsVector3D();
-        }
-    }
-    catch (const std::exception& e)
-    {
-        std::string errorMsg = e.what();
-        std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
-        debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error in Verlet integration: " + wErrorMsg);
-    }
-}
-
-float Physics::FastMagnitude(const PhysicsVector3D& vector) const
-{
-   // Use MathPrecalculation for fast square root
-   return FAST_SQRT(vector.x * vector.x + vector.y * vector.y + vector.z * vector.z);
+   outFraction = std::max(t, 0.0f);
+   return true;
 }
 
-PhysicsVector3D Physics::FastNormalize(const PhysicsVector3D& vector) const
+//==============================================================================
+// Audio Physics Methods Implementation
+//==============================================================================
+AudioPhysicsData Physics::CalculateAudioPhysics(const PhysicsVector3D& listenerPosition, 
+                                               const PhysicsVector3D& sourcePosition, 
+                                               const PhysicsVector3D& sourceVelocity)
 {
-   // Calculate magnitude using fast math
-   float magnitude = FastMagnitude(vector);
+   PHYSICS_RECORD_FUNCTION();
    
-   // Handle zero-length vector
-if (magnitude < MIN_VELOCITY_THRESHOLD)
+   AudioPhysicsData audioData;
+   audioData.listenerPosition = listenerPosition;
+   audioData.sourcePosition = sourcePosition;
+   audioData.sourceVelocity = sourceVelocity;
+   
+   try
    {
-       return PhysicsVector3D(0.0f, 0.0f, 0.0f);
+       // Calculate audio properties
+       audioData.CalculateAudioProperties();
+       
+#if defined(_DEBUG_PHYSICS_)
+       debug.logDebugMessage(LogLevel::LOG_DEBUG, L"[Physics] Calculated audio physics - Distance: %.2f, Doppler: %.3f", 
+                            audioData.distance, audioData.dopplerShift);
+#endif
+   }
+   catch (const std::exception& e)
+   {
+       std::string errorMsg = e.what();
+       std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error calculating audio physics: " + wErrorMsg);
    }
    
-   // Normalize using fast inverse
-   float invMagnitude = 1.0f / magnitude;
-   return PhysicsVector3D(vector.x * invMagnitude, vector.y * invMagnitude, vector.z * invMagnitude);
-}
-
-float Physics::FastDotProduct(const PhysicsVector3D& a, const PhysicsVector3D& b) const
-{
-   // Standard dot product calculation
-   return a.x * b.x + a.y * b.y + a.z * b.z;
-}
-
-PhysicsVector3D Physics::FastCrossProduct(const PhysicsVector3D& a, const PhysicsVector3D& b) const
-{
-   // Standard cross product calculation
-   return PhysicsVector3D(
-       a.y * b.z - a.z * b.y,
-       a.z * b.x - a.x * b.z,
-       a.x * b.y - a.y * b.x
-   );
-}
-
-float Physics::FastDistance(const PhysicsVector3D& a, const PhysicsVector3D& b) const
-{
-   // Calculate distance using fast magnitude
-   PhysicsVector3D diff = b - a;
-   return FastMagnitude(diff);
+   return audioData;
 }
 
-//==============================================================================
-// Gravity Field Methods Implementation
-//==============================================================================
-void Physics::AddGravityField(const GravityField& gravityField)
+float Physics::CalculateDopplerShift(const PhysicsVector3D& sourceVelocity, const PhysicsVector3D& listenerVelocity, 
+                                    const PhysicsVector3D& direction, float speedOfSound) const
 {
    PHYSICS_RECORD_FUNCTION();
    
    try
    {
-       std::lock_guard<std::mutex> lock(m_physicsMutex);
-       m_gravityFields.push_back(gravityField);
+       // Calculate relative velocities along the line of sight
+       float sourceVelAlongLOS = FastDotProduct(sourceVelocity, direction);
+       float listenerVelAlongLOS = FastDotProduct(listenerVelocity, direction);
        
-#if defined(_DEBUG_PHYSICS_)
-       debug.logDebugMessage(LogLevel::LOG_INFO, L"[Physics] Added gravity field at position (%.2f, %.2f, %.2f) with mass %.2f", 
-                            gravityField.center.x, gravityField.center.y, gravityField.center.z, gravityField.mass);
-#endif
+       // Doppler shift formula: f' = f * (v + vr) / (v + vs)
+       // where v = speed of sound, vr = receiver velocity, vs = source velocity
+       float dopplerFactor = (speedOfSound + listenerVelAlongLOS) / (speedOfSound + sourceVelAlongLOS);
+       
+       // Clamp to reasonable range
+       return std::clamp(dopplerFactor, 0.5f, 2.0f);
    }
    catch (const std::exception& e)
    {
        std::string errorMsg = e.what();
        std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
-       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error adding gravity field: " + wErrorMsg);
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error calculating Doppler shift: " + wErrorMsg);
+       return 1.0f; // No shift on error
    }
 }
 
-void Physics::RemoveGravityField(int index)
+float Physics::CalculateSoundOcclusion(const PhysicsVector3D& sourcePosition, const PhysicsVector3D& listenerPosition, 
+                                      const std::vector<PhysicsVector3D>& obstacles) const
 {
    PHYSICS_RECORD_FUNCTION();
    
    try
    {
-       std::lock_guard<std::mutex> lock(m_physicsMutex);
+       // Calculate occlusion based on obstacles between source and listener
+       PhysicsVector3D direction = listenerPosition - sourcePosition;
+       float distance = direction.Magnitude();
        
-       if (index >= 0 && index < static_cast<int>(m_gravityFields.size()))
+       if (distance < MIN_VELOCITY_THRESHOLD)
        {
-           m_gravityFields.erase(m_gravityFields.begin() + index);
-           
-#if defined(_DEBUG_PHYSICS_)
-           debug.logDebugMessage(LogLevel::LOG_INFO, L"[Physics] Removed gravity field at index %d", index);
-#endif
+           return 0.0f; // No occlusion if source and listener are at same position
        }
-       else
+       
+       direction = direction.Normalized();
+       float occlusion = 0.0f;
+       
+       // Check intersection with each obstacle (simplified as spheres)
+       for (const auto& obstacle : obstacles)
        {
-#if defined(_DEBUG_PHYSICS_)
-           debug.logDebugMessage(LogLevel::LOG_WARNING, L"[Physics] Invalid gravity field index: %d", index);
-#endif
+           float hitDistance;
+           if (RaySphereIntersection(sourcePosition, direction, obstacle, 1.0f, hitDistance))
+           {
+               if (hitDistance < distance)
+               {
+                   occlusion += 0.3f; // Each obstacle adds 30% occlusion
+               }
+           }
        }
+       
+       // Clamp occlusion to maximum of 90%
+       return std::clamp(occlusion, 0.0f, 0.9f);
    }
    catch (const std::exception& e)
    {
        std::string errorMsg = e.what();
        std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
-       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error removing gravity field: " + wErrorMsg);
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error calculating sound occlusion: " + wErrorMsg);
+       return 0.0f;
    }
 }
 
-void Physics::ClearGravityFields()
-{
-   PHYSICS_RECORD_FUNCTION();
-   
-   std::lock_guard<std::mutex> lock(m_physicsMutex);
-   m_gravityFields.clear();
-   
-#if defined(_DEBUG_PHYSICS_)
-   debug.logLevelMessage(LogLevel::LOG_INFO, L"[Physics] Cleared all gravity fields");
-#endif
-}
-
-PhysicsVector3D Physics::CalculateGravityAtPosition(const PhysicsVector3D& position) const
+float Physics::CalculateSoundOcclusion(const PhysicsVector3D& sourcePosition, const PhysicsVector3D& listenerPosition) const
 {
    PHYSICS_RECORD_FUNCTION();
    
-   PhysicsVector3D totalGravity(0.0f, -DEFAULT_GRAVITY, 0.0f); // Default downward gravity
-   
    try
    {
-       // Add gravitational forces from all gravity fields
-       for (const auto& gravityField : m_gravityFields)
+       std::lock_guard<std::mutex> lock(m_physicsMutex);
+       
+       PhysicsVector3D direction = listenerPosition - sourcePosition;
+       float distance = direction.Magnitude();
+       
+       if (distance < MIN_VELOCITY_THRESHOLD)
        {
-           PhysicsVector3D fieldGravity = gravityField.CalculateGravityVector(position);
-           totalGravity += fieldGravity;
+           return 0.0f; // No occlusion if source and listener are at same position
        }
+       
+       float occlusion = 0.0f;
+       
+       // Only bodies along the line of sight are visited via the dynamic tree
+       SweepSphereQuery(sourcePosition, direction, 0.0f, distance, [&](int bodyIndex, float) -> bool {
+           const PhysicsVector3D bodyPosition = m_bodyStore.GetPosition(bodyIndex);
+           const float radiusSquared = m_bodyStore.radius[bodyIndex] * m_bodyStore.radius[bodyIndex];
+           
+           // Bodies enclosing the emitter or listener (their own bodies) do not occlude
+           if ((sourcePosition - bodyPosition).MagnitudeSquared() <= radiusSquared ||
+               (listenerPosition - bodyPosition).MagnitudeSquared() <= radiusSquared)
+           {
+               return true;
+           }
+           
+           occlusion += 0.3f; // Each obstacle adds 30% occlusion
+           return occlusion < 0.9f;
+       });
+       
+       // Clamp occlusion to maximum of 90%
+       return std::clamp(occlusion, 0.0f, 0.9f);
    }
    catch (const std::exception& e)
    {
        std::string errorMsg = e.what();
        std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
-       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error calculating gravity at position: " + wErrorMsg);
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error calculating sound occlusion: " + wErrorMsg);
+       return 0.0f;
    }
-   
-   return totalGravity;
 }
 
-float Physics::CalculateOrbitalVelocity(const PhysicsVector3D& position, const GravityField& gravityField) const
+float Physics::CalculateReverb(const PhysicsVector3D& position, float roomSize, float absorptionCoefficient) const
 {
    PHYSICS_RECORD_FUNCTION();
    
    try
    {
-       // Calculate distance from gravity center
-       float distance = FastDistance(position, gravityField.center);
-       
-       // Prevent division by zero
-       if (distance < 0.1f)
-       {
-           return 0.0f;
-       }
-       
-       // Orbital velocity formula: v = sqrt(GM/r)
-       // Simplified for gaming: v = sqrt(intensity * mass / distance)
-       float orbitalVelocity = FAST_SQRT((gravityField.intensity * gravityField.mass) / distance);
+       // Simple reverb calculation based on room size and absorption
+       float baseReverb = roomSize * 0.01f; // Larger rooms have more reverb
+       float absorption = std::clamp(absorptionCoefficient, 0.0f, 1.0f);
        
-#if defined(_DEBUG_PHYSICS_)
-       debug.logDebugMessage(LogLevel::LOG_DEBUG, L"[Physics] Calculated orbital velocity: %.3f at distance %.2f", 
-                            orbitalVelocity, distance);
-#endif
+       // Apply absorption coefficient
+       float reverb = baseReverb * (1.0f - absorption);
        
-       return orbitalVelocity;
+       // Clamp to reasonable range
+       return std::clamp(reverb, 0.0f, 1.0f);
    }
    catch (const std::exception& e)
    {
        std::string errorMsg = e.what();
        std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
-       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error calculating orbital velocity: " + wErrorMsg);
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error calculating reverb: " + wErrorMsg);
        return 0.0f;
    }
 }
 
-float Physics::CalculateEscapeVelocity(const PhysicsVector3D& position, const GravityField& gravityField) const
+//==============================================================================
+// Particle System Methods Implementation
+//==============================================================================
+std::vector<PhysicsParticle> Physics::CreateExplosion(const PhysicsVector3D& center, int particleCount, 
+                                                     float explosionForce, float particleLifetime)
 {
    PHYSICS_RECORD_FUNCTION();
    
+   std::vector<PhysicsParticle> particles;
+   particles.reserve(particleCount);
+   
    try
    {
-       // Calculate distance from gravity center
-       float distance = FastDistance(position, gravityField.center);
+       // Clamp particle count to reasonable limits
+       particleCount = std::clamp(particleCount, 1, MAX_PARTICLE_COUNT);
        
-       // Prevent division by zero
-       if (distance < 0.1f)
+       for (int i = 0; i < particleCount; ++i)
        {
-           return 0.0f;
+           particles.push_back(GenerateExplosionParticle(center, explosionForce, particleLifetime));
        }
        
-       // Escape velocity formula: v = sqrt(2*GM/r)
-       // Simplified for gaming: v = sqrt(2 * intensity * mass / distance)
-       float escapeVelocity = FAST_SQRT((2.0f * gravityField.intensity * gravityField.mass) / distance);
+       // Update particle count
+       m_particleCount.store(static_cast<int>(particles.size()));
        
 #if defined(_DEBUG_PHYSICS_)
-       debug.logDebugMessage(LogLevel::LOG_DEBUG, L"[Physics] Calculated escape velocity: %.3f at distance %.2f", 
-                            escapeVelocity, distance);
+       debug.logDebugMessage(LogLevel::LOG_INFO, L"[Physics] Created explosion with %d particles at position (%.2f, %.2f, %.2f)", 
+                            particleCount, center.x, center.y, center.z);
 #endif
-       
-       return escapeVelocity;
    }
    catch (const std::exception& e)
    {
        std::string errorMsg = e.what();
        std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
-       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error calculating escape velocity: " + wErrorMsg);
-       return 0.0f;
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error creating explosion: " + wErrorMsg);
    }
+   
+   return particles;
 }
 
-//==============================================================================
-// Bouncing and Trajectory Methods Implementation
-//==============================================================================
-std::vector<PhysicsVector3D> Physics::CalculateBouncingTrajectory(const PhysicsVector3D& startPosition, 
-                                                                 const PhysicsVector3D& initialVelocity, 
-                                                                 float groundHeight, float restitution, 
-                                                                 float drag, int maxBounces)
+void Physics::UpdateParticleSystem(std::vector<PhysicsParticle>& particles, float deltaTime)
 {
    PHYSICS_RECORD_FUNCTION();
    
-   std::vector<PhysicsVector3D> trajectory;
-   trajectory.reserve(maxBounces * 10); // Reserve space for trajectory points
-   
    try
    {
-       PhysicsVector3D currentPosition = startPosition;
-       PhysicsVector3D currentVelocity = initialVelocity;
-       
-       float timeStep = 0.016f; // 60 FPS time step
-       float currentTime = 0.0f;
-       int bounceCount = 0;
-       
-       // Add starting position
-       trajectory.push_back(currentPosition);
+       int activeParticles = 0;
        
-       // Simulate trajectory with bouncing
-       while (bounceCount < maxBounces && currentTime < 30.0f) // Maximum simulation time
+       for (auto& particle : particles)
        {
-           // Apply gravity
-           PhysicsVector3D gravity = CalculateGravityAtPosition(currentPosition);
-           currentVelocity += gravity * timeStep;
-           
-           // Apply drag
-           float dragFactor = 1.0f - (drag * timeStep);
-           dragFactor = std::max(0.0f, dragFactor);
-           currentVelocity *= dragFactor;
-           
-           // Update position
-           PhysicsVector3D nextPosition = currentPosition + currentVelocity * timeStep;
-           
-           // Check for ground collision
-           if (nextPosition.y <= groundHeight && currentVelocity.y < 0.0f)
+           if (particle.isActive)
            {
-               // Calculate exact collision point
-               float collisionTime = (groundHeight - currentPosition.y) / currentVelocity.y;
-               PhysicsVector3D collisionPoint = currentPosition + currentVelocity * collisionTime;
-               collisionPoint.y = groundHeight;
-               
-               // Add collision point to trajectory
-               trajectory.push_back(collisionPoint);
-               
-               // Calculate reflection
-               PhysicsVector3D surfaceNormal(0.0f, 1.0f, 0.0f); // Ground normal points up
-               ReflectionData reflection = CalculateReflection(currentVelocity, surfaceNormal, restitution, 0.1f);
-               currentVelocity = reflection.reflectedVelocity;
-               currentPosition = collisionPoint;
-               
-               bounceCount++;
-               
-               // Stop if velocity becomes too small
-               if (currentVelocity.Magnitude() < MIN_VELOCITY_THRESHOLD)
+               particle.Update(deltaTime);
+               if (particle.isActive)
                {
-                   break;
+                   activeParticles++;
                }
            }
-           else
-           {
-               currentPosition = nextPosition;
-               trajectory.push_back(currentPosition);
-           }
-           
-           currentTime += timeStep;
        }
        
+       // Update particle count
+       m_particleCount.store(activeParticles);
+       
 #if defined(_DEBUG_PHYSICS_)
-       debug.logDebugMessage(LogLevel::LOG_INFO, L"[Physics] Calculated bouncing trajectory with %zu points and %d bounces", 
-                            trajectory.size(), bounceCount);
+       static int debugCounter = 0;
+       if (++debugCounter % 60 == 0) // Log every 60 frames to avoid spam
+       {
+           debug.logDebugMessage(LogLevel::LOG_DEBUG, L"[Physics] Updated particle system - %d active particles", activeParticles);
+       }
 #endif
    }
    catch (const std::exception& e)
    {
        std::string errorMsg = e.what();
        std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
-       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error calculating bouncing trajectory: " + wErrorMsg);
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error updating particle system: " + wErrorMsg);
    }
-   
-   return trajectory;
 }
 
-PhysicsVector3D Physics::CalculateRestingPosition(const PhysicsVector3D& startPosition, 
-                                                 const PhysicsVector3D& initialVelocity, 
-                                                 float groundHeight, float restitution, float drag)
+void Physics::ApplyWindForce(std::vector<PhysicsParticle>& particles, const PhysicsVector3D& windVelocity)
 {
    PHYSICS_RECORD_FUNCTION();
    
    try
    {
-       // Calculate final trajectory
-       std::vector<PhysicsVector3D> trajectory = CalculateBouncingTrajectory(startPosition, initialVelocity, 
-                                                                             groundHeight, restitution, drag, 20);
-       
-       // Return last position in trajectory as resting position
-       if (!trajectory.empty())
+       for (auto& particle : particles)
        {
-           PhysicsVector3D restingPosition = trajectory.back();
-           restingPosition.y = groundHeight; // Ensure it's on the ground
-           
+           if (particle.isActive)
+           {
+               // Apply wind force based on particle mass and drag
+               PhysicsVector3D windForce = windVelocity * (particle.drag * particle.mass);
+               particle.acceleration += windForce;
+           }
+       }
+       
 #if defined(_DEBUG_PHYSICS_)
-           debug.logDebugMessage(LogLevel::LOG_INFO, L"[Physics] Calculated resting position: (%.2f, %.2f, %.2f)", 
-                                restingPosition.x, restingPosition.y, restingPosition.z);
+       debug.logDebugMessage(LogLevel::LOG_DEBUG, L"[Physics] Applied wind force (%.2f, %.2f, %.2f) to particle system", 
+                            windVelocity.x, windVelocity.y, windVelocity.z);
 #endif
-           
-           return restingPosition;
-       }
-       else
-       {
-           // Fallback to start position on ground
-           PhysicsVector3D fallbackPosition = startPosition;
-           fallbackPosition.y = groundHeight;
-           return fallbackPosition;
-       }
    }
    catch (const std::exception& e)
    {
        std::string errorMsg = e.what();
        std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
-       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error calculating resting position: " + wErrorMsg);
-       
-       // Return safe fallback position
-       PhysicsVector3D fallbackPosition = startPosition;
-       fallbackPosition.y = groundHeight;
-       return fallbackPosition;
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error applying wind force: " + wErrorMsg);
    }
 }
 
-//==============================================================================
-// Collision Detection Methods Implementation
-//==============================================================================
-bool Physics::CheckAABBCollision(const PhysicsVector3D& minA, const PhysicsVector3D& maxA, 
-                                const PhysicsVector3D& minB, const PhysicsVector3D& maxB) const
-{
-   PHYSICS_RECORD_FUNCTION();
-   
-   // AABB collision detection using separating axis theorem
-   return (minA.x <= maxB.x && maxA.x >= minB.x &&
-           minA.y <= maxB.y && maxA.y >= minB.y &&
-           minA.z <= maxB.z && maxA.z >= minB.z);
-}
-
-bool Physics::CheckSphereCollision(const PhysicsVector3D& centerA, float radiusA, 
-                                  const PhysicsVector3D& centerB, float radiusB) const
-{
-   PHYSICS_RECORD_FUNCTION();
-   
-   // Sphere collision detection using distance comparison
-   float distance = FastDistance(centerA, centerB);
-   float combinedRadius = radiusA + radiusB;
-   
-   return distance <= combinedRadius;
-}
-
-bool Physics::RaySphereIntersection(const PhysicsVector3D& rayOrigin, const PhysicsVector3D& rayDirection, 
-                                   const PhysicsVector3D& sphereCenter, float sphereRadius, float& hitDistance) const
+void Physics::ApplyGravityToParticles(std::vector<PhysicsParticle>& particles, float gravity)
 {
    PHYSICS_RECORD_FUNCTION();
    
    try
    {
-       // Ray-sphere intersection using quadratic formula
-       PhysicsVector3D toSphere = rayOrigin - sphereCenter;
-       
-       float a = FastDotProduct(rayDirection, rayDirection);
-       float b = 2.0f * FastDotProduct(toSphere, rayDirection);
-       float c = FastDotProduct(toSphere, toSphere) - (sphereRadius * sphereRadius);
-       
-       float discriminant = b * b - 4.0f * a * c;
+       PhysicsVector3D gravityForce(0.0f, -gravity, 0.0f);
        
-       if (discriminant < 0.0f)
+       for (auto& particle : particles)
        {
-           return false; // No intersection
+           if (particle.isActive)
+           {
+               // Apply gravity force based on particle mass
+               particle.acceleration += gravityForce * particle.mass;
+           }
        }
        
-       // Calculate hit distance
-       float sqrtDiscriminant = FAST_SQRT(discriminant);
-       float t1 = (-b - sqrtDiscriminant) / (2.0f * a);
-       float t2 = (-b + sqrtDiscriminant) / (2.0f * a);
-       
-       // Return closest positive intersection
-       if (t1 > 0.0f)
-       {
-           hitDistance = t1;
-           return true;
-       }
-       else if (t2 > 0.0f)
+#if defined(_DEBUG_PHYSICS_)
+       static int debugCounter = 0;
+       if (++debugCounter % 120 == 0) // Log every 120 frames to avoid spam
        {
-           hitDistance = t2;
-           return true;
-       }
-       
-       return false; // Intersection behind ray origin
+           debug.logDebugMessage(LogLevel::LOG_DEBUG, L"[Physics] Applied gravity %.2f to particle system", gravity);
+       }
+#endif
    }
    catch (const std::exception& e)
    {
        std::string errorMsg = e.what();
        std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
-       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error in ray-sphere intersection: " + wErrorMsg);
-       return false;
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error applying gravity to particles: " + wErrorMsg);
    }
 }
 
-bool Physics::ContinuousCollisionDetection(const PhysicsBody& bodyA, const PhysicsBody& bodyB, float deltaTime) const
+int Physics::CreateExplosion(PhysicsParticlePool& pool, const PhysicsVector3D& center, int particleCount,
+                             float explosionForce, float particleLifetime)
 {
    PHYSICS_RECORD_FUNCTION();
    
+   int emitted = 0;
+   
    try
    {
-       // Simple CCD using swept sphere test
-       PhysicsVector3D relativeVelocity = bodyA.velocity - bodyB.velocity;
-       PhysicsVector3D relativePosition = bodyA.position - bodyB.position;
-       
-       // Assume spherical bodies with radius based on mass (simplified)
-       float radiusA = FAST_SQRT(bodyA.mass) * 0.5f;
-       float radiusB = FAST_SQRT(bodyB.mass) * 0.5f;
-       float combinedRadius = radiusA + radiusB;
+       // Same per-explosion limit as the vector overload, further limited by free pool space
+       particleCount = std::min(std::clamp(particleCount, 1, MAX_PARTICLE_COUNT), pool.GetFreeCount());
        
-       // Check if objects are moving toward each other
-       if (FastDotProduct(relativeVelocity, relativePosition) >= 0.0f)
+       for (; emitted < particleCount; ++emitted)
        {
-           return false; // Moving away from each other
+           pool.Emit(GenerateExplosionParticle(center, explosionForce, particleLifetime));
        }
        
-       // Calculate time to collision
-       float relativeSpeed = relativeVelocity.Magnitude();
-       float currentDistance = relativePosition.Magnitude();
-       
-       if (relativeSpeed > MIN_VELOCITY_THRESHOLD)
-       {
-           float timeToCollision = (currentDistance - combinedRadius) / relativeSpeed;
-           return timeToCollision <= deltaTime && timeToCollision >= 0.0f;
-       }
+       m_particleCount.store(pool.Size());
        
-       return false;
+#if defined(_DEBUG_PHYSICS_)
+       debug.logDebugMessage(LogLevel::LOG_INFO, L"[Physics] Emitted explosion with %d pooled particles at position (%.2f, %.2f, %.2f)", 
+                            emitted, center.x, center.y, center.z);
+#endif
    }
    catch (const std::exception& e)
    {
        std::string errorMsg = e.what();
        std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
-       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error in continuous collision detection: " + wErrorMsg);
-       return false;
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error creating pooled explosion: " + wErrorMsg);
    }
+   
+   return emitted;
 }
 
-//==============================================================================
-// Audio Physics Methods Implementation
-//==============================================================================
-AudioPhysicsData Physics::CalculateAudioPhysics(const PhysicsVector3D& listenerPosition, 
-                                               const PhysicsVector3D& sourcePosition, 
-                                               const PhysicsVector3D& sourceVelocity)
+void Physics::UpdateParticleSystem(PhysicsParticlePool& pool, float deltaTime)
 {
    PHYSICS_RECORD_FUNCTION();
    
-   AudioPhysicsData audioData;
-   audioData.listenerPosition = listenerPosition;
-   audioData.sourcePosition = sourcePosition;
-   audioData.sourceVelocity = sourceVelocity;
-   
    try
    {
-       // Calculate audio properties
-       audioData.CalculateAudioProperties();
+       // Vector kernels handle whole lanes, the scalar loop finishes the remainder
+       const int liveCount = pool.Size();
+       int processed = 0;
+#if defined(CPUFEATURES_X86)
+       if (m_integrationPath == PhysicsSIMDPath::AVX2)
+       {
+           processed = UpdateParticlePoolAVX2(pool, liveCount, deltaTime);
+       }
+       else if (m_integrationPath == PhysicsSIMDPath::SSE2)
+       {
+           processed = UpdateParticlePoolSSE2(pool, liveCount, deltaTime);
+       }
+#endif
+       UpdateParticlePoolScalar(pool, processed, liveCount, deltaTime);
+       
+       // Compact expired particles out of the live range
+       pool.RemoveExpired();
+       m_particleCount.store(pool.Size());
        
 #if defined(_DEBUG_PHYSICS_)
-       debug.logDebugMessage(LogLevel::LOG_DEBUG, L"[Physics] Calculated audio physics - Distance: %.2f, Doppler: %.3f", 
-                            audioData.distance, audioData.dopplerShift);
+       static int debugCounter = 0;
+       if (++debugCounter % 60 == 0) // Log every 60 frames to avoid spam
+       {
+           debug.logDebugMessage(LogLevel::LOG_DEBUG, L"[Physics] Updated particle pool - %d live particles", pool.Size());
+       }
 #endif
    }
    catch (const std::exception& e)
    {
        std::string errorMsg = e.what();
        std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
-       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error calculating audio physics: " + wErrorMsg);
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error updating particle pool: " + wErrorMsg);
    }
+}
+
+void Physics::ApplyWindForce(PhysicsParticlePool& pool, const PhysicsVector3D& windVelocity)
+{
+   PHYSICS_RECORD_FUNCTION();
    
-   return audioData;
+   // Wind force scales with particle drag and mass, as in the vector overload
+   AccumulateParticleAcceleration(pool, windVelocity, pool.drag.data(), pool.mass.data());
 }
 
-float Physics::CalculateDopplerShift(const PhysicsVector3D& sourceVelocity, const PhysicsVector3D& listenerVelocity, 
-                                    const PhysicsVector3D& direction, float speedOfSound) const
+void Physics::ApplyGravityToParticles(PhysicsParticlePool& pool, float gravity)
 {
    PHYSICS_RECORD_FUNCTION();
    
-   try
-   {
-       // Calculate relative velocities along the line of sight
-       float sourceVelAlongLOS = FastDotProduct(sourceVelocity, direction);
-       float listenerVelAlongLOS = FastDotProduct(listenerVelocity, direction);
-       
-       // Doppler shift formula: f' = f * (v + vr) / (v + vs)
-       // where v = speed of sound, vr = receiver velocity, vs = source velocity
-       float dopplerFactor = (speedOfSound + listenerVelAlongLOS) / (speedOfSound + sourceVelAlongLOS);
-       
-       // Clamp to reasonable range
-       return std::clamp(dopplerFactor, 0.5f, 2.0f);
-   }
-   catch (const std::exception& e)
-   {
-       std::string errorMsg = e.what();
-       std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
-       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error calculating Doppler shift: " + wErrorMsg);
-       return 1.0f; // No shift on error
-   }
+   // Gravity force scales with particle mass, as in the vector overload
+   AccumulateParticleAcceleration(pool, PhysicsVector3D(0.0f, -gravity, 0.0f), pool.mass.data(), nullptr);
 }
 
-float Physics::CalculateSoundOcclusion(const PhysicsVector3D& sourcePosition, const PhysicsVector3D& listenerPosition, 
-                                      const std::vector<PhysicsVector3D>& obstacles) const
+PhysicsParticle Physics::GenerateExplosionParticle(const PhysicsVector3D& center, float explosionForce, float particleLifetime) const
+{
+   PhysicsParticle particle;
+   
+   // Set particle position at explosion center with small random offset
+   particle.position = center + PhysicsVector3D(
+       (static_cast<float>(rand()) / RAND_MAX - 0.5f) * 0.2f,
+       (static_cast<float>(rand()) / RAND_MAX - 0.5f) * 0.2f,
+       (static_cast<float>(rand()) / RAND_MAX - 0.5f) * 0.2f
+   );
+   
+   // Calculate random direction for explosion
+   float theta = static_cast<float>(rand()) / RAND_MAX * 2.0f * XM_PI; // Azimuth angle
+   float phi = static_cast<float>(rand()) / RAND_MAX * XM_PI; // Elevation angle
+   
+   PhysicsVector3D direction(
+       FAST_SIN(phi) * FAST_COS(theta),
+       FAST_COS(phi),
+       FAST_SIN(phi) * FAST_SIN(theta)
+   );
+   
+   // Set particle velocity based on explosion force and direction
+   float speed = explosionForce * (0.5f + static_cast<float>(rand()) / RAND_MAX * 0.5f); // Random speed variation
+   particle.velocity = direction * speed;
+   
+   // Set particle properties
+   particle.life = particleLifetime * (0.8f + static_cast<float>(rand()) / RAND_MAX * 0.4f); // Random lifetime variation
+   particle.mass = 0.1f + static_cast<float>(rand()) / RAND_MAX * 0.1f; // Random mass variation
+   particle.drag = DEFAULT_AIR_RESISTANCE;
+   particle.isActive = true;
+   
+   return particle;
+}
+
+//==============================================================================
+// Internal Helper Methods Implementation (continued)
+//==============================================================================
+void Physics::InitializePhysicsPrecalculations()
 {
    PHYSICS_RECORD_FUNCTION();
    
    try
    {
-       // Calculate occlusion based on obstacles between source and listener
-       PhysicsVector3D direction = listenerPosition - sourcePosition;
-       float distance = direction.Magnitude();
+        #if defined(_DEBUG_PHYSICS_)
+               debug.logLevelMessage(LogLevel::LOG_INFO, L"[Physics] Initializing physics-specific precalculations");
+        #endif
        
-       if (distance < MIN_VELOCITY_THRESHOLD)
-       {
-           return 0.0f; // No occlusion if source and listener are at same position
-       }
+       // Initialize gravity lookup tables
+       UpdateGravityLookupTables();
        
-       direction = direction.Normalized();
-       float occlusion = 0.0f;
+       // Initialize reflection angle tables
+       UpdateReflectionTables();
        
-       // Check intersection with each obstacle (simplified as spheres)
-       for (const auto& obstacle : obstacles)
-       {
-           float hitDistance;
-           if (RaySphereIntersection(sourcePosition, direction, obstacle, 1.0f, hitDistance))
-           {
-               if (hitDistance < distance)
-               {
-                   occlusion += 0.3f; // Each obstacle adds 30% occlusion
-               }
-           }
-       }
+       // Initialize inertia coefficient tables
+       UpdateInertiaCoefficients();
        
-       // Clamp occlusion to maximum of 90%
-       return std::clamp(occlusion, 0.0f, 0.9f);
+        #if defined(_DEBUG_PHYSICS_)
+               debug.logLevelMessage(LogLevel::LOG_INFO, L"[Physics] Physics precalculations initialized successfully");
+        #endif
    }
    catch (const std::exception& e)
    {
        std::string errorMsg = e.what();
        std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
-       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error calculating sound occlusion: " + wErrorMsg);
-       return 0.0f;
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error initializing physics precalculations: " + wErrorMsg);
+       throw;
    }
 }
 
-float Physics::CalculateReverb(const PhysicsVector3D& position, float roomSize, float absorptionCoefficient) const
-{
-   PHYSICS_RECORD_FUNCTION();
-   
-   try
-   {
-       // Simple reverb calculation based on room size and absorption
-       float baseReverb = roomSize * 0.01f; // Larger rooms have more reverb
-       float absorption = std::clamp(absorptionCoefficient, 0.0f, 1.0f);
-       
-       // Apply absorption coefficient
-       float reverb = baseReverb * (1.0f - absorption);
-       
-       // Clamp to reasonable range
-       return std::clamp(reverb, 0.0f, 1.0f);
-   }
-   catch (const std::exception& e)
-   {
-       std::string errorMsg = e.what();
-       std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
-       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error calculating reverb: " + wErrorMsg);
-       return 0.0f;
-   }
+void Physics::UpdateGravityLookupTables()
+{
+    // This method would populate gravity intensity lookup tables
+    // for fast distance-based gravity calculations
+    PHYSICS_RECORD_FUNCTION();
+
+    try
+    {
+        // Note: These lookup tables would be integrated into MathPrecalculation class
+        // for optimal performance. For now, we document the intention.
+
+#if defined(_DEBUG_PHYSICS_)
+        debug.logLevelMessage(LogLevel::LOG_INFO, L"[Physics] Updated gravity lookup tables");
+#endif
+    }
+    catch (const std::exception& e)
+    {
+        std::string errorMsg = e.what();
+        std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
+        debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error updating gravity lookup tables: " + wErrorMsg);
+    }
+}
+
+void Physics::UpdateReflectionTables()
+{
+    // This method would populate reflection angle lookup tables
+    // for fast collision response calculations
+    PHYSICS_RECORD_FUNCTION();
+
+    try
+    {
+        // Note: These lookup tables would be integrated into MathPrecalculation class
+        // for optimal performance. For now, we document the intention.
+
+#if defined(_DEBUG_PHYSICS_)
+        debug.logLevelMessage(LogLevel::LOG_INFO, L"[Physics] Updated reflection lookup tables");
+#endif
+    }
+    catch (const std::exception& e)
+    {
+        std::string errorMsg = e.what();
+        std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
+        debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error updating reflection tables: " + wErrorMsg);
+    }
+}
+
+void Physics::UpdateInertiaCoefficients()
+{
+    // This method would populate inertia coefficient lookup tables
+    // for fast rotational physics calculations
+    PHYSICS_RECORD_FUNCTION();
+
+    try
+    {
+        // Note: These lookup tables would be integrated into MathPrecalculation class
+        // for optimal performance. For now, we document the intention.
+
+#if defined(_DEBUG_PHYSICS_)
+        debug.logLevelMessage(LogLevel::LOG_INFO, L"[Physics] Updated inertia coefficient tables");
+#endif
+    }
+    catch (const std::exception& e)
+    {
+        std::string errorMsg = e.what();
+        std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
+        debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error updating inertia coefficients: " + wErrorMsg);
+    }
+}
+
+void Physics::AllocatePhysicsMemory()
+{
+    PHYSICS_RECORD_FUNCTION();
+
+    try
+    {
+        // Memory pools would be allocated here for optimal performance
+        // This is a placeholder for future memory management optimization
+
+#if defined(_DEBUG_PHYSICS_)
+        debug.logLevelMessage(LogLevel::LOG_INFO, L"[Physics] Allocated physics memory pools");
+#endif
+    }
+    catch (const std::exception& e)
+    {
+        std::string errorMsg = e.what();
+        std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
+        debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error allocating physics memory: " + wErrorMsg);
+        throw;
+    }
+}
+
+void Physics::DeallocatePhysicsMemory()
+{
+    PHYSICS_RECORD_FUNCTION();
+
+    try
+    {
+        // Memory pools would be deallocated here
+        // This is a placeholder for future memory management optimization
+
+#if defined(_DEBUG_PHYSICS_)
+        debug.logLevelMessage(LogLevel::LOG_INFO, L"[Physics] Deallocated physics memory pools");
+#endif
+    }
+    catch (const std::exception& e)
+    {
+        std::string errorMsg = e.what();
+        std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
+        debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error deallocating physics memory: " + wErrorMsg);
+    }
+}
+
+size_t Physics::GetPhysicsMemoryUsage() const
+{
+    PHYSICS_RECORD_FUNCTION();
+
+    size_t totalMemory = 0;
+
+    try
+    {
+        // Calculate memory usage for physics collections
+        totalMemory += m_bodyStore.GetMemoryUsage();
+        totalMemory += m_solverBodies.capacity() * sizeof(PhysicsBody);
+        totalMemory += m_gravityFields.size() * sizeof(GravityField);
+        totalMemory += m_gravityTree.GetMemoryUsage();
+        totalMemory += m_ragdollJoints.size() * sizeof(RagdollJoint);
+        totalMemory += m_ragdollSolver.GetMemoryUsage();
+        totalMemory += m_frameArena.GetCapacity();
+        totalMemory += m_debugLines.size() * sizeof(PhysicsVector3D);
+        totalMemory += m_broadPhasePairs.capacity() * sizeof(std::pair<int, int>);
+        totalMemory += m_spatialHash.GetMemoryUsage();
+        totalMemory += m_bodyTree.GetMemoryUsage();
+        totalMemory += m_bodyProxies.capacity() * sizeof(int);
+        totalMemory += m_terrainHeights.capacity() * sizeof(float);
+        for (const auto& heightfield : m_heightfields)
+        {
+            totalMemory += heightfield.GetMemoryUsage();
+        }
+
+        // Add estimated memory for internal structures
+        totalMemory += sizeof(Physics);
+
+        return totalMemory;
+    }
+    catch (const std::exception& e)
+    {
+        std::string errorMsg = e.what();
+        std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
+        debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error calculating memory usage: " + wErrorMsg);
+        return 0;
+    }
 }
 
-//==============================================================================
-// Particle System Methods Implementation
-//==============================================================================
-std::vector<PhysicsParticle> Physics::CreateExplosion(const PhysicsVector3D& center, int particleCount, 
-                                                     float explosionForce, float particleLifetime)
+void Physics::BroadPhaseCollisionDetection()
 {
-   PHYSICS_RECORD_FUNCTION();
-   
-   std::vector<PhysicsParticle> particles;
-   particles.reserve(particleCount);
-   
-   try
-   {
-       // Clamp particle count to reasonable limits
-       particleCount = std::clamp(particleCount, 1, MAX_PARTICLE_COUNT);
-       
-       for (int i = 0; i < particleCount; ++i)
-       {
-           PhysicsParticle particle;
-           
-           // Set particle position at explosion center with small random offset
-           particle.position = center + PhysicsVector3D(
-               (static_cast<float>(rand()) / RAND_MAX - 0.5f) * 0.2f,
-               (static_cast<float>(rand()) / RAND_MAX - 0.5f) * 0.2f,
-               (static_cast<float>(rand()) / RAND_MAX - 0.5f) * 0.2f
-           );
-           
-           // Calculate random direction for explosion
-           float theta = static_cast<float>(rand()) / RAND_MAX * 2.0f * XM_PI; // Azimuth angle
-           float phi = static_cast<float>(rand()) / RAND_MAX * XM_PI; // Elevation angle
-           
-           PhysicsVector3D direction(
-               FAST_SIN(phi) * FAST_COS(theta),
-               FAST_COS(phi),
-               FAST_SIN(phi) * FAST_SIN(theta)
-           );
-           
-           // Set particle velocity based on explosion force and direction
-           float speed = explosionForce * (0.5f + static_cast<float>(rand()) / RAND_MAX * 0.5f); // Random speed variation
-           particle.velocity = direction * speed;
-           
-           // Set particle properties
-           particle.life = particleLifetime * (0.8f + static_cast<float>(rand()) / RAND_MAX * 0.4f); // Random lifetime variation
-           particle.mass = 0.1f + static_cast<float>(rand()) / RAND_MAX * 0.1f; // Random mass variation
-           particle.drag = DEFAULT_AIR_RESISTANCE;
-           particle.isActive = true;
-           
-           particles.push_back(particle);
-       }
-       
-       // Update particle count
-       m_particleCount.store(static_cast<int>(particles.size()));
-       
+    PHYSICS_RECORD_FUNCTION();
+
+    try
+    {
+        // Manifolds live in the per-step arena - releasing last step's storage is a pointer reset
+        m_frameArena.Reset();
+        m_collisionManifolds.clear();
+
+        // Move bodies that crossed a cell boundary, then gather pairs sharing a cell - collision
+        // layers, masks and groups reject unwanted pairs before they are stored or sorted
+        UpdateSpatialHash();
+        m_spatialHash.CollectPairs(m_broadPhasePairs, &m_bodyStore);
+
+        // Hash iteration order is arbitrary - sort so manifolds are emitted in body index order
+        std::sort(m_broadPhasePairs.begin(), m_broadPhasePairs.end());
+
+        const PhysicsBodyStore& store = m_bodyStore;
+        for (const auto& pair : m_broadPhasePairs)
+        {
+            const int indexA = pair.first;
+            const int indexB = pair.second;
+
+            // Skip inactive pairs and pairs where neither body can move (static or sleeping)
+            const uint32_t inertFlags = PhysicsBodyStore::FLAG_STATIC | PhysicsBodyStore::FLAG_SLEEPING;
+            if (!store.IsSimulated(indexA) || !store.IsSimulated(indexB) ||
+                ((store.flags[indexA] & inertFlags) != 0 && (store.flags[indexB] & inertFlags) != 0))
+            {
+                continue;
+            }
+
+            // Expanded sphere overlap test (squared to avoid the square root)
+            const float dx = store.positionX[indexB] - store.positionX[indexA];
+            const float dy = store.positionY[indexB] - store.positionY[indexA];
+            const float dz = store.positionZ[indexB] - store.positionZ[indexA];
+            const float threshold = (store.radius[indexA] + store.radius[indexB]) * BROAD_PHASE_MARGIN;
+
+            if (dx * dx + dy * dy + dz * dz <= threshold * threshold)
+            {
+                // Potential collision - add to narrow phase
+                CollisionManifold manifold;
+                manifold.indexA = indexA;
+                manifold.indexB = indexB;
+                m_collisionManifolds.push_back(manifold);
+            }
+        }
+
 #if defined(_DEBUG_PHYSICS_)
-       debug.logDebugMessage(LogLevel::LOG_INFO, L"[Physics] Created explosion with %d particles at position (%.2f, %.2f, %.2f)", 
-                            particleCount, center.x, center.y, center.z);
+        static int debugCounter = 0;
+        if (++debugCounter % 600 == 0) // Log every 600 frames to avoid spam
+        {
+            debug.logDebugMessage(LogLevel::LOG_DEBUG, L"[Physics] Broad phase - %zu cells, %zu pairs, %zu candidates",
+                m_spatialHash.GetCellCount(), m_broadPhasePairs.size(), m_collisionManifolds.size());
+        }
 #endif
-   }
-   catch (const std::exception& e)
-   {
-       std::string errorMsg = e.what();
-       std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
-       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error creating explosion: " + wErrorMsg);
-   }
-   
-   return particles;
+    }
+    catch (const std::exception& e)
+    {
+        std::string errorMsg = e.what();
+        std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
+        debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error in broad phase collision detection: " + wErrorMsg);
+    }
 }
 
-void Physics::UpdateParticleSystem(std::vector<PhysicsParticle>& particles, float deltaTime)
+void Physics::NarrowPhaseCollisionDetection()
 {
-   PHYSICS_RECORD_FUNCTION();
-   
-   try
-   {
-       int activeParticles = 0;
-       
-       for (auto& particle : particles)
-       {
-           if (particle.isActive)
-           {
-               particle.Update(deltaTime);
-               if (particle.isActive)
-               {
-                   activeParticles++;
-               }
-           }
-       }
-       
-       // Update particle count
-       m_particleCount.store(activeParticles);
-       
+    PHYSICS_RECORD_FUNCTION();
+
+    try
+    {
+        // Drop any working set left behind by an interrupted step
+        for (int bodyIndex : m_solverBodyIndices)
+        {
+            if (bodyIndex >= 0)
+            {
+                m_solverSlots[bodyIndex] = -1;
+            }
+        }
+        m_solverBodies.clear();
+        m_solverBodyIndices.clear();
+
+        // Gather the bodies of every candidate into the solver working set first, so the
+        // manifold pointers below are not invalidated by the working set growing
+        CollectTerrainPairs();
+        m_manifoldSlots.clear();
+        for (const auto& manifold : m_collisionManifolds)
+        {
+            const int slotA = GatherSolverBody(manifold.indexA);
+            const int slotB = GatherSolverBody(manifold.indexB);
+            m_manifoldSlots.emplace_back(slotA, slotB);
+        }
+
+        // Terrain pairs get the body plus a private static stand-in for the heightfield
+        const size_t pairManifoldCount = m_collisionManifolds.size();
+        for (const auto& terrainPair : m_terrainPairs)
+        {
+            const PhysicsHeightfield& heightfield = m_heightfields[terrainPair.second];
+            const int slotA = GatherSolverBody(terrainPair.first);
+
+            PhysicsBody terrain;
+            terrain.position = heightfield.GetOrigin();
+            terrain.mass = 0.0f;
+            terrain.inverseMass = 0.0f;
+            terrain.restitution = heightfield.GetRestitution();
+            terrain.friction = heightfield.GetFriction();
+            terrain.isStatic = true;
+            m_solverBodies.push_back(terrain);
+            m_solverBodyIndices.push_back(-1);
+            m_manifoldSlots.emplace_back(slotA, static_cast<int>(m_solverBodies.size()) - 1);
+        }
+
+        // Narrow phase collision detection for potential collisions
+        for (size_t i = 0; i < pairManifoldCount; ++i)
+        {
+            CollisionManifold& manifold = m_collisionManifolds[i];
+            const int indexA = manifold.indexA;
+            const int indexB = manifold.indexB;
+
+            // Generate detailed collision information
+            manifold = GenerateCollisionManifold(m_solverBodies[m_manifoldSlots[i].first], m_solverBodies[m_manifoldSlots[i].second]);
+            manifold.indexA = indexA;
+            manifold.indexB = indexB;
+        }
+        GenerateTerrainManifolds(pairManifoldCount);
+
+        // Remove manifolds with no valid contacts
+        m_collisionManifolds.erase(
+            std::remove_if(m_collisionManifolds.begin(), m_collisionManifolds.end(),
+                [](const CollisionManifold& manifold) { return manifold.contacts.empty(); }),
+            m_collisionManifolds.end()
+        );
+
 #if defined(_DEBUG_PHYSICS_)
-       static int debugCounter = 0;
-       if (++debugCounter % 60 == 0) // Log every 60 frames to avoid spam
-       {
-           debug.logDebugMessage(LogLevel::LOG_DEBUG, L"[Physics] Updated particle system - %d active particles", activeParticles);
-       }
+        if (!m_collisionManifolds.empty())
+        {
+            debug.logDebugMessage(LogLevel::LOG_DEBUG, L"[Physics] Narrow phase detected %zu valid collisions",
+                m_collisionManifolds.size());
+        }
 #endif
-   }
-   catch (const std::exception& e)
-   {
-       std::string errorMsg = e.what();
-       std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
-       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error updating particle system: " + wErrorMsg);
-   }
+    }
+    catch (const std::exception& e)
+    {
+        std::string errorMsg = e.what();
+        std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
+        debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error in narrow phase collision detection: " + wErrorMsg);
+    }
+}
+
+CollisionManifold Physics::GenerateCollisionManifold(PhysicsBody& bodyA, PhysicsBody& bodyB) const
+{
+    PHYSICS_RECORD_FUNCTION();
+
+    CollisionManifold manifold;
+    manifold.bodyA = &bodyA;
+    manifold.bodyB = &bodyB;
+
+    try
+    {
+        // Simplified sphere-sphere collision detection
+        PhysicsVector3D direction = bodyB.position - bodyA.position;
+        float distance = direction.Magnitude();
+        float combinedRadius = bodyA.radius + bodyB.radius;
+
+        if (distance < combinedRadius && distance > MIN_VELOCITY_THRESHOLD)
+        {
+            // Collision detected - generate contact point
+            ContactPoint contact;
+            contact.normal = direction.Normalized();
+            contact.penetrationDepth = combinedRadius - distance;
+            contact.position = bodyA.position + direction * 0.5f; // Midpoint
+            contact.restitution = std::min(bodyA.restitution, bodyB.restitution);
+            contact.friction = std::sqrt(bodyA.friction * bodyB.friction); // Combined friction
+
+            manifold.AddContact(contact);
+            manifold.normal = contact.normal;
+
+            // Calculate separating velocity
+            PhysicsVector3D relativeVelocity = bodyB.velocity - bodyA.velocity;
+            manifold.separatingVelocity = FastDotProduct(relativeVelocity, manifold.normal);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        std::string errorMsg = e.what();
+        std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
+        debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error generating collision manifold: " + wErrorMsg);
+    }
+
+    return manifold;
+}
+
+void Physics::SolvePositionConstraints(const PhysicsIsland& island)
+{
+    PHYSICS_RECORD_FUNCTION();
+
+    try
+    {
+        // Remove a fraction of the remaining penetration per iteration. Penetration is tracked
+        // from the bodies' current positions so corrections are never applied twice.
+        for (int iteration = 0; iteration < m_positionIterations; ++iteration)
+        {
+            for (int i = 0; i < island.manifoldCount; ++i)
+            {
+                CollisionManifold& manifold = m_collisionManifolds[m_islandManifolds[island.firstManifold + i]];
+                PhysicsBody& bodyA = *manifold.bodyA;
+                PhysicsBody& bodyB = *manifold.bodyB;
+                const float totalInverseMass = bodyA.inverseMass + bodyB.inverseMass;
+                if (totalInverseMass <= 0.0f)
+                {
+                    continue;
+                }
+
+                for (const auto& contact : manifold.contacts)
+                {
+                    const float penetration = contact.separationOffset - (bodyB.position - bodyA.position).Dot(contact.normal);
+                    const float correction = std::clamp(CONTACT_BAUMGARTE * (penetration - CONTACT_LINEAR_SLOP),
+                        0.0f, CONTACT_MAX_CORRECTION);
+                    if (correction <= 0.0f)
+                    {
+                        continue;
+                    }
+
+                    // Apply position corrections
+                    const PhysicsVector3D impulse = contact.normal * (correction / totalInverseMass);
+                    bodyA.position -= impulse * bodyA.inverseMass;
+                    bodyB.position += impulse * bodyB.inverseMass;
+                }
+            }
+        }
+    }
+    catch (const std::exception& e)
+    {
+        std::string errorMsg = e.what();
+        std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
+        debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error solving position constraints: " + wErrorMsg);
+    }
 }
 
-void Physics::ApplyWindForce(std::vector<PhysicsParticle>& particles, const PhysicsVector3D& windVelocity)
+void Physics::WarmStartContacts(const PhysicsIsland& island)
 {
-   PHYSICS_RECORD_FUNCTION();
-   
-   try
-   {
-       for (auto& particle : particles)
-       {
-           if (particle.isActive)
-           {
-               // Apply wind force based on particle mass and drag
-               PhysicsVector3D windForce = windVelocity * (particle.drag * particle.mass);
-               particle.acceleration += windForce;
-           }
-       }
-       
-#if defined(_DEBUG_PHYSICS_)
-       debug.logDebugMessage(LogLevel::LOG_DEBUG, L"[Physics] Applied wind force (%.2f, %.2f, %.2f) to particle system", 
-                            windVelocity.x, windVelocity.y, windVelocity.z);
-#endif
-   }
-   catch (const std::exception& e)
-   {
-       std::string errorMsg = e.what();
-       std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
-       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error applying wind force: " + wErrorMsg);
-   }
-}
+    // Runs inside island tasks - the contact cache is only read here
+    for (int i = 0; i < island.manifoldCount; ++i)
+    {
+        CollisionManifold& manifold = m_collisionManifolds[m_islandManifolds[island.firstManifold + i]];
+        PhysicsBody& bodyA = *manifold.bodyA;
+        PhysicsBody& bodyB = *manifold.bodyB;
 
-void Physics::ApplyGravityToParticles(std::vector<PhysicsParticle>& particles, float gravity)
-{
-   PHYSICS_RECORD_FUNCTION();
-   
-   try
-   {
-       PhysicsVector3D gravityForce(0.0f, -gravity, 0.0f);
-       
-       for (auto& particle : particles)
-       {
-           if (particle.isActive)
-           {
-               // Apply gravity force based on particle mass
-               particle.acceleration += gravityForce * particle.mass;
-           }
-       }
-       
-#if defined(_DEBUG_PHYSICS_)
-       static int debugCounter = 0;
-       if (++debugCounter % 120 == 0) // Log every 120 frames to avoid spam
-       {
-           debug.logDebugMessage(LogLevel::LOG_DEBUG, L"[Physics] Applied gravity %.2f to particle system", gravity);
-       }
-#endif
-   }
-   catch (const std::exception& e)
-   {
-       std::string errorMsg = e.what();
-       std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
-       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error applying gravity to particles: " + wErrorMsg);
-   }
+        for (auto& contact : manifold.contacts)
+        {
+            // Restitution target is taken from the approach speed before any impulse is applied
+            const float normalVelocity = (bodyB.velocity - bodyA.velocity).Dot(contact.normal);
+            contact.velocityBias = (normalVelocity < -CONTACT_RESTITUTION_THRESHOLD) ? -contact.restitution * normalVelocity : 0.0f;
+            contact.separationOffset = contact.penetrationDepth + (bodyB.position - bodyA.position).Dot(contact.normal);
+            contact.normalImpulse = 0.0f;
+            contact.tangentImpulse = PhysicsVector3D();
+
+            const PhysicsContactCache::Entry* cached = (manifold.indexA >= 0 && manifold.indexB != -1) ?
+                m_contactCache.Find(manifold.indexA, manifold.indexB, contact.featureId) : nullptr;
+            if (!cached || cached->normal.Dot(contact.normal) < CONTACT_WARM_START_NORMAL_TOLERANCE)
+            {
+                continue;
+            }
+
+            // Reuse last step's impulses, with friction projected onto the new tangent plane
+            contact.normalImpulse = cached->normalImpulse;
+            contact.tangentImpulse = cached->tangentImpulse - contact.normal * cached->tangentImpulse.Dot(contact.normal);
+
+            const PhysicsVector3D impulse = contact.normal * contact.normalImpulse + contact.tangentImpulse;
+            bodyA.velocity -= impulse * bodyA.inverseMass;
+            bodyB.velocity += impulse * bodyB.inverseMass;
+        }
+    }
 }
 
-//==============================================================================
-// Internal Helper Methods Implementation (continued)
-//==============================================================================
-void Physics::InitializePhysicsPrecalculations()
+void Physics::SolveVelocityConstraints(const PhysicsIsland& island)
 {
-   PHYSICS_RECORD_FUNCTION();
-   
-   try
-   {
-        #if defined(_DEBUG_PHYSICS_)
-               debug.logLevelMessage(LogLevel::LOG_INFO, L"[Physics] Initializing physics-specific precalculations");
-        #endif
-       
-       // Initialize gravity lookup tables
-       UpdateGravityLookupTables();
-       
-       // Initialize reflection angle tables
-       UpdateReflectionTables();
-       
-       // Initialize inertia coefficient tables
-       UpdateInertiaCoefficients();
-       
-        #if defined(_DEBUG_PHYSICS_)
-               debug.logLevelMessage(LogLevel::LOG_INFO, L"[Physics] Physics precalculations initialized successfully");
-        #endif
-   }
-   catch (const std::exception& e)
-   {
-       std::string errorMsg = e.what();
-       std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
-       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error initializing physics precalculations: " + wErrorMsg);
-       throw;
-   }
+    PHYSICS_RECORD_FUNCTION();
+
+    try
+    {
+        WarmStartContacts(island);
+
+        // Sequential impulses with clamped accumulated impulses (normal >= 0, friction inside the cone)
+        for (int iteration = 0; iteration < m_velocityIterations; ++iteration)
+        {
+            for (int i = 0; i < island.manifoldCount; ++i)
+            {
+                CollisionManifold& manifold = m_collisionManifolds[m_islandManifolds[island.firstManifold + i]];
+                PhysicsBody& bodyA = *manifold.bodyA;
+                PhysicsBody& bodyB = *manifold.bodyB;
+                const float totalInverseMass = bodyA.inverseMass + bodyB.inverseMass;
+                if (totalInverseMass <= 0.0f)
+                {
+                    continue;
+                }
+                const float effectiveMass = 1.0f / totalInverseMass;
+
+                for (auto& contact : manifold.contacts)
+                {
+                    // Friction
+                    PhysicsVector3D relativeVelocity = bodyB.velocity - bodyA.velocity;
+                    const PhysicsVector3D tangentVelocity = relativeVelocity - contact.normal * relativeVelocity.Dot(contact.normal);
+                    const PhysicsVector3D oldTangentImpulse = contact.tangentImpulse;
+                    PhysicsVector3D newTangentImpulse = oldTangentImpulse - tangentVelocity * effectiveMass;
+
+                    const float maxFriction = contact.friction * contact.normalImpulse;
+                    const float tangentImpulseSquared = newTangentImpulse.MagnitudeSquared();
+                    if (tangentImpulseSquared > maxFriction * maxFriction)
+                    {
+                        newTangentImpulse *= maxFriction / std::sqrt(tangentImpulseSquared);
+                    }
+
+                    const PhysicsVector3D frictionImpulse = newTangentImpulse - oldTangentImpulse;
+                    contact.tangentImpulse = newTangentImpulse;
+                    bodyA.velocity -= frictionImpulse * bodyA.inverseMass;
+                    bodyB.velocity += frictionImpulse * bodyB.inverseMass;
+
+                    // Normal
+                    relativeVelocity = bodyB.velocity - bodyA.velocity;
+                    const float normalVelocity = relativeVelocity.Dot(contact.normal);
+                    const float newNormalImpulse = std::max(contact.normalImpulse - effectiveMass * (normalVelocity - contact.velocityBias), 0.0f);
+                    const PhysicsVector3D normalImpulse = contact.normal * (newNormalImpulse - contact.normalImpulse);
+                    contact.normalImpulse = newNormalImpulse;
+                    bodyA.velocity -= normalImpulse * bodyA.inverseMass;
+                    bodyB.velocity += normalImpulse * bodyB.inverseMass;
+                }
+            }
+        }
+    }
+    catch (const std::exception& e)
+    {
+        std::string errorMsg = e.what();
+        std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
+        debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error solving velocity constraints: " + wErrorMsg);
+    }
 }
 
-void Physics::UpdateGravityLookupTables()
+void Physics::StoreContactImpulses()
 {
-    // This method would populate gravity intensity lookup tables
-    // for fast distance-based gravity calculations
     PHYSICS_RECORD_FUNCTION();
 
     try
     {
-        // Note: These lookup tables would be integrated into MathPrecalculation class
-        // for optimal performance. For now, we document the intention.
+        m_contactCache.BeginStep();
 
-#if defined(_DEBUG_PHYSICS_)
-        debug.logLevelMessage(LogLevel::LOG_INFO, L"[Physics] Updated gravity lookup tables");
-#endif
+        for (const auto& manifold : m_collisionManifolds)
+        {
+            // Terrain contacts are cached under the heightfield's negative index
+            if (manifold.indexA < 0 || manifold.indexB == -1)
+            {
+                continue;
+            }
+
+            for (const auto& contact : manifold.contacts)
+            {
+                m_contactCache.Store(manifold.indexA, manifold.indexB, contact.featureId, contact.normal,
+                    contact.normalImpulse, contact.tangentImpulse);
+            }
+        }
+
+        // Contacts of sleeping islands are not solved but must survive until the island wakes
+        m_contactCache.EvictStale([this](int bodyA, int bodyB) {
+            const auto isLive = [this](int bodyIndex) {
+                return static_cast<size_t>(bodyIndex) < m_bodyStore.Size() && m_bodyStore.IsSimulated(bodyIndex);
+            };
+            return isLive(bodyA) && isLive(bodyB) && (m_bodyStore.IsSleeping(bodyA) || m_bodyStore.IsSleeping(bodyB));
+        });
     }
     catch (const std::exception& e)
     {
         std::string errorMsg = e.what();
         std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
-        debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error updating gravity lookup tables: " + wErrorMsg);
+        debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error storing contact impulses: " + wErrorMsg);
     }
 }
 
-void Physics::UpdateReflectionTables()
+int Physics::FindIslandRoot(int node)
+{
+    // Path halving keeps the trees shallow without recursion
+    while (m_islandParents[node] != node)
+    {
+        m_islandParents[node] = m_islandParents[m_islandParents[node]];
+        node = m_islandParents[node];
+    }
+    return node;
+}
+
+void Physics::UniteIslands(int nodeA, int nodeB)
+{
+    const int rootA = FindIslandRoot(nodeA);
+    const int rootB = FindIslandRoot(nodeB);
+    if (rootA != rootB)
+    {
+        // Lower index wins so the structure does not depend on call order details
+        m_islandParents[std::max(rootA, rootB)] = std::min(rootA, rootB);
+    }
+}
+
+void Physics::BuildIslands()
 {
-    // This method would populate reflection angle lookup tables
-    // for fast collision response calculations
     PHYSICS_RECORD_FUNCTION();
 
+    // Nodes are solver bodies followed by the caller-owned bodies referenced by joints
+    const int solverNodeCount = static_cast<int>(m_solverBodies.size());
+    m_jointBodyNodes.clear();
+    for (const auto& joint : m_ragdollJoints)
+    {
+        if (joint.isActive && joint.bodyA && joint.bodyB)
+        {
+            m_jointBodyNodes.push_back(joint.bodyA);
+            m_jointBodyNodes.push_back(joint.bodyB);
+        }
+    }
+
+    // A sorted vector reuses its storage every step, unlike a node-based map
+    std::sort(m_jointBodyNodes.begin(), m_jointBodyNodes.end());
+    m_jointBodyNodes.erase(std::unique(m_jointBodyNodes.begin(), m_jointBodyNodes.end()), m_jointBodyNodes.end());
+
+    auto jointBodyNode = [&](PhysicsBody* body) -> int {
+        const auto it = std::lower_bound(m_jointBodyNodes.begin(), m_jointBodyNodes.end(), body);
+        return solverNodeCount + static_cast<int>(it - m_jointBodyNodes.begin());
+    };
+
+    const int nodeCount = solverNodeCount + static_cast<int>(m_jointBodyNodes.size());
+    m_islandParents.resize(nodeCount);
+    for (int node = 0; node < nodeCount; ++node)
+    {
+        m_islandParents[node] = node;
+    }
+
+    // Union bodies connected by a contact or a joint
+    const PhysicsBody* solverBase = m_solverBodies.data();
+    for (const auto& manifold : m_collisionManifolds)
+    {
+        UniteIslands(static_cast<int>(manifold.bodyA - solverBase), static_cast<int>(manifold.bodyB - solverBase));
+    }
+
+    for (const auto& joint : m_ragdollJoints)
+    {
+        if (joint.isActive && joint.bodyA && joint.bodyB)
+        {
+            UniteIslands(jointBodyNode(joint.bodyA), jointBodyNode(joint.bodyB));
+        }
+    }
+
+    // Number islands in order of first appearance - manifolds first, then joints - so the
+    // island order is fixed for a given set of constraints
+    m_islands.clear();
+    m_islandOfRoot.assign(nodeCount, -1);
+    auto islandOfNode = [&](int node) -> int {
+        int& island = m_islandOfRoot[FindIslandRoot(node)];
+        if (island < 0)
+        {
+            island = static_cast<int>(m_islands.size());
+            m_islands.emplace_back();
+        }
+        return island;
+    };
+
+    m_manifoldIslands.resize(m_collisionManifolds.size());
+    for (size_t i = 0; i < m_collisionManifolds.size(); ++i)
+    {
+        const int island = islandOfNode(static_cast<int>(m_collisionManifolds[i].bodyA - solverBase));
+        m_manifoldIslands[i] = island;
+        m_islands[island].manifoldCount++;
+    }
+
+    m_jointIslands.resize(m_ragdollJoints.size());
+    for (size_t i = 0; i < m_ragdollJoints.size(); ++i)
+    {
+        const RagdollJoint& joint = m_ragdollJoints[i];
+        m_jointIslands[i] = -1;
+        if (joint.isActive && joint.bodyA && joint.bodyB)
+        {
+            const int island = islandOfNode(jointBodyNode(joint.bodyA));
+            m_jointIslands[i] = island;
+            m_islands[island].jointCount++;
+        }
+    }
+
+    // Stable counting sort of manifold and joint indices into per-island ranges
+    int manifoldOffset = 0;
+    int jointOffset = 0;
+    for (auto& island : m_islands)
+    {
+        island.firstManifold = manifoldOffset;
+        island.firstJoint = jointOffset;
+        manifoldOffset += island.manifoldCount;
+        jointOffset += island.jointCount;
+        island.manifoldCount = 0;
+        island.jointCount = 0;
+    }
+
+    m_islandManifolds.resize(manifoldOffset);
+    for (size_t i = 0; i < m_manifoldIslands.size(); ++i)
+    {
+        PhysicsIsland& island = m_islands[m_manifoldIslands[i]];
+        m_islandManifolds[island.firstManifold + island.manifoldCount++] = static_cast<int>(i);
+    }
+
+    m_islandJoints.resize(jointOffset);
+    for (size_t i = 0; i < m_jointIslands.size(); ++i)
+    {
+        if (m_jointIslands[i] >= 0)
+        {
+            PhysicsIsland& island = m_islands[m_jointIslands[i]];
+            m_islandJoints[island.firstJoint + island.jointCount++] = static_cast<int>(i);
+        }
+    }
+}
+
+void Physics::SolveIsland(const PhysicsIsland& island)
+{
+    // Runs on solver workers - exceptions must not escape the task
     try
     {
-        // Note: These lookup tables would be integrated into MathPrecalculation class
-        // for optimal performance. For now, we document the intention.
+        // Update ragdoll joint constraints
+        for (int i = 0; i < island.jointCount; ++i)
+        {
+            m_ragdollJoints[m_islandJoints[island.firstJoint + i]].ApplyConstraints();
+        }
 
-#if defined(_DEBUG_PHYSICS_)
-        debug.logLevelMessage(LogLevel::LOG_INFO, L"[Physics] Updated reflection lookup tables");
-#endif
+        // Warm-started contact impulses, then positional drift correction
+        SolveVelocityConstraints(island);
+        SolvePositionConstraints(island);
     }
     catch (const std::exception& e)
     {
         std::string errorMsg = e.what();
         std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
-        debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error updating reflection tables: " + wErrorMsg);
+        debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error solving island: " + wErrorMsg);
+    }
+    catch (...)
+    {
+        debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Unknown exception solving island");
     }
 }
 
-void Physics::UpdateInertiaCoefficients()
+//==============================================================================
+// Ragdoll Physics Methods Implementation
+//==============================================================================
+std::vector<PhysicsBody> Physics::CreateRagdoll(const std::vector<PhysicsVector3D>& jointPositions,
+    const std::vector<std::pair<int, int>>& connections)
 {
-    // This method would populate inertia coefficient lookup tables
-    // for fast rotational physics calculations
     PHYSICS_RECORD_FUNCTION();
 
-    try
-    {
-        // Note: These lookup tables would be integrated into MathPrecalculation class
-        // for optimal performance. For now, we document the intention.
+    std::vector<PhysicsBody> ragdollBodies;
+
+    try
+    {
+        // Validate input
+        if (jointPositions.empty() || connections.empty())
+        {
+#if defined(_DEBUG_PHYSICS_)
+            debug.logLevelMessage(LogLevel::LOG_WARNING, L"[Physics] Invalid ragdoll parameters - empty positions or connections");
+#endif
+            return ragdollBodies;
+        }
+
+        // Create physics bodies for each joint
+        ragdollBodies.reserve(jointPositions.size());
+
+        for (size_t i = 0; i < jointPositions.size(); ++i)
+        {
+            PhysicsBody body;
+            body.position = jointPositions[i];
+            body.SetMass(1.0f); // Default mass
+            body.restitution = 0.1f; // Low bounce for realistic ragdoll
+            body.friction = 0.8f; // High friction for stability
+            body.drag = 0.1f; // Some air resistance
+            body.isStatic = false;
+            body.isActive = true;
+
+            ragdollBodies.push_back(body);
+        }
+
+        // Create joint constraints
+        for (const auto& connection : connections)
+        {
+            if (connection.first < static_cast<int>(ragdollBodies.size()) &&
+                connection.second < static_cast<int>(ragdollBodies.size()) &&
+                connection.first != connection.second)
+            {
+                RagdollJoint joint;
+                joint.bodyA = &ragdollBodies[connection.first];
+                joint.bodyB = &ragdollBodies[connection.second];
+                joint.anchorA = PhysicsVector3D(); // Local anchor points (simplified)
+                joint.anchorB = PhysicsVector3D();
+                joint.stiffness = 1000.0f;
+                joint.damping = 50.0f;
+                joint.isActive = true;
+
+                AddRagdollJoint(joint);
+            }
+        }
 
 #if defined(_DEBUG_PHYSICS_)
-        debug.logLevelMessage(LogLevel::LOG_INFO, L"[Physics] Updated inertia coefficient tables");
+        debug.logDebugMessage(LogLevel::LOG_INFO, L"[Physics] Created ragdoll with %zu bodies and %zu connections",
+            ragdollBodies.size(), connections.size());
 #endif
     }
     catch (const std::exception& e)
     {
         std::string errorMsg = e.what();
         std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
-        debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error updating inertia coefficients: " + wErrorMsg);
+        debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error creating ragdoll: " + wErrorMsg);
     }
+
+    return ragdollBodies;
 }
 
-void Physics::AllocatePhysicsMemory()
+void Physics::AddRagdollJoint(const RagdollJoint& joint)
 {
     PHYSICS_RECORD_FUNCTION();
 
     try
     {
-        // Memory pools would be allocated here for optimal performance
-        // This is a placeholder for future memory management optimization
+        std::lock_guard<std::mutex> lock(m_physicsMutex);
+
+        if (m_ragdollJoints.size() < MAX_RAGDOLL_JOINTS)
+        {
+            m_ragdollJoints.push_back(joint);
 
 #if defined(_DEBUG_PHYSICS_)
-        debug.logLevelMessage(LogLevel::LOG_INFO, L"[Physics] Allocated physics memory pools");
+            debug.logDebugMessage(LogLevel::LOG_INFO, L"[Physics] Added ragdoll joint - Total joints: %zu", m_ragdollJoints.size());
 #endif
-    }
-    catch (const std::exception& e)
-    {
-        std::string errorMsg = e.what();
-        std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
-        debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error allocating physics memory: " + wErrorMsg);
-        throw;
-    }
-}
-
-void Physics::DeallocatePhysicsMemory()
-{
-    PHYSICS_RECORD_FUNCTION();
-
-    try
-    {
-        // Memory pools would be deallocated here
-        // This is a placeholder for future memory management optimization
-
+        }
+        else
+        {
 #if defined(_DEBUG_PHYSICS_)
-        debug.logLevelMessage(LogLevel::LOG_INFO, L"[Physics] Deallocated physics memory pools");
+            debug.logLevelMessage(LogLevel::LOG_WARNING, L"[Physics] Maximum ragdoll joints reached, ignoring additional joint");
 #endif
+        }
     }
     catch (const std::exception& e)
     {
         std::string errorMsg = e.what();
         std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
-        debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error deallocating physics memory: " + wErrorMsg);
+        debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error adding ragdoll joint: " + wErrorMsg);
     }
 }
 
-size_t Physics::GetPhysicsMemoryUsage() const
+void Physics::RemoveRagdollJoint(int index)
 {
     PHYSICS_RECORD_FUNCTION();
 
-    size_t totalMemory = 0;
-
     try
     {
-        // Calculate memory usage for physics collections
-        totalMemory += m_physicsBodies.size() * sizeof(PhysicsBody);
-        totalMemory += m_gravityFields.size() * sizeof(GravityField);
-        totalMemory += m_ragdollJoints.size() * sizeof(RagdollJoint);
-        totalMemory += m_collisionManifolds.size() * sizeof(CollisionManifold);
-        totalMemory += m_debugLines.size() * sizeof(PhysicsVector3D);
+        std::lock_guard<std::mutex> lock(m_physicsMutex);
 
-        // Add estimated memory for internal structures
-        totalMemory += sizeof(Physics);
+        if (index >= 0 && index < static_cast<int>(m_ragdollJoints.size()))
+        {
+            m_ragdollJoints.erase(m_ragdollJoints.begin() + index);
 
-        return totalMemory;
+#if defined(_DEBUG_PHYSICS_)
+            debug.logDebugMessage(LogLevel::LOG_INFO, L"[Physics] Removed ragdoll joint at index %d", index);
+#endif
+        }
+        else
+        {
+#if defined(_DEBUG_PHYSICS_)
+            debug.logDebugMessage(LogLevel::LOG_WARNING, L"[Physics] Invalid ragdoll joint index: %d", index);
+#endif
+        }
     }
     catch (const std::exception& e)
     {
         std::string errorMsg = e.what();
         std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
-        debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error calculating memory usage: " + wErrorMsg);
-        return 0;
+        debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error removing ragdoll joint: " + wErrorMsg);
     }
 }
 
-void Physics::BroadPhaseCollisionDetection()
+void Physics::UpdateRagdoll(std::vector<PhysicsBody>& ragdollBodies, float deltaTime)
 {
     PHYSICS_RECORD_FUNCTION();
 
     try
     {
-        // Simple broad-phase collision detection using spatial hashing
-        // This is a simplified implementation for demonstration
-
-        // Clear previous manifolds
-        m_collisionManifolds.clear();
-
-        // Check all pairs of active bodies (O(n²) - would be optimized with spatial partitioning)
-        for (size_t i = 0; i < m_physicsBodies.size(); ++i)
+        // Update each ragdoll body
+        for (auto& body : ragdollBodies)
         {
-            for (size_t j = i + 1; j < m_physicsBodies.size(); ++j)
+            if (body.isActive)
             {
-                PhysicsBody& bodyA = m_physicsBodies[i];
-                PhysicsBody& bodyB = m_physicsBodies[j];
+                // Apply gravity
+                PhysicsVector3D gravity = CalculateGravityAtPosition(body.position);
+                body.ApplyForce(gravity);
 
-                // Skip inactive or static-static pairs
-                if (!bodyA.isActive || !bodyB.isActive || (bodyA.isStatic && bodyB.isStatic))
-                {
-                    continue;
-                }
+                // Integrate physics
+                VerletIntegration(body, deltaTime);
+            }
+        }
 
-                // Simple distance check for broad phase
-                float distance = FastDistance(bodyA.position, bodyB.position);
-                float combinedRadius = FAST_SQRT(bodyA.mass) + FAST_SQRT(bodyB.mass); // Approximate radius from mass
+        // Apply joint constraints
+        for (auto& joint : m_ragdollJoints)
+        {
+            if (joint.isActive)
+            {
+                joint.ApplyConstraints();
+            }
+        }
 
-                if (distance <= combinedRadius * 1.5f) // Broad phase threshold
-                {
-                    // Potential collision - add to narrow phase
-                    CollisionManifold manifold;
-                    manifold.bodyA = &bodyA;
-                    manifold.bodyB = &bodyB;
-                    m_collisionManifolds.push_back(manifold);
-                }
+#if defined(_DEBUG_PHYSICS_)
+        static int debugCounter = 0;
+        if (++debugCounter % 60 == 0) // Log every 60 frames
+        {
+            int activeBodies = 0;
+            for (const auto& body : ragdollBodies)
+            {
+                if (body.isActive) activeBodies++;
             }
+            debug.logDebugMessage(LogLevel::LOG_DEBUG, L"[Physics] Updated ragdoll - %d active bodies", activeBodies);
         }
+#endif
     }
     catch (const std::exception& e)
     {
         std::string errorMsg = e.what();
         std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
-        debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error in broad phase collision detection: " + wErrorMsg);
+        debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error updating ragdoll: " + wErrorMsg);
     }
 }
 
-void Physics::NarrowPhaseCollisionDetection()
+void Physics::BlendRagdollWithAnimation(std::vector<PhysicsBody>& ragdollBodies,
+    const std::vector<PhysicsVector3D>& animationPositions, float blendFactor)
 {
     PHYSICS_RECORD_FUNCTION();
 
     try
     {
-        // Narrow phase collision detection for potential collisions
-        for (auto& manifold : m_collisionManifolds)
+        // Ensure arrays are same size
+        size_t bodyCount = std::min(ragdollBodies.size(), animationPositions.size());
+        blendFactor = std::clamp(blendFactor, 0.0f, 1.0f);
+
+        for (size_t i = 0; i < bodyCount; ++i)
         {
-            if (!manifold.bodyA || !manifold.bodyB)
+            if (ragdollBodies[i].isActive)
             {
-                continue;
-            }
+                // Blend physics position with animation position
+                PhysicsVector3D blendedPosition = BlendPhysicsWithAnimation(
+                    ragdollBodies[i].position,
+                    animationPositions[i],
+                    blendFactor
+                );
 
-            // Generate detailed collision information
-            manifold = GenerateCollisionManifold(*manifold.bodyA, *manifold.bodyB);
+                ragdollBodies[i].position = blendedPosition;
+            }
         }
 
-        // Remove manifolds with no valid contacts
-        m_collisionManifolds.erase(
-            std::remove_if(m_collisionManifolds.begin(), m_collisionManifolds.end(),
-                [](const CollisionManifold& manifold) { return manifold.contacts.empty(); }),
-            m_collisionManifolds.end()
-        );
-
 #if defined(_DEBUG_PHYSICS_)
-        if (!m_collisionManifolds.empty())
-        {
-            debug.logDebugMessage(LogLevel::LOG_DEBUG, L"[Physics] Narrow phase detected %zu valid collisions",
-                m_collisionManifolds.size());
-        }
+        debug.logDebugMessage(LogLevel::LOG_DEBUG, L"[Physics] Blended ragdoll with animation - blend factor: %.3f", blendFactor);
 #endif
     }
     catch (const std::exception& e)
     {
         std::string errorMsg = e.what();
         std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
-        debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error in narrow phase collision detection: " + wErrorMsg);
+        debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error blending ragdoll with animation: " + wErrorMsg);
     }
 }
 
-CollisionManifold Physics::GenerateCollisionManifold(PhysicsBody& bodyA, PhysicsBody& bodyB) const
+int Physics::CreateXPBDRagdoll(const std::vector<PhysicsVector3D>& jointPositions,
+    const std::vector<std::pair<int, int>>& connections, float compliance, float coneAngle)
 {
     PHYSICS_RECORD_FUNCTION();
 
-    CollisionManifold manifold;
-    manifold.bodyA = &bodyA;
-    manifold.bodyB = &bodyB;
+    int ragdollId = -1;
 
     try
     {
-        // Simplified sphere-sphere collision detection
-        float radiusA = FAST_SQRT(bodyA.mass) * 0.5f;
-        float radiusB = FAST_SQRT(bodyB.mass) * 0.5f;
-
-        PhysicsVector3D direction = bodyB.position - bodyA.position;
-        float distance = direction.Magnitude();
-        float combinedRadius = radiusA + radiusB;
+        std::lock_guard<std::mutex> lock(m_physicsMutex);
+        ragdollId = m_ragdollSolver.AddRagdoll(jointPositions, connections, compliance, coneAngle);
 
-        if (distance < combinedRadius && distance > MIN_VELOCITY_THRESHOLD)
+#if defined(_DEBUG_PHYSICS_)
+        if (ragdollId < 0)
         {
-            // Collision detected - generate contact point
-            ContactPoint contact;
-            contact.normal = direction.Normalized();
-            contact.penetrationDepth = combinedRadius - distance;
-            contact.position = bodyA.position + direction * 0.5f; // Midpoint
-            contact.restitution = std::min(bodyA.restitution, bodyB.restitution);
-            contact.friction = std::sqrt(bodyA.friction * bodyB.friction); // Combined friction
-
-            manifold.AddContact(contact);
-            manifold.normal = contact.normal;
-
-            // Calculate separating velocity
-            PhysicsVector3D relativeVelocity = bodyB.velocity - bodyA.velocity;
-            manifold.separatingVelocity = FastDotProduct(relativeVelocity, manifold.normal);
+            debug.logLevelMessage(LogLevel::LOG_WARNING, L"[Physics] Invalid XPBD ragdoll parameters - empty or out of range connections");
+        }
+        else
+        {
+            debug.logDebugMessage(LogLevel::LOG_INFO, L"[Physics] Created XPBD ragdoll %d with %zu joints and %zu bones",
+                ragdollId, jointPositions.size(), connections.size());
         }
+#endif
     }
     catch (const std::exception& e)
     {
         std::string errorMsg = e.what();
         std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
-        debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error generating collision manifold: " + wErrorMsg);
+        debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error creating XPBD ragdoll: " + wErrorMsg);
     }
 
-    return manifold;
+    return ragdollId;
 }
 
-void Physics::SolvePositionConstraints()
+void Physics::RemoveXPBDRagdoll(int ragdollId)
 {
     PHYSICS_RECORD_FUNCTION();
 
     try
     {
-        // Solve position constraints to prevent penetration
-        const int maxIterations = 4; // Limit iterations for performance
+        std::lock_guard<std::mutex> lock(m_physicsMutex);
 
-        for (int iteration = 0; iteration < maxIterations; ++iteration)
+        if (!m_ragdollSolver.RemoveRagdoll(ragdollId))
         {
-            for (auto& manifold : m_collisionManifolds)
-            {
-                for (const auto& contact : manifold.contacts)
-                {
-                    if (contact.penetrationDepth > MIN_VELOCITY_THRESHOLD)
-                    {
-                        // Calculate position correction
-                        float totalInverseMass = manifold.bodyA->inverseMass + manifold.bodyB->inverseMass;
-                        if (totalInverseMass > 0.0f)
-                        {
-                            float correctionMagnitude = contact.penetrationDepth / totalInverseMass * 0.8f; // Baumgarte stabilization
-                            PhysicsVector3D correction = contact.normal * correctionMagnitude;
-
-                            // Apply position corrections
-                            manifold.bodyA->position -= correction * manifold.bodyA->inverseMass;
-                            manifold.bodyB->position += correction * manifold.bodyB->inverseMass;
-                        }
-                    }
-                }
-            }
+#if defined(_DEBUG_PHYSICS_)
+            debug.logDebugMessage(LogLevel::LOG_WARNING, L"[Physics] Invalid XPBD ragdoll id: %d", ragdollId);
+#endif
         }
     }
     catch (const std::exception& e)
     {
         std::string errorMsg = e.what();
         std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
-        debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error solving position constraints: " + wErrorMsg);
+        debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error removing XPBD ragdoll: " + wErrorMsg);
     }
 }
 
-void Physics::SolveVelocityConstraints()
+bool Physics::GetXPBDRagdollPositions(int ragdollId, std::vector<PhysicsVector3D>& outPositions) const
+{
+    std::lock_guard<std::mutex> lock(m_physicsMutex);
+    return m_ragdollSolver.GetPositions(ragdollId, outPositions);
+}
+
+void Physics::BlendXPBDRagdollWithAnimation(int ragdollId, const std::vector<PhysicsVector3D>& animationPositions, float blendFactor)
 {
     PHYSICS_RECORD_FUNCTION();
 
-    try
+    std::lock_guard<std::mutex> lock(m_physicsMutex);
+    m_ragdollSolver.BlendPositions(ragdollId, animationPositions, blendFactor);
+}
+
+void Physics::ApplyXPBDRagdollImpulse(int ragdollId, int jointIndex, const PhysicsVector3D& impulse)
+{
+    std::lock_guard<std::mutex> lock(m_physicsMutex);
+    m_ragdollSolver.ApplyImpulse(ragdollId, jointIndex, impulse);
+}
+
+void Physics::SetRagdollSubsteps(int substeps)
+{
+    std::lock_guard<std::mutex> lock(m_physicsMutex);
+    m_ragdollSolver.SetSubsteps(substeps);
+}
+
+void Physics::SetXPBDRagdollGround(bool enabled, float height, float friction)
+{
+    std::lock_guard<std::mutex> lock(m_physicsMutex);
+    m_ragdollSolver.SetGround(enabled, height, friction);
+}
+
+int Physics::GetXPBDRagdollCount() const
+{
+    std::lock_guard<std::mutex> lock(m_physicsMutex);
+    return m_ragdollSolver.GetRagdollCount();
+}
+
+void Physics::StepRagdolls(float deltaTime)
+{
+    PHYSICS_RECORD_FUNCTION();
+
+    if (m_ragdollSolver.GetRagdollCount() == 0)
+    {
+        return;
+    }
+
+    // Gravity fields are sampled once per step at the particle positions
+    const PhysicsVector3D* fieldGravity = nullptr;
+    if (!m_gravityFields.empty())
     {
-        // Solve velocity constraints for collision response
-        for (auto& manifold : m_collisionManifolds)
+        const int particleCount = m_ragdollSolver.GetParticleCount();
+        m_ragdollFieldGravity.resize(particleCount);
+        for (int i = 0; i < particleCount; ++i)
         {
-            manifold.ResolveCollision();
+            m_ragdollFieldGravity[i] = EvaluateGravityFields(m_ragdollSolver.GetParticlePosition(i));
         }
+        fieldGravity = m_ragdollFieldGravity.data();
     }
-    catch (const std::exception& e)
+
+    m_ragdollHeightfields.clear();
+    for (const PhysicsHeightfield& heightfield : m_heightfields)
     {
-        std::string errorMsg = e.what();
-        std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
-        debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error solving velocity constraints: " + wErrorMsg);
+        if (heightfield.IsValid())
+        {
+            m_ragdollHeightfields.push_back(&heightfield);
+        }
     }
+
+    m_ragdollSolver.Step(deltaTime, PhysicsVector3D(0.0f, -DEFAULT_GRAVITY, 0.0f), fieldGravity, m_ragdollHeightfields.data(),
+        static_cast<int>(m_ragdollHeightfields.size()), m_workerPool);
 }
 
 //==============================================================================
-// Ragdoll Physics Methods Implementation
+// Projectile Integration Kernels
 //==============================================================================
-std::vector<PhysicsBody> Physics::CreateRagdoll(const std::vector<PhysicsVector3D>& jointPositions,
-    const std::vector<std::pair<int, int>>& connections)
+// Arguments shared by the batched projectile kernels
+struct ProjectileBatchJob {
+    PhysicsVector3D startPosition;
+    const PhysicsVector3D* launchVelocities;
+    PhysicsVector3D* outPoints;                                                 // Null in first-hit-only mode
+    size_t pointStride;
+    size_t* outPointCounts;
+    ProjectileHit* outHits;                                                     // Null when only paths are wanted
+    float gravity;
+    float drag;
+    float timeStep;
+    float maxTime;
+    float groundHeight;
+};
+
+// Ground crossing inside the step previous -> position (the sample that went below the plane)
+static ProjectileHit ResolveProjectileHit(const PhysicsVector3D& previous, const PhysicsVector3D& position,
+    const PhysicsVector3D& velocity, float previousTime, float timeStep, float groundHeight)
 {
-    PHYSICS_RECORD_FUNCTION();
-
-    std::vector<PhysicsBody> ragdollBodies;
+    const float deltaY = position.y - previous.y;
+    const float fraction = (deltaY < 0.0f) ? std::clamp((groundHeight - previous.y) / deltaY, 0.0f, 1.0f) : 1.0f;
+
+    ProjectileHit hit;
+    hit.position = previous + (position - previous) * fraction;
+    hit.position.y = std::min(previous.y, groundHeight);
+    hit.velocity = velocity;
+    hit.time = previousTime + fraction * timeStep;
+    hit.hasHit = true;
+    return hit;
+}
 
-    try
-    {
-        // Validate input
-        if (jointPositions.empty() || connections.empty())
-        {
-#if defined(_DEBUG_PHYSICS_)
-            debug.logLevelMessage(LogLevel::LOG_WARNING, L"[Physics] Invalid ragdoll parameters - empty positions or connections");
-#endif
-            return ragdollBodies;
-        }
+// Single-projectile integrator behind every CalculateProjectileMotion / PredictProjectileHit entry point
+// emitPoint(point) returns false once the caller has no use for further samples, which ends the flight.
+template<typename EmitPoint>
+static ProjectileHit IntegrateProjectile(const PhysicsVector3D& startPosition, const PhysicsVector3D& initialVelocity,
+    float gravity, float drag, float timeStep, float maxTime, float groundHeight, EmitPoint&& emitPoint)
+{
+    PhysicsVector3D position = startPosition;
+    PhysicsVector3D velocity = initialVelocity;
+    const float gravityStep = -gravity * timeStep;
+    const float dragFactor = std::max(0.0f, 1.0f - drag * timeStep);
+    float currentTime = 0.0f;
+
+    bool hasRoom = emitPoint(position);
+    while (hasRoom && timeStep > 0.0f && currentTime < maxTime)
+    {
+        const PhysicsVector3D previous = position;
+        const float previousTime = currentTime;
 
-        // Create physics bodies for each joint
-        ragdollBodies.reserve(jointPositions.size());
+        velocity.y += gravityStep;
+        velocity *= dragFactor;
+        position += velocity * timeStep;
+        hasRoom = emitPoint(position);
+        currentTime += timeStep;
 
-        for (size_t i = 0; i < jointPositions.size(); ++i)
+        // Stop once the projectile moves down through the ground plane
+        if (position.y <= groundHeight && velocity.y < 0.0f)
         {
-            PhysicsBody body;
-            body.position = jointPositions[i];
-            body.SetMass(1.0f); // Default mass
-            body.restitution = 0.1f; // Low bounce for realistic ragdoll
-            body.friction = 0.8f; // High friction for stability
-            body.drag = 0.1f; // Some air resistance
-            body.isStatic = false;
-            body.isActive = true;
-
-            ragdollBodies.push_back(body);
+            return ResolveProjectileHit(previous, position, velocity, previousTime, timeStep, groundHeight);
         }
+    }
 
-        // Create joint constraints
-        for (const auto& connection : connections)
-        {
-            if (connection.first < static_cast<int>(ragdollBodies.size()) &&
-                connection.second < static_cast<int>(ragdollBodies.size()) &&
-                connection.first != connection.second)
-            {
-                RagdollJoint joint;
-                joint.bodyA = &ragdollBodies[connection.first];
-                joint.bodyB = &ragdollBodies[connection.second];
-                joint.anchorA = PhysicsVector3D(); // Local anchor points (simplified)
-                joint.anchorB = PhysicsVector3D();
-                joint.stiffness = 1000.0f;
-                joint.damping = 50.0f;
-                joint.isActive = true;
+    ProjectileHit miss;
+    miss.position = position;
+    miss.velocity = velocity;
+    miss.time = currentTime;
+    return miss;
+}
 
-                AddRagdollJoint(joint);
+// Batch lane through the scalar integrator (tails and machines without SIMD)
+static void IntegrateProjectileLane(const ProjectileBatchJob& job, size_t lane)
+{
+    PhysicsVector3D* points = job.outPoints ? job.outPoints + lane * job.pointStride : nullptr;
+    size_t pointCount = 0;
+    const bool wantsHit = (job.outHits != nullptr);
+
+    const ProjectileHit hit = IntegrateProjectile(job.startPosition, job.launchVelocities[lane], job.gravity, job.drag,
+        job.timeStep, job.maxTime, job.groundHeight, [&](const PhysicsVector3D& point) {
+            if (points && pointCount < job.pointStride)
+            {
+                points[pointCount++] = point;
             }
-        }
+            return wantsHit || (points && pointCount < job.pointStride);
+        });
 
-#if defined(_DEBUG_PHYSICS_)
-        debug.logDebugMessage(LogLevel::LOG_INFO, L"[Physics] Created ragdoll with %zu bodies and %zu connections",
-            ragdollBodies.size(), connections.size());
-#endif
+    if (job.outPointCounts)
+    {
+        job.outPointCounts[lane] = pointCount;
     }
-    catch (const std::exception& e)
+    if (job.outHits)
     {
-        std::string errorMsg = e.what();
-        std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
-        debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error creating ragdoll: " + wErrorMsg);
+        job.outHits[lane] = hit;
     }
-
-    return ragdollBodies;
 }
 
-void Physics::AddRagdollJoint(const RagdollJoint& joint)
+// Lane state shared by the SIMD kernels (rows sized for the widest kernel)
+// A lane is refilled with the next launch velocity as soon as its projectile lands, so short and long
+// flights can share a batch without leaving lanes idle until the longest one finishes.
+struct ProjectileLaneSet {
+    alignas(32) float position[3][8];
+    alignas(32) float previous[3][8];
+    alignas(32) float velocity[3][8];
+    alignas(32) float time[8];
+    alignas(32) float previousTime[8];
+    size_t launchIndex[8];
+    size_t pointCounts[8];
+    size_t launchCount;
+    size_t nextLaunch;
+    int laneCount;
+    int flyingMask;
+};
+
+// Loads the next launch into a lane, or leaves the lane empty once the batch is exhausted
+static void FillProjectileLane(const ProjectileBatchJob& job, ProjectileLaneSet& lanes, int lane)
 {
-    PHYSICS_RECORD_FUNCTION();
-
-    try
+    lanes.flyingMask &= ~(1 << lane);
+    while (lanes.nextLaunch < lanes.launchCount)
     {
-        std::lock_guard<std::mutex> lock(m_physicsMutex);
+        const size_t index = lanes.nextLaunch++;
+        const PhysicsVector3D& launchVelocity = job.launchVelocities[index];
+        const float startPosition[3] = { job.startPosition.x, job.startPosition.y, job.startPosition.z };
+        const float startVelocity[3] = { launchVelocity.x, launchVelocity.y, launchVelocity.z };
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            lanes.position[axis][lane] = startPosition[axis];
+            lanes.velocity[axis][lane] = startVelocity[axis];
+        }
+        lanes.time[lane] = 0.0f;
+        lanes.launchIndex[lane] = index;
+        lanes.pointCounts[lane] = 0;
+        if (job.outPoints && job.pointStride > 0)
+        {
+            job.outPoints[index * job.pointStride] = job.startPosition;
+            lanes.pointCounts[lane] = 1;
+        }
 
-        if (m_ragdollJoints.size() < MAX_RAGDOLL_JOINTS)
+        // Same exits as IntegrateProjectile before its first step
+        if ((job.outHits || lanes.pointCounts[lane] < job.pointStride) && 0.0f < job.maxTime)
         {
-            m_ragdollJoints.push_back(joint);
+            lanes.flyingMask |= 1 << lane;
+            return;
+        }
 
-#if defined(_DEBUG_PHYSICS_)
-            debug.logDebugMessage(LogLevel::LOG_INFO, L"[Physics] Added ragdoll joint - Total joints: %zu", m_ragdollJoints.size());
-#endif
+        if (job.outPointCounts)
+        {
+            job.outPointCounts[index] = lanes.pointCounts[lane];
         }
-        else
+        if (job.outHits)
         {
-#if defined(_DEBUG_PHYSICS_)
-            debug.logLevelMessage(LogLevel::LOG_WARNING, L"[Physics] Maximum ragdoll joints reached, ignoring additional joint");
-#endif
+            ProjectileHit miss;
+            miss.position = job.startPosition;
+            miss.velocity = launchVelocity;
+            job.outHits[index] = miss;
         }
     }
-    catch (const std::exception& e)
+}
+
+static void BeginProjectileLanes(const ProjectileBatchJob& job, size_t count, int laneCount, ProjectileLaneSet& lanes)
+{
+    lanes = ProjectileLaneSet();
+    lanes.launchCount = count;
+    lanes.laneCount = laneCount;
+    for (int lane = 0; lane < laneCount; ++lane)
     {
-        std::string errorMsg = e.what();
-        std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
-        debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error adding ragdoll joint: " + wErrorMsg);
+        FillProjectileLane(job, lanes, lane);
     }
 }
 
-void Physics::RemoveRagdollJoint(int index)
+// Publishes the results of finished lanes and refills them
+static void RetireProjectileLanes(const ProjectileBatchJob& job, ProjectileLaneSet& lanes, int doneMask, int hitMask)
 {
-    PHYSICS_RECORD_FUNCTION();
-
-    try
+    for (int lane = 0; lane < lanes.laneCount; ++lane)
     {
-        std::lock_guard<std::mutex> lock(m_physicsMutex);
-
-        if (index >= 0 && index < static_cast<int>(m_ragdollJoints.size()))
+        if ((doneMask & (1 << lane)) == 0)
         {
-            m_ragdollJoints.erase(m_ragdollJoints.begin() + index);
+            continue;
+        }
 
-#if defined(_DEBUG_PHYSICS_)
-            debug.logDebugMessage(LogLevel::LOG_INFO, L"[Physics] Removed ragdoll joint at index %d", index);
-#endif
+        const size_t index = lanes.launchIndex[lane];
+        if (job.outPointCounts)
+        {
+            job.outPointCounts[index] = lanes.pointCounts[lane];
         }
-        else
+        if (job.outHits)
         {
-#if defined(_DEBUG_PHYSICS_)
-            debug.logDebugMessage(LogLevel::LOG_WARNING, L"[Physics] Invalid ragdoll joint index: %d", index);
-#endif
+            const PhysicsVector3D position(lanes.position[0][lane], lanes.position[1][lane], lanes.position[2][lane]);
+            const PhysicsVector3D velocity(lanes.velocity[0][lane], lanes.velocity[1][lane], lanes.velocity[2][lane]);
+            if (hitMask & (1 << lane))
+            {
+                const PhysicsVector3D previous(lanes.previous[0][lane], lanes.previous[1][lane], lanes.previous[2][lane]);
+                job.outHits[index] = ResolveProjectileHit(previous, position, velocity, lanes.previousTime[lane], job.timeStep,
+                    job.groundHeight);
+            }
+            else
+            {
+                ProjectileHit miss;
+                miss.position = position;
+                miss.velocity = velocity;
+                miss.time = lanes.time[lane];
+                job.outHits[index] = miss;
+            }
         }
-    }
-    catch (const std::exception& e)
-    {
-        std::string errorMsg = e.what();
-        std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
-        debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error removing ragdoll joint: " + wErrorMsg);
+
+        FillProjectileLane(job, lanes, lane);
     }
 }
 
-void Physics::UpdateRagdoll(std::vector<PhysicsBody>& ragdollBodies, float deltaTime)
+#if defined(CPUFEATURES_X86)
+// SSE2 - 4 launch velocities in flight at a time. Multiplies and adds stay separate so every lane
+// matches IntegrateProjectile bit for bit; empty lanes keep integrating but are masked out.
+static size_t IntegrateProjectileLanesSSE2(const ProjectileBatchJob& job, size_t count)
 {
-    PHYSICS_RECORD_FUNCTION();
+    const __m128 dt = _mm_set1_ps(job.timeStep);
+    const __m128 gravityStep = _mm_set1_ps(-job.gravity * job.timeStep);
+    const __m128 dragFactor = _mm_set1_ps(std::max(0.0f, 1.0f - job.drag * job.timeStep));
+    const __m128 ground = _mm_set1_ps(job.groundHeight);
+    const __m128 maxTime = _mm_set1_ps(job.maxTime);
+    const __m128 zero = _mm_setzero_ps();
+
+    ProjectileLaneSet lanes;
+    BeginProjectileLanes(job, count, 4, lanes);
+
+    __m128 position[3];
+    __m128 velocity[3];
+    __m128 time = _mm_load_ps(lanes.time);
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        position[axis] = _mm_load_ps(lanes.position[axis]);
+        velocity[axis] = _mm_load_ps(lanes.velocity[axis]);
+    }
 
-    try
+    while (lanes.flyingMask != 0)
     {
-        // Update each ragdoll body
-        for (auto& body : ragdollBodies)
+        for (int axis = 0; axis < 3; ++axis)
         {
-            if (body.isActive)
-            {
-                // Apply gravity
-                PhysicsVector3D gravity = CalculateGravityAtPosition(body.position);
-                body.ApplyForce(gravity);
+            _mm_store_ps(lanes.previous[axis], position[axis]);
+        }
 
-                // Integrate physics
-                VerletIntegration(body, deltaTime);
-            }
+        velocity[1] = _mm_add_ps(velocity[1], gravityStep);
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            velocity[axis] = _mm_mul_ps(velocity[axis], dragFactor);
+            position[axis] = _mm_add_ps(position[axis], _mm_mul_ps(velocity[axis], dt));
         }
+        const __m128 previousTime = time;
+        time = _mm_add_ps(time, dt);
 
-        // Apply joint constraints
-        for (auto& joint : m_ragdollJoints)
+        const int hitMask = lanes.flyingMask &
+            _mm_movemask_ps(_mm_and_ps(_mm_cmple_ps(position[1], ground), _mm_cmplt_ps(velocity[1], zero)));
+        int doneMask = hitMask | (lanes.flyingMask & _mm_movemask_ps(_mm_cmpnlt_ps(time, maxTime)));
+
+        if (job.outPoints)
         {
-            if (joint.isActive)
+            for (int axis = 0; axis < 3; ++axis)
             {
-                joint.ApplyConstraints();
+                _mm_store_ps(lanes.position[axis], position[axis]);
+            }
+            for (int lane = 0; lane < 4; ++lane)
+            {
+                size_t& pointCount = lanes.pointCounts[lane];
+                if ((lanes.flyingMask & (1 << lane)) == 0)
+                {
+                    continue;
+                }
+                if (pointCount < job.pointStride)
+                {
+                    job.outPoints[lanes.launchIndex[lane] * job.pointStride + pointCount++] =
+                        PhysicsVector3D(lanes.position[0][lane], lanes.position[1][lane], lanes.position[2][lane]);
+                }
+                if (!job.outHits && pointCount >= job.pointStride)
+                {
+                    doneMask |= 1 << lane;
+                }
             }
         }
 
-#if defined(_DEBUG_PHYSICS_)
-        static int debugCounter = 0;
-        if (++debugCounter % 60 == 0) // Log every 60 frames
+        if (doneMask != 0)
         {
-            int activeBodies = 0;
-            for (const auto& body : ragdollBodies)
+            _mm_store_ps(lanes.time, time);
+            _mm_store_ps(lanes.previousTime, previousTime);
+            for (int axis = 0; axis < 3; ++axis)
             {
-                if (body.isActive) activeBodies++;
+                _mm_store_ps(lanes.position[axis], position[axis]);
+                _mm_store_ps(lanes.velocity[axis], velocity[axis]);
+            }
+
+            RetireProjectileLanes(job, lanes, doneMask, hitMask);
+
+            time = _mm_load_ps(lanes.time);
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                position[axis] = _mm_load_ps(lanes.position[axis]);
+                velocity[axis] = _mm_load_ps(lanes.velocity[axis]);
             }
-            debug.logDebugMessage(LogLevel::LOG_DEBUG, L"[Physics] Updated ragdoll - %d active bodies", activeBodies);
         }
-#endif
-    }
-    catch (const std::exception& e)
-    {
-        std::string errorMsg = e.what();
-        std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
-        debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error updating ragdoll: " + wErrorMsg);
     }
+
+    return count;
 }
 
-void Physics::BlendRagdollWithAnimation(std::vector<PhysicsBody>& ragdollBodies,
-    const std::vector<PhysicsVector3D>& animationPositions, float blendFactor)
+// AVX - 8 launch velocities in flight at a time (no FMA, for the same bit-exact reason as SSE2)
+// The upper register halves are cleared before leaving for the non-VEX bookkeeping code.
+CPUFEATURES_TARGET_AVX
+static size_t IntegrateProjectileLanesAVX(const ProjectileBatchJob& job, size_t count)
 {
-    PHYSICS_RECORD_FUNCTION();
+    const __m256 dt = _mm256_set1_ps(job.timeStep);
+    const __m256 gravityStep = _mm256_set1_ps(-job.gravity * job.timeStep);
+    const __m256 dragFactor = _mm256_set1_ps(std::max(0.0f, 1.0f - job.drag * job.timeStep));
+    const __m256 ground = _mm256_set1_ps(job.groundHeight);
+    const __m256 maxTime = _mm256_set1_ps(job.maxTime);
+    const __m256 zero = _mm256_setzero_ps();
+
+    ProjectileLaneSet lanes;
+    BeginProjectileLanes(job, count, 8, lanes);
+
+    __m256 position[3];
+    __m256 velocity[3];
+    __m256 time = _mm256_load_ps(lanes.time);
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        position[axis] = _mm256_load_ps(lanes.position[axis]);
+        velocity[axis] = _mm256_load_ps(lanes.velocity[axis]);
+    }
 
-    try
+    while (lanes.flyingMask != 0)
     {
-        // Ensure arrays are same size
-        size_t bodyCount = std::min(ragdollBodies.size(), animationPositions.size());
-        blendFactor = std::clamp(blendFactor, 0.0f, 1.0f);
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            _mm256_store_ps(lanes.previous[axis], position[axis]);
+        }
 
-        for (size_t i = 0; i < bodyCount; ++i)
+        velocity[1] = _mm256_add_ps(velocity[1], gravityStep);
+        for (int axis = 0; axis < 3; ++axis)
         {
-            if (ragdollBodies[i].isActive)
-            {
-                // Blend physics position with animation position
-                PhysicsVector3D blendedPosition = BlendPhysicsWithAnimation(
-                    ragdollBodies[i].position,
-                    animationPositions[i],
-                    blendFactor
-                );
+            velocity[axis] = _mm256_mul_ps(velocity[axis], dragFactor);
+            position[axis] = _mm256_add_ps(position[axis], _mm256_mul_ps(velocity[axis], dt));
+        }
+        const __m256 previousTime = time;
+        time = _mm256_add_ps(time, dt);
 
-                ragdollBodies[i].position = blendedPosition;
+        const int hitMask = lanes.flyingMask & _mm256_movemask_ps(_mm256_and_ps(_mm256_cmp_ps(position[1], ground, _CMP_LE_OQ),
+            _mm256_cmp_ps(velocity[1], zero, _CMP_LT_OQ)));
+        int doneMask = hitMask | (lanes.flyingMask & _mm256_movemask_ps(_mm256_cmp_ps(time, maxTime, _CMP_NLT_UQ)));
+
+        if (job.outPoints)
+        {
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                _mm256_store_ps(lanes.position[axis], position[axis]);
+            }
+            for (int lane = 0; lane < 8; ++lane)
+            {
+                size_t& pointCount = lanes.pointCounts[lane];
+                if ((lanes.flyingMask & (1 << lane)) == 0)
+                {
+                    continue;
+                }
+                if (pointCount < job.pointStride)
+                {
+                    job.outPoints[lanes.launchIndex[lane] * job.pointStride + pointCount++] =
+                        PhysicsVector3D(lanes.position[0][lane], lanes.position[1][lane], lanes.position[2][lane]);
+                }
+                if (!job.outHits && pointCount >= job.pointStride)
+                {
+                    doneMask |= 1 << lane;
+                }
             }
         }
 
-#if defined(_DEBUG_PHYSICS_)
-        debug.logDebugMessage(LogLevel::LOG_DEBUG, L"[Physics] Blended ragdoll with animation - blend factor: %.3f", blendFactor);
-#endif
-    }
-    catch (const std::exception& e)
-    {
-        std::string errorMsg = e.what();
-        std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
-        debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error blending ragdoll with animation: " + wErrorMsg);
+        if (doneMask != 0)
+        {
+            _mm256_store_ps(lanes.time, time);
+            _mm256_store_ps(lanes.previousTime, previousTime);
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                _mm256_store_ps(lanes.position[axis], position[axis]);
+                _mm256_store_ps(lanes.velocity[axis], velocity[axis]);
+            }
+
+            _mm256_zeroupper();
+            RetireProjectileLanes(job, lanes, doneMask, hitMask);
+
+            time = _mm256_load_ps(lanes.time);
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                position[axis] = _mm256_load_ps(lanes.position[axis]);
+                velocity[axis] = _mm256_load_ps(lanes.velocity[axis]);
+            }
+        }
     }
+
+    return count;
 }
+#endif
 
 //==============================================================================
 // Newtonian Motion Methods Implementation
@@ -2947,41 +10225,13 @@ std::vector<PhysicsVector3D> Physics::CalculateProjectileMotion(const PhysicsVec
 
     try
     {
-        PhysicsVector3D currentPosition = startPosition;
-        PhysicsVector3D currentVelocity = initialVelocity;
-        float currentTime = 0.0f;
-
         // Reserve space for trajectory points
         int maxPoints = static_cast<int>(maxTime / timeStep);
         trajectory.reserve(maxPoints);
 
-        // Add starting position
-        trajectory.push_back(currentPosition);
-
-        // Simulate projectile motion
-        while (currentTime < maxTime)
-        {
-            // Apply gravity
-            PhysicsVector3D gravityForce(0.0f, -gravity, 0.0f);
-            currentVelocity += gravityForce * timeStep;
-
-            // Apply drag
-            float dragFactor = 1.0f - (drag * timeStep);
-            dragFactor = std::max(0.0f, dragFactor);
-            currentVelocity *= dragFactor;
-
-            // Update position
-            currentPosition += currentVelocity * timeStep;
-            trajectory.push_back(currentPosition);
-
-            currentTime += timeStep;
-
-            // Stop if projectile hits ground (y = 0)
-            if (currentPosition.y <= 0.0f && currentVelocity.y < 0.0f)
-            {
-                break;
-            }
-        }
+        // Simulate projectile motion until it comes down through y = 0
+        IntegrateProjectile(startPosition, initialVelocity, gravity, drag, timeStep, maxTime, 0.0f,
+            [&trajectory](const PhysicsVector3D& point) { trajectory.push_back(point); return true; });
 
 #if defined(_DEBUG_PHYSICS_)
         debug.logDebugMessage(LogLevel::LOG_INFO, L"[Physics] Calculated projectile motion with %zu trajectory points",
@@ -2995,7 +10245,80 @@ std::vector<PhysicsVector3D> Physics::CalculateProjectileMotion(const PhysicsVec
         debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error calculating projectile motion: " + wErrorMsg);
     }
 
-    return trajectory;
+    return trajectory;
+}
+
+size_t Physics::CalculateProjectileMotion(const PhysicsVector3D& startPosition, const PhysicsVector3D& initialVelocity,
+    PhysicsVector3D* outPoints, size_t capacity, float gravity, float drag, float timeStep, float maxTime) const
+{
+    PHYSICS_RECORD_FUNCTION();
+
+    size_t pointCount = 0;
+    if (!outPoints || capacity == 0)
+    {
+        return 0;
+    }
+
+    IntegrateProjectile(startPosition, initialVelocity, gravity, drag, timeStep, maxTime, 0.0f,
+        [&](const PhysicsVector3D& point) { outPoints[pointCount++] = point; return pointCount < capacity; });
+
+    return pointCount;
+}
+
+void Physics::CalculateProjectileMotionBatch(const PhysicsVector3D& startPosition, const PhysicsVector3D* launchVelocities,
+    size_t count, PhysicsVector3D* outPoints, size_t pointStride, size_t* outPointCounts, ProjectileHit* outHits,
+    float gravity, float drag, float timeStep, float maxTime, float groundHeight) const
+{
+    PHYSICS_RECORD_FUNCTION();
+
+    if (!launchVelocities || count == 0 || (!outPoints && !outHits))
+    {
+        return;
+    }
+
+    ProjectileBatchJob job;
+    job.startPosition = startPosition;
+    job.launchVelocities = launchVelocities;
+    job.outPoints = outPoints;
+    job.pointStride = outPoints ? pointStride : 0;
+    job.outPointCounts = outPointCounts;
+    job.outHits = outHits;
+    job.gravity = gravity;
+    job.drag = drag;
+    job.timeStep = timeStep;
+    job.maxTime = maxTime;
+    job.groundHeight = groundHeight;
+
+    size_t processed = 0;
+#if defined(CPUFEATURES_X86)
+    // Lanes only advance together on a positive step - anything else falls through to the scalar loop
+    if (timeStep > 0.0f)
+    {
+        const CPUFeatureFlags& cpu = GetCPUFeatures();
+        if (cpu.hasAVX)
+        {
+            processed = IntegrateProjectileLanesAVX(job, count);
+        }
+        else if (cpu.hasSSE2)
+        {
+            processed = IntegrateProjectileLanesSSE2(job, count);
+        }
+    }
+#endif
+
+    for (size_t lane = processed; lane < count; ++lane)
+    {
+        IntegrateProjectileLane(job, lane);
+    }
+}
+
+ProjectileHit Physics::PredictProjectileHit(const PhysicsVector3D& startPosition, const PhysicsVector3D& initialVelocity,
+    float gravity, float drag, float timeStep, float maxTime, float groundHeight) const
+{
+    PHYSICS_RECORD_FUNCTION();
+
+    return IntegrateProjectile(startPosition, initialVelocity, gravity, drag, timeStep, maxTime, groundHeight,
+        [](const PhysicsVector3D&) { return true; });
 }
 
 PhysicsVector3D Physics::CalculateTrajectoryToTarget(const PhysicsVector3D& startPosition,
@@ -3211,6 +10534,218 @@ void Physics::GetPhysicsStatistics(int& activeBodyCount, int& collisionCount, in
    }
 }
 
+void Physics::GetPhysicsStatistics(int& activeBodyCount, int& collisionCount, int& particleCount,
+    int& sleepingBodyCount, int& awakeBodyCount) const
+{
+   GetPhysicsStatistics(activeBodyCount, collisionCount, particleCount);
+   
+   // Active bodies include sleeping ones - awake bodies are the ones actually stepped
+   sleepingBodyCount = m_sleepingBodyCount.load();
+   awakeBodyCount = std::max(0, activeBodyCount - sleepingBodyCount);
+}
+
+void Physics::GetPhysicsStatistics(PhysicsStatistics& statistics) const
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   statistics = PhysicsStatistics();
+   GetPhysicsStatistics(statistics.activeBodyCount, statistics.collisionCount, statistics.particleCount,
+       statistics.sleepingBodyCount, statistics.awakeBodyCount);
+   
+   try
+   {
+       // The profiler rings are written by the step, so read them under the physics lock
+       std::lock_guard<std::mutex> lock(m_physicsMutex);
+       
+       statistics.stepCount = m_stepCount;
+       statistics.lastUpdateTime = m_lastUpdateTime;
+       statistics.frameArenaPeakSize = m_frameArena.GetPeakSize();
+       
+#if defined(PHYSICS_PROFILING_ENABLED)
+       statistics.sampleCount = m_profiler.GetSampleCount();
+       for (int phase = 0; phase < PhysicsProfiler::PHASE_COUNT; ++phase)
+       {
+           statistics.phases[phase] = m_profiler.GetPhaseSeries(static_cast<PhysicsProfilePhase>(phase));
+       }
+       for (int counter = 0; counter < PhysicsProfiler::COUNTER_COUNT; ++counter)
+       {
+           statistics.counters[counter] = m_profiler.GetCounterSeries(static_cast<PhysicsProfileCounter>(counter));
+       }
+#endif
+   }
+   catch (const std::exception& e)
+   {
+       std::string errorMsg = e.what();
+       std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error getting step statistics: " + wErrorMsg);
+   }
+}
+
+void Physics::FormatPhysicsStatistics(std::vector<std::wstring>& lines) const
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   lines.clear();
+   
+   try
+   {
+       PhysicsStatistics statistics;
+       GetPhysicsStatistics(statistics);
+       
+       std::wostringstream line;
+       line << std::fixed << std::setprecision(3);
+       auto flush = [&lines, &line]() {
+           lines.push_back(line.str());
+           line.str(std::wstring());
+       };
+       
+       line << L"[Physics] Steps: " << statistics.stepCount << L" (" << statistics.sampleCount
+           << L" sampled), last update " << statistics.lastUpdateTime << L" ms";
+       flush();
+       line << L"[Physics] Bodies: " << statistics.activeBodyCount << L" active, " << statistics.awakeBodyCount
+           << L" awake, " << statistics.sleepingBodyCount << L" asleep - " << statistics.collisionCount
+           << L" collisions, " << statistics.particleCount << L" particles";
+       flush();
+       
+#if defined(PHYSICS_PROFILING_ENABLED)
+       auto addSeries = [&line, &flush](const char* name, const PhysicsProfileSeries& series) {
+           const std::string narrowName(name);
+           line << L"[Physics]   " << std::left << std::setw(20) << std::wstring(narrowName.begin(), narrowName.end())
+               << std::right << std::setw(10) << series.last << std::setw(10) << series.min << std::setw(10) << series.avg
+               << std::setw(10) << series.max << std::setw(10) << series.p99;
+           flush();
+       };
+       
+       line << L"[Physics]   " << std::left << std::setw(20) << L"Phase (ms)" << std::right << std::setw(10) << L"last"
+           << std::setw(10) << L"min" << std::setw(10) << L"avg" << std::setw(10) << L"max" << std::setw(10) << L"p99";
+       flush();
+       for (int phase = 0; phase < PhysicsProfiler::PHASE_COUNT; ++phase)
+       {
+           addSeries(PhysicsProfiler::GetPhaseName(static_cast<PhysicsProfilePhase>(phase)), statistics.phases[phase]);
+       }
+       
+       line << std::setprecision(1);
+       line << L"[Physics]   " << std::left << std::setw(20) << L"Counter" << std::right << std::setw(10) << L"last"
+           << std::setw(10) << L"min" << std::setw(10) << L"avg" << std::setw(10) << L"max" << std::setw(10) << L"p99";
+       flush();
+       for (int counter = 0; counter < PhysicsProfiler::COUNTER_COUNT; ++counter)
+       {
+           addSeries(PhysicsProfiler::GetCounterName(static_cast<PhysicsProfileCounter>(counter)), statistics.counters[counter]);
+       }
+#else
+       line << L"[Physics] Step profiling is compiled out (_NO_PHYSICS_PROFILING_)";
+       flush();
+#endif
+   }
+   catch (const std::exception& e)
+   {
+       std::string errorMsg = e.what();
+       std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error formatting statistics: " + wErrorMsg);
+   }
+}
+
+void Physics::LogPhysicsStatistics() const
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   // Log lines are mirrored to the console window
+   std::vector<std::wstring> lines;
+   FormatPhysicsStatistics(lines);
+   for (const std::wstring& line : lines)
+   {
+       debug.logLevelMessage(LogLevel::LOG_INFO, line);
+   }
+}
+
+bool Physics::ExportPhysicsStatistics(const std::string& filepath, PhysicsStatisticsFormat format) const
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   try
+   {
+       PhysicsStatistics statistics;
+       GetPhysicsStatistics(statistics);
+       
+       std::ofstream file(filepath, std::ios::trunc);
+       if (!file.is_open())
+       {
+           std::wstring wPath(filepath.begin(), filepath.end());
+           debug.logLevelMessage(LogLevel::LOG_WARNING, L"[Physics] Could not open statistics file: " + wPath);
+           return false;
+       }
+       file << std::fixed << std::setprecision(4);
+       
+       if (format == PhysicsStatisticsFormat::CSV)
+       {
+           // Totals first, then one row per rolling series
+           file << "section,name,last,min,avg,max,p99\n";
+           file << "total,steps," << statistics.stepCount << ",,,,\n";
+           file << "total,samples," << statistics.sampleCount << ",,,,\n";
+           file << "total,updateMs," << statistics.lastUpdateTime << ",,,,\n";
+           file << "total,activeBodies," << statistics.activeBodyCount << ",,,,\n";
+           file << "total,sleepingBodies," << statistics.sleepingBodyCount << ",,,,\n";
+           file << "total,collisions," << statistics.collisionCount << ",,,,\n";
+           file << "total,particles," << statistics.particleCount << ",,,,\n";
+           file << "total,arenaPeakBytes," << statistics.frameArenaPeakSize << ",,,,\n";
+           
+           auto writeRow = [&file](const char* section, const char* name, const PhysicsProfileSeries& series) {
+               file << section << "," << name << "," << series.last << "," << series.min << "," << series.avg << ","
+                   << series.max << "," << series.p99 << "\n";
+           };
+           for (int phase = 0; phase < PhysicsProfiler::PHASE_COUNT; ++phase)
+           {
+               writeRow("phaseMs", PhysicsProfiler::GetPhaseName(static_cast<PhysicsProfilePhase>(phase)), statistics.phases[phase]);
+           }
+           for (int counter = 0; counter < PhysicsProfiler::COUNTER_COUNT; ++counter)
+           {
+               writeRow("counter", PhysicsProfiler::GetCounterName(static_cast<PhysicsProfileCounter>(counter)), statistics.counters[counter]);
+           }
+       }
+       else
+       {
+           auto writeSeries = [&file](const char* name, const PhysicsProfileSeries& series, bool last) {
+               file << "    \"" << name << "\": { \"last\": " << series.last << ", \"min\": " << series.min << ", \"avg\": "
+                   << series.avg << ", \"max\": " << series.max << ", \"p99\": " << series.p99 << " }" << (last ? "\n" : ",\n");
+           };
+           
+           file << "{\n";
+           file << "  \"steps\": " << statistics.stepCount << ",\n";
+           file << "  \"samples\": " << statistics.sampleCount << ",\n";
+           file << "  \"updateMs\": " << statistics.lastUpdateTime << ",\n";
+           file << "  \"activeBodies\": " << statistics.activeBodyCount << ",\n";
+           file << "  \"sleepingBodies\": " << statistics.sleepingBodyCount << ",\n";
+           file << "  \"collisions\": " << statistics.collisionCount << ",\n";
+           file << "  \"particles\": " << statistics.particleCount << ",\n";
+           file << "  \"arenaPeakBytes\": " << statistics.frameArenaPeakSize << ",\n";
+           file << "  \"phasesMs\": {\n";
+           for (int phase = 0; phase < PhysicsProfiler::PHASE_COUNT; ++phase)
+           {
+               writeSeries(PhysicsProfiler::GetPhaseName(static_cast<PhysicsProfilePhase>(phase)), statistics.phases[phase],
+                   phase + 1 == PhysicsProfiler::PHASE_COUNT);
+           }
+           file << "  },\n";
+           file << "  \"counters\": {\n";
+           for (int counter = 0; counter < PhysicsProfiler::COUNTER_COUNT; ++counter)
+           {
+               writeSeries(PhysicsProfiler::GetCounterName(static_cast<PhysicsProfileCounter>(counter)), statistics.counters[counter],
+                   counter + 1 == PhysicsProfiler::COUNTER_COUNT);
+           }
+           file << "  }\n";
+           file << "}\n";
+       }
+       
+       return file.good();
+   }
+   catch (const std::exception& e)
+   {
+       std::string errorMsg = e.what();
+       std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error exporting statistics: " + wErrorMsg);
+       return false;
+   }
+}
+
 void Physics::AddDebugLine(const PhysicsVector3D& start, const PhysicsVector3D& end)
 {
    PHYSICS_RECORD_FUNCTION();
@@ -3248,8 +10783,13 @@ void Physics::ResetPerformanceCounters()
        m_lastUpdateTime = 0.0f;
        m_activeBodyCount.store(0);
        m_collisionCount.store(0);
+       m_sleepingBodyCount.store(0);
        m_particleCount.store(0);
        
+#if defined(PHYSICS_PROFILING_ENABLED)
+       m_profiler.Reset();
+#endif
+       
 #if defined(_DEBUG_PHYSICS_)
        debug.logLevelMessage(LogLevel::LOG_INFO, L"[Physics] Reset performance counters");
 #endif
@@ -3265,20 +10805,280 @@ void Physics::ResetPerformanceCounters()
 //==============================================================================
 // Additional Helper Methods Implementation
 //==============================================================================
+void Physics::IntegrateBodies(float deltaTime)
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   try
+   {
+       const size_t bodyCount = m_bodyStore.Size();
+       const PhysicsVector3D uniformGravity(0.0f, -DEFAULT_GRAVITY, 0.0f);
+       
+       // Gravity fields vary per body - accumulate them before the vector kernels run
+       if (!m_gravityFields.empty())
+       {
+           RebuildGravityTree();
+           AccumulateGravityFieldForces();
+       }
+       
+       // Vector kernels handle whole lanes, the scalar loop finishes the remainder
+       size_t processed = 0;
+#if defined(CPUFEATURES_X86)
+       if (m_integrationPath == PhysicsSIMDPath::AVX2)
+       {
+           processed = IntegrateBodyStoreAVX2(m_bodyStore, bodyCount, uniformGravity, deltaTime);
+       }
+       else if (m_integrationPath == PhysicsSIMDPath::SSE2)
+       {
+           processed = IntegrateBodyStoreSSE2(m_bodyStore, bodyCount, uniformGravity, deltaTime);
+       }
+#endif
+       IntegrateBodyStoreScalar(m_bodyStore, processed, bodyCount, uniformGravity, deltaTime);
+   }
+   catch (const std::exception& e)
+   {
+       std::string errorMsg = e.what();
+       std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error integrating bodies: " + wErrorMsg);
+   }
+}
+
+int Physics::GatherSolverBody(int bodyIndex)
+{
+   // Static bodies get a private copy per manifold so islands never share a solver body
+   if (m_bodyStore.flags[bodyIndex] & PhysicsBodyStore::FLAG_STATIC)
+   {
+       m_solverBodies.push_back(m_bodyStore.Load(bodyIndex));
+       m_solverBodyIndices.push_back(-1);
+       return static_cast<int>(m_solverBodies.size()) - 1;
+   }
+   
+   if (m_solverSlots.size() < m_bodyStore.Size())
+   {
+       m_solverSlots.resize(m_bodyStore.Size(), -1);
+   }
+   
+   int& slot = m_solverSlots[bodyIndex];
+   if (slot < 0)
+   {
+       slot = static_cast<int>(m_solverBodies.size());
+       m_solverBodies.push_back(m_bodyStore.Load(bodyIndex));
+       m_solverBodyIndices.push_back(bodyIndex);
+   }
+   
+   return slot;
+}
+
+void Physics::ScatterSolverBodies()
+{
+   // Only position and velocity are changed by the contact solver
+   for (size_t slot = 0; slot < m_solverBodies.size(); ++slot)
+   {
+       const PhysicsBody& body = m_solverBodies[slot];
+       const int bodyIndex = m_solverBodyIndices[slot];
+       if (bodyIndex < 0)
+       {
+           continue;                                                          // Static copy, nothing to write back
+       }
+       
+       m_bodyStore.positionX[bodyIndex] = body.position.x;
+       m_bodyStore.positionY[bodyIndex] = body.position.y;
+       m_bodyStore.positionZ[bodyIndex] = body.position.z;
+       m_bodyStore.velocityX[bodyIndex] = body.velocity.x;
+       m_bodyStore.velocityY[bodyIndex] = body.velocity.y;
+       m_bodyStore.velocityZ[bodyIndex] = body.velocity.z;
+       m_solverSlots[bodyIndex] = -1;
+   }
+   
+   m_solverBodies.clear();
+   m_solverBodyIndices.clear();
+}
+
+void Physics::WakeTouchedBodies()
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   // Broad phase only pairs a sleeping body with an awake dynamic one, so any real
+   // contact left after the narrow phase is a wake-up
+   for (const auto& manifold : m_collisionManifolds)
+   {
+       m_bodyStore.WakeUp(manifold.indexA);
+       if (manifold.indexB >= 0)
+       {
+           m_bodyStore.WakeUp(manifold.indexB);
+       }
+   }
+}
+
+void Physics::UpdateSleepState(float deltaTime)
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   try
+   {
+       const size_t bodyCount = m_bodyStore.Size();
+       const uint32_t skipFlags = PhysicsBodyStore::FLAG_STATIC | PhysicsBodyStore::FLAG_SLEEPING;
+       const float linearEnergyThreshold = 0.5f * SLEEP_LINEAR_VELOCITY_THRESHOLD * SLEEP_LINEAR_VELOCITY_THRESHOLD;
+       const float angularEnergyThreshold = 0.5f * SLEEP_ANGULAR_VELOCITY_THRESHOLD * SLEEP_ANGULAR_VELOCITY_THRESHOLD;
+       const float smoothing = std::min(1.0f, deltaTime / SLEEP_ENERGY_TIME_CONSTANT);
+       
+       // Island of a body in this step's solver working set (-1 when it touched nothing)
+       auto islandOfBody = [&](int bodyIndex, int& slot) -> int {
+           slot = (static_cast<size_t>(bodyIndex) < m_solverSlots.size()) ? m_solverSlots[bodyIndex] : -1;
+           if (slot < 0 || static_cast<size_t>(slot) >= m_islandOfRoot.size())
+           {
+               return -1;
+           }
+           return m_islandOfRoot[FindIslandRoot(slot)];
+       };
+       
+       // Islands holding ragdoll joints never sleep - their bodies are owned by the caller
+       const size_t islandCount = m_islands.size();
+       m_islandSleepTimers.assign(islandCount, SLEEP_TIME_WINDOW);
+       m_islandSleepHeads.assign(islandCount, -1);
+       for (size_t island = 0; island < islandCount; ++island)
+       {
+           if (m_islands[island].jointCount > 0)
+           {
+               m_islandSleepTimers[island] = 0.0f;
+           }
+       }
+       
+       // Track smoothed kinetic energies so contact jitter averages out, and how long each
+       // awake body has stayed below both thresholds; an island is only as rested as its
+       // most active body
+       for (size_t i = 0; i < bodyCount; ++i)
+       {
+           const int bodyIndex = static_cast<int>(i);
+           if (!m_bodyStore.IsSimulated(bodyIndex) || (m_bodyStore.flags[i] & skipFlags))
+           {
+               continue;
+           }
+           
+           int slot;
+           const int island = islandOfBody(bodyIndex, slot);
+           const PhysicsVector3D velocity = (slot >= 0) ? m_solverBodies[slot].velocity : m_bodyStore.GetVelocity(bodyIndex);
+           const float angularSpeedSquared = m_bodyStore.angularVelocityX[i] * m_bodyStore.angularVelocityX[i] +
+               m_bodyStore.angularVelocityY[i] * m_bodyStore.angularVelocityY[i] +
+               m_bodyStore.angularVelocityZ[i] * m_bodyStore.angularVelocityZ[i];
+           
+           float& linearEnergy = m_bodyStore.linearEnergy[i];
+           float& angularEnergy = m_bodyStore.angularEnergy[i];
+           linearEnergy += (0.5f * velocity.MagnitudeSquared() - linearEnergy) * smoothing;
+           angularEnergy += (0.5f * angularSpeedSquared - angularEnergy) * smoothing;
+           
+           float& timer = m_bodyStore.sleepTimer[i];
+           if (!m_sleepingEnabled || linearEnergy > linearEnergyThreshold || angularEnergy > angularEnergyThreshold)
+           {
+               timer = 0.0f;
+           }
+           else
+           {
+               timer += deltaTime;
+           }
+           
+           if (island >= 0)
+           {
+               m_islandSleepTimers[island] = std::min(m_islandSleepTimers[island], timer);
+           }
+       }
+       
+       // Put rested islands to sleep as a unit, linking their bodies so one wake-up wakes all
+       int sleepingBodies = 0;
+       for (size_t i = 0; i < bodyCount; ++i)
+       {
+           const int bodyIndex = static_cast<int>(i);
+           if (!m_bodyStore.IsSimulated(bodyIndex))
+           {
+               continue;
+           }
+           
+           if (m_bodyStore.flags[i] & skipFlags)
+           {
+               sleepingBodies += m_bodyStore.IsSleeping(bodyIndex) ? 1 : 0;
+               continue;
+           }
+           
+           int slot;
+           const int island = islandOfBody(bodyIndex, slot);
+           const float restTime = (island >= 0) ? m_islandSleepTimers[island] : m_bodyStore.sleepTimer[i];
+           if (!m_sleepingEnabled || restTime < SLEEP_TIME_WINDOW)
+           {
+               continue;
+           }
+           
+           if (island >= 0 && m_islandSleepHeads[island] >= 0)
+           {
+               const int head = m_islandSleepHeads[island];
+               m_bodyStore.sleepLink[i] = m_bodyStore.sleepLink[head];
+               m_bodyStore.sleepLink[head] = bodyIndex;
+           }
+           else
+           {
+               m_bodyStore.sleepLink[i] = bodyIndex;
+               if (island >= 0)
+               {
+                   m_islandSleepHeads[island] = bodyIndex;
+               }
+           }
+           
+           // Sleeping bodies are frozen exactly where they came to rest
+           m_bodyStore.flags[i] |= PhysicsBodyStore::FLAG_SLEEPING;
+           m_bodyStore.velocityX[i] = m_bodyStore.velocityY[i] = m_bodyStore.velocityZ[i] = 0.0f;
+           m_bodyStore.angularVelocityX[i] = m_bodyStore.angularVelocityY[i] = m_bodyStore.angularVelocityZ[i] = 0.0f;
+           m_bodyStore.accelerationX[i] = m_bodyStore.accelerationY[i] = m_bodyStore.accelerationZ[i] = 0.0f;
+           if (slot >= 0)
+           {
+               m_solverBodies[slot].velocity = PhysicsVector3D();
+           }
+           sleepingBodies++;
+       }
+       
+       m_sleepingBodyCount.store(sleepingBodies);
+   }
+   catch (const std::exception& e)
+   {
+       std::string errorMsg = e.what();
+       std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error updating sleep state: " + wErrorMsg);
+   }
+}
+
 void Physics::UpdateSpatialHash()
 {
    PHYSICS_RECORD_FUNCTION();
    
    try
    {
-       // Spatial hash implementation for broad-phase collision optimization
-       // This is a placeholder for future optimization
+       // Incremental update - only bodies whose expanded bounds changed cells are re-inserted
+       int movedBodies = 0;
+       for (size_t i = 0; i < m_bodyStore.Size(); ++i)
+       {
+           const int bodyIndex = static_cast<int>(i);
+           
+           if (m_bodyStore.IsSimulated(bodyIndex))
+           {
+               if (m_spatialHash.UpdateBody(bodyIndex, m_bodyStore.GetPosition(bodyIndex),
+                   m_bodyStore.radius[bodyIndex] * BROAD_PHASE_MARGIN))
+               {
+                   movedBodies++;
+               }
+               
+               // Pairs of bodies that cannot move are dropped before they reach the broad phase
+               m_spatialHash.SetBodyInert(bodyIndex,
+                   (m_bodyStore.flags[i] & (PhysicsBodyStore::FLAG_STATIC | PhysicsBodyStore::FLAG_SLEEPING)) != 0);
+           }
+           else
+           {
+               m_spatialHash.RemoveBody(bodyIndex);
+           }
+       }
        
 #if defined(_DEBUG_PHYSICS_)
        static int debugCounter = 0;
        if (++debugCounter % 600 == 0) // Log every 600 frames to avoid spam
        {
-           debug.logLevelMessage(LogLevel::LOG_DEBUG, L"[Physics] Updated spatial hash");
+           debug.logDebugMessage(LogLevel::LOG_DEBUG, L"[Physics] Updated spatial hash - %d bodies changed cells", movedBodies);
        }
 #endif
    }
@@ -3290,6 +11090,65 @@ void Physics::UpdateSpatialHash()
    }
 }
 
+void Physics::UpdateDynamicTree(float deltaTime)
+{
+   PHYSICS_RECORD_FUNCTION();
+   
+   try
+   {
+       // Leaves are only re-inserted when a body escapes its fattened bounds
+       for (size_t i = 0; i < m_bodyStore.Size(); ++i)
+       {
+           const int bodyIndex = static_cast<int>(i);
+           if (!m_bodyStore.IsSleeping(bodyIndex))
+           {
+               SyncBodyProxy(bodyIndex, m_bodyStore.GetVelocity(bodyIndex) * deltaTime);
+           }
+       }
+   }
+   catch (const std::exception& e)
+   {
+       std::string errorMsg = e.what();
+       std::wstring wErrorMsg(errorMsg.begin(), errorMsg.end());
+       debug.logLevelMessage(LogLevel::LOG_ERROR, L"[Physics] Error updating dynamic tree: " + wErrorMsg);
+   }
+}
+
+void Physics::SyncBodyProxy(int bodyIndex, const PhysicsVector3D& displacement)
+{
+   // Caller holds m_physicsMutex
+   if (static_cast<size_t>(bodyIndex) >= m_bodyProxies.size())
+   {
+       m_bodyProxies.resize(static_cast<size_t>(bodyIndex) + 1, PhysicsDynamicTree::NULL_NODE);
+   }
+   
+   const PhysicsVector3D position = m_bodyStore.GetPosition(bodyIndex);
+   int& proxyId = m_bodyProxies[bodyIndex];
+   
+   const bool shouldExist = m_bodyStore.IsSimulated(bodyIndex) &&
+       std::isfinite(position.x) && std::isfinite(position.y) && std::isfinite(position.z);
+   
+   if (!shouldExist)
+   {
+       if (proxyId != PhysicsDynamicTree::NULL_NODE)
+       {
+           m_bodyTree.DestroyProxy(proxyId);
+           proxyId = PhysicsDynamicTree::NULL_NODE;
+       }
+       return;
+   }
+   
+   const PhysicsAABB bodyBounds = PhysicsAABB::FromSphere(position, m_bodyStore.radius[bodyIndex]);
+   if (proxyId == PhysicsDynamicTree::NULL_NODE)
+   {
+       proxyId = m_bodyTree.CreateProxy(bodyBounds, bodyIndex);
+   }
+   else
+   {
+       m_bodyTree.MoveProxy(proxyId, bodyBounds, displacement);
+   }
+}
+
 bool Physics::AABBvsAABB(const PhysicsVector3D& minA, const PhysicsVector3D& maxA, 
                        const PhysicsVector3D& minB, const PhysicsVector3D& maxB) const
 {
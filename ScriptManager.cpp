@@ -509,10 +509,40 @@ bool ScriptManager::EvaluateCollisionRule(const CollisionRule& rule)
             Vector2(a->position2D.x, a->position2D.y));
     }
 
-    // Other type combinations — stubbed; expand as world data becomes available
-    debug.Log("[ScriptManager] DETECT_COLLISION: unsupported type pair " +
-              rule.entityTypeA + " / " + rule.entityTypeB);
-    return false;
+    // Any other pair involves physics bodies — A is a specific entity, B is a specific
+    // body or (index -1) any body on B's layer
+    PhysicsVector3D centerA;
+    float radiusA = rule.collisionRadius;
+    int bodyIndexA = -1;
+    if (typeA == "PLAYER") {
+        const PlayerInfo* a = m_player->GetPlayerInfo(rule.entityIndexA);
+        if (!a) return false;
+        centerA = PhysicsVector3D(a->position3D.x, a->position3D.y, a->position3D.z);
+    }
+    else {
+        PhysicsBodyHandle bodyA = m_physics->GetPhysicsBody(rule.entityIndexA);
+        if (!bodyA.IsValid() || (bodyA.GetCollisionLayer() & rule.layerA) == 0) return false;
+        centerA = bodyA.GetPosition();
+        radiusA = bodyA.GetRadius();
+        bodyIndexA = rule.entityIndexA;
+    }
+
+    if (typeB == "PLAYER") {
+        const PlayerInfo* b = m_player->GetPlayerInfo(rule.entityIndexB);
+        if (!b) return false;
+        PhysicsVector3D posB{ b->position3D.x, b->position3D.y, b->position3D.z };
+        return m_physics->CheckSphereCollision(centerA, radiusA, posB, rule.collisionRadius);
+    }
+
+    // Layer-filtered sphere query — bodies on other layers are rejected with one AND
+    bool hit = false;
+    m_physics->QuerySphere(centerA, radiusA, rule.layerB, [&](int bodyIndex) {
+        if (bodyIndex == bodyIndexA) return true;
+        if (rule.entityIndexB >= 0 && bodyIndex != rule.entityIndexB) return true;
+        hit = true;
+        return false;
+    });
+    return hit;
 }
 
 void ScriptManager::TriggerCollisionAction(const std::string& actionStr)
@@ -793,6 +823,15 @@ void ScriptManager::Cmd_DetectCollision(const std::vector<std::string>& args, in
     rule.entityTypeB  = ToUpper(args[2]);
     rule.entityIndexB = SafeStoi(args[3]);
 
+    // Entity types map onto physics collision layers
+    rule.layerA = Physics::GetCollisionLayerForEntityType(rule.entityTypeA);
+    rule.layerB = Physics::GetCollisionLayerForEntityType(rule.entityTypeB);
+    if (rule.layerA == 0 || rule.layerB == 0) {
+        SetError(line, "DETECT_COLLISION: unknown entity type " +
+                 (rule.layerA == 0 ? args[0] : args[2]));
+        return;
+    }
+
     size_t actionStart = 4;
 
     // Optional 5th numeric argument is the collision radius
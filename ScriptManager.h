@@ -121,10 +121,12 @@ struct ScriptFileHeader {
 // A collision rule registered by DETECT_COLLISION
 // =============================================================================
 struct CollisionRule {
-    std::string entityTypeA;            // "PLAYER", "ENEMY", "OBJECT", "ZONE"
+    std::string entityTypeA;            // "PLAYER", "ENEMY", "OBJECT", "ZONE", "WALL", "PROJECTILE", "PICKUP"
     int         entityIndexA = 0;
     std::string entityTypeB;
-    int         entityIndexB = 0;
+    int         entityIndexB = 0;       // Physics body index, or -1 for any body on the layer
+    uint32_t    layerA = 0;             // COLLISION_LAYER_* bit for entityTypeA
+    uint32_t    layerB = 0;             // COLLISION_LAYER_* bit for entityTypeB
     std::string onTriggerAction;        // Raw command string executed on trigger
     float       collisionRadius = 32.0f;// Default sphere radius for overlap test
     bool        triggered  = false;     // Has fired this session
@@ -0,0 +1,54 @@
+//-------------------------------------------------------------------------------------------------
+// MathTableGenerator.cpp - Build-Time MathPrecalculation Table Generator
+//
+// Purpose: Runs the MathPrecalculation runtime table builders once on the build host and writes
+//          the deterministic tables (trig, inverse trig, sqrt, interpolation, YUV to RGB, clamp and
+//          transparency) as a C++ source of const arrays. The engine compiles that source with
+//          MATHPRECALC_GENERATED_TABLES defined, so the tables live in read-only data shared by
+//          every process and MathPrecalculation::Initialize() only binds them.
+//
+//          Because the generator runs the same builder code the engine would run at startup, the
+//          generated values are bit-identical to the runtime fallback.
+//
+// Usage:
+//   MathTableGenerator <output.cpp>
+//-------------------------------------------------------------------------------------------------
+
+#include "Includes.h"
+#include "Debug.h"
+#include "ExceptionHandler.h"
+#include "MathPrecalculation.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+// Engine globals normally defined in main.cpp
+Debug debug;
+ExceptionHandler exceptionHandler;
+
+int main(int argc, char** argv)
+{
+    if (argc != 2)
+    {
+        fprintf(stderr, "Usage: MathTableGenerator <output.cpp>\n");
+        return EXIT_FAILURE;
+    }
+
+    MathPrecalculation& mathPrecalc = MathPrecalculation::GetInstance();
+    if (!mathPrecalc.Initialize())
+    {
+        fprintf(stderr, "[MathTableGenerator] MathPrecalculation initialization failed\n");
+        return EXIT_FAILURE;
+    }
+
+    const std::string outputPath = argv[1];
+    if (!mathPrecalc.ExportGeneratedTables(outputPath))
+    {
+        fprintf(stderr, "[MathTableGenerator] Failed to write %s\n", outputPath.c_str());
+        return EXIT_FAILURE;
+    }
+
+    printf("[MathTableGenerator] Wrote %s\n", outputPath.c_str());
+    return EXIT_SUCCESS;
+}
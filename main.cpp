@@ -539,7 +539,13 @@ int APIENTRY WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLi
             ApplySystemMasterVolume(config.myConfig.masterVolume);
         #endif
 
-        if (!FAST_MATH.Initialize())
+        // Build the tables used every frame during startup; movie color conversion and the physics
+        // tables are built the first time something uses them
+        MathPrecalculationConfig mathConfig;
+        mathConfig.preloadFamilies = MATH_TABLE_FAMILIES_ALL &
+            ~(MathTableFamilyBit(MathTableFamily::ColorConversion) | MathTableFamilyBit(MathTableFamily::Physics));
+
+        if (!FAST_MATH.Initialize(mathConfig))
         {
             #if defined(_DEBUG_MATHPRECALC_)
                 debug.logLevelMessage(LogLevel::LOG_CRITICAL, L"[Initialization] Failed to initialize MATHPrecalc!");